@@ -0,0 +1,268 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "common_benchmark_header.hpp"
+
+// HIP API
+#include "hipcub/device/device_batched.hpp"
+#include "hipcub/device/device_segmented_reduce.hpp"
+#include "hipcub/device/device_segmented_sort.hpp"
+
+#include <string>
+#include <vector>
+
+const unsigned int batch_size  = 10;
+const unsigned int warmup_size = 5;
+
+enum class batched_algorithm
+{
+    reduce,
+    segmented_reduce,
+    inclusive_scan,
+    sort_keys,
+    segmented_sort_keys
+};
+
+inline const char* batched_algorithm_name(batched_algorithm algorithm)
+{
+    switch(algorithm)
+    {
+        case batched_algorithm::reduce: return "device_batched_reduce";
+        case batched_algorithm::segmented_reduce: return "device_segmented_reduce";
+        case batched_algorithm::inclusive_scan: return "device_batched_inclusive_scan";
+        case batched_algorithm::sort_keys: return "device_batched_sort_keys";
+        case batched_algorithm::segmented_sort_keys: return "device_segmented_sort_keys";
+    }
+    return "";
+}
+
+// Runs num_problems problems of problem_size items with the fixed size overloads, the segmented
+// algorithms process the same problems as segments for comparison.
+template<class T>
+void run_benchmark(benchmark::State& state,
+                   batched_algorithm algorithm,
+                   hipStream_t       stream,
+                   int               num_problems,
+                   int               problem_size)
+{
+    const size_t size = static_cast<size_t>(num_problems) * problem_size;
+
+    std::vector<T> input
+        = benchmark_utils::get_random_data<T>(size,
+                                              benchmark_utils::generate_limits<T>::min(),
+                                              benchmark_utils::generate_limits<T>::max());
+    std::vector<int> offsets(num_problems + 1);
+    for(int i = 0; i <= num_problems; i++)
+    {
+        offsets[i] = i * problem_size;
+    }
+
+    T*   d_input;
+    T*   d_output;
+    int* d_offsets;
+    HIP_CHECK(hipMalloc(&d_input, size * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_output, size * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_offsets, offsets.size() * sizeof(int)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_offsets,
+                        offsets.data(),
+                        offsets.size() * sizeof(int),
+                        hipMemcpyHostToDevice));
+
+    auto dispatch = [&](void* d_temp_storage, size_t& temp_storage_bytes)
+    {
+        switch(algorithm)
+        {
+            case batched_algorithm::reduce:
+                return hipcub::DeviceBatched::ReduceFixedSize(d_temp_storage,
+                                                              temp_storage_bytes,
+                                                              d_input,
+                                                              d_output,
+                                                              problem_size,
+                                                              num_problems,
+                                                              hipcub::Sum(),
+                                                              T(0),
+                                                              stream);
+            case batched_algorithm::segmented_reduce:
+                return hipcub::DeviceSegmentedReduce::Sum(d_temp_storage,
+                                                          temp_storage_bytes,
+                                                          d_input,
+                                                          d_output,
+                                                          num_problems,
+                                                          d_offsets,
+                                                          d_offsets + 1,
+                                                          stream);
+            case batched_algorithm::inclusive_scan:
+                return hipcub::DeviceBatched::InclusiveScanFixedSize(d_temp_storage,
+                                                                     temp_storage_bytes,
+                                                                     d_input,
+                                                                     d_output,
+                                                                     problem_size,
+                                                                     num_problems,
+                                                                     hipcub::Sum(),
+                                                                     stream);
+            case batched_algorithm::sort_keys:
+                return hipcub::DeviceBatched::SortKeysFixedSize(d_temp_storage,
+                                                                temp_storage_bytes,
+                                                                d_input,
+                                                                d_output,
+                                                                problem_size,
+                                                                num_problems,
+                                                                hipcub::Less(),
+                                                                stream);
+            case batched_algorithm::segmented_sort_keys:
+                return hipcub::DeviceSegmentedSort::SortKeys(d_temp_storage,
+                                                             temp_storage_bytes,
+                                                             d_input,
+                                                             d_output,
+                                                             static_cast<int>(size),
+                                                             num_problems,
+                                                             d_offsets,
+                                                             d_offsets + 1,
+                                                             stream);
+        }
+        return hipErrorInvalidValue;
+    };
+
+    void*  d_temp_storage     = nullptr;
+    size_t temp_storage_bytes = 0;
+    HIP_CHECK(dispatch(d_temp_storage, temp_storage_bytes));
+    HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; ++i)
+    {
+        HIP_CHECK(dispatch(d_temp_storage, temp_storage_bytes));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; ++i)
+        {
+            HIP_CHECK(dispatch(d_temp_storage, temp_storage_bytes));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipFree(d_temp_storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_offsets));
+}
+
+#define CREATE_BENCHMARK(T, ALGORITHM, PROBLEMS, PROBLEM_SIZE)                            \
+    benchmark::RegisterBenchmark(                                                         \
+        (std::string(batched_algorithm_name(batched_algorithm::ALGORITHM))                \
+         + "<data_type:" #T ">.(problems:" #PROBLEMS ",problem_size:" #PROBLEM_SIZE ")")  \
+            .c_str(),                                                                     \
+        [=](benchmark::State& state)                                                      \
+        {                                                                                 \
+            run_benchmark<T>(state,                                                       \
+                             batched_algorithm::ALGORITHM,                                \
+                             stream,                                                      \
+                             PROBLEMS,                                                    \
+                             PROBLEM_SIZE);                                               \
+        })
+
+#define BENCHMARK_PROBLEM_SIZES(T, ALGORITHM, PROBLEMS)                                   \
+    CREATE_BENCHMARK(T, ALGORITHM, PROBLEMS, 8),                                          \
+        CREATE_BENCHMARK(T, ALGORITHM, PROBLEMS, 32),                                     \
+        CREATE_BENCHMARK(T, ALGORITHM, PROBLEMS, 128),                                    \
+        CREATE_BENCHMARK(T, ALGORITHM, PROBLEMS, 512),                                    \
+        CREATE_BENCHMARK(T, ALGORITHM, PROBLEMS, 2048)
+
+#define BENCHMARK_BATCH_SIZES(T, ALGORITHM)                                               \
+    BENCHMARK_PROBLEM_SIZES(T, ALGORITHM, 100),                                           \
+        BENCHMARK_PROBLEM_SIZES(T, ALGORITHM, 1000),                                      \
+        BENCHMARK_PROBLEM_SIZES(T, ALGORITHM, 10000)
+
+void add_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                    hipStream_t                                   stream)
+{
+    std::vector<benchmark::internal::Benchmark*> bs = {
+        BENCHMARK_BATCH_SIZES(int, reduce),
+        BENCHMARK_BATCH_SIZES(int, segmented_reduce),
+        BENCHMARK_BATCH_SIZES(float, reduce),
+        BENCHMARK_BATCH_SIZES(int, inclusive_scan),
+        BENCHMARK_BATCH_SIZES(float, inclusive_scan),
+        BENCHMARK_BATCH_SIZES(int, sort_keys),
+        BENCHMARK_BATCH_SIZES(int, segmented_sort_keys),
+        BENCHMARK_BATCH_SIZES(double, sort_keys),
+    };
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const int trials = parser.get<int>("trials");
+
+    std::cout << "benchmark_device_batched" << std::endl;
+
+    // HIP
+    hipStream_t     stream = 0; // default
+    hipDeviceProp_t devProp;
+    int             device_id = 0;
+    HIP_CHECK(hipGetDevice(&device_id));
+    HIP_CHECK(hipGetDeviceProperties(&devProp, device_id));
+    std::cout << "[HIP] Device name: " << devProp.name << std::endl;
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+    add_benchmarks(benchmarks, stream);
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
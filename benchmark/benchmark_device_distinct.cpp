@@ -0,0 +1,239 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "common_benchmark_header.hpp"
+
+// HIP API
+#include "hipcub/hipcub.hpp"
+
+#ifndef DEFAULT_N
+const size_t DEFAULT_N = 1024 * 1024 * 32;
+#endif
+
+const unsigned int batch_size  = 4;
+const unsigned int warmup_size = 2;
+
+// The keys are drawn from [0, cardinality). The baseline is the way to get the distinct keys of
+// an unsorted input without a hash table: sort it and compact it with DeviceSelect::Unique.
+template<class Key>
+void run_distinct_benchmark(benchmark::State& state,
+                            size_t            cardinality,
+                            bool              use_sort,
+                            hipStream_t       stream,
+                            size_t            size)
+{
+    using key_type = Key;
+
+    // The whole input is random, a replicated part would cap the number of distinct keys
+    std::vector<key_type> keys_input
+        = benchmark_utils::get_random_data<key_type>(size,
+                                                     key_type(0),
+                                                     static_cast<key_type>(cardinality - 1),
+                                                     size);
+
+    key_type*     d_keys_input;
+    key_type*     d_keys_sorted;
+    key_type*     d_keys_output;
+    unsigned int* d_num_distinct;
+    HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_keys_sorted, size * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_keys_output, size * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_num_distinct, sizeof(unsigned int)));
+    HIP_CHECK(
+        hipMemcpy(d_keys_input, keys_input.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+
+    auto dispatch = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+    {
+        if(!use_sort)
+        {
+            return hipcub::DeviceDistinct::Distinct(d_temporary_storage,
+                                                    temporary_storage_bytes,
+                                                    d_keys_input,
+                                                    d_keys_output,
+                                                    d_num_distinct,
+                                                    static_cast<int>(size),
+                                                    stream);
+        }
+
+        size_t     sort_bytes   = 0;
+        size_t     unique_bytes = 0;
+        hipError_t error        = hipcub::DeviceRadixSort::SortKeys(nullptr,
+                                                             sort_bytes,
+                                                             d_keys_input,
+                                                             d_keys_sorted,
+                                                             size,
+                                                             0,
+                                                             sizeof(key_type) * 8,
+                                                             stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        error = hipcub::DeviceSelect::Unique(nullptr,
+                                             unique_bytes,
+                                             d_keys_sorted,
+                                             d_keys_output,
+                                             d_num_distinct,
+                                             size,
+                                             stream);
+        if(error != hipSuccess || d_temporary_storage == nullptr)
+        {
+            temporary_storage_bytes = std::max(sort_bytes, unique_bytes);
+            return error;
+        }
+        error = hipcub::DeviceRadixSort::SortKeys(d_temporary_storage,
+                                                  sort_bytes,
+                                                  d_keys_input,
+                                                  d_keys_sorted,
+                                                  size,
+                                                  0,
+                                                  sizeof(key_type) * 8,
+                                                  stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        return hipcub::DeviceSelect::Unique(d_temporary_storage,
+                                            unique_bytes,
+                                            d_keys_sorted,
+                                            d_keys_output,
+                                            d_num_distinct,
+                                            size,
+                                            stream);
+    };
+
+    void*  d_temporary_storage     = nullptr;
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; ++i)
+    {
+        HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; ++i)
+        {
+            HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(key_type));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_keys_input));
+    HIP_CHECK(hipFree(d_keys_sorted));
+    HIP_CHECK(hipFree(d_keys_output));
+    HIP_CHECK(hipFree(d_num_distinct));
+}
+
+#define CREATE_DISTINCT_BENCHMARK(Key, CARDINALITY, USE_SORT)                             \
+    benchmark::RegisterBenchmark(                                                         \
+        (std::string(USE_SORT ? "device_radix_sort_unique" : "device_distinct")           \
+         + "<key_data_type:" #Key ">.(cardinality:" #CARDINALITY ")")                     \
+            .c_str(),                                                                     \
+        [=](benchmark::State& state)                                                      \
+        { run_distinct_benchmark<Key>(state, CARDINALITY, USE_SORT, stream, size); })
+
+// Sweeps the cardinality to show where sorting overtakes the hash table
+#define BENCHMARK_KEY_TYPE(type, CARDINALITY)                                             \
+    CREATE_DISTINCT_BENCHMARK(type, CARDINALITY, true),                                   \
+        CREATE_DISTINCT_BENCHMARK(type, CARDINALITY, false)
+
+void add_distinct_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                             hipStream_t                                   stream,
+                             size_t                                        size)
+{
+    std::vector<benchmark::internal::Benchmark*> bs = {
+        BENCHMARK_KEY_TYPE(int, 16),
+        BENCHMARK_KEY_TYPE(int, 1024),
+        BENCHMARK_KEY_TYPE(int, 65536),
+        BENCHMARK_KEY_TYPE(int, 1048576),
+        BENCHMARK_KEY_TYPE(int, 16777216),
+        BENCHMARK_KEY_TYPE(int, 1073741824),
+        BENCHMARK_KEY_TYPE(long long, 1024),
+        BENCHMARK_KEY_TYPE(long long, 1048576),
+        BENCHMARK_KEY_TYPE(long long, 1073741824),
+    };
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t size   = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+
+    std::cout << "benchmark_device_distinct" << std::endl;
+
+    // HIP
+    hipStream_t     stream = 0; // default
+    hipDeviceProp_t devProp;
+    int             device_id = 0;
+    HIP_CHECK(hipGetDevice(&device_id));
+    HIP_CHECK(hipGetDeviceProperties(&devProp, device_id));
+    std::cout << "[HIP] Device name: " << devProp.name << std::endl;
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+    add_distinct_benchmarks(benchmarks, stream, size);
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
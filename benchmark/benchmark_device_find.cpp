@@ -0,0 +1,388 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "common_benchmark_header.hpp"
+
+// HIP API
+#include "hipcub/hipcub.hpp"
+
+#ifndef DEFAULT_N
+const size_t DEFAULT_N = 1024 * 1024 * 16;
+#endif
+
+const unsigned int batch_size  = 4;
+const unsigned int warmup_size = 2;
+
+// Baseline: every thread searches its needle in the whole haystack in global memory.
+template<class Key>
+__global__ __launch_bounds__(256) void naive_lower_bound_kernel(const Key*    haystack,
+                                                                size_t        haystack_size,
+                                                                const Key*    needles,
+                                                                size_t        num_needles,
+                                                                unsigned int* output)
+{
+    const size_t i = static_cast<size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    if(i >= num_needles)
+    {
+        return;
+    }
+    const Key needle = needles[i];
+    size_t    first  = 0;
+    size_t    last   = haystack_size;
+    while(first < last)
+    {
+        const size_t middle = (first + last) / 2;
+        if(haystack[middle] < needle)
+        {
+            first = middle + 1;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+    output[i] = static_cast<unsigned int>(first);
+}
+
+struct less_op
+{
+    template<class T>
+    __host__ __device__ bool operator()(const T& a, const T& b) const
+    {
+        return a < b;
+    }
+};
+
+template<class T>
+struct greater_than_zero_op
+{
+    __host__ __device__ bool operator()(const T& item) const
+    {
+        return item > T(0);
+    }
+};
+
+enum class find_algorithm
+{
+    naive_lower_bound,
+    lower_bound,
+    upper_bound
+};
+
+template<class Key>
+void run_find_benchmark(benchmark::State& state,
+                        size_t            haystack_size,
+                        find_algorithm    algorithm,
+                        hipStream_t       stream,
+                        size_t            size)
+{
+    using key_type    = Key;
+    using output_type = unsigned int;
+
+    std::vector<key_type> haystack = benchmark_utils::get_random_data<key_type>(
+        haystack_size,
+        benchmark_utils::generate_limits<key_type>::min(),
+        benchmark_utils::generate_limits<key_type>::max());
+    std::sort(haystack.begin(), haystack.end());
+    const std::vector<key_type> needles = benchmark_utils::get_random_data<key_type>(
+        size,
+        benchmark_utils::generate_limits<key_type>::min(),
+        benchmark_utils::generate_limits<key_type>::max());
+
+    key_type*    d_haystack;
+    key_type*    d_needles;
+    output_type* d_output;
+    HIP_CHECK(hipMalloc(&d_haystack, haystack_size * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_needles, size * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_output, size * sizeof(output_type)));
+    HIP_CHECK(hipMemcpy(d_haystack,
+                        haystack.data(),
+                        haystack_size * sizeof(key_type),
+                        hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_needles, needles.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+
+    auto dispatch = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+    {
+        switch(algorithm)
+        {
+            case find_algorithm::naive_lower_bound:
+                if(d_temporary_storage == nullptr)
+                {
+                    temporary_storage_bytes = 4;
+                    return hipSuccess;
+                }
+                hipLaunchKernelGGL(HIP_KERNEL_NAME(naive_lower_bound_kernel<key_type>),
+                                   dim3((size + 255) / 256),
+                                   dim3(256),
+                                   0,
+                                   stream,
+                                   d_haystack,
+                                   haystack_size,
+                                   d_needles,
+                                   size,
+                                   d_output);
+                return hipGetLastError();
+            case find_algorithm::lower_bound:
+                return hipcub::DeviceFind::LowerBound(d_temporary_storage,
+                                                      temporary_storage_bytes,
+                                                      d_haystack,
+                                                      haystack_size,
+                                                      d_needles,
+                                                      size,
+                                                      d_output,
+                                                      less_op(),
+                                                      stream);
+            case find_algorithm::upper_bound:
+            default:
+                return hipcub::DeviceFind::UpperBound(d_temporary_storage,
+                                                      temporary_storage_bytes,
+                                                      d_haystack,
+                                                      haystack_size,
+                                                      d_needles,
+                                                      size,
+                                                      d_output,
+                                                      less_op(),
+                                                      stream);
+        }
+    };
+
+    void*  d_temporary_storage     = nullptr;
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; ++i)
+    {
+        HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; ++i)
+        {
+            HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(key_type));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_haystack));
+    HIP_CHECK(hipFree(d_needles));
+    HIP_CHECK(hipFree(d_output));
+}
+
+// The only match is at match_percent of the input, 100 means there is none. The baseline is a
+// DeviceReduce::Max over the whole input, which answers the same any-of question.
+template<class Key>
+void run_find_if_benchmark(benchmark::State& state,
+                           int               match_percent,
+                           bool              use_reduce,
+                           hipStream_t       stream,
+                           size_t            size)
+{
+    using key_type = Key;
+
+    std::vector<key_type> input(size, key_type(0));
+    const size_t          match = size * match_percent / 100;
+    if(match < size)
+    {
+        input[match] = key_type(1);
+    }
+
+    key_type* d_input;
+    key_type* d_max;
+    int*      d_index;
+    HIP_CHECK(hipMalloc(&d_input, size * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_max, sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_index, sizeof(int)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+
+    const greater_than_zero_op<key_type> predicate;
+
+    auto dispatch = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+    {
+        if(use_reduce)
+        {
+            return hipcub::DeviceReduce::Max(d_temporary_storage,
+                                             temporary_storage_bytes,
+                                             d_input,
+                                             d_max,
+                                             static_cast<int>(size),
+                                             stream);
+        }
+        return hipcub::DeviceFind::FindIf(d_temporary_storage,
+                                          temporary_storage_bytes,
+                                          d_input,
+                                          d_index,
+                                          predicate,
+                                          static_cast<int>(size),
+                                          stream);
+    };
+
+    void*  d_temporary_storage     = nullptr;
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; ++i)
+    {
+        HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; ++i)
+        {
+            HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(key_type));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_max));
+    HIP_CHECK(hipFree(d_index));
+}
+
+#define CREATE_FIND_BENCHMARK(Key, HAYSTACK, ALGORITHM)                                   \
+    benchmark::RegisterBenchmark(                                                         \
+        (std::string("device_find_" #ALGORITHM) + "<key_data_type:" #Key                  \
+         ">.(haystack_size:" + std::to_string(HAYSTACK) + ")")                            \
+            .c_str(),                                                                     \
+        [=](benchmark::State& state)                                                      \
+        {                                                                                 \
+            run_find_benchmark<Key>(state,                                                \
+                                    HAYSTACK,                                             \
+                                    find_algorithm::ALGORITHM,                            \
+                                    stream,                                               \
+                                    size);                                                \
+        })
+
+#define BENCHMARK_KEY_TYPE(type, HAYSTACK)                                                \
+    CREATE_FIND_BENCHMARK(type, HAYSTACK, naive_lower_bound),                             \
+        CREATE_FIND_BENCHMARK(type, HAYSTACK, lower_bound),                               \
+        CREATE_FIND_BENCHMARK(type, HAYSTACK, upper_bound)
+
+#define CREATE_FIND_IF_BENCHMARK(Key, MATCH_PERCENT, USE_REDUCE)                          \
+    benchmark::RegisterBenchmark(                                                         \
+        (std::string(USE_REDUCE ? "device_reduce_max" : "device_find_if")                 \
+         + "<key_data_type:" #Key ">.(match_percent:" #MATCH_PERCENT ")")                 \
+            .c_str(),                                                                     \
+        [=](benchmark::State& state)                                                      \
+        { run_find_if_benchmark<Key>(state, MATCH_PERCENT, USE_REDUCE, stream, size); })
+
+#define BENCHMARK_FIND_IF_KEY_TYPE(type)                                                  \
+    CREATE_FIND_IF_BENCHMARK(type, 100, true),                                            \
+        CREATE_FIND_IF_BENCHMARK(type, 0, false),                                         \
+        CREATE_FIND_IF_BENCHMARK(type, 1, false),                                         \
+        CREATE_FIND_IF_BENCHMARK(type, 50, false),                                        \
+        CREATE_FIND_IF_BENCHMARK(type, 100, false)
+
+void add_find_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                         hipStream_t                                   stream,
+                         size_t                                        size)
+{
+    std::vector<benchmark::internal::Benchmark*> bs = {
+        BENCHMARK_KEY_TYPE(int, 1 << 10),
+        BENCHMARK_KEY_TYPE(int, 1 << 20),
+        BENCHMARK_KEY_TYPE(int, 1 << 26),
+        BENCHMARK_KEY_TYPE(float, 1 << 20),
+        BENCHMARK_KEY_TYPE(double, 1 << 20),
+        BENCHMARK_KEY_TYPE(double, 1 << 26),
+        BENCHMARK_FIND_IF_KEY_TYPE(int),
+        BENCHMARK_FIND_IF_KEY_TYPE(double),
+    };
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of needles");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t size   = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+
+    std::cout << "benchmark_device_find" << std::endl;
+
+    // HIP
+    hipStream_t     stream = 0; // default
+    hipDeviceProp_t devProp;
+    int             device_id = 0;
+    HIP_CHECK(hipGetDevice(&device_id));
+    HIP_CHECK(hipGetDeviceProperties(&devProp, device_id));
+    std::cout << "[HIP] Device name: " << devProp.name << std::endl;
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+    add_find_benchmarks(benchmarks, stream, size);
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -0,0 +1,272 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "common_benchmark_header.hpp"
+
+// HIP API
+#include "hipcub/hipcub.hpp"
+
+#ifndef DEFAULT_N
+const size_t DEFAULT_N = 1024 * 1024 * 32;
+#endif
+
+const unsigned int batch_size  = 4;
+const unsigned int warmup_size = 2;
+
+// The keys are drawn from [0, cardinality) and the values of every key are summed. The baseline
+// is the way to aggregate an unsorted input without a hash table: sort the pairs by key and
+// reduce the runs with DeviceReduce::ReduceByKey.
+template<class Key, class Value>
+void run_group_by_benchmark(benchmark::State& state,
+                            size_t            cardinality,
+                            bool              use_sort,
+                            hipStream_t       stream,
+                            size_t            size)
+{
+    using key_type   = Key;
+    using value_type = Value;
+
+    // The whole input is random, a replicated part would cap the number of groups
+    std::vector<key_type> keys_input
+        = benchmark_utils::get_random_data<key_type>(size,
+                                                     key_type(0),
+                                                     static_cast<key_type>(cardinality - 1),
+                                                     size);
+    std::vector<value_type> values_input
+        = benchmark_utils::get_random_data<value_type>(size, value_type(0), value_type(100));
+
+    key_type*     d_keys_input;
+    key_type*     d_keys_sorted;
+    key_type*     d_unique_output;
+    value_type*   d_values_input;
+    value_type*   d_values_sorted;
+    value_type*   d_aggregates_output;
+    unsigned int* d_num_groups;
+    HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_keys_sorted, size * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_unique_output, size * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_values_input, size * sizeof(value_type)));
+    HIP_CHECK(hipMalloc(&d_values_sorted, size * sizeof(value_type)));
+    HIP_CHECK(hipMalloc(&d_aggregates_output, size * sizeof(value_type)));
+    HIP_CHECK(hipMalloc(&d_num_groups, sizeof(unsigned int)));
+    HIP_CHECK(
+        hipMemcpy(d_keys_input, keys_input.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_values_input,
+                        values_input.data(),
+                        size * sizeof(value_type),
+                        hipMemcpyHostToDevice));
+
+    auto dispatch = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+    {
+        if(!use_sort)
+        {
+            return hipcub::DeviceGroupBy::ReduceByKey(d_temporary_storage,
+                                                      temporary_storage_bytes,
+                                                      d_keys_input,
+                                                      d_unique_output,
+                                                      d_values_input,
+                                                      d_aggregates_output,
+                                                      d_num_groups,
+                                                      hipcub::Sum(),
+                                                      value_type(0),
+                                                      static_cast<int>(size),
+                                                      stream);
+        }
+
+        size_t     sort_bytes   = 0;
+        size_t     reduce_bytes = 0;
+        hipError_t error        = hipcub::DeviceRadixSort::SortPairs(nullptr,
+                                                              sort_bytes,
+                                                              d_keys_input,
+                                                              d_keys_sorted,
+                                                              d_values_input,
+                                                              d_values_sorted,
+                                                              size,
+                                                              0,
+                                                              sizeof(key_type) * 8,
+                                                              stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        error = hipcub::DeviceReduce::ReduceByKey(nullptr,
+                                                  reduce_bytes,
+                                                  d_keys_sorted,
+                                                  d_unique_output,
+                                                  d_values_sorted,
+                                                  d_aggregates_output,
+                                                  d_num_groups,
+                                                  hipcub::Sum(),
+                                                  size,
+                                                  stream);
+        if(error != hipSuccess || d_temporary_storage == nullptr)
+        {
+            temporary_storage_bytes = std::max(sort_bytes, reduce_bytes);
+            return error;
+        }
+        error = hipcub::DeviceRadixSort::SortPairs(d_temporary_storage,
+                                                   sort_bytes,
+                                                   d_keys_input,
+                                                   d_keys_sorted,
+                                                   d_values_input,
+                                                   d_values_sorted,
+                                                   size,
+                                                   0,
+                                                   sizeof(key_type) * 8,
+                                                   stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        return hipcub::DeviceReduce::ReduceByKey(d_temporary_storage,
+                                                 reduce_bytes,
+                                                 d_keys_sorted,
+                                                 d_unique_output,
+                                                 d_values_sorted,
+                                                 d_aggregates_output,
+                                                 d_num_groups,
+                                                 hipcub::Sum(),
+                                                 size,
+                                                 stream);
+    };
+
+    void*  d_temporary_storage     = nullptr;
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; ++i)
+    {
+        HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; ++i)
+        {
+            HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size
+                            * (sizeof(key_type) + sizeof(value_type)));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_keys_input));
+    HIP_CHECK(hipFree(d_keys_sorted));
+    HIP_CHECK(hipFree(d_unique_output));
+    HIP_CHECK(hipFree(d_values_input));
+    HIP_CHECK(hipFree(d_values_sorted));
+    HIP_CHECK(hipFree(d_aggregates_output));
+    HIP_CHECK(hipFree(d_num_groups));
+}
+
+#define CREATE_GROUP_BY_BENCHMARK(Key, Value, CARDINALITY, USE_SORT)                      \
+    benchmark::RegisterBenchmark(                                                         \
+        (std::string(USE_SORT ? "device_radix_sort_reduce_by_key" : "device_group_by")    \
+         + "<key_data_type:" #Key ",value_data_type:" #Value ">.(cardinality:"            \
+         + #CARDINALITY ")")                                                              \
+            .c_str(),                                                                     \
+        [=](benchmark::State& state)                                                      \
+        { run_group_by_benchmark<Key, Value>(state, CARDINALITY, USE_SORT, stream, size); })
+
+// Sweeps the cardinality to show where sorting overtakes the hash table
+#define BENCHMARK_KEY_TYPE(key, value, CARDINALITY)                                       \
+    CREATE_GROUP_BY_BENCHMARK(key, value, CARDINALITY, true),                             \
+        CREATE_GROUP_BY_BENCHMARK(key, value, CARDINALITY, false)
+
+void add_group_by_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                             hipStream_t                                   stream,
+                             size_t                                        size)
+{
+    std::vector<benchmark::internal::Benchmark*> bs = {
+        BENCHMARK_KEY_TYPE(int, float, 16),
+        BENCHMARK_KEY_TYPE(int, float, 1024),
+        BENCHMARK_KEY_TYPE(int, float, 65536),
+        BENCHMARK_KEY_TYPE(int, float, 1048576),
+        BENCHMARK_KEY_TYPE(int, float, 16777216),
+        BENCHMARK_KEY_TYPE(int, double, 1024),
+        BENCHMARK_KEY_TYPE(int, double, 1048576),
+        BENCHMARK_KEY_TYPE(long long, float, 1024),
+        BENCHMARK_KEY_TYPE(long long, float, 1048576),
+    };
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t size   = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+
+    std::cout << "benchmark_device_group_by" << std::endl;
+
+    // HIP
+    hipStream_t     stream = 0; // default
+    hipDeviceProp_t devProp;
+    int             device_id = 0;
+    HIP_CHECK(hipGetDevice(&device_id));
+    HIP_CHECK(hipGetDeviceProperties(&devProp, device_id));
+    std::cout << "[HIP] Device name: " << devProp.name << std::endl;
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+    add_group_by_benchmarks(benchmarks, stream, size);
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -0,0 +1,250 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "common_benchmark_header.hpp"
+
+// HIP API
+#include "hipcub/hipcub.hpp"
+
+#ifndef DEFAULT_N
+const size_t DEFAULT_N = 1024 * 1024 * 32;
+#endif
+
+const unsigned int batch_size  = 4;
+const unsigned int warmup_size = 2;
+
+struct less_op
+{
+    template<class T>
+    __host__ __device__ bool operator()(const T& a, const T& b) const
+    {
+        return a < b;
+    }
+};
+
+enum class merge_algorithm
+{
+    merge_sort,
+    merge_keys,
+    merge_pairs
+};
+
+// Both sequences have size / 2 items. The baseline sorts the concatenation of both sequences,
+// which is what was needed to merge them before DeviceMerge.
+template<class Key, class Value>
+void run_merge_benchmark(benchmark::State& state,
+                         merge_algorithm   algorithm,
+                         hipStream_t       stream,
+                         size_t            size)
+{
+    using key_type   = Key;
+    using value_type = Value;
+
+    const size_t size1 = size / 2;
+    const size_t size2 = size - size1;
+
+    std::vector<key_type> keys_input = benchmark_utils::get_random_data<key_type>(
+        size,
+        benchmark_utils::generate_limits<key_type>::min(),
+        benchmark_utils::generate_limits<key_type>::max());
+    std::sort(keys_input.begin(), keys_input.begin() + size1);
+    std::sort(keys_input.begin() + size1, keys_input.end());
+
+    std::vector<value_type> values_input(size, value_type(1));
+
+    key_type*   d_keys_input;
+    key_type*   d_keys_output;
+    value_type* d_values_input;
+    value_type* d_values_output;
+    HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_keys_output, size * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_values_input, size * sizeof(value_type)));
+    HIP_CHECK(hipMalloc(&d_values_output, size * sizeof(value_type)));
+    HIP_CHECK(
+        hipMemcpy(d_keys_input, keys_input.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_values_input,
+                        values_input.data(),
+                        size * sizeof(value_type),
+                        hipMemcpyHostToDevice));
+
+    const key_type*   d_keys1   = d_keys_input;
+    const key_type*   d_keys2   = d_keys_input + size1;
+    const value_type* d_values1 = d_values_input;
+    const value_type* d_values2 = d_values_input + size1;
+
+    auto dispatch = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+    {
+        switch(algorithm)
+        {
+            case merge_algorithm::merge_sort:
+                return hipcub::DeviceMergeSort::SortKeysCopy(d_temporary_storage,
+                                                             temporary_storage_bytes,
+                                                             d_keys_input,
+                                                             d_keys_output,
+                                                             size,
+                                                             less_op(),
+                                                             stream);
+            case merge_algorithm::merge_keys:
+                return hipcub::DeviceMerge::MergeKeys(d_temporary_storage,
+                                                      temporary_storage_bytes,
+                                                      d_keys1,
+                                                      size1,
+                                                      d_keys2,
+                                                      size2,
+                                                      d_keys_output,
+                                                      less_op(),
+                                                      stream);
+            case merge_algorithm::merge_pairs:
+            default:
+                return hipcub::DeviceMerge::MergePairs(d_temporary_storage,
+                                                       temporary_storage_bytes,
+                                                       d_keys1,
+                                                       d_values1,
+                                                       size1,
+                                                       d_keys2,
+                                                       d_values2,
+                                                       size2,
+                                                       d_keys_output,
+                                                       d_values_output,
+                                                       less_op(),
+                                                       stream);
+        }
+    };
+
+    void*  d_temporary_storage     = nullptr;
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; ++i)
+    {
+        HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; ++i)
+        {
+            HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    const size_t item_bytes
+        = sizeof(key_type) + (algorithm == merge_algorithm::merge_pairs ? sizeof(value_type) : 0);
+    state.SetBytesProcessed(state.iterations() * batch_size * size * item_bytes);
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_keys_input));
+    HIP_CHECK(hipFree(d_keys_output));
+    HIP_CHECK(hipFree(d_values_input));
+    HIP_CHECK(hipFree(d_values_output));
+}
+
+#define CREATE_MERGE_BENCHMARK(Key, Value, ALGORITHM)                                     \
+    benchmark::RegisterBenchmark(                                                         \
+        std::string("device_merge_" #ALGORITHM "<key_data_type:" #Key                     \
+                    ",value_data_type:" #Value ">")                                       \
+            .c_str(),                                                                     \
+        [=](benchmark::State& state)                                                      \
+        {                                                                                 \
+            run_merge_benchmark<Key, Value>(state,                                        \
+                                            merge_algorithm::ALGORITHM,                   \
+                                            stream,                                       \
+                                            size);                                        \
+        })
+
+#define BENCHMARK_TYPE(Key, Value)                                                        \
+    CREATE_MERGE_BENCHMARK(Key, Value, merge_sort),                                       \
+        CREATE_MERGE_BENCHMARK(Key, Value, merge_keys),                                   \
+        CREATE_MERGE_BENCHMARK(Key, Value, merge_pairs)
+
+void add_merge_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                          hipStream_t                                   stream,
+                          size_t                                        size)
+{
+    std::vector<benchmark::internal::Benchmark*> bs = {
+        BENCHMARK_TYPE(int, int),
+        BENCHMARK_TYPE(long long, long long),
+        BENCHMARK_TYPE(uint8_t, uint8_t),
+        BENCHMARK_TYPE(double, int),
+    };
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t size   = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+
+    std::cout << "benchmark_device_merge" << std::endl;
+
+    // HIP
+    hipStream_t     stream = 0; // default
+    hipDeviceProp_t devProp;
+    int             device_id = 0;
+    HIP_CHECK(hipGetDevice(&device_id));
+    HIP_CHECK(hipGetDeviceProperties(&devProp, device_id));
+    std::cout << "[HIP] Device name: " << devProp.name << std::endl;
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+    add_merge_benchmarks(benchmarks, stream, size);
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
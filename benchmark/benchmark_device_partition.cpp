@@ -24,6 +24,7 @@
 
 // HIP API
 #include "hipcub/device/device_partition.hpp"
+#include "hipcub/device/device_radix_sort.hpp"
 
 #include <chrono>
 #include <vector>
@@ -50,6 +51,20 @@ struct LessOp
 private:
     T pivot_;
 };
+
+template<typename T>
+struct LowBitsBucketOp
+{
+    HIPCUB_HOST_DEVICE LowBitsBucketOp(unsigned int num_buckets) : mask_{num_buckets - 1} {}
+
+    HIPCUB_HOST_DEVICE unsigned int operator()(const T& val) const
+    {
+        return static_cast<unsigned int>(val) & mask_;
+    }
+
+private:
+    unsigned int mask_;
+};
 } // namespace
 
 template<typename T, typename F>
@@ -327,6 +342,106 @@ void run_threeway(benchmark::State& state,
     HIP_CHECK(hipFree(d_num_selected_output));
 }
 
+// The bucket of an item is given by the low bits of its key. A radix sort of these bits produces the same
+// stable partition, without the bucket offsets and counts, and is the baseline.
+template<typename T>
+void run_buckets(benchmark::State& state,
+                 const hipStream_t stream,
+                 const unsigned int num_buckets,
+                 const bool         use_sort,
+                 const size_t       size)
+{
+    const auto input
+        = benchmark_utils::get_random_data<T>(size,
+                                              benchmark_utils::generate_limits<T>::min(),
+                                              benchmark_utils::generate_limits<T>::max());
+
+    T*            d_input          = nullptr;
+    T*            d_output         = nullptr;
+    unsigned int* d_bucket_offsets = nullptr;
+    unsigned int* d_bucket_counts  = nullptr;
+    HIP_CHECK(hipMalloc(&d_input, input.size() * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_output, input.size() * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_bucket_offsets, num_buckets * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc(&d_bucket_counts, num_buckets * sizeof(unsigned int)));
+
+    const auto bucket_op = LowBitsBucketOp<T>{num_buckets};
+    int        end_bit   = 0;
+    while((1u << end_bit) < num_buckets)
+    {
+        end_bit++;
+    }
+
+    auto dispatch = [&](void* d_temp_storage, size_t& temp_storage_bytes)
+    {
+        if(use_sort)
+        {
+            return hipcub::DeviceRadixSort::SortKeys(d_temp_storage,
+                                                     temp_storage_bytes,
+                                                     d_input,
+                                                     d_output,
+                                                     static_cast<int>(input.size()),
+                                                     0,
+                                                     end_bit,
+                                                     stream);
+        }
+        return hipcub::DevicePartition::Buckets(d_temp_storage,
+                                                temp_storage_bytes,
+                                                d_input,
+                                                d_output,
+                                                d_bucket_offsets,
+                                                d_bucket_counts,
+                                                static_cast<int>(num_buckets),
+                                                bucket_op,
+                                                static_cast<int>(input.size()),
+                                                stream);
+    };
+
+    // Allocate temporary storage
+    void*  d_temp_storage     = nullptr;
+    size_t temp_storage_bytes = 0;
+    HIP_CHECK(dispatch(nullptr, temp_storage_bytes));
+    HIP_CHECK(hipMalloc(&d_temp_storage, temp_storage_bytes));
+
+    // Warm-up
+    HIP_CHECK(hipMemcpy(d_input, input.data(), input.size() * sizeof(T), hipMemcpyHostToDevice));
+    for(unsigned int i = 0; i < warmup_size; ++i)
+    {
+        HIP_CHECK(dispatch(d_temp_storage, temp_storage_bytes));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Run benchmark
+    for(auto _ : state)
+    {
+        namespace chrono = std::chrono;
+        using clock      = chrono::high_resolution_clock;
+
+        const auto start = clock::now();
+        for(unsigned int i = 0; i < batch_size; ++i)
+        {
+            HIP_CHECK(dispatch(d_temp_storage, temp_storage_bytes));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        const auto end             = clock::now();
+        using seconds_d            = chrono::duration<double>;
+        const auto elapsed_seconds = chrono::duration_cast<seconds_d>(end - start);
+
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+
+    state.SetItemsProcessed(state.iterations() * batch_size * input.size());
+    state.SetBytesProcessed(
+        static_cast<int64_t>(state.iterations() * batch_size * input.size() * sizeof(input[0])));
+
+    HIP_CHECK(hipFree(d_temp_storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_bucket_offsets));
+    HIP_CHECK(hipFree(d_bucket_counts));
+}
+
 #define CREATE_BENCHMARK_FLAGGED(T, T_FLAG, SPLIT_T)                                              \
     benchmark::RegisterBenchmark(std::string("device_parition_flagged<data_type:" #T              \
                                              ",flag_type:" #T_FLAG ">.(split_threshold:" #SPLIT_T \
@@ -357,6 +472,17 @@ void run_threeway(benchmark::State& state,
                                  static_cast<T>(LARGE_T),                                    \
                                  size)
 
+#define CREATE_BENCHMARK_BUCKETS(T, BUCKETS, USE_SORT)                                     \
+    benchmark::RegisterBenchmark(std::string(USE_SORT ? "device_radix_sort_low_bits"       \
+                                                      : "device_parition_buckets")         \
+                                     .append("<data_type:" #T ">.(buckets:" #BUCKETS ")")  \
+                                     .c_str(),                                             \
+                                 &run_buckets<T>,                                          \
+                                 stream,                                                   \
+                                 BUCKETS,                                                  \
+                                 USE_SORT,                                                 \
+                                 size)
+
 #define BENCHMARK_FLAGGED_TYPE(type, flag_type)                                                   \
     CREATE_BENCHMARK_FLAGGED(type, flag_type, 33), CREATE_BENCHMARK_FLAGGED(type, flag_type, 50), \
         CREATE_BENCHMARK_FLAGGED(type, flag_type, 60),                                            \
@@ -370,6 +496,10 @@ void run_threeway(benchmark::State& state,
     CREATE_BENCHMARK_THREEWAY(type, 33, 66), CREATE_BENCHMARK_THREEWAY(type, 10, 66), \
         CREATE_BENCHMARK_THREEWAY(type, 50, 60), CREATE_BENCHMARK_THREEWAY(type, 50, 90)
 
+#define BENCHMARK_BUCKETS_TYPE(type, BUCKETS)          \
+    CREATE_BENCHMARK_BUCKETS(type, BUCKETS, true),     \
+        CREATE_BENCHMARK_BUCKETS(type, BUCKETS, false)
+
 int main(int argc, char* argv[])
 {
     cli::Parser parser(argc, argv);
@@ -422,6 +552,12 @@ int main(int argc, char* argv[])
         BENCHMARK_THREEWAY_TYPE(double),
         BENCHMARK_THREEWAY_TYPE(custom_float2),
         BENCHMARK_THREEWAY_TYPE(custom_double2),
+
+        BENCHMARK_BUCKETS_TYPE(unsigned int, 16),
+        BENCHMARK_BUCKETS_TYPE(unsigned int, 64),
+        BENCHMARK_BUCKETS_TYPE(unsigned int, 256),
+        BENCHMARK_BUCKETS_TYPE(unsigned long long, 16),
+        BENCHMARK_BUCKETS_TYPE(unsigned long long, 256),
     };
 
     // Use manual timing
@@ -27,6 +27,7 @@
 
 // HIP API
 #include "hipcub/device/device_radix_sort.hpp"
+#include "hipcub/device/device_run_length_encode.hpp"
 
 #ifndef DEFAULT_N
 const size_t DEFAULT_N = 1024 * 1024 * 32;
@@ -373,6 +374,554 @@ void run_sort_pairs_benchmark(benchmark::State&                 state,
     HIP_CHECK(hipFree(d_values_output));
 }
 
+// Compared to run_sort_pairs_benchmark no index buffer is uploaded or read, the indices are
+// generated by the sort.
+template<class Key, bool DiscardKeys = false>
+void run_arg_sort_benchmark(benchmark::State&                 state,
+                            hipStream_t                       stream,
+                            size_t                            size,
+                            std::shared_ptr<std::vector<Key>> keys_input)
+{
+    using key_type   = Key;
+    using index_type = unsigned int;
+
+    key_type*   d_keys_input;
+    key_type*   d_keys_output = nullptr;
+    index_type* d_indices_output;
+    HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(key_type)));
+    if(!DiscardKeys)
+    {
+        HIP_CHECK(hipMalloc(&d_keys_output, size * sizeof(key_type)));
+    }
+    HIP_CHECK(hipMalloc(&d_indices_output, size * sizeof(index_type)));
+    HIP_CHECK(hipMemcpy(d_keys_input,
+                        keys_input->data(),
+                        size * sizeof(key_type),
+                        hipMemcpyHostToDevice));
+
+    void*  d_temporary_storage     = nullptr;
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(hipcub::DeviceRadixSort::ArgSort(d_temporary_storage,
+                                               temporary_storage_bytes,
+                                               d_keys_input,
+                                               d_keys_output,
+                                               d_indices_output,
+                                               size,
+                                               0,
+                                               sizeof(key_type) * 8,
+                                               stream));
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; i++)
+    {
+        HIP_CHECK(hipcub::DeviceRadixSort::ArgSort(d_temporary_storage,
+                                                   temporary_storage_bytes,
+                                                   d_keys_input,
+                                                   d_keys_output,
+                                                   d_indices_output,
+                                                   size,
+                                                   0,
+                                                   sizeof(key_type) * 8,
+                                                   stream));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; i++)
+        {
+            HIP_CHECK(hipcub::DeviceRadixSort::ArgSort(d_temporary_storage,
+                                                       temporary_storage_bytes,
+                                                       d_keys_input,
+                                                       d_keys_output,
+                                                       d_indices_output,
+                                                       size,
+                                                       0,
+                                                       sizeof(key_type) * 8,
+                                                       stream));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size
+                            * (sizeof(key_type) + sizeof(index_type)));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_keys_input));
+    HIP_CHECK(hipFree(d_keys_output));
+    HIP_CHECK(hipFree(d_indices_output));
+}
+
+/// Rows of \p Columns columns of full range keys, sorted lexicographically. The columns are
+/// packed into as few composite keys as fit, so the time is comparable to \p ArgSort of a key of
+/// the same total width.
+template<class Column, unsigned int Columns>
+void run_arg_sort_columns_benchmark(benchmark::State& state, hipStream_t stream, size_t size)
+{
+    using column_type = Column;
+    using index_type  = unsigned int;
+
+    std::vector<column_type*>            d_columns(Columns);
+    std::vector<hipcub::RadixSortColumn> columns;
+    for(unsigned int column = 0; column < Columns; column++)
+    {
+        const std::vector<column_type> values = generate_keys<column_type>(size);
+        HIP_CHECK(hipMalloc(&d_columns[column], size * sizeof(column_type)));
+        HIP_CHECK(hipMemcpy(d_columns[column],
+                            values.data(),
+                            size * sizeof(column_type),
+                            hipMemcpyHostToDevice));
+        columns.push_back(hipcub::RadixSortColumn(d_columns[column]));
+    }
+    index_type* d_indices_output;
+    HIP_CHECK(hipMalloc(&d_indices_output, size * sizeof(index_type)));
+
+    void*  d_temporary_storage     = nullptr;
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(hipcub::DeviceRadixSort::ArgSortColumns(d_temporary_storage,
+                                                      temporary_storage_bytes,
+                                                      columns.data(),
+                                                      Columns,
+                                                      d_indices_output,
+                                                      size,
+                                                      stream));
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; i++)
+    {
+        HIP_CHECK(hipcub::DeviceRadixSort::ArgSortColumns(d_temporary_storage,
+                                                          temporary_storage_bytes,
+                                                          columns.data(),
+                                                          Columns,
+                                                          d_indices_output,
+                                                          size,
+                                                          stream));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; i++)
+        {
+            HIP_CHECK(hipcub::DeviceRadixSort::ArgSortColumns(d_temporary_storage,
+                                                              temporary_storage_bytes,
+                                                              columns.data(),
+                                                              Columns,
+                                                              d_indices_output,
+                                                              size,
+                                                              stream));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size
+                            * (Columns * sizeof(column_type) + sizeof(index_type)));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    for(unsigned int column = 0; column < Columns; column++)
+    {
+        HIP_CHECK(hipFree(d_columns[column]));
+    }
+    HIP_CHECK(hipFree(d_indices_output));
+}
+
+/// Random byte strings of \p KeyBytes bytes whose first \p SharedBytes bytes are equal, so the
+/// words of the shared prefix are sorted for all keys and the keys become unique after it.
+template<unsigned int KeyBytes, unsigned int SharedBytes>
+void run_arg_sort_bytes_benchmark(benchmark::State& state, hipStream_t stream, size_t size)
+{
+    using index_type = unsigned int;
+
+    std::vector<uint8_t> keys_input = generate_keys<uint8_t>(size * KeyBytes);
+    for(size_t row = 0; row < size; row++)
+    {
+        std::fill_n(keys_input.begin() + row * KeyBytes, SharedBytes, uint8_t(42));
+    }
+
+    uint8_t*    d_keys;
+    index_type* d_indices_output;
+    HIP_CHECK(hipMalloc(&d_keys, keys_input.size()));
+    HIP_CHECK(hipMalloc(&d_indices_output, size * sizeof(index_type)));
+    HIP_CHECK(hipMemcpy(d_keys, keys_input.data(), keys_input.size(), hipMemcpyHostToDevice));
+
+    void*  d_temporary_storage     = nullptr;
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(hipcub::DeviceRadixSort::ArgSortBytes(d_temporary_storage,
+                                                    temporary_storage_bytes,
+                                                    d_keys,
+                                                    KeyBytes,
+                                                    d_indices_output,
+                                                    size,
+                                                    stream));
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; i++)
+    {
+        HIP_CHECK(hipcub::DeviceRadixSort::ArgSortBytes(d_temporary_storage,
+                                                        temporary_storage_bytes,
+                                                        d_keys,
+                                                        KeyBytes,
+                                                        d_indices_output,
+                                                        size,
+                                                        stream));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; i++)
+        {
+            HIP_CHECK(hipcub::DeviceRadixSort::ArgSortBytes(d_temporary_storage,
+                                                            temporary_storage_bytes,
+                                                            d_keys,
+                                                            KeyBytes,
+                                                            d_indices_output,
+                                                            size,
+                                                            stream));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size
+                            * (KeyBytes + sizeof(index_type)));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_keys));
+    HIP_CHECK(hipFree(d_indices_output));
+}
+
+/// Keys like 64-bit timestamps that differ only in their low \p Bits bits, sorted over all bits or
+/// over the detected bits.
+template<class Key, unsigned int Bits, bool DetectBits>
+void run_sort_keys_detect_bits_benchmark(benchmark::State& state, hipStream_t stream, size_t size)
+{
+    using key_type = Key;
+
+    std::vector<key_type> keys_input
+        = benchmark_utils::get_random_data<key_type>(size, 0, (key_type(1) << Bits) - 1);
+    for(key_type& key : keys_input)
+    {
+        key += key_type(1) << (sizeof(key_type) * 8 - 2);
+    }
+
+    key_type* d_keys_input;
+    key_type* d_keys_output;
+    HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_keys_output, size * sizeof(key_type)));
+    HIP_CHECK(hipMemcpy(d_keys_input,
+                        keys_input.data(),
+                        size * sizeof(key_type),
+                        hipMemcpyHostToDevice));
+
+    auto run = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+    {
+        if(DetectBits)
+        {
+            return hipcub::DeviceRadixSort::SortKeysDetectBits(d_temporary_storage,
+                                                               temporary_storage_bytes,
+                                                               d_keys_input,
+                                                               d_keys_output,
+                                                               size,
+                                                               stream);
+        }
+        return hipcub::DeviceRadixSort::SortKeys(d_temporary_storage,
+                                                 temporary_storage_bytes,
+                                                 d_keys_input,
+                                                 d_keys_output,
+                                                 size,
+                                                 0,
+                                                 sizeof(key_type) * 8,
+                                                 stream);
+    };
+
+    void*  d_temporary_storage     = nullptr;
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; i++)
+    {
+        HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; i++)
+        {
+            HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(key_type));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_keys_input));
+    HIP_CHECK(hipFree(d_keys_output));
+}
+
+/// Counts the occurrences of \p Distinct different keys, with \p SortKeysAndCount or with
+/// \p SortKeys followed by \p DeviceRunLengthEncode::Encode on the sorted keys.
+template<class Key, unsigned int Distinct, bool Fused>
+void run_sort_keys_and_count_benchmark(benchmark::State& state, hipStream_t stream, size_t size)
+{
+    using key_type   = Key;
+    using count_type = unsigned int;
+
+    std::vector<key_type> keys_input
+        = benchmark_utils::get_random_data<key_type>(size, 0, key_type(Distinct - 1));
+
+    key_type*     d_keys_input;
+    key_type*     d_keys_sorted;
+    key_type*     d_unique_output;
+    count_type*   d_counts_output;
+    unsigned int* d_num_unique_output;
+    HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_keys_sorted, size * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_unique_output, size * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_counts_output, size * sizeof(count_type)));
+    HIP_CHECK(hipMalloc(&d_num_unique_output, sizeof(unsigned int)));
+    HIP_CHECK(hipMemcpy(d_keys_input,
+                        keys_input.data(),
+                        size * sizeof(key_type),
+                        hipMemcpyHostToDevice));
+
+    auto run = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+    {
+        if(Fused)
+        {
+            return hipcub::DeviceRadixSort::SortKeysAndCount(d_temporary_storage,
+                                                             temporary_storage_bytes,
+                                                             d_keys_input,
+                                                             d_unique_output,
+                                                             d_counts_output,
+                                                             d_num_unique_output,
+                                                             size,
+                                                             stream);
+        }
+        // Both algorithms share the storage, sized for the larger one
+        size_t     sort_bytes   = temporary_storage_bytes;
+        size_t     encode_bytes = temporary_storage_bytes;
+        hipError_t error        = hipcub::DeviceRadixSort::SortKeys(d_temporary_storage,
+                                                                    sort_bytes,
+                                                                    d_keys_input,
+                                                                    d_keys_sorted,
+                                                                    size,
+                                                                    0,
+                                                                    sizeof(key_type) * 8,
+                                                                    stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        error = hipcub::DeviceRunLengthEncode::Encode(d_temporary_storage,
+                                                      encode_bytes,
+                                                      d_keys_sorted,
+                                                      d_unique_output,
+                                                      d_counts_output,
+                                                      d_num_unique_output,
+                                                      size,
+                                                      stream);
+        if(d_temporary_storage == nullptr)
+        {
+            temporary_storage_bytes = std::max(sort_bytes, encode_bytes);
+        }
+        return error;
+    };
+
+    void*  d_temporary_storage     = nullptr;
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; i++)
+    {
+        HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; i++)
+        {
+            HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(key_type));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_keys_input));
+    HIP_CHECK(hipFree(d_keys_sorted));
+    HIP_CHECK(hipFree(d_unique_output));
+    HIP_CHECK(hipFree(d_counts_output));
+    HIP_CHECK(hipFree(d_num_unique_output));
+}
+
+/// Sorts a copy of the input in place. The copy is restored before every sort and only the sort
+/// is timed, so the time compares directly with the out-of-place benchmarks of the same types.
+template<class Key, class Value, bool Pairs>
+void run_sort_in_place_benchmark(benchmark::State&                 state,
+                                 hipStream_t                       stream,
+                                 size_t                            size,
+                                 std::shared_ptr<std::vector<Key>> keys_input)
+{
+    using key_type   = Key;
+    using value_type = Value;
+
+    std::vector<value_type> values_input(size);
+    std::iota(values_input.begin(), values_input.end(), 0);
+
+    key_type*   d_keys_input;
+    key_type*   d_keys;
+    value_type* d_values_input;
+    value_type* d_values;
+    HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_keys, size * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_values_input, size * sizeof(value_type)));
+    HIP_CHECK(hipMalloc(&d_values, size * sizeof(value_type)));
+    HIP_CHECK(hipMemcpy(d_keys_input,
+                        keys_input->data(),
+                        size * sizeof(key_type),
+                        hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_values_input,
+                        values_input.data(),
+                        size * sizeof(value_type),
+                        hipMemcpyHostToDevice));
+
+    auto restore = [&]()
+    {
+        HIP_CHECK(hipMemcpyAsync(d_keys,
+                                 d_keys_input,
+                                 size * sizeof(key_type),
+                                 hipMemcpyDeviceToDevice,
+                                 stream));
+        HIP_CHECK(hipMemcpyAsync(d_values,
+                                 d_values_input,
+                                 size * sizeof(value_type),
+                                 hipMemcpyDeviceToDevice,
+                                 stream));
+    };
+    auto run = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+    {
+        if(Pairs)
+        {
+            return hipcub::DeviceRadixSort::SortPairsInPlace(d_temporary_storage,
+                                                             temporary_storage_bytes,
+                                                             d_keys,
+                                                             d_values,
+                                                             size,
+                                                             stream);
+        }
+        return hipcub::DeviceRadixSort::SortKeysInPlace(d_temporary_storage,
+                                                        temporary_storage_bytes,
+                                                        d_keys,
+                                                        size,
+                                                        stream);
+    };
+
+    void*  d_temporary_storage     = nullptr;
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; i++)
+    {
+        restore();
+        HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // HIP events creation
+    hipEvent_t start, stop;
+    HIP_CHECK(hipEventCreate(&start));
+    HIP_CHECK(hipEventCreate(&stop));
+
+    for(auto _ : state)
+    {
+        float elapsed_mseconds = 0;
+        for(size_t i = 0; i < batch_size; i++)
+        {
+            restore();
+            HIP_CHECK(hipEventRecord(start, stream));
+            HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipEventRecord(stop, stream));
+            HIP_CHECK(hipEventSynchronize(stop));
+
+            float batch_mseconds;
+            HIP_CHECK(hipEventElapsedTime(&batch_mseconds, start, stop));
+            elapsed_mseconds += batch_mseconds;
+        }
+        state.SetIterationTime(elapsed_mseconds / 1000);
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size
+                            * (sizeof(key_type) + (Pairs ? sizeof(value_type) : 0)));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipEventDestroy(start));
+    HIP_CHECK(hipEventDestroy(stop));
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_keys_input));
+    HIP_CHECK(hipFree(d_keys));
+    HIP_CHECK(hipFree(d_values_input));
+    HIP_CHECK(hipFree(d_values));
+}
+
 #define CREATE_SORT_KEYS_BENCHMARK(Key)                                                 \
     {                                                                                   \
         auto keys_input = std::make_shared<std::vector<Key>>(generate_keys<Key>(size)); \
@@ -407,6 +956,94 @@ void run_sort_pairs_benchmark(benchmark::State&                 state,
             { run_sort_pairs_benchmark<Key, Value, true>(state, stream, size, keys_input); })); \
     }
 
+#define CREATE_ARG_SORT_BENCHMARK(Key)                                                  \
+    {                                                                                   \
+        auto keys_input = std::make_shared<std::vector<Key>>(generate_keys<Key>(size)); \
+        benchmarks.push_back(benchmark::RegisterBenchmark(                              \
+            std::string("device_radix_arg_sort"                                         \
+                        "<key_data_type:" #Key ">.")                                    \
+                .c_str(),                                                               \
+            [=](benchmark::State& state)                                                \
+            { run_arg_sort_benchmark<Key>(state, stream, size, keys_input); }));        \
+        benchmarks.push_back(benchmark::RegisterBenchmark(                              \
+            std::string("device_radix_arg_sort_discard_keys"                            \
+                        "<key_data_type:" #Key ">.")                                    \
+                .c_str(),                                                               \
+            [=](benchmark::State& state)                                                \
+            { run_arg_sort_benchmark<Key, true>(state, stream, size, keys_input); }));  \
+    }
+
+#define CREATE_ARG_SORT_COLUMNS_BENCHMARK(Column, Columns)                              \
+    benchmarks.push_back(benchmark::RegisterBenchmark(                                  \
+        std::string("device_radix_arg_sort_columns"                                     \
+                    "<column_data_type:" #Column ",columns:" #Columns ">.")             \
+            .c_str(),                                                                   \
+        [=](benchmark::State& state)                                                    \
+        { run_arg_sort_columns_benchmark<Column, Columns>(state, stream, size); }));
+
+#define CREATE_ARG_SORT_BYTES_BENCHMARK(KeyBytes, SharedBytes)                          \
+    benchmarks.push_back(benchmark::RegisterBenchmark(                                  \
+        std::string("device_radix_arg_sort_bytes"                                       \
+                    "<key_bytes:" #KeyBytes ",shared_bytes:" #SharedBytes ">.")         \
+            .c_str(),                                                                   \
+        [=](benchmark::State& state)                                                    \
+        { run_arg_sort_bytes_benchmark<KeyBytes, SharedBytes>(state, stream, size); }));
+
+#define CREATE_SORT_KEYS_DETECT_BITS_BENCHMARK(Key, Bits)                                  \
+    benchmarks.push_back(benchmark::RegisterBenchmark(                                     \
+        std::string("device_radix_sort_keys_all_bits"                                      \
+                    "<key_data_type:" #Key ",varying_bits:" #Bits ">.")                    \
+            .c_str(),                                                                      \
+        [=](benchmark::State& state)                                                       \
+        { run_sort_keys_detect_bits_benchmark<Key, Bits, false>(state, stream, size); })); \
+    benchmarks.push_back(benchmark::RegisterBenchmark(                                     \
+        std::string("device_radix_sort_keys_detect_bits"                                   \
+                    "<key_data_type:" #Key ",varying_bits:" #Bits ">.")                    \
+            .c_str(),                                                                      \
+        [=](benchmark::State& state)                                                       \
+        { run_sort_keys_detect_bits_benchmark<Key, Bits, true>(state, stream, size); }));
+
+#define CREATE_SORT_KEYS_AND_COUNT_BENCHMARK(Key, Distinct)                                  \
+    benchmarks.push_back(benchmark::RegisterBenchmark(                                       \
+        std::string("device_radix_sort_keys_then_encode"                                     \
+                    "<key_data_type:" #Key ",distinct_keys:" #Distinct ">.")                 \
+            .c_str(),                                                                        \
+        [=](benchmark::State& state)                                                         \
+        { run_sort_keys_and_count_benchmark<Key, Distinct, false>(state, stream, size); })); \
+    benchmarks.push_back(benchmark::RegisterBenchmark(                                       \
+        std::string("device_radix_sort_keys_and_count"                                       \
+                    "<key_data_type:" #Key ",distinct_keys:" #Distinct ">.")                 \
+            .c_str(),                                                                        \
+        [=](benchmark::State& state)                                                         \
+        { run_sort_keys_and_count_benchmark<Key, Distinct, true>(state, stream, size); }));
+
+#define CREATE_SORT_IN_PLACE_BENCHMARK(Key, Value)                                      \
+    {                                                                                   \
+        auto keys_input = std::make_shared<std::vector<Key>>(generate_keys<Key>(size)); \
+        benchmarks.push_back(benchmark::RegisterBenchmark(                              \
+            std::string("device_radix_sort_keys_in_place"                               \
+                        "<key_data_type:" #Key ">.")                                    \
+                .c_str(),                                                               \
+            [=](benchmark::State& state)                                                \
+            {                                                                           \
+                run_sort_in_place_benchmark<Key, Value, false>(state,                   \
+                                                               stream,                  \
+                                                               size,                    \
+                                                               keys_input);             \
+            }));                                                                        \
+        benchmarks.push_back(benchmark::RegisterBenchmark(                              \
+            std::string("device_radix_sort_pairs_in_place"                              \
+                        "<key_data_type:" #Key ",value_data_type:" #Value ">.")         \
+                .c_str(),                                                               \
+            [=](benchmark::State& state)                                                \
+            {                                                                           \
+                run_sort_in_place_benchmark<Key, Value, true>(state,                    \
+                                                              stream,                   \
+                                                              size,                     \
+                                                              keys_input);              \
+            }));                                                                        \
+    }
+
 void add_sort_keys_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
                               hipStream_t                                   stream,
                               size_t                                        size)
@@ -418,6 +1055,13 @@ void add_sort_keys_benchmarks(std::vector<benchmark::internal::Benchmark*>& benc
     CREATE_SORT_KEYS_BENCHMARK(uint8_t)
     CREATE_SORT_KEYS_BENCHMARK(short)
     CREATE_SORT_KEYS_BENCHMARK(custom_int_t)
+
+    CREATE_SORT_KEYS_DETECT_BITS_BENCHMARK(unsigned long long, 20)
+    CREATE_SORT_KEYS_DETECT_BITS_BENCHMARK(unsigned long long, 35)
+
+    CREATE_SORT_KEYS_AND_COUNT_BENCHMARK(int, 1000)
+    CREATE_SORT_KEYS_AND_COUNT_BENCHMARK(int, 1000000)
+    CREATE_SORT_KEYS_AND_COUNT_BENCHMARK(long long, 100000)
 }
 
 void add_sort_pairs_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
@@ -450,6 +1094,33 @@ void add_sort_pairs_benchmarks(std::vector<benchmark::internal::Benchmark*>& ben
     CREATE_SORT_PAIRS_BENCHMARK(custom_int_t, float)
 }
 
+void add_arg_sort_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                             hipStream_t                                   stream,
+                             size_t                                        size)
+{
+    CREATE_ARG_SORT_BENCHMARK(int)
+    CREATE_ARG_SORT_BENCHMARK(long long)
+    CREATE_ARG_SORT_BENCHMARK(float)
+
+    CREATE_ARG_SORT_COLUMNS_BENCHMARK(short, 2)
+    CREATE_ARG_SORT_COLUMNS_BENCHMARK(short, 4)
+    CREATE_ARG_SORT_COLUMNS_BENCHMARK(int, 3)
+
+    CREATE_ARG_SORT_BYTES_BENCHMARK(16, 0)
+    CREATE_ARG_SORT_BYTES_BENCHMARK(16, 8)
+    CREATE_ARG_SORT_BYTES_BENCHMARK(32, 16)
+}
+
+void add_sort_in_place_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                                  hipStream_t                                   stream,
+                                  size_t                                        size)
+{
+    // Same types as the out-of-place key and pair benchmarks they are compared with
+    CREATE_SORT_IN_PLACE_BENCHMARK(int, float)
+    CREATE_SORT_IN_PLACE_BENCHMARK(long long, double)
+    CREATE_SORT_IN_PLACE_BENCHMARK(uint8_t, uint8_t)
+}
+
 int main(int argc, char* argv[])
 {
     cli::Parser parser(argc, argv);
@@ -476,6 +1147,8 @@ int main(int argc, char* argv[])
     std::vector<benchmark::internal::Benchmark*> benchmarks;
     add_sort_keys_benchmarks(benchmarks, stream, size);
     add_sort_pairs_benchmarks(benchmarks, stream, size);
+    add_arg_sort_benchmarks(benchmarks, stream, size);
+    add_sort_in_place_benchmarks(benchmarks, stream, size);
 
     // Use manual timing
     for(auto& b : benchmarks)
@@ -124,6 +124,38 @@ struct Benchmark<T, hipcub::ArgMin>
     }
 };
 
+// Tag for the single-pass reduction of all statistics
+struct AllStatistics
+{};
+
+template<typename T>
+struct Benchmark<T, AllStatistics>
+{
+    using Statistics = hipcub::ReduceStatistics<T, double>;
+
+    static void run(benchmark::State& state, size_t size, const hipStream_t stream)
+    {
+        hipError_t (*ptr_to_statistics)(void*, size_t&, T*, Statistics*, int, hipStream_t)
+            = &hipcub::DeviceReduce::Statistics<hipcub::REDUCE_STATISTICS_ALL>;
+        run_benchmark<T, Statistics>(state, size, stream, ptr_to_statistics);
+    }
+};
+
+// Tag for the sum with a fixed order of additions, compare with hipcub::Sum for its cost
+struct ReproducibleSum
+{};
+
+template<typename T>
+struct Benchmark<T, ReproducibleSum>
+{
+    static void run(benchmark::State& state, size_t size, const hipStream_t stream)
+    {
+        hipError_t (*ptr_to_sum)(void*, size_t&, T*, T*, int, hipStream_t)
+            = &hipcub::DeviceReduce::ReproducibleSum;
+        run_benchmark<T, T>(state, size, stream, ptr_to_sum);
+    }
+};
+
 #define CREATE_BENCHMARK(T, REDUCE_OP)                                                \
     benchmark::RegisterBenchmark(std::string("device_reduce"                          \
                                              "<data_type:" #T ",op:" #REDUCE_OP ">.") \
@@ -173,6 +205,9 @@ int main(int argc, char* argv[])
 #ifdef HIPCUB_ROCPRIM_API
         CREATE_BENCHMARK(custom_double2, hipcub::ArgMin),
 #endif
+        CREATE_BENCHMARKS(AllStatistics),
+        CREATE_BENCHMARK(float, ReproducibleSum),
+        CREATE_BENCHMARK(double, ReproducibleSum),
     };
 
     // Use manual timing
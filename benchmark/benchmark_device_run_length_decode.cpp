@@ -0,0 +1,217 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "common_benchmark_header.hpp"
+
+// HIP API
+#include "hipcub/device/device_run_length_decode.hpp"
+
+#ifndef DEFAULT_N
+const size_t DEFAULT_N = 1024 * 1024 * 32;
+#endif
+
+// With skewed lengths every 1000th run is 1000 times longer than the others
+template<class T>
+void run_decode_benchmark(benchmark::State& state,
+                          size_t            max_length,
+                          bool              skewed,
+                          hipStream_t       stream,
+                          size_t            size)
+{
+    using value_type  = T;
+    using length_type = unsigned int;
+
+    // Generate data
+    std::vector<size_t> random_lengths
+        = benchmark_utils::get_random_data<size_t>(100000, 1, max_length);
+    std::vector<length_type> lengths;
+    size_t                   offset = 0;
+    while(offset < size)
+    {
+        size_t length = random_lengths[lengths.size() % random_lengths.size()];
+        if(skewed && lengths.size() % 1000 == 0)
+        {
+            length *= 1000;
+        }
+        length = std::min(length, size - offset);
+        lengths.push_back(static_cast<length_type>(length));
+        offset += length;
+    }
+    const unsigned int runs_count = lengths.size();
+
+    std::vector<value_type> values = benchmark_utils::get_random_data<value_type>(
+        runs_count,
+        benchmark_utils::generate_limits<value_type>::min(),
+        benchmark_utils::generate_limits<value_type>::max());
+
+    value_type*  d_values;
+    length_type* d_lengths;
+    value_type*  d_output;
+    HIP_CHECK(hipMalloc(&d_values, runs_count * sizeof(value_type)));
+    HIP_CHECK(hipMalloc(&d_lengths, runs_count * sizeof(length_type)));
+    HIP_CHECK(hipMalloc(&d_output, size * sizeof(value_type)));
+    HIP_CHECK(hipMemcpy(d_values,
+                        values.data(),
+                        runs_count * sizeof(value_type),
+                        hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_lengths,
+                        lengths.data(),
+                        runs_count * sizeof(length_type),
+                        hipMemcpyHostToDevice));
+
+    void*  d_temporary_storage     = nullptr;
+    size_t temporary_storage_bytes = 0;
+
+    HIP_CHECK(hipcub::DeviceRunLengthDecode::Decode(nullptr,
+                                                    temporary_storage_bytes,
+                                                    d_values,
+                                                    d_lengths,
+                                                    d_output,
+                                                    runs_count,
+                                                    stream));
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < 10; i++)
+    {
+        HIP_CHECK(hipcub::DeviceRunLengthDecode::Decode(d_temporary_storage,
+                                                        temporary_storage_bytes,
+                                                        d_values,
+                                                        d_lengths,
+                                                        d_output,
+                                                        runs_count,
+                                                        stream));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    const unsigned int batch_size = 10;
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; i++)
+        {
+            HIP_CHECK(hipcub::DeviceRunLengthDecode::Decode(d_temporary_storage,
+                                                            temporary_storage_bytes,
+                                                            d_values,
+                                                            d_lengths,
+                                                            d_output,
+                                                            runs_count,
+                                                            stream));
+        }
+        HIP_CHECK(hipStreamSynchronize(stream));
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(value_type));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_values));
+    HIP_CHECK(hipFree(d_lengths));
+    HIP_CHECK(hipFree(d_output));
+}
+
+#define CREATE_DECODE_BENCHMARK(T)                                                       \
+    benchmark::RegisterBenchmark(std::string("device_run_length_decode"                  \
+                                             "<data_type:" #T ">."                       \
+                                             "(random_number_range:[1, "                 \
+                                             + std::to_string(max_length) + "], skewed:" \
+                                             + (skewed ? "true" : "false") + ")")        \
+                                     .c_str(),                                           \
+                                 &run_decode_benchmark<T>,                               \
+                                 max_length,                                             \
+                                 skewed,                                                 \
+                                 stream,                                                 \
+                                 size)
+
+void add_decode_benchmarks(size_t                                        max_length,
+                           bool                                          skewed,
+                           std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                           hipStream_t                                   stream,
+                           size_t                                        size)
+{
+    using custom_float2 = benchmark_utils::custom_type<float, float>;
+
+    std::vector<benchmark::internal::Benchmark*> bs = {
+        CREATE_DECODE_BENCHMARK(int),
+        CREATE_DECODE_BENCHMARK(long long),
+        CREATE_DECODE_BENCHMARK(uint8_t),
+        CREATE_DECODE_BENCHMARK(custom_float2),
+    };
+
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t size   = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+
+    std::cout << "benchmark_device_run_length_decode" << std::endl;
+
+    // HIP
+    hipStream_t     stream = 0; // default
+    hipDeviceProp_t devProp;
+    int             device_id = 0;
+    HIP_CHECK(hipGetDevice(&device_id));
+    HIP_CHECK(hipGetDeviceProperties(&devProp, device_id));
+    std::cout << "[HIP] Device name: " << devProp.name << std::endl;
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+    add_decode_benchmarks(1000, false, benchmarks, stream, size);
+    add_decode_benchmarks(10, false, benchmarks, stream, size);
+    add_decode_benchmarks(10, true, benchmarks, stream, size);
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
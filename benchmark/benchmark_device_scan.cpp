@@ -77,6 +77,39 @@ auto run_device_scan(void*             temporary_storage,
                                              stream);
 }
 
+// Tag for the sums with a fixed order of additions, compare with hipcub::Sum for their cost
+struct ReproducibleSum
+{};
+
+template<bool Exclusive, class T>
+hipError_t run_device_scan(void*             temporary_storage,
+                           size_t&           storage_size,
+                           T*                input,
+                           T*                output,
+                           const T           initial_value,
+                           const size_t      input_size,
+                           ReproducibleSum   scan_op,
+                           const hipStream_t stream)
+{
+    (void)initial_value;
+    (void)scan_op;
+    if(Exclusive)
+    {
+        return hipcub::DeviceScan::ReproducibleExclusiveSum(temporary_storage,
+                                                            storage_size,
+                                                            input,
+                                                            output,
+                                                            input_size,
+                                                            stream);
+    }
+    return hipcub::DeviceScan::ReproducibleInclusiveSum(temporary_storage,
+                                                        storage_size,
+                                                        input,
+                                                        output,
+                                                        input_size,
+                                                        stream);
+}
+
 template<bool Exclusive, class T, class K, class BinaryFunction>
 auto run_device_scan_by_key(void*             temporary_storage,
                             size_t&           storage_size,
@@ -317,6 +350,16 @@ void run_benchmark_by_key(benchmark::State& state,
         CREATE_BENCHMARK(true, int8_t, SCAN_OP), CREATE_BENCHMARK(false, uint8_t, SCAN_OP),        \
         CREATE_BENCHMARK(true, uint8_t, SCAN_OP)
 
+#define CREATE_REPRODUCIBLE_BENCHMARK(EXCL, T)                                             \
+    benchmark::RegisterBenchmark(                                                          \
+        std::string(std::string(EXCL ? "device_exclusive_scan" : "device_inclusive_scan")  \
+                    + "<data_type:" #T ",op:ReproducibleSum>.")                            \
+            .c_str(),                                                                      \
+        &run_benchmark<EXCL, T, ReproducibleSum>,                                          \
+        size,                                                                              \
+        stream,                                                                            \
+        ReproducibleSum())
+
 int main(int argc, char* argv[])
 {
     cli::Parser parser(argc, argv);
@@ -351,6 +394,10 @@ int main(int argc, char* argv[])
     std::vector<benchmark::internal::Benchmark*> benchmarks = {
         CREATE_BENCHMARKS(hipcub::Sum),
         CREATE_BENCHMARKS(hipcub::Min),
+        CREATE_REPRODUCIBLE_BENCHMARK(false, float),
+        CREATE_REPRODUCIBLE_BENCHMARK(true, float),
+        CREATE_REPRODUCIBLE_BENCHMARK(false, double),
+        CREATE_REPRODUCIBLE_BENCHMARK(true, double),
     };
 
     // Use manual timing
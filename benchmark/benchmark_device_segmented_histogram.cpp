@@ -0,0 +1,251 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "common_benchmark_header.hpp"
+
+// HIP API
+#include "hipcub/hipcub.hpp"
+
+#ifndef DEFAULT_N
+const size_t DEFAULT_N = 1024 * 1024 * 32;
+#endif
+
+const unsigned int batch_size  = 4;
+const unsigned int warmup_size = 2;
+
+// Runs either DeviceSegmentedHistogram or one DeviceHistogram::HistogramEven per segment, the
+// loop the segmented algorithm replaces.
+template<class T>
+void run_segmented_histogram_benchmark(benchmark::State& state,
+                                       size_t            desired_segments,
+                                       int               bins,
+                                       bool              use_loop,
+                                       hipStream_t       stream,
+                                       size_t            size)
+{
+    using offset_type  = int;
+    using sample_type  = T;
+    using counter_type = unsigned int;
+
+    std::vector<offset_type> offsets;
+
+    const double avg_segment_length = static_cast<double>(size) / desired_segments;
+
+    std::random_device         rd;
+    std::default_random_engine gen(rd());
+
+    std::uniform_real_distribution<double> segment_length_dis(0, avg_segment_length * 2);
+
+    unsigned int segments_count = 0;
+    size_t       offset         = 0;
+    while(offset < size)
+    {
+        const size_t segment_length = std::round(segment_length_dis(gen));
+        offsets.push_back(offset);
+        ++segments_count;
+        offset += segment_length;
+    }
+    offsets.push_back(size);
+
+    const sample_type lower_level = 0;
+    const sample_type upper_level = static_cast<sample_type>(bins);
+
+    std::vector<sample_type> samples
+        = benchmark_utils::get_random_data<sample_type>(size, lower_level, upper_level);
+
+    offset_type* d_offsets;
+    HIP_CHECK(hipMalloc(&d_offsets, (segments_count + 1) * sizeof(offset_type)));
+    HIP_CHECK(hipMemcpy(d_offsets,
+                        offsets.data(),
+                        (segments_count + 1) * sizeof(offset_type),
+                        hipMemcpyHostToDevice));
+
+    const size_t histogram_size = static_cast<size_t>(segments_count) * bins;
+
+    sample_type*  d_samples;
+    counter_type* d_histogram;
+    HIP_CHECK(hipMalloc(&d_samples, size * sizeof(sample_type)));
+    HIP_CHECK(hipMalloc(&d_histogram, histogram_size * sizeof(counter_type)));
+    HIP_CHECK(
+        hipMemcpy(d_samples, samples.data(), size * sizeof(sample_type), hipMemcpyHostToDevice));
+
+    auto dispatch = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+    {
+        if(use_loop)
+        {
+            // The storage needed for the whole input is enough for every segment
+            size_t segment_storage_bytes = temporary_storage_bytes;
+            for(unsigned int segment = 0; segment < segments_count; ++segment)
+            {
+                const offset_type num_samples
+                    = d_temporary_storage == nullptr ? static_cast<offset_type>(size)
+                                                     : offsets[segment + 1] - offsets[segment];
+                const hipError_t error
+                    = hipcub::DeviceHistogram::HistogramEven(d_temporary_storage,
+                                                             segment_storage_bytes,
+                                                             d_samples + offsets[segment],
+                                                             d_histogram + segment * bins,
+                                                             bins + 1,
+                                                             lower_level,
+                                                             upper_level,
+                                                             num_samples,
+                                                             stream);
+                if(error != hipSuccess || d_temporary_storage == nullptr)
+                {
+                    temporary_storage_bytes = segment_storage_bytes;
+                    return error;
+                }
+            }
+            return hipSuccess;
+        }
+        return hipcub::DeviceSegmentedHistogram::HistogramEven(d_temporary_storage,
+                                                               temporary_storage_bytes,
+                                                               d_samples,
+                                                               d_histogram,
+                                                               bins + 1,
+                                                               lower_level,
+                                                               upper_level,
+                                                               static_cast<int>(segments_count),
+                                                               d_offsets,
+                                                               d_offsets + 1,
+                                                               stream);
+    };
+
+    void*  d_temporary_storage     = nullptr;
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; ++i)
+    {
+        HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; ++i)
+        {
+            HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(sample_type));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_offsets));
+    HIP_CHECK(hipFree(d_samples));
+    HIP_CHECK(hipFree(d_histogram));
+}
+
+#define CREATE_SEGMENTED_HISTOGRAM_BENCHMARK(T, SEGMENTS, BINS, USE_LOOP)                  \
+    benchmark::RegisterBenchmark(                                                          \
+        (std::string(USE_LOOP ? "device_histogram_loop" : "device_segmented_histogram")    \
+         + "<data_type:" #T ",bins:" #BINS ">.(number_of_segments:~"                       \
+         + std::to_string(SEGMENTS) + " segments)")                                        \
+            .c_str(),                                                                      \
+        [=](benchmark::State& state)                                                       \
+        {                                                                                  \
+            run_segmented_histogram_benchmark<T>(state,                                    \
+                                                 SEGMENTS,                                 \
+                                                 BINS,                                     \
+                                                 USE_LOOP,                                 \
+                                                 stream,                                   \
+                                                 size);                                    \
+        })
+
+#define BENCHMARK_TYPE(type, SEGMENTS, BINS)                                               \
+    CREATE_SEGMENTED_HISTOGRAM_BENCHMARK(type, SEGMENTS, BINS, true),                      \
+        CREATE_SEGMENTED_HISTOGRAM_BENCHMARK(type, SEGMENTS, BINS, false)
+
+void add_segmented_histogram_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                                        hipStream_t                                   stream,
+                                        size_t                                        size)
+{
+    std::vector<benchmark::internal::Benchmark*> bs = {
+        BENCHMARK_TYPE(int, 100, 256),
+        BENCHMARK_TYPE(int, 1000, 256),
+        BENCHMARK_TYPE(int, 10000, 16),
+        BENCHMARK_TYPE(int, 10000, 256),
+        BENCHMARK_TYPE(int, 1000, 10000),
+        BENCHMARK_TYPE(float, 10000, 2048),
+    };
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t size   = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+
+    std::cout << "benchmark_device_segmented_histogram" << std::endl;
+
+    // HIP
+    hipStream_t     stream = 0; // default
+    hipDeviceProp_t devProp;
+    int             device_id = 0;
+    HIP_CHECK(hipGetDevice(&device_id));
+    HIP_CHECK(hipGetDeviceProperties(&devProp, device_id));
+    std::cout << "[HIP] Device name: " << devProp.name << std::endl;
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+    add_segmented_histogram_benchmarks(benchmarks, stream, size);
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -34,9 +34,12 @@ const unsigned int warmup_size = 5;
 
 using OffsetType = int;
 
+// long_percent percent of the segments are on average 100 times longer than the others, which
+// skews the distribution towards many short segments with a few long ones.
 template<class T, class OutputT, class SegmentedReduceKernel>
 void run_benchmark(benchmark::State&     state,
                    size_t                desired_segments,
+                   size_t                long_percent,
                    hipStream_t           stream,
                    size_t                size,
                    SegmentedReduceKernel segmented_reduce)
@@ -47,15 +50,22 @@ void run_benchmark(benchmark::State&     state,
     const unsigned int         seed = 123;
     std::default_random_engine gen(seed);
 
-    const double avg_segment_length = static_cast<double>(size) / desired_segments;
+    const double long_fraction      = long_percent / 100.0;
+    const double avg_segment_length = static_cast<double>(size) / desired_segments
+                                      / (1.0 - long_fraction + 100.0 * long_fraction);
     std::uniform_real_distribution<double> segment_length_dis(0, avg_segment_length * 2);
+    std::uniform_real_distribution<double> long_segment_length_dis(avg_segment_length * 50,
+                                                                   avg_segment_length * 150);
+    std::bernoulli_distribution            long_segment_dis(long_fraction);
 
     std::vector<OffsetType> offsets;
     unsigned int            segments_count = 0;
     size_t                  offset         = 0;
     while(offset < size)
     {
-        const size_t segment_length = std::round(segment_length_dis(gen));
+        const bool   is_long = long_percent > 0 && long_segment_dis(gen);
+        const size_t segment_length
+            = std::round(is_long ? long_segment_length_dis(gen) : segment_length_dis(gen));
         offsets.push_back(offset);
         segments_count++;
         offset += segment_length;
@@ -148,24 +158,30 @@ struct Benchmark;
 template<typename T>
 struct Benchmark<T, hipcub::Sum>
 {
-    static void
-        run(benchmark::State& state, size_t desired_segments, const hipStream_t stream, size_t size)
+    static void run(benchmark::State& state,
+                    size_t            desired_segments,
+                    size_t            long_percent,
+                    const hipStream_t stream,
+                    size_t            size)
     {
         hipError_t (*ptr_to_sum)(void*, size_t&, T*, T*, int, OffsetType*, OffsetType*, hipStream_t)
             = &hipcub::DeviceSegmentedReduce::Sum;
-        run_benchmark<T, T>(state, desired_segments, stream, size, ptr_to_sum);
+        run_benchmark<T, T>(state, desired_segments, long_percent, stream, size, ptr_to_sum);
     }
 };
 
 template<typename T>
 struct Benchmark<T, hipcub::Min>
 {
-    static void
-        run(benchmark::State& state, size_t desired_segments, const hipStream_t stream, size_t size)
+    static void run(benchmark::State& state,
+                    size_t            desired_segments,
+                    size_t            long_percent,
+                    const hipStream_t stream,
+                    size_t            size)
     {
         hipError_t (*ptr_to_min)(void*, size_t&, T*, T*, int, OffsetType*, OffsetType*, hipStream_t)
             = &hipcub::DeviceSegmentedReduce::Min;
-        run_benchmark<T, T>(state, desired_segments, stream, size, ptr_to_min);
+        run_benchmark<T, T>(state, desired_segments, long_percent, stream, size, ptr_to_min);
     }
 };
 
@@ -176,8 +192,11 @@ struct Benchmark<T, hipcub::ArgMin>
     using Iterator   = typename hipcub::ArgIndexInputIterator<T*, Difference>;
     using KeyValue   = typename Iterator::value_type;
 
-    static void
-        run(benchmark::State& state, size_t desired_segments, const hipStream_t stream, size_t size)
+    static void run(benchmark::State& state,
+                    size_t            desired_segments,
+                    size_t            long_percent,
+                    const hipStream_t stream,
+                    size_t            size)
     {
         hipError_t (*ptr_to_argmin)(void*,
                                     size_t&,
@@ -188,10 +207,145 @@ struct Benchmark<T, hipcub::ArgMin>
                                     OffsetType*,
                                     hipStream_t)
             = &hipcub::DeviceSegmentedReduce::ArgMin;
-        run_benchmark<T, KeyValue>(state, desired_segments, stream, size, ptr_to_argmin);
+        run_benchmark<T, KeyValue>(state,
+                                   desired_segments,
+                                   long_percent,
+                                   stream,
+                                   size,
+                                   ptr_to_argmin);
     }
 };
 
+template<typename T>
+struct Benchmark<T, hipcub::ArgMax>
+{
+    using Difference = OffsetType;
+    using Iterator   = typename hipcub::ArgIndexInputIterator<T*, Difference>;
+    using KeyValue   = typename Iterator::value_type;
+
+    static void run(benchmark::State& state,
+                    size_t            desired_segments,
+                    size_t            long_percent,
+                    const hipStream_t stream,
+                    size_t            size)
+    {
+        hipError_t (*ptr_to_argmax)(void*,
+                                    size_t&,
+                                    T*,
+                                    KeyValue*,
+                                    int,
+                                    OffsetType*,
+                                    OffsetType*,
+                                    hipStream_t)
+            = &hipcub::DeviceSegmentedReduce::ArgMax;
+        run_benchmark<T, KeyValue>(state,
+                                   desired_segments,
+                                   long_percent,
+                                   stream,
+                                   size,
+                                   ptr_to_argmax);
+    }
+};
+
+// Compares SumFixedSize against Sum over the same equally sized segments given as offsets
+template<class T>
+void run_fixed_size_benchmark(benchmark::State& state,
+                              int               segment_size,
+                              bool              use_offsets,
+                              hipStream_t       stream,
+                              size_t            size)
+{
+    using value_type = T;
+
+    const int segments_count = static_cast<int>(size / segment_size);
+    size                     = static_cast<size_t>(segments_count) * segment_size;
+
+    std::vector<OffsetType> offsets(segments_count + 1);
+    for(int segment = 0; segment <= segments_count; segment++)
+    {
+        offsets[segment] = segment * segment_size;
+    }
+
+    std::vector<value_type> values_input(size);
+    std::iota(values_input.begin(), values_input.end(), 0);
+
+    OffsetType* d_offsets;
+    HIP_CHECK(hipMalloc(&d_offsets, (segments_count + 1) * sizeof(OffsetType)));
+    HIP_CHECK(hipMemcpy(d_offsets,
+                        offsets.data(),
+                        (segments_count + 1) * sizeof(OffsetType),
+                        hipMemcpyHostToDevice));
+
+    value_type* d_values_input;
+    HIP_CHECK(hipMalloc(&d_values_input, size * sizeof(value_type)));
+    HIP_CHECK(hipMemcpy(d_values_input,
+                        values_input.data(),
+                        size * sizeof(value_type),
+                        hipMemcpyHostToDevice));
+
+    value_type* d_aggregates_output;
+    HIP_CHECK(hipMalloc(&d_aggregates_output, segments_count * sizeof(value_type)));
+
+    auto dispatch = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+    {
+        if(use_offsets)
+        {
+            return hipcub::DeviceSegmentedReduce::Sum(d_temporary_storage,
+                                                      temporary_storage_bytes,
+                                                      d_values_input,
+                                                      d_aggregates_output,
+                                                      segments_count,
+                                                      d_offsets,
+                                                      d_offsets + 1,
+                                                      stream);
+        }
+        return hipcub::DeviceSegmentedReduce::SumFixedSize(d_temporary_storage,
+                                                           temporary_storage_bytes,
+                                                           d_values_input,
+                                                           d_aggregates_output,
+                                                           segments_count,
+                                                           segment_size,
+                                                           stream);
+    };
+
+    void*  d_temporary_storage     = nullptr;
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; i++)
+    {
+        HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; i++)
+        {
+            HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+        }
+        HIP_CHECK(hipStreamSynchronize(stream));
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(value_type));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_offsets));
+    HIP_CHECK(hipFree(d_values_input));
+    HIP_CHECK(hipFree(d_aggregates_output));
+}
+
 #define CREATE_BENCHMARK(T, SEGMENTS, REDUCE_OP)                                            \
     benchmark::RegisterBenchmark(std::string("device_segmented_reduce"                      \
                                              "<data_type:" #T ",reduce_op:" #REDUCE_OP ">." \
@@ -200,9 +354,29 @@ struct Benchmark<T, hipcub::ArgMin>
                                      .c_str(),                                              \
                                  &Benchmark<T, REDUCE_OP>::run,                             \
                                  SEGMENTS,                                                  \
+                                 0,                                                         \
                                  stream,                                                    \
                                  size)
 
+#define CREATE_SKEWED_BENCHMARK(T, AVG_LENGTH, LONG_PERCENT, REDUCE_OP)                     \
+    benchmark::RegisterBenchmark(std::string("device_segmented_reduce"                      \
+                                             "<data_type:" #T ",reduce_op:" #REDUCE_OP ">." \
+                                             "(average_segment_length:" #AVG_LENGTH         \
+                                             ",long_segments:" #LONG_PERCENT "%)")          \
+                                     .c_str(),                                              \
+                                 &Benchmark<T, REDUCE_OP>::run,                             \
+                                 size / AVG_LENGTH,                                         \
+                                 LONG_PERCENT,                                              \
+                                 stream,                                                    \
+                                 size)
+
+#define BENCHMARK_SKEWED_TYPE(type, REDUCE_OP)                                            \
+    CREATE_SKEWED_BENCHMARK(type, 4, 0, REDUCE_OP),                                       \
+        CREATE_SKEWED_BENCHMARK(type, 16, 0, REDUCE_OP),                                  \
+        CREATE_SKEWED_BENCHMARK(type, 16, 1, REDUCE_OP),                                  \
+        CREATE_SKEWED_BENCHMARK(type, 64, 1, REDUCE_OP),                                  \
+        CREATE_SKEWED_BENCHMARK(type, 64, 10, REDUCE_OP)
+
 #define BENCHMARK_TYPE(type, REDUCE_OP)                                           \
     CREATE_BENCHMARK(type, 1, REDUCE_OP), CREATE_BENCHMARK(type, 100, REDUCE_OP), \
         CREATE_BENCHMARK(type, 10000, REDUCE_OP)
@@ -211,6 +385,19 @@ struct Benchmark<T, hipcub::ArgMin>
     BENCHMARK_TYPE(float, REDUCE_OP), BENCHMARK_TYPE(double, REDUCE_OP), \
         BENCHMARK_TYPE(int8_t, REDUCE_OP), BENCHMARK_TYPE(int, REDUCE_OP)
 
+#define CREATE_FIXED_SIZE_BENCHMARK(T, SEGMENT_SIZE, USE_OFFSETS)                         \
+    benchmark::RegisterBenchmark(                                                         \
+        (std::string(USE_OFFSETS ? "device_segmented_reduce_offsets"                      \
+                                 : "device_segmented_reduce_fixed_size")                  \
+         + "<data_type:" #T ",reduce_op:hipcub::Sum>.(segment_size:" #SEGMENT_SIZE ")")   \
+            .c_str(),                                                                     \
+        [=](benchmark::State& state)                                                      \
+        { run_fixed_size_benchmark<T>(state, SEGMENT_SIZE, USE_OFFSETS, stream, size); })
+
+#define BENCHMARK_FIXED_SIZE(type, SEGMENT_SIZE)                                          \
+    CREATE_FIXED_SIZE_BENCHMARK(type, SEGMENT_SIZE, true),                                \
+        CREATE_FIXED_SIZE_BENCHMARK(type, SEGMENT_SIZE, false)
+
 void add_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
                     hipStream_t                                   stream,
                     size_t                                        size)
@@ -228,6 +415,16 @@ void add_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
 #ifdef HIPCUB_ROCPRIM_API
         BENCHMARK_TYPE(custom_double2, hipcub::ArgMin),
 #endif
+        BENCHMARK_SKEWED_TYPE(float, hipcub::ArgMin),
+        BENCHMARK_SKEWED_TYPE(int, hipcub::ArgMin),
+        BENCHMARK_SKEWED_TYPE(double, hipcub::ArgMax),
+        BENCHMARK_SKEWED_TYPE(int8_t, hipcub::ArgMax),
+        BENCHMARK_FIXED_SIZE(float, 4),
+        BENCHMARK_FIXED_SIZE(float, 16),
+        BENCHMARK_FIXED_SIZE(float, 64),
+        BENCHMARK_FIXED_SIZE(float, 1024),
+        BENCHMARK_FIXED_SIZE(int8_t, 32),
+        BENCHMARK_FIXED_SIZE(double, 32),
     };
 
     benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
@@ -0,0 +1,228 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "common_benchmark_header.hpp"
+
+// HIP API
+#include "hipcub/hipcub.hpp"
+
+#ifndef DEFAULT_N
+const size_t DEFAULT_N = 1024 * 1024 * 32;
+#endif
+
+const unsigned int batch_size  = 4;
+const unsigned int warmup_size = 2;
+
+// Runs either DeviceSegmentedScan on the offsets or DeviceScan::InclusiveSumByKey on the
+// equivalent materialized segment ids, the cost of building the keys is not included.
+template<class T>
+void run_segmented_scan_benchmark(benchmark::State& state,
+                                  size_t            desired_segments,
+                                  bool              use_keys,
+                                  hipStream_t       stream,
+                                  size_t            size)
+{
+    using offset_type = int;
+    using value_type  = T;
+
+    std::vector<offset_type> offsets;
+    std::vector<offset_type> keys(size);
+
+    const double avg_segment_length = static_cast<double>(size) / desired_segments;
+
+    std::random_device         rd;
+    std::default_random_engine gen(rd());
+
+    std::uniform_real_distribution<double> segment_length_dis(0, avg_segment_length * 2);
+
+    unsigned int segments_count = 0;
+    size_t       offset         = 0;
+    while(offset < size)
+    {
+        const size_t segment_length = std::round(segment_length_dis(gen));
+        const size_t end            = std::min(size, offset + segment_length);
+        std::fill(keys.begin() + offset, keys.begin() + end, segments_count);
+        offsets.push_back(offset);
+        ++segments_count;
+        offset = end;
+    }
+    offsets.push_back(size);
+
+    std::vector<value_type> values_input
+        = benchmark_utils::get_random_data<value_type>(size, value_type(0), value_type(100));
+
+    offset_type* d_offsets;
+    HIP_CHECK(hipMalloc(&d_offsets, (segments_count + 1) * sizeof(offset_type)));
+    HIP_CHECK(hipMemcpy(d_offsets,
+                        offsets.data(),
+                        (segments_count + 1) * sizeof(offset_type),
+                        hipMemcpyHostToDevice));
+
+    offset_type* d_keys;
+    HIP_CHECK(hipMalloc(&d_keys, size * sizeof(offset_type)));
+    HIP_CHECK(hipMemcpy(d_keys, keys.data(), size * sizeof(offset_type), hipMemcpyHostToDevice));
+
+    value_type* d_values_input;
+    value_type* d_values_output;
+    HIP_CHECK(hipMalloc(&d_values_input, size * sizeof(value_type)));
+    HIP_CHECK(hipMalloc(&d_values_output, size * sizeof(value_type)));
+    HIP_CHECK(hipMemcpy(d_values_input,
+                        values_input.data(),
+                        size * sizeof(value_type),
+                        hipMemcpyHostToDevice));
+
+    auto dispatch = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+    {
+        if(use_keys)
+        {
+            return hipcub::DeviceScan::InclusiveSumByKey(d_temporary_storage,
+                                                         temporary_storage_bytes,
+                                                         d_keys,
+                                                         d_values_input,
+                                                         d_values_output,
+                                                         static_cast<int>(size),
+                                                         hipcub::Equality(),
+                                                         stream);
+        }
+        return hipcub::DeviceSegmentedScan::InclusiveSum(d_temporary_storage,
+                                                         temporary_storage_bytes,
+                                                         d_values_input,
+                                                         d_values_output,
+                                                         segments_count,
+                                                         d_offsets,
+                                                         d_offsets + 1,
+                                                         stream);
+    };
+
+    void*  d_temporary_storage     = nullptr;
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; ++i)
+    {
+        HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; ++i)
+        {
+            HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(value_type));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_offsets));
+    HIP_CHECK(hipFree(d_keys));
+    HIP_CHECK(hipFree(d_values_input));
+    HIP_CHECK(hipFree(d_values_output));
+}
+
+#define CREATE_SEGMENTED_SCAN_BENCHMARK(T, SEGMENTS, USE_KEYS)                            \
+    benchmark::RegisterBenchmark(                                                         \
+        (std::string(USE_KEYS ? "device_inclusive_sum_by_key" : "device_segmented_scan")  \
+         + "<data_type:" #T ">.(number_of_segments:~" + std::to_string(SEGMENTS)          \
+         + " segments)")                                                                  \
+            .c_str(),                                                                     \
+        [=](benchmark::State& state)                                                      \
+        { run_segmented_scan_benchmark<T>(state, SEGMENTS, USE_KEYS, stream, size); })
+
+#define BENCHMARK_TYPE(type, SEGMENTS)                                                    \
+    CREATE_SEGMENTED_SCAN_BENCHMARK(type, SEGMENTS, true),                                \
+        CREATE_SEGMENTED_SCAN_BENCHMARK(type, SEGMENTS, false)
+
+void add_segmented_scan_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                                   hipStream_t                                   stream,
+                                   size_t                                        size)
+{
+    std::vector<benchmark::internal::Benchmark*> bs = {
+        BENCHMARK_TYPE(float, 100),
+        BENCHMARK_TYPE(float, 10000),
+        BENCHMARK_TYPE(float, 1000000),
+        BENCHMARK_TYPE(int, 1000),
+        BENCHMARK_TYPE(int, 4000000),
+        BENCHMARK_TYPE(double, 100000),
+    };
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t size   = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+
+    std::cout << "benchmark_device_segmented_scan" << std::endl;
+
+    // HIP
+    hipStream_t     stream = 0; // default
+    hipDeviceProp_t devProp;
+    int             device_id = 0;
+    HIP_CHECK(hipGetDevice(&device_id));
+    HIP_CHECK(hipGetDeviceProperties(&devProp, device_id));
+    std::cout << "[HIP] Device name: " << devProp.name << std::endl;
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+    add_segmented_scan_benchmarks(benchmarks, stream, size);
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
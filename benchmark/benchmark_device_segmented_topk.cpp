@@ -0,0 +1,230 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "common_benchmark_header.hpp"
+
+// HIP API
+#include "hipcub/hipcub.hpp"
+
+#ifndef DEFAULT_N
+const size_t DEFAULT_N = 1024 * 1024 * 32;
+#endif
+
+const unsigned int batch_size  = 4;
+const unsigned int warmup_size = 2;
+
+// Runs either DeviceSegmentedTopK or the segmented sort it replaces, the gather after the sort
+// is not included so the baseline is a lower bound.
+template<class Key>
+void run_topk_benchmark(benchmark::State& state,
+                        size_t            desired_segments,
+                        int               k,
+                        bool              use_sort,
+                        hipStream_t       stream,
+                        size_t            size)
+{
+    using offset_type = int;
+    using key_type    = Key;
+
+    std::vector<offset_type> offsets;
+
+    const double avg_segment_length = static_cast<double>(size) / desired_segments;
+
+    std::random_device         rd;
+    std::default_random_engine gen(rd());
+
+    std::uniform_real_distribution<double> segment_length_dis(0, avg_segment_length * 2);
+
+    unsigned int segments_count = 0;
+    size_t       offset         = 0;
+    while(offset < size)
+    {
+        const size_t segment_length = std::round(segment_length_dis(gen));
+        offsets.push_back(offset);
+        ++segments_count;
+        offset += segment_length;
+    }
+    offsets.push_back(size);
+
+    std::vector<key_type> keys_input = benchmark_utils::get_random_data<key_type>(
+        size,
+        benchmark_utils::generate_limits<key_type>::min(),
+        benchmark_utils::generate_limits<key_type>::max());
+
+    const size_t output_size
+        = use_sort ? size : static_cast<size_t>(segments_count) * static_cast<size_t>(k);
+
+    offset_type* d_offsets;
+    HIP_CHECK(hipMalloc(&d_offsets, (segments_count + 1) * sizeof(offset_type)));
+    HIP_CHECK(hipMemcpy(d_offsets,
+                        offsets.data(),
+                        (segments_count + 1) * sizeof(offset_type),
+                        hipMemcpyHostToDevice));
+
+    key_type* d_keys_input;
+    key_type* d_keys_output;
+    HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_keys_output, output_size * sizeof(key_type)));
+    HIP_CHECK(
+        hipMemcpy(d_keys_input, keys_input.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+
+    auto dispatch = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+    {
+        if(use_sort)
+        {
+            return hipcub::DeviceSegmentedSort::SortKeysDescending(d_temporary_storage,
+                                                                   temporary_storage_bytes,
+                                                                   d_keys_input,
+                                                                   d_keys_output,
+                                                                   size,
+                                                                   segments_count,
+                                                                   d_offsets,
+                                                                   d_offsets + 1,
+                                                                   stream);
+        }
+        return hipcub::DeviceSegmentedTopK::MaxKeys(d_temporary_storage,
+                                                    temporary_storage_bytes,
+                                                    d_keys_input,
+                                                    d_keys_output,
+                                                    size,
+                                                    segments_count,
+                                                    d_offsets,
+                                                    d_offsets + 1,
+                                                    k,
+                                                    stream);
+    };
+
+    void*  d_temporary_storage     = nullptr;
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; ++i)
+    {
+        HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; ++i)
+        {
+            HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(key_type));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_offsets));
+    HIP_CHECK(hipFree(d_keys_input));
+    HIP_CHECK(hipFree(d_keys_output));
+}
+
+#define CREATE_TOPK_BENCHMARK(Key, SEGMENTS, K, USE_SORT)                                 \
+    benchmark::RegisterBenchmark(                                                         \
+        (std::string(USE_SORT ? "device_segmented_sort_keys" : "device_segmented_topk")   \
+         + "<key_data_type:" #Key ",k:" #K ">.(number_of_segments:~"                      \
+         + std::to_string(SEGMENTS) + " segments)")                                       \
+            .c_str(),                                                                     \
+        [=](benchmark::State& state)                                                      \
+        { run_topk_benchmark<Key>(state, SEGMENTS, K, USE_SORT, stream, size); })
+
+#define BENCHMARK_KEY_TYPE(type, SEGMENTS)                                                \
+    CREATE_TOPK_BENCHMARK(type, SEGMENTS, 0, true),                                       \
+        CREATE_TOPK_BENCHMARK(type, SEGMENTS, 1, false),                                  \
+        CREATE_TOPK_BENCHMARK(type, SEGMENTS, 8, false),                                  \
+        CREATE_TOPK_BENCHMARK(type, SEGMENTS, 100, false)
+
+void add_topk_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                         hipStream_t                                   stream,
+                         size_t                                        size)
+{
+    std::vector<benchmark::internal::Benchmark*> bs = {
+        BENCHMARK_KEY_TYPE(float, 1000),
+        BENCHMARK_KEY_TYPE(float, 100000),
+        BENCHMARK_KEY_TYPE(float, 2000000),
+        BENCHMARK_KEY_TYPE(int, 1000),
+        BENCHMARK_KEY_TYPE(int, 2000000),
+        BENCHMARK_KEY_TYPE(uint8_t, 100000),
+        BENCHMARK_KEY_TYPE(double, 100000),
+    };
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t size   = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+
+    std::cout << "benchmark_device_segmented_topk" << std::endl;
+
+    // HIP
+    hipStream_t     stream = 0; // default
+    hipDeviceProp_t devProp;
+    int             device_id = 0;
+    HIP_CHECK(hipGetDevice(&device_id));
+    HIP_CHECK(hipGetDeviceProperties(&devProp, device_id));
+    std::cout << "[HIP] Device name: " << devProp.name << std::endl;
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+    add_topk_benchmarks(benchmarks, stream, size);
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
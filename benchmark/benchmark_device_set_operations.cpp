@@ -0,0 +1,302 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "common_benchmark_header.hpp"
+
+// HIP API
+#include "hipcub/hipcub.hpp"
+
+#ifndef DEFAULT_N
+const size_t DEFAULT_N = 1024 * 1024 * 32;
+#endif
+
+const unsigned int batch_size  = 4;
+const unsigned int warmup_size = 2;
+
+struct less_op
+{
+    template<class T>
+    __host__ __device__ bool operator()(const T& a, const T& b) const
+    {
+        return a < b;
+    }
+};
+
+enum class set_algorithm
+{
+    merge_sort_unique,
+    intersection,
+    set_union,
+    difference,
+    symmetric_difference
+};
+
+// Both sequences have size / 2 items. The baseline is the previous way of intersecting sorted
+// key lists: sort the concatenation of both and compact it with DeviceSelect::Unique.
+template<class Key>
+void run_set_operation_benchmark(benchmark::State& state,
+                                 set_algorithm     algorithm,
+                                 hipStream_t       stream,
+                                 size_t            size)
+{
+    using key_type = Key;
+
+    const size_t size1 = size / 2;
+    const size_t size2 = size - size1;
+
+    std::vector<key_type> keys_input = benchmark_utils::get_random_data<key_type>(
+        size,
+        benchmark_utils::generate_limits<key_type>::min(),
+        benchmark_utils::generate_limits<key_type>::max());
+    std::sort(keys_input.begin(), keys_input.begin() + size1);
+    std::sort(keys_input.begin() + size1, keys_input.end());
+
+    key_type*     d_keys_input;
+    key_type*     d_keys_sorted;
+    key_type*     d_keys_output;
+    unsigned int* d_num_selected;
+    HIP_CHECK(hipMalloc(&d_keys_input, size * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_keys_sorted, size * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_keys_output, size * sizeof(key_type)));
+    HIP_CHECK(hipMalloc(&d_num_selected, sizeof(unsigned int)));
+    HIP_CHECK(
+        hipMemcpy(d_keys_input, keys_input.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+
+    const key_type* d_keys1 = d_keys_input;
+    const key_type* d_keys2 = d_keys_input + size1;
+
+    auto dispatch = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+    {
+        switch(algorithm)
+        {
+            case set_algorithm::merge_sort_unique:
+            {
+                size_t     sort_bytes   = 0;
+                size_t     unique_bytes = 0;
+                hipError_t error        = hipcub::DeviceMergeSort::SortKeysCopy(nullptr,
+                                                                         sort_bytes,
+                                                                         d_keys_input,
+                                                                         d_keys_sorted,
+                                                                         size,
+                                                                         less_op(),
+                                                                         stream);
+                if(error != hipSuccess)
+                {
+                    return error;
+                }
+                error = hipcub::DeviceSelect::Unique(nullptr,
+                                                     unique_bytes,
+                                                     d_keys_sorted,
+                                                     d_keys_output,
+                                                     d_num_selected,
+                                                     size,
+                                                     stream);
+                if(error != hipSuccess || d_temporary_storage == nullptr)
+                {
+                    temporary_storage_bytes = std::max(sort_bytes, unique_bytes);
+                    return error;
+                }
+                error = hipcub::DeviceMergeSort::SortKeysCopy(d_temporary_storage,
+                                                              sort_bytes,
+                                                              d_keys_input,
+                                                              d_keys_sorted,
+                                                              size,
+                                                              less_op(),
+                                                              stream);
+                if(error != hipSuccess)
+                {
+                    return error;
+                }
+                return hipcub::DeviceSelect::Unique(d_temporary_storage,
+                                                    unique_bytes,
+                                                    d_keys_sorted,
+                                                    d_keys_output,
+                                                    d_num_selected,
+                                                    size,
+                                                    stream);
+            }
+            case set_algorithm::intersection:
+                return hipcub::DeviceSetOperations::IntersectionKeys(d_temporary_storage,
+                                                                     temporary_storage_bytes,
+                                                                     d_keys1,
+                                                                     size1,
+                                                                     d_keys2,
+                                                                     size2,
+                                                                     d_keys_output,
+                                                                     d_num_selected,
+                                                                     less_op(),
+                                                                     stream);
+            case set_algorithm::set_union:
+                return hipcub::DeviceSetOperations::UnionKeys(d_temporary_storage,
+                                                              temporary_storage_bytes,
+                                                              d_keys1,
+                                                              size1,
+                                                              d_keys2,
+                                                              size2,
+                                                              d_keys_output,
+                                                              d_num_selected,
+                                                              less_op(),
+                                                              stream);
+            case set_algorithm::difference:
+                return hipcub::DeviceSetOperations::DifferenceKeys(d_temporary_storage,
+                                                                   temporary_storage_bytes,
+                                                                   d_keys1,
+                                                                   size1,
+                                                                   d_keys2,
+                                                                   size2,
+                                                                   d_keys_output,
+                                                                   d_num_selected,
+                                                                   less_op(),
+                                                                   stream);
+            case set_algorithm::symmetric_difference:
+            default:
+                return hipcub::DeviceSetOperations::SymmetricDifferenceKeys(
+                    d_temporary_storage,
+                    temporary_storage_bytes,
+                    d_keys1,
+                    size1,
+                    d_keys2,
+                    size2,
+                    d_keys_output,
+                    d_num_selected,
+                    less_op(),
+                    stream);
+        }
+    };
+
+    void*  d_temporary_storage     = nullptr;
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; ++i)
+    {
+        HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; ++i)
+        {
+            HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * size * sizeof(key_type));
+    state.SetItemsProcessed(state.iterations() * batch_size * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_keys_input));
+    HIP_CHECK(hipFree(d_keys_sorted));
+    HIP_CHECK(hipFree(d_keys_output));
+    HIP_CHECK(hipFree(d_num_selected));
+}
+
+#define CREATE_SET_OPERATION_BENCHMARK(Key, ALGORITHM)                                    \
+    benchmark::RegisterBenchmark(                                                         \
+        std::string("device_set_operations_" #ALGORITHM "<key_data_type:" #Key ">")       \
+            .c_str(),                                                                     \
+        [=](benchmark::State& state)                                                      \
+        {                                                                                 \
+            run_set_operation_benchmark<Key>(state,                                       \
+                                             set_algorithm::ALGORITHM,                    \
+                                             stream,                                      \
+                                             size);                                       \
+        })
+
+#define BENCHMARK_KEY_TYPE(type)                                                          \
+    CREATE_SET_OPERATION_BENCHMARK(type, merge_sort_unique),                              \
+        CREATE_SET_OPERATION_BENCHMARK(type, intersection),                               \
+        CREATE_SET_OPERATION_BENCHMARK(type, set_union),                                  \
+        CREATE_SET_OPERATION_BENCHMARK(type, difference),                                 \
+        CREATE_SET_OPERATION_BENCHMARK(type, symmetric_difference)
+
+void add_set_operation_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                                  hipStream_t                                   stream,
+                                  size_t                                        size)
+{
+    std::vector<benchmark::internal::Benchmark*> bs = {
+        BENCHMARK_KEY_TYPE(int),
+        BENCHMARK_KEY_TYPE(long long),
+        BENCHMARK_KEY_TYPE(uint8_t),
+        BENCHMARK_KEY_TYPE(double),
+    };
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of values");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t size   = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+
+    std::cout << "benchmark_device_set_operations" << std::endl;
+
+    // HIP
+    hipStream_t     stream = 0; // default
+    hipDeviceProp_t devProp;
+    int             device_id = 0;
+    HIP_CHECK(hipGetDevice(&device_id));
+    HIP_CHECK(hipGetDeviceProperties(&devProp, device_id));
+    std::cout << "[HIP] Device name: " << devProp.name << std::endl;
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+    add_set_operation_benchmarks(benchmarks, stream, size);
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
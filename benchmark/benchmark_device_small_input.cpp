@@ -0,0 +1,260 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "common_benchmark_header.hpp"
+
+// HIP API
+#include "hipcub/device/device_radix_sort.hpp"
+#include "hipcub/device/device_reduce.hpp"
+#include "hipcub/device/device_scan.hpp"
+#include "hipcub/device/device_select.hpp"
+
+#include <string>
+#include <vector>
+
+const unsigned int batch_size  = 64;
+const unsigned int warmup_size = 8;
+
+enum class small_input_algorithm
+{
+    reduce_sum,
+    inclusive_sum,
+    select_if,
+    radix_sort_pairs
+};
+
+inline const char* small_input_algorithm_name(small_input_algorithm algorithm)
+{
+    switch(algorithm)
+    {
+        case small_input_algorithm::reduce_sum: return "device_reduce_sum";
+        case small_input_algorithm::inclusive_sum: return "device_inclusive_sum";
+        case small_input_algorithm::select_if: return "device_select_if";
+        case small_input_algorithm::radix_sort_pairs: return "device_radix_sort_pairs";
+    }
+    return "";
+}
+
+template<class T>
+struct less_than_op
+{
+    T limit;
+
+    HIPCUB_HOST_DEVICE bool operator()(const T& value) const
+    {
+        return value < limit;
+    }
+};
+
+// Measures the latency of a single call, every call is followed by a synchronization so the
+// launches of consecutive calls don't overlap. Inputs of up to 2048 items take the single block
+// paths, the larger sizes show the multi-kernel dispatch for comparison.
+template<class T>
+void run_benchmark(benchmark::State&     state,
+                   small_input_algorithm algorithm,
+                   hipStream_t           stream,
+                   size_t                size)
+{
+    using value_type = unsigned int;
+
+    std::vector<T> input
+        = benchmark_utils::get_random_data<T>(size,
+                                              benchmark_utils::generate_limits<T>::min(),
+                                              benchmark_utils::generate_limits<T>::max());
+    std::vector<value_type> values(size);
+    for(size_t i = 0; i < size; i++)
+    {
+        values[i] = static_cast<value_type>(i);
+    }
+    const T limit = input[size / 2];
+
+    T*            d_input;
+    T*            d_output;
+    value_type*   d_values_input;
+    value_type*   d_values_output;
+    unsigned int* d_selected_count_output;
+    HIP_CHECK(hipMalloc(&d_input, size * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_output, size * sizeof(T)));
+    HIP_CHECK(hipMalloc(&d_values_input, size * sizeof(value_type)));
+    HIP_CHECK(hipMalloc(&d_values_output, size * sizeof(value_type)));
+    HIP_CHECK(hipMalloc(&d_selected_count_output, sizeof(unsigned int)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_values_input,
+                        values.data(),
+                        size * sizeof(value_type),
+                        hipMemcpyHostToDevice));
+
+    auto dispatch = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+    {
+        switch(algorithm)
+        {
+            case small_input_algorithm::reduce_sum:
+                return hipcub::DeviceReduce::Sum(d_temporary_storage,
+                                                 temporary_storage_bytes,
+                                                 d_input,
+                                                 d_output,
+                                                 size,
+                                                 stream);
+            case small_input_algorithm::inclusive_sum:
+                return hipcub::DeviceScan::InclusiveSum(d_temporary_storage,
+                                                        temporary_storage_bytes,
+                                                        d_input,
+                                                        d_output,
+                                                        size,
+                                                        stream);
+            case small_input_algorithm::select_if:
+                return hipcub::DeviceSelect::If(d_temporary_storage,
+                                                temporary_storage_bytes,
+                                                d_input,
+                                                d_output,
+                                                d_selected_count_output,
+                                                size,
+                                                less_than_op<T>{limit},
+                                                stream);
+            case small_input_algorithm::radix_sort_pairs:
+                return hipcub::DeviceRadixSort::SortPairs(d_temporary_storage,
+                                                          temporary_storage_bytes,
+                                                          d_input,
+                                                          d_output,
+                                                          d_values_input,
+                                                          d_values_output,
+                                                          size,
+                                                          0,
+                                                          static_cast<int>(sizeof(T) * 8),
+                                                          stream);
+        }
+        return hipErrorInvalidValue;
+    };
+
+    void*  d_temporary_storage     = nullptr;
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; ++i)
+    {
+        HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; ++i)
+        {
+            HIP_CHECK(dispatch(d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipStreamSynchronize(stream));
+        }
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count() / batch_size);
+    }
+    state.SetBytesProcessed(state.iterations() * size * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * size);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_values_input));
+    HIP_CHECK(hipFree(d_values_output));
+    HIP_CHECK(hipFree(d_selected_count_output));
+}
+
+#define CREATE_BENCHMARK(T, ALGORITHM, SIZE)                                              \
+    benchmark::RegisterBenchmark(                                                         \
+        (std::string(small_input_algorithm_name(small_input_algorithm::ALGORITHM))        \
+         + "<data_type:" #T ">.(size:" #SIZE ")")                                         \
+            .c_str(),                                                                     \
+        [=](benchmark::State& state)                                                      \
+        { run_benchmark<T>(state, small_input_algorithm::ALGORITHM, stream, SIZE); })
+
+#define BENCHMARK_SIZES(T, ALGORITHM)                                                     \
+    CREATE_BENCHMARK(T, ALGORITHM, 1), CREATE_BENCHMARK(T, ALGORITHM, 16),                \
+        CREATE_BENCHMARK(T, ALGORITHM, 256), CREATE_BENCHMARK(T, ALGORITHM, 1024),        \
+        CREATE_BENCHMARK(T, ALGORITHM, 2048), CREATE_BENCHMARK(T, ALGORITHM, 4096),       \
+        CREATE_BENCHMARK(T, ALGORITHM, 16384), CREATE_BENCHMARK(T, ALGORITHM, 65536)
+
+void add_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                    hipStream_t                                   stream)
+{
+    std::vector<benchmark::internal::Benchmark*> bs = {
+        BENCHMARK_SIZES(int, reduce_sum),
+        BENCHMARK_SIZES(float, reduce_sum),
+        BENCHMARK_SIZES(int, inclusive_sum),
+        BENCHMARK_SIZES(float, inclusive_sum),
+        BENCHMARK_SIZES(int, select_if),
+        BENCHMARK_SIZES(int, radix_sort_pairs),
+        BENCHMARK_SIZES(float, radix_sort_pairs),
+    };
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const int trials = parser.get<int>("trials");
+
+    std::cout << "benchmark_device_small_input" << std::endl;
+
+    // HIP
+    hipStream_t     stream = 0; // default
+    hipDeviceProp_t devProp;
+    int             device_id = 0;
+    HIP_CHECK(hipGetDevice(&device_id));
+    HIP_CHECK(hipGetDeviceProperties(&devProp, device_id));
+    std::cout << "[HIP] Device name: " << devProp.name << std::endl;
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+    add_benchmarks(benchmarks, stream);
+
+    // Use manual timing, the sizes are small enough to report microseconds per call
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMicrosecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -0,0 +1,208 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "common_benchmark_header.hpp"
+
+// HIP API
+#include "hipcub/hipcub.hpp"
+
+#ifndef DEFAULT_N
+const size_t DEFAULT_N = 1024 * 1024 * 32;
+#endif
+
+const unsigned int batch_size  = 4;
+const unsigned int warmup_size = 2;
+
+// Sorts strings that start with one of 16 random prefixes of PrefixLength characters followed by
+// a random suffix of up to SuffixLength characters. Long shared prefixes take more refinement
+// levels. size is the total number of characters.
+template<unsigned int PrefixLength, unsigned int SuffixLength>
+void run_string_sort_benchmark(benchmark::State& state, hipStream_t stream, size_t size)
+{
+    using offset_type = unsigned int;
+    using index_type  = unsigned int;
+
+    const size_t num_strings = std::max<size_t>(size / (PrefixLength + SuffixLength / 2 + 1), 1);
+
+    std::random_device                          rd;
+    std::default_random_engine                  gen(rd());
+    std::uniform_int_distribution<unsigned int> char_dis('a', 'z');
+    std::uniform_int_distribution<unsigned int> suffix_dis(0, SuffixLength);
+    std::uniform_int_distribution<unsigned int> prefix_dis(0, 15);
+
+    std::vector<std::string> prefixes(16);
+    for(auto& prefix : prefixes)
+    {
+        for(unsigned int c = 0; c < PrefixLength; c++)
+        {
+            prefix.push_back(static_cast<char>(char_dis(gen)));
+        }
+    }
+
+    std::vector<char>        chars;
+    std::vector<offset_type> offsets(num_strings + 1, 0);
+    for(size_t i = 0; i < num_strings; i++)
+    {
+        const std::string& prefix = prefixes[prefix_dis(gen)];
+        chars.insert(chars.end(), prefix.begin(), prefix.end());
+        const unsigned int suffix_length = suffix_dis(gen);
+        for(unsigned int c = 0; c < suffix_length; c++)
+        {
+            chars.push_back(static_cast<char>(char_dis(gen)));
+        }
+        offsets[i + 1] = static_cast<offset_type>(chars.size());
+    }
+
+    char*        d_chars;
+    offset_type* d_offsets;
+    index_type*  d_indices;
+    HIP_CHECK(hipMalloc(&d_chars, std::max<size_t>(chars.size(), 1)));
+    HIP_CHECK(hipMalloc(&d_offsets, (num_strings + 1) * sizeof(offset_type)));
+    HIP_CHECK(hipMalloc(&d_indices, num_strings * sizeof(index_type)));
+    HIP_CHECK(hipMemcpy(d_chars, chars.data(), chars.size(), hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_offsets,
+                        offsets.data(),
+                        (num_strings + 1) * sizeof(offset_type),
+                        hipMemcpyHostToDevice));
+
+    void*  d_temporary_storage     = nullptr;
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(hipcub::DeviceStringSort::ArgSort(d_temporary_storage,
+                                                temporary_storage_bytes,
+                                                d_chars,
+                                                d_offsets,
+                                                d_indices,
+                                                static_cast<int>(num_strings),
+                                                stream));
+
+    HIP_CHECK(hipMalloc(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Warm-up
+    for(size_t i = 0; i < warmup_size; ++i)
+    {
+        HIP_CHECK(hipcub::DeviceStringSort::ArgSort(d_temporary_storage,
+                                                    temporary_storage_bytes,
+                                                    d_chars,
+                                                    d_offsets,
+                                                    d_indices,
+                                                    static_cast<int>(num_strings),
+                                                    stream));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        for(size_t i = 0; i < batch_size; ++i)
+        {
+            HIP_CHECK(hipcub::DeviceStringSort::ArgSort(d_temporary_storage,
+                                                        temporary_storage_bytes,
+                                                        d_chars,
+                                                        d_offsets,
+                                                        d_indices,
+                                                        static_cast<int>(num_strings),
+                                                        stream));
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds
+            = std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+    }
+    state.SetBytesProcessed(state.iterations() * batch_size * chars.size());
+    state.SetItemsProcessed(state.iterations() * batch_size * num_strings);
+
+    HIP_CHECK(hipFree(d_temporary_storage));
+    HIP_CHECK(hipFree(d_chars));
+    HIP_CHECK(hipFree(d_offsets));
+    HIP_CHECK(hipFree(d_indices));
+}
+
+#define CREATE_STRING_SORT_BENCHMARK(PREFIX, SUFFIX)                                           \
+    benchmark::RegisterBenchmark(                                                              \
+        std::string("device_string_sort<prefix_length:" #PREFIX ",suffix_length:" #SUFFIX ">") \
+            .c_str(),                                                                          \
+        [=](benchmark::State& state)                                                           \
+        { run_string_sort_benchmark<PREFIX, SUFFIX>(state, stream, size); })
+
+void add_string_sort_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                                hipStream_t                                   stream,
+                                size_t                                        size)
+{
+    std::vector<benchmark::internal::Benchmark*> bs = {
+        CREATE_STRING_SORT_BENCHMARK(0, 8),
+        CREATE_STRING_SORT_BENCHMARK(0, 32),
+        CREATE_STRING_SORT_BENCHMARK(8, 16),
+        CREATE_STRING_SORT_BENCHMARK(32, 16),
+    };
+    benchmarks.insert(benchmarks.end(), bs.begin(), bs.end());
+}
+
+int main(int argc, char* argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<size_t>("size", "size", DEFAULT_N, "number of characters");
+    parser.set_optional<int>("trials", "trials", -1, "number of iterations");
+    parser.run_and_exit_if_error();
+
+    // Parse argv
+    benchmark::Initialize(&argc, argv);
+    const size_t size   = parser.get<size_t>("size");
+    const int    trials = parser.get<int>("trials");
+
+    std::cout << "benchmark_device_string_sort" << std::endl;
+
+    // HIP
+    hipStream_t     stream = 0; // default
+    hipDeviceProp_t devProp;
+    int             device_id = 0;
+    HIP_CHECK(hipGetDevice(&device_id));
+    HIP_CHECK(hipGetDeviceProperties(&devProp, device_id));
+    std::cout << "[HIP] Device name: " << devProp.name << std::endl;
+
+    // Add benchmarks
+    std::vector<benchmark::internal::Benchmark*> benchmarks;
+    add_string_sort_benchmarks(benchmarks, stream, size);
+
+    // Use manual timing
+    for(auto& b : benchmarks)
+    {
+        b->UseManualTime();
+        b->Unit(benchmark::kMillisecond);
+    }
+
+    // Force number of iterations
+    if(trials > 0)
+    {
+        for(auto& b : benchmarks)
+        {
+            b->Iterations(trials);
+        }
+    }
+
+    // Run benchmarks
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
@@ -0,0 +1,363 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HIPCUB_CUB_AGENT_AGENT_FIXED_SEGMENT_HPP_
+#define HIPCUB_CUB_AGENT_AGENT_FIXED_SEGMENT_HPP_
+
+#include "../../../config.hpp"
+
+#include "agent_single_block.hpp"
+
+#include <cub/block/block_radix_sort.cuh>
+#include <cub/util_type.cuh>
+#include <cub/warp/warp_reduce.cuh>
+
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace detail
+{
+
+/// Begin offset of every segment computed from its index, used with a counting iterator in
+/// place of the offset arrays.
+template<class OffsetT>
+struct fixed_segment_offset_op
+{
+    OffsetT segment_size;
+
+    HIPCUB_HOST_DEVICE HIPCUB_FORCEINLINE OffsetT operator()(OffsetT segment) const
+    {
+        return segment * segment_size;
+    }
+};
+
+static constexpr unsigned int fixed_segment_reduce_block_size = 256;
+/// Segments of at most \p fixed_segment_reduce_warp_max_size items are reduced by logical warps
+/// of 4, 16 or 32 threads depending on the segment size, larger ones by the block per segment
+/// kernel of \p cub::DeviceSegmentedReduce.
+static constexpr int          fixed_segment_reduce_warp_max_size = 1024;
+static constexpr unsigned int fixed_segment_reduce_vector_bytes  = 16;
+
+template<class T, unsigned int ItemsPerVector>
+struct alignas(sizeof(T) * ItemsPerVector) fixed_segment_vector
+{
+    T items[ItemsPerVector];
+};
+
+/// Number of items loaded at once by a lane when the segments are aligned, 1 if the input is not
+/// a pointer to items which fit evenly into a vector.
+template<class InputIteratorT>
+struct fixed_segment_vector_items
+{
+    using input_type = typename std::iterator_traits<InputIteratorT>::value_type;
+    static constexpr bool vectorizable
+        = std::is_pointer<InputIteratorT>::value
+          && fixed_segment_reduce_vector_bytes % sizeof(input_type) == 0
+          && sizeof(input_type) < fixed_segment_reduce_vector_bytes;
+    static constexpr unsigned int value
+        = vectorizable ? fixed_segment_reduce_vector_bytes / sizeof(input_type) : 1;
+};
+
+template<class T>
+inline bool fixed_segment_is_aligned(T* input)
+{
+    return reinterpret_cast<uintptr_t>(input) % fixed_segment_reduce_vector_bytes == 0;
+}
+
+template<class InputIteratorT>
+inline bool fixed_segment_is_aligned(InputIteratorT /*input*/)
+{
+    return false;
+}
+
+template<class AccT, class InputIteratorT, class ReduceOpT>
+HIPCUB_DEVICE HIPCUB_FORCEINLINE AccT
+    fixed_segment_reduce_lane(InputIteratorT input,
+                              unsigned int   first,
+                              unsigned int   size,
+                              unsigned int   stride,
+                              ReduceOpT      reduce_op,
+                              std::integral_constant<unsigned int, 1>)
+{
+    AccT lane_aggregate = static_cast<AccT>(input[first]);
+    for(unsigned int i = first + stride; i < size; i += stride)
+    {
+        lane_aggregate = reduce_op(lane_aggregate, static_cast<AccT>(input[i]));
+    }
+    return lane_aggregate;
+}
+
+/// Loads whole vectors, \p first and \p size count vectors instead of items. Only takes
+/// vectors of more than one item so a <tt>const T*</tt> with one item per vector picks the
+/// overload above.
+template<class AccT, class T, class ReduceOpT, unsigned int ItemsPerVector>
+HIPCUB_DEVICE HIPCUB_FORCEINLINE auto
+    fixed_segment_reduce_lane(const T*     input,
+                              unsigned int first,
+                              unsigned int size,
+                              unsigned int stride,
+                              ReduceOpT    reduce_op,
+                              std::integral_constant<unsigned int, ItemsPerVector>)
+        -> std::enable_if_t<(ItemsPerVector > 1), AccT>
+{
+    using vector_type = fixed_segment_vector<T, ItemsPerVector>;
+
+    const vector_type* vectors        = reinterpret_cast<const vector_type*>(input);
+    vector_type        vector         = vectors[first];
+    AccT               lane_aggregate = static_cast<AccT>(vector.items[0]);
+    for(unsigned int item = 1; item < ItemsPerVector; item++)
+    {
+        lane_aggregate = reduce_op(lane_aggregate, static_cast<AccT>(vector.items[item]));
+    }
+    for(unsigned int i = first + stride; i < size; i += stride)
+    {
+        vector = vectors[i];
+        for(unsigned int item = 0; item < ItemsPerVector; item++)
+        {
+            lane_aggregate = reduce_op(lane_aggregate, static_cast<AccT>(vector.items[item]));
+        }
+    }
+    return lane_aggregate;
+}
+
+/// Every logical warp of \p WarpThreads reduces one segment starting at
+/// <tt>segment * segment_size</tt>. With \p ItemsPerVector greater than 1 the segments must be
+/// aligned to whole vectors.
+template<unsigned int WarpThreads,
+         unsigned int ItemsPerVector,
+         class AccT,
+         class InputIteratorT,
+         class OutputIteratorT,
+         class ReduceOpT,
+         class InitT>
+__global__ __launch_bounds__(fixed_segment_reduce_block_size) void fixed_segment_reduce_kernel(
+    InputIteratorT  input,
+    OutputIteratorT output,
+    unsigned int    num_segments,
+    unsigned int    segment_size,
+    ReduceOpT       reduce_op,
+    InitT           init)
+{
+    constexpr unsigned int warps_per_block = fixed_segment_reduce_block_size / WarpThreads;
+    using warp_reduce_type                 = ::cub::WarpReduce<AccT, WarpThreads>;
+
+    __shared__ ::cub::Uninitialized<typename warp_reduce_type::TempStorage>
+        storage[warps_per_block];
+
+    const unsigned int lane    = threadIdx.x % WarpThreads;
+    const unsigned int warp_id = threadIdx.x / WarpThreads;
+    const unsigned int segment = blockIdx.x * warps_per_block + warp_id;
+    if(segment >= num_segments)
+    {
+        return;
+    }
+
+    const unsigned int vectors = segment_size / ItemsPerVector;
+    AccT               lane_aggregate{};
+    if(lane < vectors)
+    {
+        lane_aggregate = fixed_segment_reduce_lane<AccT>(
+            input + static_cast<size_t>(segment) * segment_size,
+            lane,
+            vectors,
+            WarpThreads,
+            reduce_op,
+            std::integral_constant<unsigned int, ItemsPerVector>{});
+    }
+
+    const int  valid_lanes = static_cast<int>(vectors < WarpThreads ? vectors : WarpThreads);
+    const AccT aggregate   = warp_reduce_type(storage[warp_id].Alias())
+                               .Reduce(lane_aggregate, reduce_op, valid_lanes);
+    if(lane == 0)
+    {
+        output[segment] = segment_size > 0 ? reduce_op(static_cast<AccT>(init), aggregate)
+                                           : static_cast<AccT>(init);
+    }
+}
+
+template<unsigned int WarpThreads,
+         unsigned int ItemsPerVector,
+         class AccT,
+         class InputIteratorT,
+         class OutputIteratorT,
+         class ReduceOpT,
+         class InitT>
+inline hipError_t fixed_segment_warp_reduce(InputIteratorT  input,
+                                            OutputIteratorT output,
+                                            int             num_segments,
+                                            int             segment_size,
+                                            ReduceOpT       reduce_op,
+                                            InitT           init,
+                                            hipStream_t     stream)
+{
+    constexpr unsigned int warps_per_block = fixed_segment_reduce_block_size / WarpThreads;
+    const unsigned int     grid_size
+        = (static_cast<unsigned int>(num_segments) + warps_per_block - 1) / warps_per_block;
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(fixed_segment_reduce_kernel<WarpThreads,
+                                                                   ItemsPerVector,
+                                                                   AccT,
+                                                                   InputIteratorT,
+                                                                   OutputIteratorT,
+                                                                   ReduceOpT,
+                                                                   InitT>),
+                       dim3(grid_size),
+                       dim3(fixed_segment_reduce_block_size),
+                       0,
+                       stream,
+                       input,
+                       output,
+                       static_cast<unsigned int>(num_segments),
+                       static_cast<unsigned int>(segment_size),
+                       reduce_op,
+                       init);
+    return hipGetLastError();
+}
+
+/// Segments of at most \p fixed_segment_sort_warp_max_size keys are sorted by a block of 64
+/// threads, up to \p fixed_segment_sort_block_max_size keys by a block of 256 threads. Larger
+/// segments use \p cub::DeviceSegmentedRadixSort with offsets computed from the segment index.
+static constexpr unsigned int fixed_segment_sort_warp_block_size      = 64;
+static constexpr unsigned int fixed_segment_sort_warp_items_per_thread = 2;
+static constexpr int          fixed_segment_sort_warp_max_size
+    = fixed_segment_sort_warp_block_size * fixed_segment_sort_warp_items_per_thread;
+static constexpr int fixed_segment_sort_block_max_size = single_block_max_items;
+
+/// Every block sorts the segment starting at <tt>segment * segment_size</tt> with a stable block
+/// radix sort, see \p single_block_radix_sort_kernel.
+template<bool         Descending,
+         unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class KeyT,
+         class ValueT>
+__global__ __launch_bounds__(BlockSize) void fixed_segment_radix_sort_kernel(
+    const KeyT*   keys_input,
+    KeyT*         keys_output,
+    const ValueT* values_input,
+    ValueT*       values_output,
+    unsigned int  segment_size,
+    int           begin_bit,
+    int           end_bit)
+{
+    constexpr bool with_values = !std::is_same<ValueT, ::cub::NullType>::value;
+    using block_sort_type      = ::cub::BlockRadixSort<KeyT, BlockSize, ItemsPerThread, ValueT>;
+
+    __shared__ ::cub::Uninitialized<typename block_sort_type::TempStorage> storage;
+
+    const unsigned int flat_id = threadIdx.x;
+    const unsigned int segment = blockIdx.x;
+    const size_t       offset  = static_cast<size_t>(segment) * segment_size;
+    const KeyT         padding = single_block_radix_sort_padding<Descending, KeyT>();
+
+    KeyT   keys[ItemsPerThread];
+    ValueT values[ItemsPerThread];
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        const unsigned int i = flat_id * ItemsPerThread + item;
+        keys[item]           = i < segment_size ? keys_input[offset + i] : padding;
+        if(with_values && i < segment_size)
+        {
+            values[item] = values_input[offset + i];
+        }
+    }
+
+    block_sort_type block_sort(storage.Alias());
+    single_block_radix_sort_items<Descending>(block_sort, keys, values, begin_bit, end_bit);
+
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        const unsigned int i = item * BlockSize + flat_id;
+        if(i < segment_size)
+        {
+            keys_output[offset + i] = keys[item];
+            if(with_values)
+            {
+                values_output[offset + i] = values[item];
+            }
+        }
+    }
+}
+
+/// Keys must be \p single_block_sortable.
+template<bool         Descending,
+         unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class KeyT,
+         class ValueT>
+inline auto fixed_segment_block_radix_sort(const KeyT*   keys_input,
+                                           KeyT*         keys_output,
+                                           const ValueT* values_input,
+                                           ValueT*       values_output,
+                                           int           num_segments,
+                                           int           segment_size,
+                                           int           begin_bit,
+                                           int           end_bit,
+                                           hipStream_t   stream)
+    -> std::enable_if_t<single_block_sortable<KeyT>::value, hipError_t>
+{
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(fixed_segment_radix_sort_kernel<Descending,
+                                                                       BlockSize,
+                                                                       ItemsPerThread,
+                                                                       KeyT,
+                                                                       ValueT>),
+                       dim3(num_segments),
+                       dim3(BlockSize),
+                       0,
+                       stream,
+                       keys_input,
+                       keys_output,
+                       values_input,
+                       values_output,
+                       static_cast<unsigned int>(segment_size),
+                       begin_bit,
+                       end_bit);
+    return hipGetLastError();
+}
+
+// Never called, the callers check single_block_sortable first
+template<bool         Descending,
+         unsigned int BlockSize,
+         unsigned int ItemsPerThread,
+         class KeyT,
+         class ValueT>
+inline auto fixed_segment_block_radix_sort(const KeyT*,
+                                           KeyT*,
+                                           const ValueT*,
+                                           ValueT*,
+                                           int,
+                                           int,
+                                           int,
+                                           int,
+                                           hipStream_t)
+    -> std::enable_if_t<!single_block_sortable<KeyT>::value, hipError_t>
+{
+    return hipErrorInvalidValue;
+}
+
+} // namespace detail
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_CUB_AGENT_AGENT_FIXED_SEGMENT_HPP_
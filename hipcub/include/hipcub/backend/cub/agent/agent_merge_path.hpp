@@ -0,0 +1,64 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HIPCUB_CUB_AGENT_AGENT_MERGE_PATH_HPP_
+#define HIPCUB_CUB_AGENT_AGENT_MERGE_PATH_HPP_
+
+#include "../../../config.hpp"
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace detail
+{
+
+/// Returns how many items of \p a precede \p diagonal on the merge path of \p a and \p b. Equal
+/// items of \p a are placed before the ones of \p b, which keeps the merge stable.
+template<class OffsetT, class IteratorAT, class IteratorBT, class CompareOpT>
+HIPCUB_HOST_DEVICE HIPCUB_FORCEINLINE OffsetT merge_path_search(OffsetT    diagonal,
+                                                                IteratorAT a,
+                                                                OffsetT    a_size,
+                                                                IteratorBT b,
+                                                                OffsetT    b_size,
+                                                                CompareOpT compare_op)
+{
+    OffsetT split_min = diagonal > b_size ? diagonal - b_size : 0;
+    OffsetT split_max = diagonal < a_size ? diagonal : a_size;
+    while(split_min < split_max)
+    {
+        const OffsetT split_pivot = split_min + (split_max - split_min) / 2;
+        if(!compare_op(b[diagonal - 1 - split_pivot], a[split_pivot]))
+        {
+            split_min = split_pivot + 1;
+        }
+        else
+        {
+            split_max = split_pivot;
+        }
+    }
+    return split_min;
+}
+
+} // namespace detail
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_CUB_AGENT_AGENT_MERGE_PATH_HPP_
@@ -0,0 +1,501 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef HIPCUB_CUB_AGENT_AGENT_RADIX_SORT_COLUMNS_HPP_
+#define HIPCUB_CUB_AGENT_AGENT_RADIX_SORT_COLUMNS_HPP_
+
+#include "../../../config.hpp"
+
+#include "../util_temporary_storage.hpp"
+
+#include <cub/block/block_reduce.cuh>
+#include <cub/device/device_radix_sort.cuh>
+#include <cub/util_type.cuh>
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+BEGIN_HIPCUB_NAMESPACE
+
+/// \brief One column of a lexicographic sort, see \p DeviceRadixSort::ArgSortColumns.
+///
+/// Integral and floating point columns of up to 8 bytes are supported, the values are compared
+/// like \p DeviceRadixSort compares keys of the same type.
+struct RadixSortColumn
+{
+    const void*   d_data;
+    unsigned char item_bytes;
+    bool          is_signed;
+    bool          is_floating_point;
+    bool          descending;
+
+    RadixSortColumn() = default;
+
+    template<class T>
+    HIPCUB_HOST_DEVICE RadixSortColumn(const T* d_data, bool descending = false)
+        : d_data(d_data)
+        , item_bytes(sizeof(T))
+        , is_signed(::cub::NumericTraits<T>::CATEGORY == ::cub::SIGNED_INTEGER)
+        , is_floating_point(::cub::NumericTraits<T>::CATEGORY == ::cub::FLOATING_POINT)
+        , descending(descending)
+    {
+        static_assert(::cub::NumericTraits<T>::CATEGORY != ::cub::NOT_A_NUMBER && sizeof(T) <= 8,
+                      "Only integral and floating point columns of up to 8 bytes are supported");
+    }
+};
+
+namespace detail
+{
+
+static constexpr unsigned int radix_sort_columns_block_size    = 256;
+static constexpr unsigned int radix_sort_columns_max_columns   = 16;
+static constexpr unsigned int radix_sort_columns_max_grid_size = 1024;
+
+/// Columns are packed into 128-bit keys when they are available, otherwise into 64-bit keys.
+#if CUB_IS_INT128_ENABLED
+using radix_sort_columns_wide_key_type = __uint128_t;
+#else
+using radix_sort_columns_wide_key_type = uint64_t;
+#endif
+static constexpr unsigned int radix_sort_columns_max_key_bits
+    = sizeof(radix_sort_columns_wide_key_type) * 8;
+
+struct radix_sort_columns_params
+{
+    RadixSortColumn columns[radix_sort_columns_max_columns];
+    unsigned int    num_columns;
+};
+
+/// Smallest and largest value of every column, the bits of a column in a composite key are its
+/// value minus the smallest value, or the largest value minus its value when it is descending.
+struct radix_sort_columns_ranges
+{
+    uint64_t     minimums[radix_sort_columns_max_columns];
+    uint64_t     maximums[radix_sort_columns_max_columns];
+    unsigned int bits[radix_sort_columns_max_columns];
+};
+
+/// Returns the value of a column as unsigned bits that compare like the value.
+HIPCUB_DEVICE HIPCUB_FORCEINLINE uint64_t radix_sort_column_bits(const RadixSortColumn& column,
+                                                                 size_t                 row)
+{
+    uint64_t bits;
+    switch(column.item_bytes)
+    {
+        case 1: bits = static_cast<const uint8_t*>(column.d_data)[row]; break;
+        case 2: bits = static_cast<const uint16_t*>(column.d_data)[row]; break;
+        case 4: bits = static_cast<const uint32_t*>(column.d_data)[row]; break;
+        default: bits = static_cast<const uint64_t*>(column.d_data)[row]; break;
+    }
+    const unsigned int item_bits = column.item_bytes * 8u;
+    const uint64_t     sign_bit  = uint64_t(1) << (item_bits - 1);
+    const uint64_t     mask      = sign_bit | (sign_bit - 1);
+    if(column.is_floating_point)
+    {
+        return (bits & sign_bit) ? (~bits & mask) : (bits | sign_bit);
+    }
+    return column.is_signed ? (bits ^ sign_bit) : bits;
+}
+
+/// Every block reduces the range of its rows column by column and merges it with atomics.
+static __global__
+    __launch_bounds__(radix_sort_columns_block_size) void radix_sort_columns_range_kernel(
+    radix_sort_columns_params params, uint64_t* ranges, size_t size)
+{
+    using block_reduce_type = ::cub::BlockReduce<unsigned long long, radix_sort_columns_block_size>;
+
+    __shared__ ::cub::Uninitialized<typename block_reduce_type::TempStorage> storage;
+
+    const unsigned int flat_id = threadIdx.x;
+    const size_t       first_row
+        = static_cast<size_t>(blockIdx.x) * radix_sort_columns_block_size + flat_id;
+    const size_t stride = static_cast<size_t>(gridDim.x) * radix_sort_columns_block_size;
+
+    for(unsigned int column = 0; column < params.num_columns; column++)
+    {
+        unsigned long long minimum = ~0ull;
+        unsigned long long maximum = 0;
+        for(size_t row = first_row; row < size; row += stride)
+        {
+            const uint64_t bits = radix_sort_column_bits(params.columns[column], row);
+            minimum             = bits < minimum ? bits : minimum;
+            maximum             = bits > maximum ? bits : maximum;
+        }
+
+        minimum = block_reduce_type(storage.Alias()).Reduce(minimum, ::cub::Min());
+        __syncthreads();
+        maximum = block_reduce_type(storage.Alias()).Reduce(maximum, ::cub::Max());
+        __syncthreads();
+        if(flat_id == 0)
+        {
+            atomicMin(reinterpret_cast<unsigned long long*>(&ranges[column]), minimum);
+            atomicMax(reinterpret_cast<unsigned long long*>(
+                          &ranges[radix_sort_columns_max_columns + column]),
+                      maximum);
+        }
+    }
+}
+
+/// Packs the columns <tt>[first_column, last_column)</tt> of every row into one key, the first
+/// column in the most significant bits. After the first pass the rows are read in the order of
+/// the current permutation.
+template<class KeyT, class IndexT>
+__global__ __launch_bounds__(radix_sort_columns_block_size) void radix_sort_columns_pack_kernel(
+    radix_sort_columns_params params,
+    radix_sort_columns_ranges ranges,
+    unsigned int              first_column,
+    unsigned int              last_column,
+    const IndexT*             permutation,
+    KeyT*                     keys,
+    size_t                    size)
+{
+    const size_t i = static_cast<size_t>(blockIdx.x) * radix_sort_columns_block_size + threadIdx.x;
+    if(i >= size)
+    {
+        return;
+    }
+
+    const size_t row = permutation == nullptr ? i : static_cast<size_t>(permutation[i]);
+
+    KeyT key = 0;
+    for(unsigned int column = first_column; column < last_column; column++)
+    {
+        const unsigned int bits = ranges.bits[column];
+        if(bits == 0)
+        {
+            continue;
+        }
+        const uint64_t value = radix_sort_column_bits(params.columns[column], row);
+        const uint64_t digit = params.columns[column].descending
+                                   ? ranges.maximums[column] - value
+                                   : value - ranges.minimums[column];
+        key = (bits < sizeof(KeyT) * 8 ? static_cast<KeyT>(key << bits) : KeyT(0))
+              | static_cast<KeyT>(digit);
+    }
+    keys[i] = key;
+}
+
+template<class IndexT>
+__global__ __launch_bounds__(radix_sort_columns_block_size) void radix_sort_columns_sequence_kernel(
+    IndexT* indices, size_t size)
+{
+    const size_t i = static_cast<size_t>(blockIdx.x) * radix_sort_columns_block_size + threadIdx.x;
+    if(i < size)
+    {
+        indices[i] = static_cast<IndexT>(i);
+    }
+}
+
+/// Sorts the permutation by one group of packed columns. CUB reads the values through
+/// pointers, so the first pass sorts a materialized sequence of indices.
+template<class KeyT, class IndexT>
+inline hipError_t radix_sort_columns_pass(void*                            d_sort_storage,
+                                          size_t                           sort_bytes,
+                                          const radix_sort_columns_params& params,
+                                          const radix_sort_columns_ranges& ranges,
+                                          unsigned int                     first_column,
+                                          unsigned int                     last_column,
+                                          unsigned int                     bits,
+                                          const IndexT*                    permutation,
+                                          IndexT*                          indices_output,
+                                          IndexT*                          sequence,
+                                          void*                            keys_input,
+                                          void*                            keys_output,
+                                          size_t                           size,
+                                          hipStream_t                      stream)
+{
+    KeyT*              keys      = static_cast<KeyT*>(keys_input);
+    const unsigned int grid_size = static_cast<unsigned int>(
+        (size + radix_sort_columns_block_size - 1) / radix_sort_columns_block_size);
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(radix_sort_columns_pack_kernel<KeyT, IndexT>),
+                       dim3(grid_size),
+                       dim3(radix_sort_columns_block_size),
+                       0,
+                       stream,
+                       params,
+                       ranges,
+                       first_column,
+                       last_column,
+                       permutation,
+                       keys,
+                       size);
+    hipError_t error = hipGetLastError();
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    if(permutation == nullptr)
+    {
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(radix_sort_columns_sequence_kernel),
+                           dim3(grid_size),
+                           dim3(radix_sort_columns_block_size),
+                           0,
+                           stream,
+                           sequence,
+                           size);
+        error = hipGetLastError();
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        permutation = sequence;
+    }
+    return hipCUDAErrorTohipError(::cub::DeviceRadixSort::SortPairs(d_sort_storage,
+                                                                    sort_bytes,
+                                                                    keys,
+                                                                    static_cast<KeyT*>(keys_output),
+                                                                    permutation,
+                                                                    indices_output,
+                                                                    size,
+                                                                    0,
+                                                                    static_cast<int>(bits),
+                                                                    stream));
+}
+
+template<class KeyT, class IndexT>
+inline hipError_t radix_sort_columns_storage_bytes(size_t& sort_bytes, size_t size)
+{
+    size_t     bytes = 0;
+    hipError_t error
+        = hipCUDAErrorTohipError(::cub::DeviceRadixSort::SortPairs(nullptr,
+                                                                   bytes,
+                                                                   static_cast<KeyT*>(nullptr),
+                                                                   static_cast<KeyT*>(nullptr),
+                                                                   static_cast<IndexT*>(nullptr),
+                                                                   static_cast<IndexT*>(nullptr),
+                                                                   size));
+    sort_bytes = std::max(sort_bytes, bytes);
+    return error;
+}
+
+/// The range of every column is reduced on the device and copied back, which synchronizes the
+/// stream once. The columns are then split into groups of at most
+/// \p radix_sort_columns_max_key_bits significant bits, starting from the first column, and the
+/// groups are sorted from the last to the first with stable radix sorts of their packed keys.
+/// Columns with a single value take no bits and no passes.
+template<class IndexT, class NumItemsT>
+inline hipError_t radix_sort_columns(void*                  d_temp_storage,
+                                     size_t&                temp_storage_bytes,
+                                     const RadixSortColumn* columns,
+                                     int                    num_columns,
+                                     IndexT*                indices_output,
+                                     NumItemsT              num_items,
+                                     hipStream_t            stream)
+{
+    using wide_key_type = radix_sort_columns_wide_key_type;
+
+    if(num_columns < 0 || static_cast<unsigned int>(num_columns) > radix_sort_columns_max_columns)
+    {
+        return hipErrorInvalidValue;
+    }
+    const size_t size = num_items > 0 ? static_cast<size_t>(num_items) : 0;
+
+    size_t     sort_bytes = 0;
+    hipError_t error      = radix_sort_columns_storage_bytes<uint64_t, IndexT>(sort_bytes, size);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    error = radix_sort_columns_storage_bytes<wide_key_type, IndexT>(sort_bytes, size);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    void*  allocations[5]      = {};
+    size_t allocation_sizes[5] = {sort_bytes,
+                                  size * sizeof(wide_key_type),
+                                  size * sizeof(wide_key_type),
+                                  size * sizeof(IndexT),
+                                  2 * radix_sort_columns_max_columns * sizeof(uint64_t)};
+    error = AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes);
+    if(error != hipSuccess || d_temp_storage == nullptr)
+    {
+        return error;
+    }
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+
+    radix_sort_columns_params params{};
+    params.num_columns = static_cast<unsigned int>(num_columns);
+    for(int column = 0; column < num_columns; column++)
+    {
+        params.columns[column] = columns[column];
+    }
+
+    // Minimums start at all ones and maximums at zero
+    uint64_t* d_ranges = static_cast<uint64_t*>(allocations[4]);
+    error              = hipMemsetAsync(d_ranges,
+                                        0xFF,
+                                        radix_sort_columns_max_columns * sizeof(uint64_t),
+                                        stream);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    error = hipMemsetAsync(d_ranges + radix_sort_columns_max_columns,
+                           0,
+                           radix_sort_columns_max_columns * sizeof(uint64_t),
+                           stream);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    const size_t grid_size
+        = (size + radix_sort_columns_block_size - 1) / radix_sort_columns_block_size;
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(radix_sort_columns_range_kernel),
+                       dim3(std::min(grid_size, size_t(radix_sort_columns_max_grid_size))),
+                       dim3(radix_sort_columns_block_size),
+                       0,
+                       stream,
+                       params,
+                       d_ranges,
+                       size);
+    error = hipGetLastError();
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    radix_sort_columns_ranges ranges{};
+    error = hipMemcpyAsync(ranges.minimums,
+                           d_ranges,
+                           2 * radix_sort_columns_max_columns * sizeof(uint64_t),
+                           hipMemcpyDeviceToHost,
+                           stream);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    error = hipStreamSynchronize(stream);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    // Groups of consecutive columns as [first, last) with their number of bits
+    unsigned int group_first[radix_sort_columns_max_columns];
+    unsigned int group_last[radix_sort_columns_max_columns];
+    unsigned int group_bits[radix_sort_columns_max_columns];
+    unsigned int num_groups = 0;
+    for(unsigned int column = 0; column < params.num_columns; column++)
+    {
+        const uint64_t range = ranges.maximums[column] - ranges.minimums[column];
+        unsigned int   bits  = 0;
+        while(bits < 64 && (range >> bits) != 0)
+        {
+            bits++;
+        }
+        ranges.bits[column] = bits;
+        if(bits == 0)
+        {
+            continue;
+        }
+        if(num_groups == 0
+           || group_bits[num_groups - 1] + bits > radix_sort_columns_max_key_bits)
+        {
+            group_first[num_groups] = column;
+            group_bits[num_groups]  = 0;
+            num_groups++;
+        }
+        group_last[num_groups - 1] = column + 1;
+        group_bits[num_groups - 1] += bits;
+    }
+
+    IndexT* d_indices = static_cast<IndexT*>(allocations[3]);
+    if(num_groups == 0)
+    {
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(radix_sort_columns_sequence_kernel),
+                           dim3(static_cast<unsigned int>(grid_size)),
+                           dim3(radix_sort_columns_block_size),
+                           0,
+                           stream,
+                           indices_output,
+                           size);
+        return hipGetLastError();
+    }
+
+    // The passes alternate between the two index buffers, so the last one writes the output
+    const IndexT* permutation = nullptr;
+    for(unsigned int pass = 0; pass < num_groups; pass++)
+    {
+        const unsigned int group  = num_groups - 1 - pass;
+        IndexT*            output = group % 2 == 0 ? indices_output : d_indices;
+        if(group_bits[group] <= 64)
+        {
+            error = radix_sort_columns_pass<uint64_t>(allocations[0],
+                                                      sort_bytes,
+                                                      params,
+                                                      ranges,
+                                                      group_first[group],
+                                                      group_last[group],
+                                                      group_bits[group],
+                                                      permutation,
+                                                      output,
+                                                      output == d_indices ? indices_output
+                                                                          : d_indices,
+                                                      allocations[1],
+                                                      allocations[2],
+                                                      size,
+                                                      stream);
+        }
+        else
+        {
+            error = radix_sort_columns_pass<wide_key_type>(allocations[0],
+                                                           sort_bytes,
+                                                           params,
+                                                           ranges,
+                                                           group_first[group],
+                                                           group_last[group],
+                                                           group_bits[group],
+                                                           permutation,
+                                                           output,
+                                                           output == d_indices ? indices_output
+                                                                               : d_indices,
+                                                           allocations[1],
+                                                           allocations[2],
+                                                           size,
+                                                           stream);
+        }
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        permutation = output;
+    }
+
+    return hipSuccess;
+}
+
+} // namespace detail
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_CUB_AGENT_AGENT_RADIX_SORT_COLUMNS_HPP_
@@ -0,0 +1,572 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef HIPCUB_CUB_AGENT_AGENT_RADIX_SORT_IN_PLACE_HPP_
+#define HIPCUB_CUB_AGENT_AGENT_RADIX_SORT_IN_PLACE_HPP_
+
+#include "../../../config.hpp"
+
+#include "../util_temporary_storage.hpp"
+#include "agent_single_block.hpp"
+
+#include <cub/block/block_radix_sort.cuh>
+#include <cub/block/block_scan.cuh>
+#include <cub/util_type.cuh>
+
+#include <algorithm>
+#include <type_traits>
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace detail
+{
+
+/// The in-place sort partitions the keys by 8-bit digits from the most significant one. Every
+/// segment of a level is partitioned by moving each item directly to its bucket, buckets of at
+/// most \p single_block_max_items items are then sorted by one block each and larger buckets
+/// are the segments of the next level. Segments are processed in batches of at most
+/// \p radix_sort_in_place_max_batch_size, which bounds the per bucket state.
+static constexpr unsigned int radix_sort_in_place_block_size     = 256;
+static constexpr unsigned int radix_sort_in_place_radix_bits     = 8;
+static constexpr unsigned int radix_sort_in_place_buckets        = 256;
+static constexpr unsigned int radix_sort_in_place_max_batch_size = 1024;
+static constexpr unsigned int radix_sort_in_place_grid_size      = 4096;
+/// Read positions are biased, so the decrements that find a bucket without unread items never
+/// borrow from the write position packed above them.
+static constexpr unsigned long long radix_sort_in_place_read_bias = 1ull << 31;
+
+static_assert(radix_sort_in_place_block_size == radix_sort_in_place_buckets,
+              "Every thread handles one bucket in the histogram and scan kernels");
+
+struct radix_sort_in_place_segment
+{
+    unsigned int begin;
+    unsigned int end;
+};
+
+/// Maps keys to unsigned bits in sorting order and back.
+template<class KeyT, bool Descending>
+struct radix_sort_in_place_codec
+{
+    using bits_type = typename ::cub::Traits<KeyT>::UnsignedBits;
+
+    static constexpr bits_type sign_bit  = bits_type(1) << (sizeof(bits_type) * 8 - 1);
+    static constexpr bool      is_signed
+        = ::cub::NumericTraits<KeyT>::CATEGORY == ::cub::SIGNED_INTEGER;
+    static constexpr bool      is_floating_point
+        = ::cub::NumericTraits<KeyT>::CATEGORY == ::cub::FLOATING_POINT;
+
+    HIPCUB_DEVICE HIPCUB_FORCEINLINE static bits_type encode(bits_type bits)
+    {
+        if(is_floating_point)
+        {
+            bits = (bits & sign_bit) ? static_cast<bits_type>(~bits)
+                                     : static_cast<bits_type>(bits ^ sign_bit);
+        }
+        else if(is_signed)
+        {
+            bits = static_cast<bits_type>(bits ^ sign_bit);
+        }
+        return Descending ? static_cast<bits_type>(~bits) : bits;
+    }
+
+    HIPCUB_DEVICE HIPCUB_FORCEINLINE static bits_type decode(bits_type bits)
+    {
+        if(Descending)
+        {
+            bits = static_cast<bits_type>(~bits);
+        }
+        if(is_floating_point)
+        {
+            return (bits & sign_bit) ? static_cast<bits_type>(bits ^ sign_bit)
+                                     : static_cast<bits_type>(~bits);
+        }
+        return is_signed ? static_cast<bits_type>(bits ^ sign_bit) : bits;
+    }
+
+    HIPCUB_DEVICE HIPCUB_FORCEINLINE static unsigned int digit(bits_type bits, unsigned int shift)
+    {
+        return static_cast<unsigned int>(encode(bits) >> shift) & (radix_sort_in_place_buckets - 1);
+    }
+};
+
+static __global__ __launch_bounds__(1) void radix_sort_in_place_init_kernel(
+    radix_sort_in_place_segment* segments, unsigned int size)
+{
+    segments[0] = {0, size};
+}
+
+template<class CodecT>
+__global__
+    __launch_bounds__(radix_sort_in_place_block_size) void radix_sort_in_place_histogram_kernel(
+    const typename CodecT::bits_type*  keys,
+    const radix_sort_in_place_segment* segments,
+    unsigned int*                      counts,
+    unsigned int                       shift)
+{
+    __shared__ unsigned int block_counts[radix_sort_in_place_buckets];
+
+    const unsigned int                flat_id    = threadIdx.x;
+    const unsigned int                segment_id = blockIdx.y;
+    const radix_sort_in_place_segment segment    = segments[segment_id];
+    const unsigned int                stride     = gridDim.x * radix_sort_in_place_block_size;
+    const unsigned int first = blockIdx.x * radix_sort_in_place_block_size + flat_id;
+
+    block_counts[flat_id] = 0;
+    __syncthreads();
+
+    for(unsigned int i = segment.begin + first; i < segment.end; i += stride)
+    {
+        atomicAdd(&block_counts[CodecT::digit(keys[i], shift)], 1u);
+    }
+    __syncthreads();
+
+    if(block_counts[flat_id] != 0)
+    {
+        atomicAdd(&counts[segment_id * radix_sort_in_place_buckets + flat_id],
+                  block_counts[flat_id]);
+    }
+}
+
+/// Turns the counts of every segment into bucket offsets and initializes the write and read
+/// positions of the buckets. Buckets too large for one block are appended to the next level.
+static __global__
+    __launch_bounds__(radix_sort_in_place_block_size) void radix_sort_in_place_scan_kernel(
+    const radix_sort_in_place_segment* segments,
+    unsigned int*                      counts,
+    unsigned long long*                positions,
+    unsigned int*                      pending_reads,
+    radix_sort_in_place_segment*       next_segments,
+    unsigned int*                      next_segments_count,
+    bool                               append)
+{
+    using block_scan_type = ::cub::BlockScan<unsigned int, radix_sort_in_place_block_size>;
+
+    __shared__ ::cub::Uninitialized<typename block_scan_type::TempStorage> storage;
+
+    const unsigned int                flat_id    = threadIdx.x;
+    const unsigned int                segment_id = blockIdx.x;
+    const radix_sort_in_place_segment segment    = segments[segment_id];
+    const unsigned int                bucket = segment_id * radix_sort_in_place_buckets + flat_id;
+
+    const unsigned int count = counts[bucket];
+    unsigned int       offset;
+    block_scan_type(storage.Alias()).ExclusiveSum(count, offset);
+
+    counts[bucket]        = offset;
+    positions[bucket]     = (static_cast<unsigned long long>(offset) << 32)
+                        | (offset + count + radix_sort_in_place_read_bias);
+    pending_reads[bucket] = 0;
+
+    if(append && count > single_block_max_items)
+    {
+        const unsigned int next = atomicAdd(next_segments_count, 1u);
+        next_segments[next]     = {segment.begin + offset, segment.begin + offset + count};
+    }
+}
+
+/// Moves every item of the segments to its bucket. The write position of a bucket counts up
+/// from its first item and the read position counts down from its last one, both are packed in
+/// one word so every slot is claimed by exactly one of them:
+/// - A thread without an item takes the last unread item of a bucket.
+/// - A thread with an item claims the next write slot of its bucket. An unread slot is swapped
+///   with the item and the thread continues with the item it found, an already read slot takes
+///   the item once the pending reads of the bucket have completed.
+/// A bucket is finished when its write position reaches its read position.
+template<class CodecT, class ValueT>
+__global__
+    __launch_bounds__(radix_sort_in_place_block_size) void radix_sort_in_place_permute_kernel(
+    typename CodecT::bits_type*        keys,
+    ValueT*                            values,
+    const radix_sort_in_place_segment* segments,
+    unsigned long long*                positions,
+    unsigned int*                      pending_reads,
+    unsigned int                       shift)
+{
+    using bits_type            = typename CodecT::bits_type;
+    constexpr bool with_values = !std::is_same<ValueT, ::cub::NullType>::value;
+
+    const unsigned int                segment_id = blockIdx.y;
+    const radix_sort_in_place_segment segment    = segments[segment_id];
+    const unsigned int                thread_id
+        = blockIdx.x * radix_sort_in_place_block_size + threadIdx.x;
+    if(thread_id >= segment.end - segment.begin)
+    {
+        return;
+    }
+
+    unsigned long long* bucket_positions = positions + segment_id * radix_sort_in_place_buckets;
+    unsigned int*       bucket_pending_reads
+        = pending_reads + segment_id * radix_sort_in_place_buckets;
+
+    unsigned int bucket  = thread_id % radix_sort_in_place_buckets;
+    bool         holding = false;
+    bits_type    key;
+    ValueT       value;
+    while(true)
+    {
+        if(!holding)
+        {
+            for(unsigned int tries = 0; tries < radix_sort_in_place_buckets && !holding; tries++)
+            {
+                const unsigned long long current
+                    = *static_cast<volatile unsigned long long*>(&bucket_positions[bucket]);
+                if((current >> 32) + radix_sort_in_place_read_bias < (current & 0xFFFFFFFFull))
+                {
+                    atomicAdd(&bucket_pending_reads[bucket], 1u);
+                    __threadfence();
+                    const unsigned long long previous
+                        = atomicAdd(&bucket_positions[bucket], ~0ull);
+                    const unsigned int write = static_cast<unsigned int>(previous >> 32);
+                    const unsigned int read  = static_cast<unsigned int>(
+                        (previous & 0xFFFFFFFFull) - radix_sort_in_place_read_bias);
+                    if(read > write)
+                    {
+                        const unsigned int slot = segment.begin + read - 1;
+                        key                     = keys[slot];
+                        if(with_values)
+                        {
+                            value = values[slot];
+                        }
+                        holding = true;
+                    }
+                    __threadfence();
+                    atomicSub(&bucket_pending_reads[bucket], 1u);
+                }
+                if(!holding)
+                {
+                    bucket = (bucket + 1) % radix_sort_in_place_buckets;
+                }
+            }
+            if(!holding)
+            {
+                return;
+            }
+        }
+
+        const unsigned int       target   = CodecT::digit(key, shift);
+        const unsigned long long previous = atomicAdd(&bucket_positions[target], 1ull << 32);
+        const unsigned int       write    = static_cast<unsigned int>(previous >> 32);
+        const unsigned int       read
+            = static_cast<unsigned int>((previous & 0xFFFFFFFFull) - radix_sort_in_place_read_bias);
+        const unsigned int slot = segment.begin + write;
+        if(write < read)
+        {
+            const bits_type found_key = keys[slot];
+            keys[slot]                = key;
+            key                       = found_key;
+            if(with_values)
+            {
+                const ValueT found_value = values[slot];
+                values[slot]             = value;
+                value                    = found_value;
+            }
+        }
+        else
+        {
+            // The slot was read by another thread, which may not have loaded it yet
+            while(*static_cast<volatile unsigned int*>(&bucket_pending_reads[target]) != 0)
+            {}
+            __threadfence();
+            keys[slot] = key;
+            if(with_values)
+            {
+                values[slot] = value;
+            }
+            holding = false;
+        }
+    }
+}
+
+/// Sorts every bucket of at most \p single_block_max_items items by the bits below the digit of
+/// the level with one block.
+template<class CodecT, class ValueT>
+__global__ __launch_bounds__(single_block_size) void radix_sort_in_place_bucket_kernel(
+    typename CodecT::bits_type*        keys,
+    ValueT*                            values,
+    const radix_sort_in_place_segment* segments,
+    const unsigned int*                offsets,
+    unsigned int                       shift)
+{
+    using bits_type            = typename CodecT::bits_type;
+    constexpr bool with_values = !std::is_same<ValueT, ::cub::NullType>::value;
+    using block_sort_type      = ::cub::BlockRadixSort<bits_type,
+                                                       single_block_size,
+                                                       single_block_items_per_thread,
+                                                       ValueT>;
+
+    __shared__ ::cub::Uninitialized<typename block_sort_type::TempStorage> storage;
+
+    const unsigned int                flat_id    = threadIdx.x;
+    const unsigned int                bucket     = blockIdx.x;
+    const unsigned int                segment_id = blockIdx.y;
+    const radix_sort_in_place_segment segment    = segments[segment_id];
+    const unsigned int*               segment_offsets
+        = offsets + segment_id * radix_sort_in_place_buckets;
+
+    const unsigned int begin = segment.begin + segment_offsets[bucket];
+    const unsigned int end   = bucket + 1 < radix_sort_in_place_buckets
+                                   ? segment.begin + segment_offsets[bucket + 1]
+                                   : segment.end;
+    const unsigned int size  = end - begin;
+    if(size <= 1 || size > single_block_max_items)
+    {
+        return;
+    }
+
+    bits_type sort_keys[single_block_items_per_thread];
+    ValueT    sort_values[single_block_items_per_thread];
+    for(unsigned int item = 0; item < single_block_items_per_thread; item++)
+    {
+        const unsigned int i = flat_id * single_block_items_per_thread + item;
+        sort_keys[item]      = i < size ? CodecT::encode(keys[begin + i])
+                                        : static_cast<bits_type>(~bits_type(0));
+        if(with_values && i < size)
+        {
+            sort_values[item] = values[begin + i];
+        }
+    }
+
+    block_sort_type block_sort(storage.Alias());
+    single_block_radix_sort_items<false>(block_sort,
+                                         sort_keys,
+                                         sort_values,
+                                         0,
+                                         static_cast<int>(shift));
+
+    for(unsigned int item = 0; item < single_block_items_per_thread; item++)
+    {
+        const unsigned int i = item * single_block_size + flat_id;
+        if(i < size)
+        {
+            keys[begin + i] = CodecT::decode(sort_keys[item]);
+            if(with_values)
+            {
+                values[begin + i] = sort_values[item];
+            }
+        }
+    }
+}
+
+/// The auxiliary memory is the per bucket state of one batch of segments and two lists of
+/// segments, which hold at most one segment per \p single_block_max_items items. The number of
+/// segments of every level is copied back, which synchronizes the stream once per level.
+template<bool Descending, class KeyT, class ValueT, class NumItemsT>
+inline hipError_t radix_sort_in_place(void*       d_temp_storage,
+                                      size_t&     temp_storage_bytes,
+                                      KeyT*       keys,
+                                      ValueT*     values,
+                                      NumItemsT   num_items,
+                                      hipStream_t stream)
+{
+    using codec_type = radix_sort_in_place_codec<KeyT, Descending>;
+    using bits_type  = typename codec_type::bits_type;
+
+    static_assert(::cub::NumericTraits<KeyT>::CATEGORY != ::cub::NOT_A_NUMBER,
+                  "Only integral and floating point keys are supported");
+
+    // Positions within a segment are biased 32-bit values
+    if(num_items > 0
+       && static_cast<unsigned long long>(num_items) >= radix_sort_in_place_read_bias)
+    {
+        return hipErrorInvalidValue;
+    }
+    const unsigned int size = num_items > 0 ? static_cast<unsigned int>(num_items) : 0;
+
+    const size_t max_segments = size / (single_block_max_items + 1) + 1;
+    const size_t batch_state  = radix_sort_in_place_max_batch_size * radix_sort_in_place_buckets;
+
+    void*  allocations[6]      = {};
+    size_t allocation_sizes[6] = {max_segments * sizeof(radix_sort_in_place_segment),
+                                  max_segments * sizeof(radix_sort_in_place_segment),
+                                  batch_state * sizeof(unsigned int),
+                                  batch_state * sizeof(unsigned long long),
+                                  batch_state * sizeof(unsigned int),
+                                  sizeof(unsigned int)};
+    hipError_t error
+        = AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes);
+    if(error != hipSuccess || d_temp_storage == nullptr)
+    {
+        return error;
+    }
+    if(size <= 1)
+    {
+        return hipSuccess;
+    }
+
+    using segment_type = radix_sort_in_place_segment;
+
+    segment_type*       segments            = static_cast<segment_type*>(allocations[0]);
+    segment_type*       next_segments       = static_cast<segment_type*>(allocations[1]);
+    unsigned int*       counts              = static_cast<unsigned int*>(allocations[2]);
+    unsigned long long* positions           = static_cast<unsigned long long*>(allocations[3]);
+    unsigned int*       pending_reads       = static_cast<unsigned int*>(allocations[4]);
+    unsigned int*       next_segments_count = static_cast<unsigned int*>(allocations[5]);
+    bits_type*          keys_bits           = reinterpret_cast<bits_type*>(keys);
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(radix_sort_in_place_init_kernel),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       stream,
+                       segments,
+                       size);
+    error = hipGetLastError();
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    unsigned int segments_count = 1;
+    for(unsigned int shift = sizeof(bits_type) * 8 - radix_sort_in_place_radix_bits;
+        segments_count > 0;
+        shift -= radix_sort_in_place_radix_bits)
+    {
+        const bool last_level = shift == 0;
+
+        error = hipMemsetAsync(next_segments_count, 0, sizeof(unsigned int), stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        for(unsigned int batch_begin = 0; batch_begin < segments_count;
+            batch_begin += radix_sort_in_place_max_batch_size)
+        {
+            const unsigned int batch_size
+                = std::min(segments_count - batch_begin, radix_sort_in_place_max_batch_size);
+            const radix_sort_in_place_segment* batch_segments = segments + batch_begin;
+            // Blocks beyond the size of a segment return immediately
+            const dim3 grid_size(std::max(radix_sort_in_place_grid_size / batch_size, 1u),
+                                 batch_size);
+
+            error = hipMemsetAsync(counts,
+                                   0,
+                                   batch_size * radix_sort_in_place_buckets * sizeof(unsigned int),
+                                   stream);
+            if(error != hipSuccess)
+            {
+                return error;
+            }
+
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(radix_sort_in_place_histogram_kernel<codec_type>),
+                               grid_size,
+                               dim3(radix_sort_in_place_block_size),
+                               0,
+                               stream,
+                               keys_bits,
+                               batch_segments,
+                               counts,
+                               shift);
+            error = hipGetLastError();
+            if(error != hipSuccess)
+            {
+                return error;
+            }
+
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(radix_sort_in_place_scan_kernel),
+                               dim3(batch_size),
+                               dim3(radix_sort_in_place_block_size),
+                               0,
+                               stream,
+                               batch_segments,
+                               counts,
+                               positions,
+                               pending_reads,
+                               next_segments,
+                               next_segments_count,
+                               !last_level);
+            error = hipGetLastError();
+            if(error != hipSuccess)
+            {
+                return error;
+            }
+
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(radix_sort_in_place_permute_kernel<codec_type, ValueT>),
+                grid_size,
+                dim3(radix_sort_in_place_block_size),
+                0,
+                stream,
+                keys_bits,
+                values,
+                batch_segments,
+                positions,
+                pending_reads,
+                shift);
+            error = hipGetLastError();
+            if(error != hipSuccess)
+            {
+                return error;
+            }
+
+            if(last_level)
+            {
+                continue;
+            }
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(radix_sort_in_place_bucket_kernel<codec_type, ValueT>),
+                dim3(radix_sort_in_place_buckets, batch_size),
+                dim3(single_block_size),
+                0,
+                stream,
+                keys_bits,
+                values,
+                batch_segments,
+                counts,
+                shift);
+            error = hipGetLastError();
+            if(error != hipSuccess)
+            {
+                return error;
+            }
+        }
+        if(last_level)
+        {
+            break;
+        }
+
+        error = hipMemcpyAsync(&segments_count,
+                               next_segments_count,
+                               sizeof(unsigned int),
+                               hipMemcpyDeviceToHost,
+                               stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        error = hipStreamSynchronize(stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        std::swap(segments, next_segments);
+    }
+
+    return hipSuccess;
+}
+
+} // namespace detail
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_CUB_AGENT_AGENT_RADIX_SORT_IN_PLACE_HPP_
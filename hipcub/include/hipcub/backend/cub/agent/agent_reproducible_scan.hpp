@@ -0,0 +1,317 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HIPCUB_CUB_AGENT_AGENT_REPRODUCIBLE_SCAN_HPP_
+#define HIPCUB_CUB_AGENT_AGENT_REPRODUCIBLE_SCAN_HPP_
+
+#include "../../../config.hpp"
+
+#include <cub/util_type.cuh>
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace detail
+{
+
+/// The tile decomposition of the reproducible reduce and scan is fixed and doesn't depend on the
+/// device, so the order of the additions only depends on the number of items. CUB does not
+/// provide a reproducible scan, this is the same algorithm as on the rocPRIM backend.
+static constexpr unsigned int reproducible_scan_block_size       = 256;
+static constexpr unsigned int reproducible_scan_items_per_thread = 16;
+static constexpr unsigned int reproducible_scan_items_per_tile
+    = reproducible_scan_block_size * reproducible_scan_items_per_thread;
+
+template<class AccT>
+struct reproducible_scan_storage
+{
+    AccT items[reproducible_scan_items_per_tile];
+    AccT thread_totals[reproducible_scan_block_size];
+};
+
+/// Loads a tile in a striped arrangement and transposes it through LDS, so every thread owns
+/// \p reproducible_scan_items_per_thread consecutive items. Items past \p size are zero.
+template<class InputIteratorT, class AccT>
+__device__ void reproducible_scan_load_tile(InputIteratorT input,
+                                            size_t         size,
+                                            AccT (&items)[reproducible_scan_items_per_thread],
+                                            reproducible_scan_storage<AccT>& storage)
+{
+    constexpr unsigned int block_size       = reproducible_scan_block_size;
+    constexpr unsigned int items_per_thread = reproducible_scan_items_per_thread;
+    constexpr size_t       items_per_tile   = reproducible_scan_items_per_tile;
+
+    const unsigned int flat_id     = threadIdx.x;
+    const size_t       tile_offset = blockIdx.x * items_per_tile;
+    const size_t       valid = size - tile_offset < items_per_tile ? size - tile_offset
+                                                                   : items_per_tile;
+
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        const unsigned int index = i * block_size + flat_id;
+        storage.items[index]     = index < valid ? static_cast<AccT>(input[tile_offset + index])
+                                                 : AccT(0);
+    }
+    __syncthreads();
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        items[i] = storage.items[flat_id * items_per_thread + i];
+    }
+    __syncthreads();
+}
+
+/// Scans a tile in an order that only depends on the tile size: every thread scans its own items
+/// sequentially and the thread totals are combined by a Kogge-Stone scan in LDS. Warp-level
+/// primitives are not used, so the wavefront size of the device does not change the result.
+/// Returns the total of the tile.
+template<bool Exclusive, class AccT>
+__device__ AccT reproducible_scan_tile(AccT (&items)[reproducible_scan_items_per_thread],
+                                       AccT* thread_totals)
+{
+    constexpr unsigned int block_size       = reproducible_scan_block_size;
+    constexpr unsigned int items_per_thread = reproducible_scan_items_per_thread;
+
+    const unsigned int flat_id = threadIdx.x;
+
+    for(unsigned int i = 1; i < items_per_thread; i++)
+    {
+        items[i] = items[i - 1] + items[i];
+    }
+    thread_totals[flat_id] = items[items_per_thread - 1];
+    __syncthreads();
+
+    for(unsigned int distance = 1; distance < block_size; distance <<= 1)
+    {
+        const AccT previous = flat_id >= distance ? thread_totals[flat_id - distance] : AccT(0);
+        __syncthreads();
+        if(flat_id >= distance)
+        {
+            thread_totals[flat_id] = previous + thread_totals[flat_id];
+        }
+        __syncthreads();
+    }
+
+    const AccT prefix = flat_id == 0 ? AccT(0) : thread_totals[flat_id - 1];
+    const AccT total  = thread_totals[block_size - 1];
+    __syncthreads();
+
+    if(Exclusive)
+    {
+        for(unsigned int i = items_per_thread - 1; i > 0; i--)
+        {
+            items[i] = prefix + items[i - 1];
+        }
+        items[0] = prefix;
+    }
+    else
+    {
+        for(unsigned int i = 0; i < items_per_thread; i++)
+        {
+            items[i] = prefix + items[i];
+        }
+    }
+    return total;
+}
+
+/// Writes the total of every tile to \p tile_totals.
+template<class InputIteratorT, class OutputIteratorT, class AccT>
+__global__ __launch_bounds__(reproducible_scan_block_size) void reproducible_scan_totals_kernel(
+    InputIteratorT input, OutputIteratorT tile_totals, size_t size)
+{
+    __shared__ ::cub::Uninitialized<reproducible_scan_storage<AccT>> storage;
+
+    AccT items[reproducible_scan_items_per_thread];
+    reproducible_scan_load_tile(input, size, items, storage.Alias());
+    const AccT total = reproducible_scan_tile<false>(items, storage.Alias().thread_totals);
+    if(threadIdx.x == 0)
+    {
+        tile_totals[blockIdx.x] = total;
+    }
+}
+
+/// Scans every tile and adds the exclusive prefix of the tile, if \p tile_prefixes is not null.
+/// Every block reads its whole tile before writing it, so the scan can run in place.
+template<bool Exclusive, class InputIteratorT, class OutputIteratorT, class AccT>
+__global__ __launch_bounds__(reproducible_scan_block_size) void reproducible_scan_kernel(
+    InputIteratorT input, OutputIteratorT output, const AccT* tile_prefixes, size_t size)
+{
+    constexpr unsigned int block_size       = reproducible_scan_block_size;
+    constexpr unsigned int items_per_thread = reproducible_scan_items_per_thread;
+    constexpr size_t       items_per_tile   = reproducible_scan_items_per_tile;
+
+    __shared__ ::cub::Uninitialized<reproducible_scan_storage<AccT>> storage;
+
+    const unsigned int flat_id     = threadIdx.x;
+    const unsigned int tile_id     = blockIdx.x;
+    const size_t       tile_offset = static_cast<size_t>(tile_id) * items_per_tile;
+    const size_t       valid = size - tile_offset < items_per_tile ? size - tile_offset
+                                                                   : items_per_tile;
+
+    AccT items[items_per_thread];
+    reproducible_scan_load_tile(input, size, items, storage.Alias());
+    reproducible_scan_tile<Exclusive>(items, storage.Alias().thread_totals);
+
+    const AccT tile_prefix = tile_prefixes == nullptr ? AccT(0) : tile_prefixes[tile_id];
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        storage.Alias().items[flat_id * items_per_thread + i] = tile_prefix + items[i];
+    }
+    __syncthreads();
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        const unsigned int index = i * block_size + flat_id;
+        if(index < valid)
+        {
+            output[tile_offset + index] = storage.Alias().items[index];
+        }
+    }
+}
+
+inline size_t reproducible_scan_tiles(size_t size)
+{
+    return (size + reproducible_scan_items_per_tile - 1) / reproducible_scan_items_per_tile;
+}
+
+/// Returns the size of the tile totals of every level of the reduction of \p size items.
+template<class AccT>
+inline size_t reproducible_scan_temp_storage_bytes(size_t size)
+{
+    size_t bytes = 0;
+    while(size > reproducible_scan_items_per_tile)
+    {
+        size = reproducible_scan_tiles(size);
+        bytes += size * sizeof(AccT);
+    }
+    return bytes;
+}
+
+/// Reduces the tiles level by level until a single tile is left, \p tile_totals must hold
+/// \p reproducible_scan_temp_storage_bytes(size) bytes.
+template<class AccT, class InputIteratorT, class OutputIteratorT>
+inline hipError_t reproducible_reduce(InputIteratorT  input,
+                                      OutputIteratorT output,
+                                      size_t          size,
+                                      AccT*           tile_totals,
+                                      hipStream_t     stream)
+{
+    const size_t tiles = reproducible_scan_tiles(size);
+
+    if(tiles <= 1)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(reproducible_scan_totals_kernel<InputIteratorT, OutputIteratorT, AccT>),
+            dim3(1),
+            dim3(reproducible_scan_block_size),
+            0,
+            stream,
+            input,
+            output,
+            size);
+        return hipGetLastError();
+    }
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(reproducible_scan_totals_kernel<InputIteratorT, AccT*, AccT>),
+        dim3(tiles),
+        dim3(reproducible_scan_block_size),
+        0,
+        stream,
+        input,
+        tile_totals,
+        size);
+    hipError_t error = hipGetLastError();
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    return reproducible_reduce<AccT>(static_cast<const AccT*>(tile_totals),
+                                     output,
+                                     tiles,
+                                     tile_totals + tiles,
+                                     stream);
+}
+
+/// Scans the tile totals recursively with the same decomposition and then scans every tile
+/// starting from its prefix, \p tile_totals must hold
+/// \p reproducible_scan_temp_storage_bytes(size) bytes.
+template<bool Exclusive, class AccT, class InputIteratorT, class OutputIteratorT>
+inline hipError_t reproducible_scan(InputIteratorT  input,
+                                    OutputIteratorT output,
+                                    size_t          size,
+                                    AccT*           tile_totals,
+                                    hipStream_t     stream)
+{
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+    const size_t tiles = reproducible_scan_tiles(size);
+
+    const AccT* tile_prefixes = nullptr;
+    if(tiles > 1)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(reproducible_scan_totals_kernel<InputIteratorT, AccT*, AccT>),
+            dim3(tiles),
+            dim3(reproducible_scan_block_size),
+            0,
+            stream,
+            input,
+            tile_totals,
+            size);
+        hipError_t error = hipGetLastError();
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+
+        error = reproducible_scan<true, AccT>(static_cast<const AccT*>(tile_totals),
+                                              tile_totals,
+                                              tiles,
+                                              tile_totals + tiles,
+                                              stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        tile_prefixes = tile_totals;
+    }
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(
+            reproducible_scan_kernel<Exclusive, InputIteratorT, OutputIteratorT, AccT>),
+        dim3(tiles),
+        dim3(reproducible_scan_block_size),
+        0,
+        stream,
+        input,
+        output,
+        tile_prefixes,
+        size);
+    return hipGetLastError();
+}
+
+} // namespace detail
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_CUB_AGENT_AGENT_REPRODUCIBLE_SCAN_HPP_
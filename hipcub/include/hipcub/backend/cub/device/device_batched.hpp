@@ -0,0 +1,860 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HIPCUB_CUB_DEVICE_DEVICE_BATCHED_HPP_
+#define HIPCUB_CUB_DEVICE_DEVICE_BATCHED_HPP_
+
+#include "../../../config.hpp"
+
+#include <cub/block/block_merge_sort.cuh>
+#include <cub/util_type.cuh>
+#include <cub/warp/warp_merge_sort.cuh>
+#include <cub/warp/warp_reduce.cuh>
+#include <cub/warp/warp_scan.cuh>
+
+#include <iterator>
+#include <type_traits>
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace detail
+{
+
+static constexpr unsigned int batched_block_size = 256;
+/// Number of threads of the warp that handles one problem. CUB does not provide batched
+/// algorithms, these are the same kernels as on the rocPRIM backend.
+static constexpr unsigned int batched_warp_threads    = 32;
+static constexpr unsigned int batched_warps_per_block = batched_block_size / batched_warp_threads;
+/// Sorts of at most \p batched_warp_sort_max_size items are done by a logical warp, larger ones
+/// of at most \p batched_block_sort_max_size items by a block.
+static constexpr unsigned int batched_warp_sort_items_per_thread  = 4;
+static constexpr unsigned int batched_block_sort_items_per_thread = 8;
+static constexpr int          batched_warp_sort_max_size
+    = batched_warp_threads * batched_warp_sort_items_per_thread;
+static constexpr int batched_block_sort_max_size
+    = batched_block_size * batched_block_sort_items_per_thread;
+
+/// Iterators of problems of the same size stored back to back, used by the fixed size overloads.
+template<class IteratorT>
+struct batched_fixed_size_iterators
+{
+    IteratorT base;
+    size_t    problem_size;
+
+    HIPCUB_HOST_DEVICE HIPCUB_FORCEINLINE IteratorT operator[](size_t problem) const
+    {
+        return base + problem * problem_size;
+    }
+};
+
+struct batched_fixed_sizes
+{
+    int size;
+
+    HIPCUB_HOST_DEVICE HIPCUB_FORCEINLINE int operator[](size_t /*problem*/) const
+    {
+        return size;
+    }
+};
+
+template<class IteratorT>
+HIPCUB_HOST_DEVICE HIPCUB_FORCEINLINE batched_fixed_size_iterators<IteratorT>
+    make_batched_fixed_size_iterators(IteratorT base, int problem_size)
+{
+    return batched_fixed_size_iterators<IteratorT>{base, static_cast<size_t>(problem_size)};
+}
+
+/// Every lane reduces a strided part of its problem, the partial results are combined with a
+/// single warp reduction.
+template<class AccT,
+         class InputIteratorsT,
+         class OutputIteratorT,
+         class SizeIteratorT,
+         class ReduceOpT,
+         class InitT>
+__global__ __launch_bounds__(batched_block_size) void batched_reduce_kernel(
+    InputIteratorsT inputs,
+    OutputIteratorT outputs,
+    SizeIteratorT   sizes,
+    unsigned int    num_problems,
+    ReduceOpT       reduce_op,
+    InitT           init)
+{
+    using warp_reduce_type = ::cub::WarpReduce<AccT, batched_warp_threads>;
+
+    __shared__ ::cub::Uninitialized<typename warp_reduce_type::TempStorage>
+        storage[batched_warps_per_block];
+
+    const unsigned int lane    = threadIdx.x % batched_warp_threads;
+    const unsigned int warp_id = threadIdx.x / batched_warp_threads;
+    const unsigned int problem
+        = blockIdx.x * batched_warps_per_block + warp_id;
+    if(problem >= num_problems)
+    {
+        return;
+    }
+
+    const auto         input = inputs[problem];
+    const unsigned int size  = static_cast<unsigned int>(sizes[problem]);
+
+    AccT thread_aggregate{};
+    if(lane < size)
+    {
+        thread_aggregate = static_cast<AccT>(input[lane]);
+        for(unsigned int i = lane + batched_warp_threads; i < size; i += batched_warp_threads)
+        {
+            thread_aggregate = reduce_op(thread_aggregate, static_cast<AccT>(input[i]));
+        }
+    }
+
+    const int valid_lanes
+        = static_cast<int>(size < batched_warp_threads ? size : batched_warp_threads);
+    const AccT aggregate = warp_reduce_type(storage[warp_id].Alias())
+                               .Reduce(thread_aggregate, reduce_op, valid_lanes);
+    if(lane == 0)
+    {
+        outputs[problem] = size > 0 ? reduce_op(static_cast<AccT>(init), aggregate)
+                                    : static_cast<AccT>(init);
+    }
+}
+
+/// The problem is scanned in chunks of one item per lane and the aggregate of the previous
+/// chunks is carried over. Lanes past the end repeat the last item, they only affect the
+/// aggregate of the last chunk which is not used.
+template<bool Exclusive,
+         class AccT,
+         class InputIteratorsT,
+         class OutputIteratorsT,
+         class SizeIteratorT,
+         class ScanOpT>
+__global__ __launch_bounds__(batched_block_size) void batched_scan_kernel(
+    InputIteratorsT  inputs,
+    OutputIteratorsT outputs,
+    SizeIteratorT    sizes,
+    unsigned int     num_problems,
+    ScanOpT          scan_op,
+    AccT             init)
+{
+    using warp_scan_type = ::cub::WarpScan<AccT, batched_warp_threads>;
+
+    __shared__ ::cub::Uninitialized<typename warp_scan_type::TempStorage>
+        storage[batched_warps_per_block];
+
+    const unsigned int lane    = threadIdx.x % batched_warp_threads;
+    const unsigned int warp_id = threadIdx.x / batched_warp_threads;
+    const unsigned int problem
+        = blockIdx.x * batched_warps_per_block + warp_id;
+    if(problem >= num_problems)
+    {
+        return;
+    }
+
+    const auto         input  = inputs[problem];
+    auto               output = outputs[problem];
+    const unsigned int size   = static_cast<unsigned int>(sizes[problem]);
+
+    AccT carry     = init;
+    bool has_carry = Exclusive;
+    for(unsigned int offset = 0; offset < size; offset += batched_warp_threads)
+    {
+        const unsigned int i    = offset + lane;
+        const AccT         item = static_cast<AccT>(input[i < size ? i : size - 1]);
+
+        AccT           result;
+        AccT           chunk_aggregate;
+        warp_scan_type warp_scan(storage[warp_id].Alias());
+        if(Exclusive)
+        {
+            warp_scan.ExclusiveScan(item, result, scan_op, chunk_aggregate);
+            result = lane == 0 ? carry : scan_op(carry, result);
+        }
+        else
+        {
+            warp_scan.InclusiveScan(item, result, scan_op, chunk_aggregate);
+            result = has_carry ? scan_op(carry, result) : result;
+        }
+        carry     = has_carry ? scan_op(carry, chunk_aggregate) : chunk_aggregate;
+        has_carry = true;
+
+        if(i < size)
+        {
+            output[i] = result;
+        }
+        __syncwarp();
+    }
+}
+
+/// Sorts the problem in the blocked arrangement. Items past the end are not part of the merges,
+/// every thread passes its first item as the out-of-bounds default so the items it pads with
+/// never order before its valid ones.
+template<class SortT,
+         unsigned int ItemsPerThread,
+         class KeyT,
+         class ValueT,
+         class CompareOpT>
+HIPCUB_DEVICE HIPCUB_FORCEINLINE void batched_sort_items(SortT& sort,
+                                                         KeyT (&keys)[ItemsPerThread],
+                                                         ValueT (&values)[ItemsPerThread],
+                                                         CompareOpT compare_op,
+                                                         int        valid_items)
+{
+    sort.Sort(keys, values, compare_op, valid_items, keys[0]);
+}
+
+template<class SortT, unsigned int ItemsPerThread, class KeyT, class CompareOpT>
+HIPCUB_DEVICE HIPCUB_FORCEINLINE void
+    batched_sort_items(SortT& sort,
+                       KeyT (&keys)[ItemsPerThread],
+                       ::cub::NullType (&/*values*/)[ItemsPerThread],
+                       CompareOpT compare_op,
+                       int        valid_items)
+{
+    sort.Sort(keys, compare_op, valid_items, keys[0]);
+}
+
+/// Loads, sorts and stores one problem with the \p ProblemThreads threads of \p sort, \p rank is
+/// the index of the calling thread among them.
+template<unsigned int ItemsPerThread,
+         class SortT,
+         class KeyT,
+         class ValueT,
+         class CompareOpT>
+HIPCUB_DEVICE HIPCUB_FORCEINLINE void batched_sort_problem(SortT&        sort,
+                                                           unsigned int  rank,
+                                                           const KeyT*   keys_input,
+                                                           KeyT*         keys_output,
+                                                           const ValueT* values_input,
+                                                           ValueT*       values_output,
+                                                           unsigned int  size,
+                                                           CompareOpT    compare_op)
+{
+    constexpr bool with_values = !std::is_same<ValueT, ::cub::NullType>::value;
+
+    KeyT   keys[ItemsPerThread];
+    ValueT values[ItemsPerThread];
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        const unsigned int i = rank * ItemsPerThread + item;
+        keys[item]           = keys_input[i < size ? i : size - 1];
+        if(with_values && i < size)
+        {
+            values[item] = values_input[i];
+        }
+    }
+
+    batched_sort_items(sort, keys, values, compare_op, static_cast<int>(size));
+
+    for(unsigned int item = 0; item < ItemsPerThread; item++)
+    {
+        const unsigned int i = rank * ItemsPerThread + item;
+        if(i < size)
+        {
+            keys_output[i] = keys[item];
+            if(with_values)
+            {
+                values_output[i] = values[item];
+            }
+        }
+    }
+}
+
+template<class KeyT,
+         class ValueT,
+         class KeysInputsT,
+         class KeysOutputsT,
+         class ValuesInputsT,
+         class ValuesOutputsT,
+         class SizeIteratorT,
+         class CompareOpT>
+__global__ __launch_bounds__(batched_block_size) void batched_warp_sort_kernel(
+    KeysInputsT    keys_inputs,
+    KeysOutputsT   keys_outputs,
+    ValuesInputsT  values_inputs,
+    ValuesOutputsT values_outputs,
+    SizeIteratorT  sizes,
+    unsigned int   num_problems,
+    CompareOpT     compare_op)
+{
+    using warp_sort_type = ::cub::WarpMergeSort<KeyT,
+                                         batched_warp_sort_items_per_thread,
+                                         batched_warp_threads,
+                                         ValueT>;
+
+    __shared__ ::cub::Uninitialized<typename warp_sort_type::TempStorage>
+        storage[batched_warps_per_block];
+
+    const unsigned int lane    = threadIdx.x % batched_warp_threads;
+    const unsigned int warp_id = threadIdx.x / batched_warp_threads;
+    const unsigned int problem
+        = blockIdx.x * batched_warps_per_block + warp_id;
+    if(problem >= num_problems)
+    {
+        return;
+    }
+    const unsigned int size = static_cast<unsigned int>(sizes[problem]);
+    if(size == 0)
+    {
+        return;
+    }
+
+    constexpr bool with_values = !std::is_same<ValueT, ::cub::NullType>::value;
+    warp_sort_type warp_sort(storage[warp_id].Alias());
+    batched_sort_problem<batched_warp_sort_items_per_thread>(
+        warp_sort,
+        lane,
+        keys_inputs[problem],
+        keys_outputs[problem],
+        with_values ? values_inputs[problem] : nullptr,
+        with_values ? values_outputs[problem] : nullptr,
+        size,
+        compare_op);
+}
+
+template<class KeyT,
+         class ValueT,
+         class KeysInputsT,
+         class KeysOutputsT,
+         class ValuesInputsT,
+         class ValuesOutputsT,
+         class SizeIteratorT,
+         class CompareOpT>
+__global__ __launch_bounds__(batched_block_size) void batched_block_sort_kernel(
+    KeysInputsT    keys_inputs,
+    KeysOutputsT   keys_outputs,
+    ValuesInputsT  values_inputs,
+    ValuesOutputsT values_outputs,
+    SizeIteratorT  sizes,
+    CompareOpT     compare_op)
+{
+    using block_sort_type = ::cub::
+        BlockMergeSort<KeyT, batched_block_size, batched_block_sort_items_per_thread, ValueT>;
+
+    __shared__ ::cub::Uninitialized<typename block_sort_type::TempStorage> storage;
+
+    const unsigned int problem = blockIdx.x;
+    const unsigned int size    = static_cast<unsigned int>(sizes[problem]);
+    if(size == 0)
+    {
+        return;
+    }
+
+    constexpr bool  with_values = !std::is_same<ValueT, ::cub::NullType>::value;
+    block_sort_type block_sort(storage.Alias());
+    batched_sort_problem<batched_block_sort_items_per_thread>(
+        block_sort,
+        threadIdx.x,
+        keys_inputs[problem],
+        keys_outputs[problem],
+        with_values ? values_inputs[problem] : nullptr,
+        with_values ? values_outputs[problem] : nullptr,
+        size,
+        compare_op);
+}
+
+/// The batched algorithms don't use temporary storage.
+inline bool batched_temp_storage_query(void* d_temp_storage, size_t& temp_storage_bytes)
+{
+    if(d_temp_storage == nullptr)
+    {
+        // Make sure user won't try to allocate 0 bytes memory
+        temp_storage_bytes = 1;
+        return true;
+    }
+    return false;
+}
+
+inline unsigned int batched_warp_grid_size(int num_problems)
+{
+    return (static_cast<unsigned int>(num_problems) + batched_warps_per_block - 1)
+           / batched_warps_per_block;
+}
+
+template<class AccT,
+         class InputIteratorsT,
+         class OutputIteratorT,
+         class SizeIteratorT,
+         class ReduceOpT,
+         class InitT>
+inline hipError_t batched_reduce(void*           d_temp_storage,
+                                 size_t&         temp_storage_bytes,
+                                 InputIteratorsT inputs,
+                                 OutputIteratorT outputs,
+                                 SizeIteratorT   sizes,
+                                 int             num_problems,
+                                 ReduceOpT       reduce_op,
+                                 InitT           init,
+                                 hipStream_t     stream)
+{
+    if(batched_temp_storage_query(d_temp_storage, temp_storage_bytes) || num_problems <= 0)
+    {
+        return hipSuccess;
+    }
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(batched_reduce_kernel<AccT,
+                                                             InputIteratorsT,
+                                                             OutputIteratorT,
+                                                             SizeIteratorT,
+                                                             ReduceOpT,
+                                                             InitT>),
+                       dim3(batched_warp_grid_size(num_problems)),
+                       dim3(batched_block_size),
+                       0,
+                       stream,
+                       inputs,
+                       outputs,
+                       sizes,
+                       static_cast<unsigned int>(num_problems),
+                       reduce_op,
+                       init);
+    return hipGetLastError();
+}
+
+/// \p init is only used by the exclusive scan.
+template<bool Exclusive,
+         class AccT,
+         class InputIteratorsT,
+         class OutputIteratorsT,
+         class SizeIteratorT,
+         class ScanOpT>
+inline hipError_t batched_scan(void*            d_temp_storage,
+                               size_t&          temp_storage_bytes,
+                               InputIteratorsT  inputs,
+                               OutputIteratorsT outputs,
+                               SizeIteratorT    sizes,
+                               int              num_problems,
+                               ScanOpT          scan_op,
+                               AccT             init,
+                               hipStream_t      stream)
+{
+    if(batched_temp_storage_query(d_temp_storage, temp_storage_bytes) || num_problems <= 0)
+    {
+        return hipSuccess;
+    }
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(batched_scan_kernel<Exclusive,
+                                                           AccT,
+                                                           InputIteratorsT,
+                                                           OutputIteratorsT,
+                                                           SizeIteratorT,
+                                                           ScanOpT>),
+                       dim3(batched_warp_grid_size(num_problems)),
+                       dim3(batched_block_size),
+                       0,
+                       stream,
+                       inputs,
+                       outputs,
+                       sizes,
+                       static_cast<unsigned int>(num_problems),
+                       scan_op,
+                       init);
+    return hipGetLastError();
+}
+
+/// Problems are sorted by logical warps if \p max_problem_size fits into one, else by blocks.
+/// Pass \p NullType values to sort only the keys.
+template<class KeyT,
+         class ValueT,
+         class KeysInputsT,
+         class KeysOutputsT,
+         class ValuesInputsT,
+         class ValuesOutputsT,
+         class SizeIteratorT,
+         class CompareOpT>
+inline hipError_t batched_sort(void*          d_temp_storage,
+                               size_t&        temp_storage_bytes,
+                               KeysInputsT    keys_inputs,
+                               KeysOutputsT   keys_outputs,
+                               ValuesInputsT  values_inputs,
+                               ValuesOutputsT values_outputs,
+                               SizeIteratorT  sizes,
+                               int            num_problems,
+                               int            max_problem_size,
+                               CompareOpT     compare_op,
+                               hipStream_t    stream)
+{
+    if(max_problem_size > batched_block_sort_max_size)
+    {
+        return hipErrorInvalidValue;
+    }
+    if(batched_temp_storage_query(d_temp_storage, temp_storage_bytes) || num_problems <= 0)
+    {
+        return hipSuccess;
+    }
+
+    if(max_problem_size <= batched_warp_sort_max_size)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(batched_warp_sort_kernel<KeyT,
+                                                     ValueT,
+                                                     KeysInputsT,
+                                                     KeysOutputsT,
+                                                     ValuesInputsT,
+                                                     ValuesOutputsT,
+                                                     SizeIteratorT,
+                                                     CompareOpT>),
+            dim3(batched_warp_grid_size(num_problems)),
+            dim3(batched_block_size),
+            0,
+            stream,
+            keys_inputs,
+            keys_outputs,
+            values_inputs,
+            values_outputs,
+            sizes,
+            static_cast<unsigned int>(num_problems),
+            compare_op);
+        return hipGetLastError();
+    }
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(batched_block_sort_kernel<KeyT,
+                                                  ValueT,
+                                                  KeysInputsT,
+                                                  KeysOutputsT,
+                                                  ValuesInputsT,
+                                                  ValuesOutputsT,
+                                                  SizeIteratorT,
+                                                  CompareOpT>),
+        dim3(num_problems),
+        dim3(batched_block_size),
+        0,
+        stream,
+        keys_inputs,
+        keys_outputs,
+        values_inputs,
+        values_outputs,
+        sizes,
+        compare_op);
+    return hipGetLastError();
+}
+
+} // namespace detail
+
+/// \brief Runs reductions, scans and sorts of many independent small problems with a single
+/// launch. Problem \p i is given by the iterator <tt>d_inputs[i]</tt> (or a pointer of an array
+/// of pointers) of <tt>d_sizes[i]</tt> items, the \p FixedSize overloads take problems of the
+/// same size stored back to back.
+///
+/// Every problem of a reduction or scan is processed by a logical warp of 32 threads, which
+/// loops over problems larger than the warp. Sorts use a logical warp per problem if
+/// \p max_problem_size is at most 128 items and a block per problem up to 2048 items, larger
+/// problems are rejected with \p hipErrorInvalidValue. None of the algorithms use temporary
+/// storage, the size query returns one byte.
+struct DeviceBatched
+{
+    /// \brief Reduces every problem with \p reduction_op and \p init, the result of problem
+    /// \p i is written to <tt>d_outputs[i]</tt>. \p reduction_op must be associative and
+    /// commutative, empty problems produce \p init.
+    template<typename InputIteratorsT,
+             typename OutputIteratorT,
+             typename SizeIteratorT,
+             typename ReduceOpT,
+             typename T>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t Reduce(void*           d_temp_storage,
+                                                     size_t&         temp_storage_bytes,
+                                                     InputIteratorsT d_inputs,
+                                                     OutputIteratorT d_outputs,
+                                                     SizeIteratorT   d_sizes,
+                                                     int             num_problems,
+                                                     ReduceOpT       reduction_op,
+                                                     T               init,
+                                                     hipStream_t     stream = 0)
+    {
+        using input_iterator_type = typename std::iterator_traits<InputIteratorsT>::value_type;
+        using input_type          = typename std::iterator_traits<input_iterator_type>::value_type;
+        using accumulator_type    = ::cub::detail::accumulator_t<ReduceOpT, T, input_type>;
+
+        return detail::batched_reduce<accumulator_type>(d_temp_storage,
+                                                        temp_storage_bytes,
+                                                        d_inputs,
+                                                        d_outputs,
+                                                        d_sizes,
+                                                        num_problems,
+                                                        reduction_op,
+                                                        init,
+                                                        stream);
+    }
+
+    /// \brief Same as \p Reduce for \p num_problems problems of \p problem_size items stored
+    /// back to back in \p d_in.
+    template<typename InputIteratorT, typename OutputIteratorT, typename ReduceOpT, typename T>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t ReduceFixedSize(void*           d_temp_storage,
+                                                              size_t&         temp_storage_bytes,
+                                                              InputIteratorT  d_in,
+                                                              OutputIteratorT d_out,
+                                                              int             problem_size,
+                                                              int             num_problems,
+                                                              ReduceOpT       reduction_op,
+                                                              T               init,
+                                                              hipStream_t     stream = 0)
+    {
+        using input_type       = typename std::iterator_traits<InputIteratorT>::value_type;
+        using accumulator_type = ::cub::detail::accumulator_t<ReduceOpT, T, input_type>;
+
+        return detail::batched_reduce<accumulator_type>(
+            d_temp_storage,
+            temp_storage_bytes,
+            detail::make_batched_fixed_size_iterators(d_in, problem_size),
+            d_out,
+            detail::batched_fixed_sizes{problem_size},
+            num_problems,
+            reduction_op,
+            init,
+            stream);
+    }
+
+    /// \brief Computes the inclusive scan of every problem with \p scan_op, problem \p i is
+    /// written to <tt>d_outputs[i]</tt>.
+    template<typename InputIteratorsT,
+             typename OutputIteratorsT,
+             typename SizeIteratorT,
+             typename ScanOpT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t InclusiveScan(void*            d_temp_storage,
+                                                            size_t&          temp_storage_bytes,
+                                                            InputIteratorsT  d_inputs,
+                                                            OutputIteratorsT d_outputs,
+                                                            SizeIteratorT    d_sizes,
+                                                            int              num_problems,
+                                                            ScanOpT          scan_op,
+                                                            hipStream_t      stream = 0)
+    {
+        using input_iterator_type = typename std::iterator_traits<InputIteratorsT>::value_type;
+        using input_type          = typename std::iterator_traits<input_iterator_type>::value_type;
+        using accumulator_type    = ::cub::detail::accumulator_t<ScanOpT, input_type, input_type>;
+
+        return detail::batched_scan<false>(d_temp_storage,
+                                           temp_storage_bytes,
+                                           d_inputs,
+                                           d_outputs,
+                                           d_sizes,
+                                           num_problems,
+                                           scan_op,
+                                           accumulator_type{},
+                                           stream);
+    }
+
+    /// \brief Same as \p InclusiveScan for \p num_problems problems of \p problem_size items
+    /// stored back to back in \p d_in and \p d_out.
+    template<typename InputIteratorT, typename OutputIteratorT, typename ScanOpT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        InclusiveScanFixedSize(void*           d_temp_storage,
+                               size_t&         temp_storage_bytes,
+                               InputIteratorT  d_in,
+                               OutputIteratorT d_out,
+                               int             problem_size,
+                               int             num_problems,
+                               ScanOpT         scan_op,
+                               hipStream_t     stream = 0)
+    {
+        using input_type       = typename std::iterator_traits<InputIteratorT>::value_type;
+        using accumulator_type = ::cub::detail::accumulator_t<ScanOpT, input_type, input_type>;
+
+        return detail::batched_scan<false>(
+            d_temp_storage,
+            temp_storage_bytes,
+            detail::make_batched_fixed_size_iterators(d_in, problem_size),
+            detail::make_batched_fixed_size_iterators(d_out, problem_size),
+            detail::batched_fixed_sizes{problem_size},
+            num_problems,
+            scan_op,
+            accumulator_type{},
+            stream);
+    }
+
+    /// \brief Computes the exclusive scan of every problem with \p scan_op and \p init, problem
+    /// \p i is written to <tt>d_outputs[i]</tt>.
+    template<typename InputIteratorsT,
+             typename OutputIteratorsT,
+             typename SizeIteratorT,
+             typename ScanOpT,
+             typename InitValueT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t ExclusiveScan(void*            d_temp_storage,
+                                                            size_t&          temp_storage_bytes,
+                                                            InputIteratorsT  d_inputs,
+                                                            OutputIteratorsT d_outputs,
+                                                            SizeIteratorT    d_sizes,
+                                                            int              num_problems,
+                                                            ScanOpT          scan_op,
+                                                            InitValueT       init,
+                                                            hipStream_t      stream = 0)
+    {
+        using accumulator_type = ::cub::detail::accumulator_t<ScanOpT, InitValueT, InitValueT>;
+
+        return detail::batched_scan<true>(d_temp_storage,
+                                          temp_storage_bytes,
+                                          d_inputs,
+                                          d_outputs,
+                                          d_sizes,
+                                          num_problems,
+                                          scan_op,
+                                          static_cast<accumulator_type>(init),
+                                          stream);
+    }
+
+    /// \brief Same as \p ExclusiveScan for \p num_problems problems of \p problem_size items
+    /// stored back to back in \p d_in and \p d_out.
+    template<typename InputIteratorT,
+             typename OutputIteratorT,
+             typename ScanOpT,
+             typename InitValueT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        ExclusiveScanFixedSize(void*           d_temp_storage,
+                               size_t&         temp_storage_bytes,
+                               InputIteratorT  d_in,
+                               OutputIteratorT d_out,
+                               int             problem_size,
+                               int             num_problems,
+                               ScanOpT         scan_op,
+                               InitValueT      init,
+                               hipStream_t     stream = 0)
+    {
+        using accumulator_type = ::cub::detail::accumulator_t<ScanOpT, InitValueT, InitValueT>;
+
+        return detail::batched_scan<true>(
+            d_temp_storage,
+            temp_storage_bytes,
+            detail::make_batched_fixed_size_iterators(d_in, problem_size),
+            detail::make_batched_fixed_size_iterators(d_out, problem_size),
+            detail::batched_fixed_sizes{problem_size},
+            num_problems,
+            scan_op,
+            static_cast<accumulator_type>(init),
+            stream);
+    }
+
+    /// \brief Sorts the keys of every problem with \p compare_op, problem \p i is read from
+    /// <tt>d_keys_in[i]</tt> and written to <tt>d_keys_out[i]</tt>. \p max_problem_size must be
+    /// at least the largest size of \p d_sizes and at most 2048. The sort is stable.
+    template<typename KeyT, typename SizeIteratorT, typename CompareOpT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t SortKeys(void*              d_temp_storage,
+                                                       size_t&            temp_storage_bytes,
+                                                       const KeyT* const* d_keys_in,
+                                                       KeyT* const*       d_keys_out,
+                                                       SizeIteratorT      d_sizes,
+                                                       int                num_problems,
+                                                       int                max_problem_size,
+                                                       CompareOpT         compare_op,
+                                                       hipStream_t        stream = 0)
+    {
+        return detail::batched_sort<KeyT, ::cub::NullType>(
+            d_temp_storage,
+            temp_storage_bytes,
+            d_keys_in,
+            d_keys_out,
+            static_cast<const ::cub::NullType* const*>(nullptr),
+            static_cast<::cub::NullType* const*>(nullptr),
+            d_sizes,
+            num_problems,
+            max_problem_size,
+            compare_op,
+            stream);
+    }
+
+    /// \brief Same as \p SortKeys for \p num_problems problems of \p problem_size keys stored
+    /// back to back in \p d_keys_in and \p d_keys_out.
+    template<typename KeyT, typename CompareOpT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t SortKeysFixedSize(void*       d_temp_storage,
+                                                                size_t&     temp_storage_bytes,
+                                                                const KeyT* d_keys_in,
+                                                                KeyT*       d_keys_out,
+                                                                int         problem_size,
+                                                                int         num_problems,
+                                                                CompareOpT  compare_op,
+                                                                hipStream_t stream = 0)
+    {
+        return detail::batched_sort<KeyT, ::cub::NullType>(
+            d_temp_storage,
+            temp_storage_bytes,
+            detail::make_batched_fixed_size_iterators(d_keys_in, problem_size),
+            detail::make_batched_fixed_size_iterators(d_keys_out, problem_size),
+            detail::make_batched_fixed_size_iterators(
+                static_cast<const ::cub::NullType*>(nullptr), 0),
+            detail::make_batched_fixed_size_iterators(static_cast<::cub::NullType*>(nullptr), 0),
+            detail::batched_fixed_sizes{problem_size},
+            num_problems,
+            problem_size,
+            compare_op,
+            stream);
+    }
+
+    /// \brief Sorts the key-value pairs of every problem by key with \p compare_op, problem
+    /// \p i is read from <tt>d_keys_in[i]</tt> and <tt>d_values_in[i]</tt> and written to
+    /// <tt>d_keys_out[i]</tt> and <tt>d_values_out[i]</tt>. \p max_problem_size must be at
+    /// least the largest size of \p d_sizes and at most 2048. The sort is stable.
+    template<typename KeyT, typename ValueT, typename SizeIteratorT, typename CompareOpT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t SortPairs(void*                d_temp_storage,
+                                                        size_t&              temp_storage_bytes,
+                                                        const KeyT* const*   d_keys_in,
+                                                        KeyT* const*         d_keys_out,
+                                                        const ValueT* const* d_values_in,
+                                                        ValueT* const*       d_values_out,
+                                                        SizeIteratorT        d_sizes,
+                                                        int                  num_problems,
+                                                        int                  max_problem_size,
+                                                        CompareOpT           compare_op,
+                                                        hipStream_t          stream = 0)
+    {
+        return detail::batched_sort<KeyT, ValueT>(d_temp_storage,
+                                                  temp_storage_bytes,
+                                                  d_keys_in,
+                                                  d_keys_out,
+                                                  d_values_in,
+                                                  d_values_out,
+                                                  d_sizes,
+                                                  num_problems,
+                                                  max_problem_size,
+                                                  compare_op,
+                                                  stream);
+    }
+
+    /// \brief Same as \p SortPairs for \p num_problems problems of \p problem_size pairs stored
+    /// back to back in the key and value arrays.
+    template<typename KeyT, typename ValueT, typename CompareOpT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t SortPairsFixedSize(void*         d_temp_storage,
+                                                                 size_t&       temp_storage_bytes,
+                                                                 const KeyT*   d_keys_in,
+                                                                 KeyT*         d_keys_out,
+                                                                 const ValueT* d_values_in,
+                                                                 ValueT*       d_values_out,
+                                                                 int           problem_size,
+                                                                 int           num_problems,
+                                                                 CompareOpT    compare_op,
+                                                                 hipStream_t   stream = 0)
+    {
+        return detail::batched_sort<KeyT, ValueT>(
+            d_temp_storage,
+            temp_storage_bytes,
+            detail::make_batched_fixed_size_iterators(d_keys_in, problem_size),
+            detail::make_batched_fixed_size_iterators(d_keys_out, problem_size),
+            detail::make_batched_fixed_size_iterators(d_values_in, problem_size),
+            detail::make_batched_fixed_size_iterators(d_values_out, problem_size),
+            detail::batched_fixed_sizes{problem_size},
+            num_problems,
+            problem_size,
+            compare_op,
+            stream);
+    }
+};
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_CUB_DEVICE_DEVICE_BATCHED_HPP_
@@ -0,0 +1,826 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HIPCUB_CUB_DEVICE_DEVICE_GROUP_BY_HPP_
+#define HIPCUB_CUB_DEVICE_DEVICE_GROUP_BY_HPP_
+
+#include "../../../config.hpp"
+
+#include "../agent/agent_hash_table.hpp"
+#include "../agent/single_pass_scan_operators.hpp"
+#include "../util_temporary_storage.hpp"
+
+#include <cub/block/block_scan.cuh>
+#include <cub/device/device_merge_sort.cuh>
+#include <cub/device/device_reduce.cuh>
+#include <cub/iterator/constant_input_iterator.cuh>
+#include <cub/thread/thread_operators.cuh>
+#include <cub/util_type.cuh>
+
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace detail
+{
+
+static constexpr unsigned int group_by_block_size       = 256;
+static constexpr unsigned int group_by_items_per_thread = 2;
+static constexpr unsigned int group_by_items_per_tile
+    = group_by_block_size * group_by_items_per_thread;
+/// Slots of the LDS table of a tile, twice the number of items keeps the load factor at 0.5.
+static constexpr unsigned int group_by_local_capacity = 2 * group_by_items_per_tile;
+/// Largest global table allocated when the caller does not bound it.
+static constexpr size_t group_by_max_table_capacity = size_t(1) << 25;
+/// Slots probed before a key is spilled, only used when the table can fill up.
+static constexpr size_t group_by_max_probes = 256;
+
+// Counters in temporary storage
+static constexpr unsigned int group_by_tile_counter = 0;
+static constexpr unsigned int group_by_spilled      = 1;
+static constexpr unsigned int group_by_table_groups = 2;
+static constexpr unsigned int group_by_spill_groups = 3;
+
+template<class T>
+struct group_by_has_atomic_add
+    : std::integral_constant<bool,
+                             std::is_same<T, int>::value || std::is_same<T, unsigned int>::value
+                                 || std::is_same<T, unsigned long long>::value
+                                 || std::is_same<T, float>::value
+                                 || std::is_same<T, double>::value>
+{};
+
+template<class T>
+struct group_by_has_atomic_min_max
+    : std::integral_constant<bool,
+                             std::is_same<T, int>::value || std::is_same<T, unsigned int>::value
+                                 || std::is_same<T, unsigned long long>::value>
+{};
+
+/// Applies \p reduction_op to an aggregate in global memory or LDS atomically. Any operator is
+/// applied with a CAS loop on the bits of the aggregate, sums, minima and maxima of the types
+/// with hardware atomics are specialized below.
+template<class T, class ReductionOpT, class Enable = void>
+struct group_by_atomic_reduce
+{
+    static_assert(sizeof(T) == 4 || sizeof(T) == 8,
+                  "DeviceGroupBy aggregates of custom operators must be 4 or 8 bytes large");
+
+    using word_type =
+        typename std::conditional<sizeof(T) == 4, unsigned int, unsigned long long>::type;
+
+    HIPCUB_DEVICE static HIPCUB_FORCEINLINE void
+        apply(T* aggregate, const T& value, ReductionOpT reduction_op)
+    {
+        word_type* word     = reinterpret_cast<word_type*>(aggregate);
+        word_type  observed = *word;
+        word_type  assumed;
+        do
+        {
+            assumed = observed;
+            T current;
+            memcpy(&current, &assumed, sizeof(T));
+            const T   desired = reduction_op(current, value);
+            word_type desired_word;
+            memcpy(&desired_word, &desired, sizeof(T));
+            observed = atomicCAS(word, assumed, desired_word);
+        }
+        while(observed != assumed);
+    }
+};
+
+template<class T>
+struct group_by_atomic_reduce<T,
+                              ::cub::Sum,
+                              typename std::enable_if<group_by_has_atomic_add<T>::value>::type>
+{
+    HIPCUB_DEVICE static HIPCUB_FORCEINLINE void apply(T* aggregate, const T& value, ::cub::Sum)
+    {
+        atomicAdd(aggregate, value);
+    }
+};
+
+template<class T>
+struct group_by_atomic_reduce<T,
+                              ::cub::Min,
+                              typename std::enable_if<group_by_has_atomic_min_max<T>::value>::type>
+{
+    HIPCUB_DEVICE static HIPCUB_FORCEINLINE void apply(T* aggregate, const T& value, ::cub::Min)
+    {
+        atomicMin(aggregate, value);
+    }
+};
+
+template<class T>
+struct group_by_atomic_reduce<T,
+                              ::cub::Max,
+                              typename std::enable_if<group_by_has_atomic_min_max<T>::value>::type>
+{
+    HIPCUB_DEVICE static HIPCUB_FORCEINLINE void apply(T* aggregate, const T& value, ::cub::Max)
+    {
+        atomicMax(aggregate, value);
+    }
+};
+
+struct group_by_less
+{
+    template<class T>
+    HIPCUB_HOST_DEVICE HIPCUB_FORCEINLINE bool operator()(const T& a, const T& b) const
+    {
+        return a < b;
+    }
+};
+
+template<class KeyT, class AccumT>
+struct group_by_storage
+{
+    using block_scan_type = ::cub::BlockScan<unsigned int, group_by_block_size>;
+    using tile_prefix_type
+        = TilePrefixCallbackOp<unsigned int, ::cub::Sum, ScanTileState<unsigned int>>;
+
+    KeyT         keys[group_by_items_per_tile];
+    unsigned int slots[group_by_local_capacity];
+    AccumT       aggregates[group_by_local_capacity];
+    unsigned int tile;
+
+    typename block_scan_type::TempStorage  scan;
+    typename tile_prefix_type::TempStorage prefix;
+};
+
+/// Groups the items of a tile in an LDS table, every slot gets the position of the first
+/// occurrence of its key in the tile and, if \p Aggregate, the reduction of its values. Only the
+/// first occurrences update the global table, so keys of low cardinality cost one global atomic
+/// per tile instead of one per item.
+template<bool Aggregate,
+         class KeysIteratorT,
+         class ValuesIteratorT,
+         class KeyT,
+         class AccumT,
+         class ReductionOpT>
+HIPCUB_DEVICE HIPCUB_FORCEINLINE void
+    group_by_aggregate_tile(KeysIteratorT                   keys,
+                            ValuesIteratorT                 values,
+                            size_t                          tile_offset,
+                            unsigned int                    tile_items,
+                            group_by_storage<KeyT, AccumT>& storage,
+                            unsigned int (&local_slots)[group_by_items_per_thread],
+                            unsigned int (&hashes)[group_by_items_per_thread],
+                            ReductionOpT reduction_op,
+                            AccumT       init)
+{
+    const unsigned int flat_id = threadIdx.x;
+
+    for(unsigned int i = flat_id; i < group_by_local_capacity; i += group_by_block_size)
+    {
+        storage.slots[i] = hash_table_empty_slot;
+        if HIPCUB_IF_CONSTEXPR(Aggregate)
+        {
+            storage.aggregates[i] = init;
+        }
+    }
+    for(unsigned int item = 0; item < group_by_items_per_thread; item++)
+    {
+        const unsigned int i = item * group_by_block_size + flat_id;
+        if(i < tile_items)
+        {
+            storage.keys[i] = keys[tile_offset + i];
+        }
+    }
+    __syncthreads();
+
+    for(unsigned int item = 0; item < group_by_items_per_thread; item++)
+    {
+        const unsigned int i = item * group_by_block_size + flat_id;
+        if(i < tile_items)
+        {
+            const KeyT key    = storage.keys[i];
+            hashes[item]      = hash_table_default_hash()(key);
+            local_slots[item] = static_cast<unsigned int>(
+                hash_table_insert(storage.slots,
+                                  group_by_local_capacity,
+                                  storage.keys,
+                                  key,
+                                  i,
+                                  hashes[item],
+                                  ::cub::Equality(),
+                                  group_by_local_capacity));
+            atomicMin(&storage.slots[local_slots[item]], i);
+            if HIPCUB_IF_CONSTEXPR(Aggregate)
+            {
+                group_by_atomic_reduce<AccumT, ReductionOpT>::apply(
+                    &storage.aggregates[local_slots[item]],
+                    static_cast<AccumT>(values[tile_offset + i]),
+                    reduction_op);
+            }
+        }
+    }
+    __syncthreads();
+}
+
+template<class AccumT>
+__global__ __launch_bounds__(group_by_block_size) void group_by_init_kernel(
+    ScanTileState<unsigned int> tile_state,
+    unsigned int*               counters,
+    unsigned int                num_tiles,
+    unsigned int*               table_slots,
+    AccumT*                     table_aggregates,
+    size_t                      table_capacity,
+    AccumT                      init)
+{
+    const size_t flat_id = static_cast<size_t>(blockIdx.x) * group_by_block_size + threadIdx.x;
+    // The table has more slots than there are tiles
+    tile_state.InitializeStatus(num_tiles);
+    if(flat_id < 4)
+    {
+        counters[flat_id] = 0;
+    }
+    if(flat_id < table_capacity)
+    {
+        table_slots[flat_id]      = hash_table_empty_slot;
+        table_aggregates[flat_id] = init;
+    }
+}
+
+/// Merges the groups of every tile into the global table. If the table may fill up, keys which
+/// find neither their slot nor an empty one within \p group_by_max_probes slots are spilled with
+/// the aggregate of the tile. Slots are never freed, so all items of a spilled key are spilled.
+template<bool MayFill,
+         class KeysIteratorT,
+         class ValuesIteratorT,
+         class KeyT,
+         class AccumT,
+         class ReductionOpT>
+__global__ __launch_bounds__(group_by_block_size) void group_by_insert_kernel(
+    KeysIteratorT   keys,
+    ValuesIteratorT values,
+    size_t          num_items,
+    unsigned int*   table_slots,
+    AccumT*         table_aggregates,
+    size_t          table_capacity,
+    KeyT*           spill_keys,
+    AccumT*         spill_aggregates,
+    unsigned int*   counters,
+    ReductionOpT    reduction_op,
+    AccumT          init)
+{
+    using storage_type = group_by_storage<KeyT, AccumT>;
+
+    __shared__ ::cub::Uninitialized<storage_type> storage_raw;
+    storage_type& storage = storage_raw.Alias();
+
+    const unsigned int flat_id     = threadIdx.x;
+    const size_t       tile_offset = static_cast<size_t>(blockIdx.x) * group_by_items_per_tile;
+    const unsigned int tile_items  = num_items - tile_offset < group_by_items_per_tile
+                                         ? static_cast<unsigned int>(num_items - tile_offset)
+                                         : group_by_items_per_tile;
+
+    unsigned int local_slots[group_by_items_per_thread];
+    unsigned int hashes[group_by_items_per_thread];
+    group_by_aggregate_tile<true>(keys,
+                                  values,
+                                  tile_offset,
+                                  tile_items,
+                                  storage,
+                                  local_slots,
+                                  hashes,
+                                  reduction_op,
+                                  init);
+
+    for(unsigned int item = 0; item < group_by_items_per_thread; item++)
+    {
+        const unsigned int i = item * group_by_block_size + flat_id;
+        if(i < tile_items && storage.slots[local_slots[item]] == i)
+        {
+            const unsigned int index     = static_cast<unsigned int>(tile_offset + i);
+            const AccumT       aggregate = storage.aggregates[local_slots[item]];
+            const size_t       slot
+                = hash_table_insert(table_slots,
+                                    table_capacity,
+                                    keys,
+                                    storage.keys[i],
+                                    index,
+                                    hashes[item],
+                                    ::cub::Equality(),
+                                    MayFill ? group_by_max_probes : table_capacity);
+            if(slot < table_capacity)
+            {
+                atomicMin(&table_slots[slot], index);
+                group_by_atomic_reduce<AccumT, ReductionOpT>::apply(&table_aggregates[slot],
+                                                                    aggregate,
+                                                                    reduction_op);
+            }
+            else
+            {
+                const unsigned int spill = atomicAdd(&counters[group_by_spilled], 1u);
+                spill_keys[spill]        = storage.keys[i];
+                spill_aggregates[spill]  = aggregate;
+            }
+        }
+    }
+}
+
+/// Writes the groups of the table in the order of the first occurrence of their keys, selected
+/// with a block scan and a decoupled look-back like \p DeviceDistinct.
+template<bool MayFill,
+         class KeysIteratorT,
+         class AccumT,
+         class UniqueOutputIteratorT,
+         class AggregatesOutputIteratorT>
+__global__ __launch_bounds__(group_by_block_size) void group_by_select_kernel(
+    KeysIteratorT               keys,
+    size_t                      num_items,
+    const unsigned int*         table_slots,
+    const AccumT*               table_aggregates,
+    size_t                      table_capacity,
+    UniqueOutputIteratorT       unique_out,
+    AggregatesOutputIteratorT   aggregates_out,
+    unsigned int*               counters,
+    ScanTileState<unsigned int> tile_state,
+    unsigned int                num_tiles)
+{
+    using key_type         = typename std::iterator_traits<KeysIteratorT>::value_type;
+    using storage_type     = group_by_storage<key_type, AccumT>;
+    using block_scan_type  = typename storage_type::block_scan_type;
+    using tile_prefix_type = typename storage_type::tile_prefix_type;
+
+    __shared__ ::cub::Uninitialized<storage_type> storage_raw;
+    storage_type& storage = storage_raw.Alias();
+
+    const unsigned int flat_id = threadIdx.x;
+    if(flat_id == 0)
+    {
+        storage.tile = atomicAdd(&counters[group_by_tile_counter], 1u);
+    }
+    __syncthreads();
+
+    const unsigned int tile        = storage.tile;
+    const size_t       tile_offset = static_cast<size_t>(tile) * group_by_items_per_tile;
+    const unsigned int tile_items  = num_items - tile_offset < group_by_items_per_tile
+                                         ? static_cast<unsigned int>(num_items - tile_offset)
+                                         : group_by_items_per_tile;
+
+    unsigned int local_slots[group_by_items_per_thread];
+    unsigned int hashes[group_by_items_per_thread];
+    group_by_aggregate_tile<false>(keys,
+                                   static_cast<const AccumT*>(nullptr),
+                                   tile_offset,
+                                   tile_items,
+                                   storage,
+                                   local_slots,
+                                   hashes,
+                                   ::cub::Sum(),
+                                   AccumT());
+
+    bool         selected[group_by_items_per_thread];
+    size_t       slots[group_by_items_per_thread];
+    unsigned int selected_count = 0;
+    for(unsigned int item = 0; item < group_by_items_per_thread; item++)
+    {
+        const unsigned int i = item * group_by_block_size + flat_id;
+        selected[item]       = false;
+        if(i < tile_items && storage.slots[local_slots[item]] == i)
+        {
+            // Spilled keys are not found
+            slots[item]    = hash_table_find(table_slots,
+                                          table_capacity,
+                                          keys,
+                                          storage.keys[i],
+                                          hashes[item],
+                                          ::cub::Equality(),
+                                          MayFill ? group_by_max_probes : table_capacity);
+            selected[item] = slots[item] < table_capacity
+                             && table_slots[slots[item]] == tile_offset + i;
+            selected_count += selected[item] ? 1 : 0;
+        }
+    }
+
+    unsigned int output_offset;
+    if(tile == 0)
+    {
+        unsigned int tile_selected;
+        block_scan_type(storage.scan).ExclusiveSum(selected_count, output_offset, tile_selected);
+        if(flat_id == 0)
+        {
+            tile_state.SetInclusive(0, tile_selected);
+            if(num_tiles == 1)
+            {
+                counters[group_by_table_groups] = tile_selected;
+            }
+        }
+    }
+    else
+    {
+        tile_prefix_type prefix_op(tile_state, storage.prefix, ::cub::Sum(), tile);
+        block_scan_type(storage.scan).ExclusiveSum(selected_count, output_offset, prefix_op);
+        if(flat_id == 0 && tile == num_tiles - 1)
+        {
+            counters[group_by_table_groups] = prefix_op.GetInclusivePrefix();
+        }
+    }
+
+    for(unsigned int item = 0; item < group_by_items_per_thread; item++)
+    {
+        if(selected[item])
+        {
+            const unsigned int i          = item * group_by_block_size + flat_id;
+            unique_out[output_offset]     = storage.keys[i];
+            aggregates_out[output_offset] = table_aggregates[slots[item]];
+            output_offset++;
+        }
+    }
+}
+
+template<class NumGroupsIteratorT>
+__global__ __launch_bounds__(1) void group_by_num_groups_kernel(const unsigned int* counters,
+                                                                NumGroupsIteratorT num_groups_out)
+{
+    *num_groups_out = counters[group_by_table_groups] + counters[group_by_spill_groups];
+}
+
+template<class KeysIteratorT,
+         class UniqueOutputIteratorT,
+         class ValuesIteratorT,
+         class AggregatesOutputIteratorT,
+         class NumGroupsIteratorT,
+         class ReductionOpT,
+         class InitT>
+inline hipError_t group_by_reduce(void*                     d_temp_storage,
+                                  size_t&                   temp_storage_bytes,
+                                  KeysIteratorT             keys,
+                                  UniqueOutputIteratorT     unique_out,
+                                  ValuesIteratorT           values,
+                                  AggregatesOutputIteratorT aggregates_out,
+                                  NumGroupsIteratorT        num_groups_out,
+                                  ReductionOpT              reduction_op,
+                                  InitT                     init,
+                                  int                       num_items,
+                                  size_t                    max_table_capacity,
+                                  hipStream_t               stream)
+{
+    using key_type   = typename std::iterator_traits<KeysIteratorT>::value_type;
+    using accum_type = InitT;
+
+    const size_t       size      = num_items > 0 ? static_cast<size_t>(num_items) : 0;
+    const unsigned int num_tiles = static_cast<unsigned int>(
+        (size + group_by_items_per_tile - 1) / group_by_items_per_tile);
+    const size_t full_capacity    = hash_table_capacity(size);
+    const size_t bounded_capacity = hash_table_capacity(max_table_capacity / 2);
+    const size_t table_capacity
+        = bounded_capacity < full_capacity ? bounded_capacity : full_capacity;
+    // A table smaller than the one for all items being distinct may fill up
+    const bool   may_fill   = table_capacity < full_capacity;
+    const size_t spill_size = may_fill ? size : 0;
+
+    size_t     tile_state_bytes = 0;
+    hipError_t error
+        = ScanTileState<unsigned int>::AllocationSize(num_tiles > 0 ? num_tiles : 1u,
+                                                      tile_state_bytes);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    size_t sort_bytes   = 0;
+    size_t reduce_bytes = 0;
+    if(may_fill)
+    {
+        error = hipCUDAErrorTohipError(
+            ::cub::DeviceMergeSort::SortPairsCopy(nullptr,
+                                                  sort_bytes,
+                                                  static_cast<key_type*>(nullptr),
+                                                  static_cast<accum_type*>(nullptr),
+                                                  static_cast<key_type*>(nullptr),
+                                                  static_cast<accum_type*>(nullptr),
+                                                  static_cast<int>(spill_size),
+                                                  group_by_less(),
+                                                  stream));
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        error = hipCUDAErrorTohipError(
+            ::cub::DeviceReduce::ReduceByKey(nullptr,
+                                             reduce_bytes,
+                                             static_cast<key_type*>(nullptr),
+                                             unique_out,
+                                             static_cast<accum_type*>(nullptr),
+                                             aggregates_out,
+                                             static_cast<unsigned int*>(nullptr),
+                                             reduction_op,
+                                             static_cast<int>(spill_size),
+                                             stream));
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+    }
+
+    void*  allocations[9]      = {};
+    size_t allocation_sizes[9] = {tile_state_bytes,
+                                  4 * sizeof(unsigned int),
+                                  table_capacity * sizeof(unsigned int),
+                                  table_capacity * sizeof(accum_type),
+                                  spill_size * sizeof(key_type),
+                                  spill_size * sizeof(accum_type),
+                                  spill_size * sizeof(key_type),
+                                  spill_size * sizeof(accum_type),
+                                  sort_bytes > reduce_bytes ? sort_bytes : reduce_bytes};
+    error = AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes);
+    if(error != hipSuccess || d_temp_storage == nullptr)
+    {
+        return error;
+    }
+
+    ScanTileState<unsigned int> tile_state;
+    error = tile_state.Init(num_tiles > 0 ? num_tiles : 1u, allocations[0], tile_state_bytes);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    unsigned int* counters                = static_cast<unsigned int*>(allocations[1]);
+    unsigned int* table_slots             = static_cast<unsigned int*>(allocations[2]);
+    accum_type*   table_aggregates        = static_cast<accum_type*>(allocations[3]);
+    key_type*     spill_keys              = static_cast<key_type*>(allocations[4]);
+    accum_type*   spill_aggregates        = static_cast<accum_type*>(allocations[5]);
+    key_type*     sorted_spill_keys       = static_cast<key_type*>(allocations[6]);
+    accum_type*   sorted_spill_aggregates = static_cast<accum_type*>(allocations[7]);
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(group_by_init_kernel),
+                       dim3((table_capacity + group_by_block_size - 1) / group_by_block_size),
+                       dim3(group_by_block_size),
+                       0,
+                       stream,
+                       tile_state,
+                       counters,
+                       num_tiles,
+                       table_slots,
+                       table_aggregates,
+                       table_capacity,
+                       static_cast<accum_type>(init));
+    error = hipGetLastError();
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    if(num_tiles > 0)
+    {
+        auto insert_kernel = may_fill ? group_by_insert_kernel<true,
+                                                               KeysIteratorT,
+                                                               ValuesIteratorT,
+                                                               key_type,
+                                                               accum_type,
+                                                               ReductionOpT>
+                                      : group_by_insert_kernel<false,
+                                                               KeysIteratorT,
+                                                               ValuesIteratorT,
+                                                               key_type,
+                                                               accum_type,
+                                                               ReductionOpT>;
+        hipLaunchKernelGGL(insert_kernel,
+                           dim3(num_tiles),
+                           dim3(group_by_block_size),
+                           0,
+                           stream,
+                           keys,
+                           values,
+                           size,
+                           table_slots,
+                           table_aggregates,
+                           table_capacity,
+                           spill_keys,
+                           spill_aggregates,
+                           counters,
+                           reduction_op,
+                           static_cast<accum_type>(init));
+        error = hipGetLastError();
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+
+        auto select_kernel = may_fill ? group_by_select_kernel<true,
+                                                               KeysIteratorT,
+                                                               accum_type,
+                                                               UniqueOutputIteratorT,
+                                                               AggregatesOutputIteratorT>
+                                      : group_by_select_kernel<false,
+                                                               KeysIteratorT,
+                                                               accum_type,
+                                                               UniqueOutputIteratorT,
+                                                               AggregatesOutputIteratorT>;
+        hipLaunchKernelGGL(select_kernel,
+                           dim3(num_tiles),
+                           dim3(group_by_block_size),
+                           0,
+                           stream,
+                           keys,
+                           size,
+                           table_slots,
+                           table_aggregates,
+                           table_capacity,
+                           unique_out,
+                           aggregates_out,
+                           counters,
+                           tile_state,
+                           num_tiles);
+        error = hipGetLastError();
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+    }
+
+    if(may_fill && num_tiles > 0)
+    {
+        // The sizes of the sort-based path are only known on the device
+        unsigned int host_counters[4];
+        error = hipMemcpyAsync(host_counters,
+                               counters,
+                               sizeof(host_counters),
+                               hipMemcpyDeviceToHost,
+                               stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        error = hipStreamSynchronize(stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+
+        const size_t spilled      = host_counters[group_by_spilled];
+        const size_t table_groups = host_counters[group_by_table_groups];
+        if(spilled > 0)
+        {
+            error = hipCUDAErrorTohipError(
+                ::cub::DeviceMergeSort::SortPairsCopy(allocations[8],
+                                                      sort_bytes,
+                                                      spill_keys,
+                                                      spill_aggregates,
+                                                      sorted_spill_keys,
+                                                      sorted_spill_aggregates,
+                                                      static_cast<int>(spilled),
+                                                      group_by_less(),
+                                                      stream));
+            if(error != hipSuccess)
+            {
+                return error;
+            }
+            error = hipCUDAErrorTohipError(
+                ::cub::DeviceReduce::ReduceByKey(allocations[8],
+                                                 reduce_bytes,
+                                                 sorted_spill_keys,
+                                                 unique_out + table_groups,
+                                                 sorted_spill_aggregates,
+                                                 aggregates_out + table_groups,
+                                                 counters + group_by_spill_groups,
+                                                 reduction_op,
+                                                 static_cast<int>(spilled),
+                                                 stream));
+            if(error != hipSuccess)
+            {
+                return error;
+            }
+        }
+    }
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(group_by_num_groups_kernel),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       stream,
+                       counters,
+                       num_groups_out);
+    return hipGetLastError();
+}
+
+} // namespace detail
+
+/// Same hash table aggregation as on the rocPRIM backend, CUB does not provide an unordered
+/// reduce-by-key.
+struct DeviceGroupBy
+{
+    template<typename KeysInputIteratorT,
+             typename UniqueOutputIteratorT,
+             typename ValuesInputIteratorT,
+             typename AggregatesOutputIteratorT,
+             typename NumGroupsOutputIteratorT,
+             typename ReductionOpT,
+             typename InitT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        ReduceByKey(void*                     d_temp_storage,
+                    size_t&                   temp_storage_bytes,
+                    KeysInputIteratorT        d_keys_in,
+                    UniqueOutputIteratorT     d_unique_out,
+                    ValuesInputIteratorT      d_values_in,
+                    AggregatesOutputIteratorT d_aggregates_out,
+                    NumGroupsOutputIteratorT  d_num_groups_out,
+                    ReductionOpT              reduction_op,
+                    InitT                     init,
+                    int                       num_items,
+                    hipStream_t               stream = 0)
+    {
+        return detail::group_by_reduce(d_temp_storage,
+                                       temp_storage_bytes,
+                                       d_keys_in,
+                                       d_unique_out,
+                                       d_values_in,
+                                       d_aggregates_out,
+                                       d_num_groups_out,
+                                       reduction_op,
+                                       init,
+                                       num_items,
+                                       detail::group_by_max_table_capacity,
+                                       stream);
+    }
+
+    template<typename KeysInputIteratorT,
+             typename UniqueOutputIteratorT,
+             typename ValuesInputIteratorT,
+             typename AggregatesOutputIteratorT,
+             typename NumGroupsOutputIteratorT,
+             typename ReductionOpT,
+             typename InitT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        ReduceByKeyWithTableCapacity(void*                     d_temp_storage,
+                                     size_t&                   temp_storage_bytes,
+                                     KeysInputIteratorT        d_keys_in,
+                                     UniqueOutputIteratorT     d_unique_out,
+                                     ValuesInputIteratorT      d_values_in,
+                                     AggregatesOutputIteratorT d_aggregates_out,
+                                     NumGroupsOutputIteratorT  d_num_groups_out,
+                                     ReductionOpT              reduction_op,
+                                     InitT                     init,
+                                     int                       num_items,
+                                     size_t                    table_capacity,
+                                     hipStream_t               stream = 0)
+    {
+        return detail::group_by_reduce(d_temp_storage,
+                                       temp_storage_bytes,
+                                       d_keys_in,
+                                       d_unique_out,
+                                       d_values_in,
+                                       d_aggregates_out,
+                                       d_num_groups_out,
+                                       reduction_op,
+                                       init,
+                                       num_items,
+                                       table_capacity,
+                                       stream);
+    }
+
+    template<typename KeysInputIteratorT,
+             typename UniqueOutputIteratorT,
+             typename CountsOutputIteratorT,
+             typename NumGroupsOutputIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        CountByKey(void*                    d_temp_storage,
+                   size_t&                  temp_storage_bytes,
+                   KeysInputIteratorT       d_keys_in,
+                   UniqueOutputIteratorT    d_unique_out,
+                   CountsOutputIteratorT    d_counts_out,
+                   NumGroupsOutputIteratorT d_num_groups_out,
+                   int                      num_items,
+                   hipStream_t              stream = 0)
+    {
+        return detail::group_by_reduce(d_temp_storage,
+                                       temp_storage_bytes,
+                                       d_keys_in,
+                                       d_unique_out,
+                                       ::cub::ConstantInputIterator<unsigned int>(1),
+                                       d_counts_out,
+                                       d_num_groups_out,
+                                       ::cub::Sum(),
+                                       0u,
+                                       num_items,
+                                       detail::group_by_max_table_capacity,
+                                       stream);
+    }
+};
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_CUB_DEVICE_DEVICE_GROUP_BY_HPP_
@@ -0,0 +1,283 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HIPCUB_CUB_DEVICE_DEVICE_MERGE_HPP_
+#define HIPCUB_CUB_DEVICE_DEVICE_MERGE_HPP_
+
+#include "../../../config.hpp"
+
+#include "../agent/agent_merge_path.hpp"
+
+#include <cub/util_type.cuh>
+
+#include <iterator>
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace detail
+{
+
+static constexpr unsigned int merge_block_size       = 256;
+static constexpr unsigned int merge_items_per_thread = 8;
+static constexpr unsigned int merge_items_per_tile   = merge_block_size * merge_items_per_thread;
+
+template<class KeyT>
+struct merge_storage
+{
+    // The items of the first sequence followed by the items of the second sequence
+    KeyT         keys[merge_items_per_tile];
+    unsigned int indices[merge_items_per_tile];
+    size_t       tile_splits[2];
+};
+
+/// Same merge path decomposition as \p rocprim::merge, which CUB 2.5 does not provide. Every
+/// thread merges its part of the tile staged in LDS, the merged keys and their positions in the
+/// tile are exchanged through LDS so the output is written coalesced.
+template<bool WithValues,
+         class KeysIterator1T,
+         class ValuesIterator1T,
+         class KeysIterator2T,
+         class ValuesIterator2T,
+         class KeysOutputIteratorT,
+         class ValuesOutputIteratorT,
+         class CompareOpT>
+__global__ __launch_bounds__(merge_block_size) void merge_kernel(KeysIterator1T        keys1,
+                                                                 ValuesIterator1T      values1,
+                                                                 size_t                num_items1,
+                                                                 KeysIterator2T        keys2,
+                                                                 ValuesIterator2T      values2,
+                                                                 size_t                num_items2,
+                                                                 KeysOutputIteratorT   keys_out,
+                                                                 ValuesOutputIteratorT values_out,
+                                                                 CompareOpT            compare_op)
+{
+    using key_type     = typename std::iterator_traits<KeysIterator1T>::value_type;
+    using storage_type = merge_storage<key_type>;
+
+    __shared__ ::cub::Uninitialized<storage_type> storage_raw;
+    storage_type& storage = storage_raw.Alias();
+
+    const unsigned int flat_id     = threadIdx.x;
+    const size_t       path_length = num_items1 + num_items2;
+    const size_t       tile_offset = static_cast<size_t>(blockIdx.x) * merge_items_per_tile;
+    const unsigned int tile_items  = path_length - tile_offset < merge_items_per_tile
+                                         ? static_cast<unsigned int>(path_length - tile_offset)
+                                         : merge_items_per_tile;
+
+    if(flat_id < 2)
+    {
+        storage.tile_splits[flat_id] = merge_path_search(tile_offset + flat_id * tile_items,
+                                                         keys1,
+                                                         num_items1,
+                                                         keys2,
+                                                         num_items2,
+                                                         compare_op);
+    }
+    __syncthreads();
+
+    const size_t       first_offset  = storage.tile_splits[0];
+    const size_t       second_offset = tile_offset - first_offset;
+    const unsigned int first_items
+        = static_cast<unsigned int>(storage.tile_splits[1] - first_offset);
+    const unsigned int second_items = tile_items - first_items;
+
+    for(unsigned int i = flat_id; i < tile_items; i += merge_block_size)
+    {
+        storage.keys[i] = i < first_items ? keys1[first_offset + i]
+                                          : keys2[second_offset + i - first_items];
+    }
+    __syncthreads();
+
+    const key_type*    tile_keys1 = storage.keys;
+    const key_type*    tile_keys2 = storage.keys + first_items;
+    const unsigned int thread_diagonal
+        = flat_id * merge_items_per_thread < tile_items ? flat_id * merge_items_per_thread
+                                                        : tile_items;
+
+    unsigned int i = merge_path_search(thread_diagonal,
+                                       tile_keys1,
+                                       first_items,
+                                       tile_keys2,
+                                       second_items,
+                                       compare_op);
+    unsigned int j = thread_diagonal - i;
+
+    key_type     thread_keys[merge_items_per_thread];
+    unsigned int thread_indices[merge_items_per_thread];
+    for(unsigned int item = 0; item < merge_items_per_thread; item++)
+    {
+        if(thread_diagonal + item < tile_items)
+        {
+            const bool from_first
+                = j >= second_items
+                  || (i < first_items && !compare_op(tile_keys2[j], tile_keys1[i]));
+            thread_indices[item] = from_first ? i++ : first_items + j++;
+            thread_keys[item]    = storage.keys[thread_indices[item]];
+        }
+    }
+    __syncthreads();
+
+    for(unsigned int item = 0; item < merge_items_per_thread; item++)
+    {
+        if(thread_diagonal + item < tile_items)
+        {
+            storage.keys[thread_diagonal + item]    = thread_keys[item];
+            storage.indices[thread_diagonal + item] = thread_indices[item];
+        }
+    }
+    __syncthreads();
+
+    for(unsigned int i = flat_id; i < tile_items; i += merge_block_size)
+    {
+        keys_out[tile_offset + i] = storage.keys[i];
+        if HIPCUB_IF_CONSTEXPR(WithValues)
+        {
+            const unsigned int index = storage.indices[i];
+            values_out[tile_offset + i]
+                = index < first_items ? values1[first_offset + index]
+                                      : values2[second_offset + index - first_items];
+        }
+    }
+}
+
+template<bool WithValues,
+         class KeysIterator1T,
+         class ValuesIterator1T,
+         class KeysIterator2T,
+         class ValuesIterator2T,
+         class KeysOutputIteratorT,
+         class ValuesOutputIteratorT,
+         class CompareOpT>
+inline hipError_t merge(void*                 d_temp_storage,
+                        size_t&               temp_storage_bytes,
+                        KeysIterator1T        keys1,
+                        ValuesIterator1T      values1,
+                        int                   num_items1,
+                        KeysIterator2T        keys2,
+                        ValuesIterator2T      values2,
+                        int                   num_items2,
+                        KeysOutputIteratorT   keys_out,
+                        ValuesOutputIteratorT values_out,
+                        CompareOpT            compare_op,
+                        hipStream_t           stream)
+{
+    if(d_temp_storage == nullptr)
+    {
+        temp_storage_bytes = 4;
+        return hipSuccess;
+    }
+
+    const size_t size1 = num_items1 > 0 ? static_cast<size_t>(num_items1) : 0;
+    const size_t size2 = num_items2 > 0 ? static_cast<size_t>(num_items2) : 0;
+    const size_t tiles = (size1 + size2 + merge_items_per_tile - 1) / merge_items_per_tile;
+    if(tiles == 0)
+    {
+        return hipSuccess;
+    }
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(merge_kernel<WithValues>),
+                       dim3(tiles),
+                       dim3(merge_block_size),
+                       0,
+                       stream,
+                       keys1,
+                       values1,
+                       size1,
+                       keys2,
+                       values2,
+                       size2,
+                       keys_out,
+                       values_out,
+                       compare_op);
+    return hipGetLastError();
+}
+
+} // namespace detail
+
+struct DeviceMerge
+{
+    template<typename KeyIteratorIn1T,
+             typename KeyIteratorIn2T,
+             typename KeyIteratorOutT,
+             typename CompareOpT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t MergeKeys(void*           d_temp_storage,
+                                                        size_t&         temp_storage_bytes,
+                                                        KeyIteratorIn1T d_keys_in1,
+                                                        int             num_keys1,
+                                                        KeyIteratorIn2T d_keys_in2,
+                                                        int             num_keys2,
+                                                        KeyIteratorOutT d_keys_out,
+                                                        CompareOpT      compare_op,
+                                                        hipStream_t     stream = 0)
+    {
+        return detail::merge<false>(d_temp_storage,
+                                    temp_storage_bytes,
+                                    d_keys_in1,
+                                    static_cast<::cub::NullType*>(nullptr),
+                                    num_keys1,
+                                    d_keys_in2,
+                                    static_cast<::cub::NullType*>(nullptr),
+                                    num_keys2,
+                                    d_keys_out,
+                                    static_cast<::cub::NullType*>(nullptr),
+                                    compare_op,
+                                    stream);
+    }
+
+    template<typename KeyIteratorIn1T,
+             typename ValueIteratorIn1T,
+             typename KeyIteratorIn2T,
+             typename ValueIteratorIn2T,
+             typename KeyIteratorOutT,
+             typename ValueIteratorOutT,
+             typename CompareOpT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t MergePairs(void*             d_temp_storage,
+                                                         size_t&           temp_storage_bytes,
+                                                         KeyIteratorIn1T   d_keys_in1,
+                                                         ValueIteratorIn1T d_values_in1,
+                                                         int               num_keys1,
+                                                         KeyIteratorIn2T   d_keys_in2,
+                                                         ValueIteratorIn2T d_values_in2,
+                                                         int               num_keys2,
+                                                         KeyIteratorOutT   d_keys_out,
+                                                         ValueIteratorOutT d_values_out,
+                                                         CompareOpT        compare_op,
+                                                         hipStream_t       stream = 0)
+    {
+        return detail::merge<true>(d_temp_storage,
+                                   temp_storage_bytes,
+                                   d_keys_in1,
+                                   d_values_in1,
+                                   num_keys1,
+                                   d_keys_in2,
+                                   d_values_in2,
+                                   num_keys2,
+                                   d_keys_out,
+                                   d_values_out,
+                                   compare_op,
+                                   stream);
+    }
+};
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_CUB_DEVICE_DEVICE_MERGE_HPP_
@@ -33,10 +33,311 @@
 #include "../../../config.hpp"
 #include "../../../util_deprecated.hpp"
 
+#include "../util_temporary_storage.hpp"
+
+#include <cub/block/block_radix_sort.cuh>
+#include <cub/block/block_scan.cuh>
 #include <cub/device/device_partition.cuh>
+#include <cub/device/device_scan.cuh>
+#include <cub/util_type.cuh>
+
+#include <iterator>
 
 BEGIN_HIPCUB_NAMESPACE
 
+namespace detail
+{
+
+static constexpr unsigned int partition_buckets_block_size       = 256;
+static constexpr unsigned int partition_buckets_items_per_thread = 8;
+static constexpr unsigned int partition_buckets_items_per_tile
+    = partition_buckets_block_size * partition_buckets_items_per_thread;
+/// Every thread of a block owns one bucket of the tile histogram.
+static constexpr unsigned int partition_buckets_max_buckets = partition_buckets_block_size;
+/// Bucket ids are sorted with one more bit, so items past the end of a tile sort last.
+static constexpr unsigned int partition_buckets_sort_bits = 9;
+
+template<class T>
+struct partition_buckets_storage
+{
+    using block_sort_type = ::cub::BlockRadixSort<unsigned int,
+                                                  partition_buckets_block_size,
+                                                  partition_buckets_items_per_thread,
+                                                  unsigned int>;
+    using block_scan_type = ::cub::BlockScan<unsigned int, partition_buckets_block_size>;
+
+    T            items[partition_buckets_items_per_tile];
+    unsigned int histogram[partition_buckets_max_buckets];
+    unsigned int local_offsets[partition_buckets_max_buckets];
+    unsigned int global_offsets[partition_buckets_max_buckets];
+
+    typename block_sort_type::TempStorage sort;
+    typename block_scan_type::TempStorage scan;
+};
+
+/// Counts the items of every bucket in a tile. The counts are stored bucket-major, so an
+/// exclusive scan over them yields the output offset of every bucket of every tile.
+template<class InputIteratorT, class BucketOpT>
+__global__ __launch_bounds__(partition_buckets_block_size) void partition_buckets_histogram_kernel(
+    InputIteratorT input,
+    size_t         num_items,
+    BucketOpT      bucket_op,
+    unsigned int*  tile_counts,
+    unsigned int   num_buckets,
+    unsigned int   num_tiles)
+{
+    __shared__ unsigned int histogram[partition_buckets_max_buckets];
+
+    const unsigned int flat_id     = threadIdx.x;
+    const unsigned int tile        = blockIdx.x;
+    const size_t       tile_offset = static_cast<size_t>(tile) * partition_buckets_items_per_tile;
+    const unsigned int tile_items  = num_items - tile_offset < partition_buckets_items_per_tile
+                                         ? static_cast<unsigned int>(num_items - tile_offset)
+                                         : partition_buckets_items_per_tile;
+
+    histogram[flat_id] = 0;
+    __syncthreads();
+
+    for(unsigned int item = 0; item < partition_buckets_items_per_thread; item++)
+    {
+        const unsigned int i = item * partition_buckets_block_size + flat_id;
+        if(i < tile_items)
+        {
+            atomicAdd(&histogram[static_cast<unsigned int>(bucket_op(input[tile_offset + i]))],
+                      1u);
+        }
+    }
+    __syncthreads();
+
+    if(flat_id < num_buckets)
+    {
+        tile_counts[static_cast<size_t>(flat_id) * num_tiles + tile] = histogram[flat_id];
+    }
+}
+
+/// Groups the items of a tile by bucket with a stable block radix sort of their bucket ids in
+/// LDS, so every bucket of the tile is written as one contiguous run.
+template<class InputIteratorT, class OutputIteratorT, class BucketOpT>
+__global__ __launch_bounds__(partition_buckets_block_size) void partition_buckets_scatter_kernel(
+    InputIteratorT      input,
+    OutputIteratorT     output,
+    size_t              num_items,
+    BucketOpT           bucket_op,
+    const unsigned int* tile_offsets,
+    unsigned int        num_buckets,
+    unsigned int        num_tiles)
+{
+    using value_type      = typename std::iterator_traits<InputIteratorT>::value_type;
+    using storage_type    = partition_buckets_storage<value_type>;
+    using block_sort_type = typename storage_type::block_sort_type;
+    using block_scan_type = typename storage_type::block_scan_type;
+
+    __shared__ ::cub::Uninitialized<storage_type> storage_raw;
+    storage_type& storage = storage_raw.Alias();
+
+    const unsigned int flat_id     = threadIdx.x;
+    const unsigned int tile        = blockIdx.x;
+    const size_t       tile_offset = static_cast<size_t>(tile) * partition_buckets_items_per_tile;
+    const unsigned int tile_items  = num_items - tile_offset < partition_buckets_items_per_tile
+                                         ? static_cast<unsigned int>(num_items - tile_offset)
+                                         : partition_buckets_items_per_tile;
+
+    for(unsigned int item = 0; item < partition_buckets_items_per_thread; item++)
+    {
+        const unsigned int i = item * partition_buckets_block_size + flat_id;
+        if(i < tile_items)
+        {
+            storage.items[i] = input[tile_offset + i];
+        }
+    }
+    storage.histogram[flat_id] = 0;
+    __syncthreads();
+
+    // Blocked arrangement, the local indices are in input order which keeps the sort stable
+    unsigned int buckets[partition_buckets_items_per_thread];
+    unsigned int indices[partition_buckets_items_per_thread];
+    for(unsigned int item = 0; item < partition_buckets_items_per_thread; item++)
+    {
+        const unsigned int i = flat_id * partition_buckets_items_per_thread + item;
+        indices[item]        = i;
+        buckets[item]        = partition_buckets_max_buckets;
+        if(i < tile_items)
+        {
+            buckets[item] = static_cast<unsigned int>(bucket_op(storage.items[i]));
+            atomicAdd(&storage.histogram[buckets[item]], 1u);
+        }
+    }
+    __syncthreads();
+
+    unsigned int local_offset;
+    block_scan_type(storage.scan).ExclusiveSum(storage.histogram[flat_id], local_offset);
+    storage.local_offsets[flat_id] = local_offset;
+    if(flat_id < num_buckets)
+    {
+        storage.global_offsets[flat_id]
+            = tile_offsets[static_cast<size_t>(flat_id) * num_tiles + tile];
+    }
+
+    block_sort_type(storage.sort)
+        .SortBlockedToStriped(buckets, indices, 0, partition_buckets_sort_bits);
+    __syncthreads();
+
+    // Striped arrangement, consecutive threads write consecutive items of a bucket
+    for(unsigned int item = 0; item < partition_buckets_items_per_thread; item++)
+    {
+        const unsigned int rank = item * partition_buckets_block_size + flat_id;
+        if(rank < tile_items)
+        {
+            const unsigned int bucket = buckets[item];
+            output[storage.global_offsets[bucket] + (rank - storage.local_offsets[bucket])]
+                = storage.items[indices[item]];
+        }
+    }
+}
+
+template<class OffsetsOutputIteratorT, class CountsOutputIteratorT>
+__global__ __launch_bounds__(partition_buckets_block_size) void partition_buckets_offsets_kernel(
+    const unsigned int*    tile_offsets,
+    size_t                 num_items,
+    unsigned int           num_buckets,
+    unsigned int           num_tiles,
+    OffsetsOutputIteratorT bucket_offsets_out,
+    CountsOutputIteratorT  bucket_counts_out)
+{
+    const unsigned int bucket = blockIdx.x * partition_buckets_block_size + threadIdx.x;
+    if(bucket < num_buckets)
+    {
+        const size_t begin
+            = num_tiles > 0 ? tile_offsets[static_cast<size_t>(bucket) * num_tiles] : 0;
+        const size_t end = num_tiles > 0 && bucket + 1 < num_buckets
+                               ? tile_offsets[static_cast<size_t>(bucket + 1) * num_tiles]
+                               : num_items;
+        bucket_offsets_out[bucket] = begin;
+        bucket_counts_out[bucket]  = end - begin;
+    }
+}
+
+template<class InputIteratorT,
+         class OutputIteratorT,
+         class OffsetsOutputIteratorT,
+         class CountsOutputIteratorT,
+         class BucketOpT>
+inline hipError_t partition_buckets(void*                  d_temp_storage,
+                                    size_t&                temp_storage_bytes,
+                                    InputIteratorT         input,
+                                    OutputIteratorT        output,
+                                    OffsetsOutputIteratorT bucket_offsets_out,
+                                    CountsOutputIteratorT  bucket_counts_out,
+                                    int                    num_buckets,
+                                    BucketOpT              bucket_op,
+                                    int                    num_items,
+                                    hipStream_t            stream)
+{
+    if(num_buckets < 0 || static_cast<unsigned int>(num_buckets) > partition_buckets_max_buckets)
+    {
+        return hipErrorInvalidValue;
+    }
+
+    const size_t       size      = num_items > 0 ? static_cast<size_t>(num_items) : 0;
+    const unsigned int buckets   = static_cast<unsigned int>(num_buckets);
+    const unsigned int num_tiles = static_cast<unsigned int>(
+        (size + partition_buckets_items_per_tile - 1) / partition_buckets_items_per_tile);
+    const size_t counts_size = static_cast<size_t>(buckets) * num_tiles;
+
+    size_t     scan_bytes = 0;
+    hipError_t error      = hipCUDAErrorTohipError(
+        ::cub::DeviceScan::ExclusiveSum(nullptr,
+                                        scan_bytes,
+                                        static_cast<unsigned int*>(nullptr),
+                                        static_cast<unsigned int*>(nullptr),
+                                        counts_size,
+                                        stream));
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    void*  allocations[2]      = {};
+    size_t allocation_sizes[2] = {counts_size * sizeof(unsigned int), scan_bytes};
+    error = AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes);
+    if(error != hipSuccess || d_temp_storage == nullptr)
+    {
+        return error;
+    }
+    unsigned int* tile_counts = static_cast<unsigned int*>(allocations[0]);
+
+    if(num_tiles > 0 && buckets > 0)
+    {
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(partition_buckets_histogram_kernel),
+                           dim3(num_tiles),
+                           dim3(partition_buckets_block_size),
+                           0,
+                           stream,
+                           input,
+                           size,
+                           bucket_op,
+                           tile_counts,
+                           buckets,
+                           num_tiles);
+        error = hipGetLastError();
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+
+        // In place, the counts are not needed afterwards
+        error = hipCUDAErrorTohipError(::cub::DeviceScan::ExclusiveSum(allocations[1],
+                                                                       scan_bytes,
+                                                                       tile_counts,
+                                                                       tile_counts,
+                                                                       counts_size,
+                                                                       stream));
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(partition_buckets_scatter_kernel),
+                           dim3(num_tiles),
+                           dim3(partition_buckets_block_size),
+                           0,
+                           stream,
+                           input,
+                           output,
+                           size,
+                           bucket_op,
+                           tile_counts,
+                           buckets,
+                           num_tiles);
+        error = hipGetLastError();
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+    }
+
+    if(buckets > 0)
+    {
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(partition_buckets_offsets_kernel),
+                           dim3((buckets + partition_buckets_block_size - 1)
+                                / partition_buckets_block_size),
+                           dim3(partition_buckets_block_size),
+                           0,
+                           stream,
+                           tile_counts,
+                           size,
+                           buckets,
+                           num_tiles,
+                           bucket_offsets_out,
+                           bucket_counts_out);
+        return hipGetLastError();
+    }
+
+    return hipSuccess;
+}
+
+} // namespace detail
+
 struct DevicePartition
 {
     template<typename InputIteratorT,
@@ -203,6 +504,36 @@ struct DevicePartition
                   select_second_part_op,
                   stream);
     }
+
+    /// Same N-way partition as on the rocPRIM backend, CUB does not provide one.
+    template<typename InputIteratorT,
+             typename OutputIteratorT,
+             typename OffsetsOutputIteratorT,
+             typename CountsOutputIteratorT,
+             typename BucketOpT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        Buckets(void*                  d_temp_storage,
+                size_t&                temp_storage_bytes,
+                InputIteratorT         d_in,
+                OutputIteratorT        d_out,
+                OffsetsOutputIteratorT d_bucket_offsets_out,
+                CountsOutputIteratorT  d_bucket_counts_out,
+                int                    num_buckets,
+                BucketOpT              bucket_op,
+                int                    num_items,
+                hipStream_t            stream = 0)
+    {
+        return detail::partition_buckets(d_temp_storage,
+                                         temp_storage_bytes,
+                                         d_in,
+                                         d_out,
+                                         d_bucket_offsets_out,
+                                         d_bucket_counts_out,
+                                         num_buckets,
+                                         bucket_op,
+                                         num_items,
+                                         stream);
+    }
 };
 
 END_HIPCUB_NAMESPACE
@@ -33,12 +33,342 @@
 #include "../../../config.hpp"
 #include "../../../util_deprecated.hpp"
 
+#include "../agent/agent_radix_sort_bytes.hpp"
+#include "../agent/agent_radix_sort_columns.hpp"
+#include "../agent/agent_radix_sort_count.hpp"
+#include "../agent/agent_radix_sort_in_place.hpp"
+#include "../agent/agent_single_block.hpp"
+#include "../util_temporary_storage.hpp"
+
+#include <cub/block/block_reduce.cuh>
 #include <cub/device/device_radix_sort.cuh>
+#include <cub/util_type.cuh>
 
+#include <algorithm>
 #include <type_traits>
 
 BEGIN_HIPCUB_NAMESPACE
 
+namespace detail
+{
+
+static constexpr unsigned int radix_sort_gather_block_size = 256;
+
+template<class IndexT>
+__global__ __launch_bounds__(radix_sort_gather_block_size) void radix_arg_sort_sequence_kernel(
+    IndexT* indices, size_t size)
+{
+    const size_t row
+        = static_cast<size_t>(blockIdx.x) * radix_sort_gather_block_size + threadIdx.x;
+    if(row < size)
+    {
+        indices[row] = static_cast<IndexT>(row);
+    }
+}
+
+/// Every thread reads the index of its row once and moves that row of all columns.
+template<class IndexT, class InputColumnsT, class OutputColumnsT>
+__global__ __launch_bounds__(radix_sort_gather_block_size) void radix_sort_gather_columns_kernel(
+    const IndexT*  indices,
+    InputColumnsT  columns_input,
+    OutputColumnsT columns_output,
+    unsigned int   num_columns,
+    size_t         size)
+{
+    const size_t row
+        = static_cast<size_t>(blockIdx.x) * radix_sort_gather_block_size + threadIdx.x;
+    if(row >= size)
+    {
+        return;
+    }
+
+    const IndexT index = indices[row];
+    for(unsigned int column = 0; column < num_columns; column++)
+    {
+        columns_output[column][row] = columns_input[column][index];
+    }
+}
+
+/// CUB only reads the values through pointers, so the indices are materialized in the temporary
+/// storage before the sort. When \p keys_output is \p nullptr the sorted keys are written to the
+/// temporary storage and discarded.
+template<bool Descending, class KeyT, class IndexT, class NumItemsT>
+inline hipError_t radix_arg_sort(void*       d_temp_storage,
+                                 size_t&     temp_storage_bytes,
+                                 const KeyT* keys_input,
+                                 KeyT*       keys_output,
+                                 IndexT*     indices_output,
+                                 NumItemsT   num_items,
+                                 int         begin_bit,
+                                 int         end_bit,
+                                 hipStream_t stream)
+{
+    const bool   discard_keys = keys_output == nullptr;
+    const size_t size         = num_items > 0 ? static_cast<size_t>(num_items) : 0;
+
+    auto sort = [&](void* d_sort_storage, size_t& sort_bytes, KeyT* keys, const IndexT* indices)
+    {
+        if(Descending)
+        {
+            return hipCUDAErrorTohipError(
+                ::cub::DeviceRadixSort::SortPairsDescending(d_sort_storage,
+                                                            sort_bytes,
+                                                            keys_input,
+                                                            keys,
+                                                            indices,
+                                                            indices_output,
+                                                            num_items,
+                                                            begin_bit,
+                                                            end_bit,
+                                                            stream));
+        }
+        return hipCUDAErrorTohipError(::cub::DeviceRadixSort::SortPairs(d_sort_storage,
+                                                                        sort_bytes,
+                                                                        keys_input,
+                                                                        keys,
+                                                                        indices,
+                                                                        indices_output,
+                                                                        num_items,
+                                                                        begin_bit,
+                                                                        end_bit,
+                                                                        stream));
+    };
+
+    size_t     sort_bytes = 0;
+    hipError_t error      = sort(nullptr, sort_bytes, keys_output, nullptr);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    void*  allocations[3]      = {};
+    size_t allocation_sizes[3] = {sort_bytes,
+                                  size * sizeof(IndexT),
+                                  discard_keys ? size * sizeof(KeyT) : 0};
+    error = AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes);
+    if(error != hipSuccess || d_temp_storage == nullptr)
+    {
+        return error;
+    }
+
+    IndexT* indices = static_cast<IndexT*>(allocations[1]);
+    if(size > 0)
+    {
+        const unsigned int grid_size = static_cast<unsigned int>(
+            (size + radix_sort_gather_block_size - 1) / radix_sort_gather_block_size);
+
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(radix_arg_sort_sequence_kernel),
+                           dim3(grid_size),
+                           dim3(radix_sort_gather_block_size),
+                           0,
+                           stream,
+                           indices,
+                           size);
+        error = hipGetLastError();
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+    }
+
+    return sort(allocations[0],
+                sort_bytes,
+                discard_keys ? static_cast<KeyT*>(allocations[2]) : keys_output,
+                indices);
+}
+
+template<class IndexT, class InputColumnsT, class OutputColumnsT, class NumItemsT>
+inline hipError_t radix_sort_gather_columns(void*          d_temp_storage,
+                                            size_t&        temp_storage_bytes,
+                                            const IndexT*  indices,
+                                            InputColumnsT  columns_input,
+                                            OutputColumnsT columns_output,
+                                            int            num_columns,
+                                            NumItemsT      num_items,
+                                            hipStream_t    stream)
+{
+    if(d_temp_storage == nullptr)
+    {
+        // Make sure user won't try to allocate 0 bytes memory
+        temp_storage_bytes = 1;
+        return hipSuccess;
+    }
+    if(num_columns <= 0 || num_items <= 0)
+    {
+        return hipSuccess;
+    }
+
+    const size_t       size      = static_cast<size_t>(num_items);
+    const unsigned int grid_size = static_cast<unsigned int>(
+        (size + radix_sort_gather_block_size - 1) / radix_sort_gather_block_size);
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(radix_sort_gather_columns_kernel),
+                       dim3(grid_size),
+                       dim3(radix_sort_gather_block_size),
+                       0,
+                       stream,
+                       indices,
+                       columns_input,
+                       columns_output,
+                       static_cast<unsigned int>(num_columns),
+                       size);
+    return hipGetLastError();
+}
+
+static constexpr unsigned int radix_sort_bits_block_size    = 256;
+static constexpr unsigned int radix_sort_bits_max_grid_size = 1024;
+
+struct radix_sort_bits_or
+{
+    HIPCUB_HOST_DEVICE HIPCUB_FORCEINLINE unsigned long long
+        operator()(unsigned long long lhs, unsigned long long rhs) const
+    {
+        return lhs | rhs;
+    }
+};
+
+/// Returns 64 bits of \p bits starting from bit <tt>64 * Word</tt>, or zero beyond the type.
+template<unsigned int Word, class BitsT>
+HIPCUB_DEVICE HIPCUB_FORCEINLINE unsigned long long radix_sort_bits_word(BitsT bits)
+{
+    constexpr unsigned int shift = Word * 64 < sizeof(BitsT) * 8 ? Word * 64 : 0;
+    return Word * 64 < sizeof(BitsT) * 8 ? static_cast<unsigned long long>(bits >> shift) : 0;
+}
+
+/// Sets every bit that differs between a key and the first key in \p mask, which holds two
+/// 64-bit words for keys of up to 16 bytes. Encoding the keys for sorting flips the same bits of
+/// all keys of the same sign and keys of different signs differ in the sign bit, so the raw bits
+/// give the same range as the encoded ones.
+template<class KeyT>
+__global__ __launch_bounds__(radix_sort_bits_block_size) void radix_sort_bits_kernel(
+    const KeyT* keys, unsigned long long* mask, size_t size)
+{
+    using bits_type         = typename ::cub::Traits<KeyT>::UnsignedBits;
+    using block_reduce_type = ::cub::BlockReduce<unsigned long long, radix_sort_bits_block_size>;
+
+    __shared__ ::cub::Uninitialized<typename block_reduce_type::TempStorage> storage;
+
+    const unsigned int flat_id = threadIdx.x;
+    const size_t       stride  = static_cast<size_t>(gridDim.x) * radix_sort_bits_block_size;
+    const bits_type*   bits    = reinterpret_cast<const bits_type*>(keys);
+    const bits_type    first   = bits[0];
+
+    bits_type differing = 0;
+    for(size_t row = static_cast<size_t>(blockIdx.x) * radix_sort_bits_block_size + flat_id;
+        row < size;
+        row += stride)
+    {
+        differing |= static_cast<bits_type>(bits[row] ^ first);
+    }
+
+    const unsigned long long low
+        = block_reduce_type(storage.Alias()).Reduce(radix_sort_bits_word<0>(differing),
+                                                    radix_sort_bits_or());
+    __syncthreads();
+    const unsigned long long high
+        = block_reduce_type(storage.Alias()).Reduce(radix_sort_bits_word<1>(differing),
+                                                    radix_sort_bits_or());
+    if(flat_id == 0)
+    {
+        atomicOr(&mask[0], low);
+        atomicOr(&mask[1], high);
+    }
+}
+
+/// Narrows the bit range of a sort to the bits that differ between the keys. \p sort is called
+/// with the temporary storage and the bit range, the size of its storage is queried for all bits.
+/// The mask of the differing bits is copied back, which synchronizes the stream once.
+template<class KeyT, class NumItemsT, class SortT>
+inline hipError_t radix_sort_detected_bits(void*       d_temp_storage,
+                                           size_t&     temp_storage_bytes,
+                                           const KeyT* keys_input,
+                                           NumItemsT   num_items,
+                                           hipStream_t stream,
+                                           SortT       sort)
+{
+    static_assert(sizeof(KeyT) <= 2 * sizeof(unsigned long long),
+                  "The bit range is detected for keys of up to 16 bytes");
+
+    const size_t size = num_items > 0 ? static_cast<size_t>(num_items) : 0;
+
+    size_t     sort_bytes = 0;
+    hipError_t error      = sort(nullptr, sort_bytes, 0, static_cast<int>(sizeof(KeyT) * 8));
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    void*  allocations[2]      = {};
+    size_t allocation_sizes[2] = {sort_bytes, 2 * sizeof(unsigned long long)};
+    error = AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes);
+    if(error != hipSuccess || d_temp_storage == nullptr)
+    {
+        return error;
+    }
+
+    unsigned long long mask[2] = {};
+    if(size > 1)
+    {
+        unsigned long long* d_mask = static_cast<unsigned long long*>(allocations[1]);
+        error = hipMemsetAsync(d_mask, 0, 2 * sizeof(unsigned long long), stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+
+        const size_t grid_size
+            = (size + radix_sort_bits_block_size - 1) / radix_sort_bits_block_size;
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(radix_sort_bits_kernel),
+                           dim3(std::min(grid_size, size_t(radix_sort_bits_max_grid_size))),
+                           dim3(radix_sort_bits_block_size),
+                           0,
+                           stream,
+                           keys_input,
+                           d_mask,
+                           size);
+        error = hipGetLastError();
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+
+        error = hipMemcpyAsync(mask,
+                               d_mask,
+                               2 * sizeof(unsigned long long),
+                               hipMemcpyDeviceToHost,
+                               stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        error = hipStreamSynchronize(stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+    }
+
+    // Equal keys still take a pass of one bit, which writes them to the output in a stable order
+    auto is_set  = [&](int bit) { return ((mask[bit / 64] >> (bit % 64)) & 1) != 0; };
+    int begin_bit = 0;
+    int end_bit   = 1;
+    if(mask[0] != 0 || mask[1] != 0)
+    {
+        while(!is_set(begin_bit))
+        {
+            begin_bit++;
+        }
+        end_bit = 128;
+        while(!is_set(end_bit - 1))
+        {
+            end_bit--;
+        }
+    }
+    return sort(allocations[0], sort_bytes, begin_bit, end_bit);
+}
+
+} // namespace detail
+
 struct DeviceRadixSort
 {
     template<typename KeyT, typename ValueT, typename NumItemsT>
@@ -53,6 +383,19 @@ struct DeviceRadixSort
                                                         int           end_bit   = sizeof(KeyT) * 8,
                                                         hipStream_t   stream    = 0)
     {
+        if(detail::single_block_sortable<KeyT>::value && detail::single_block_eligible(num_items))
+        {
+            return detail::single_block_radix_sort<false>(d_temp_storage,
+                                                          temp_storage_bytes,
+                                                          d_keys_in,
+                                                          d_keys_out,
+                                                          d_values_in,
+                                                          d_values_out,
+                                                          static_cast<size_t>(num_items),
+                                                          begin_bit,
+                                                          end_bit,
+                                                          stream);
+        }
         return hipCUDAErrorTohipError(::cub::DeviceRadixSort::SortPairs(d_temp_storage,
                                                                         temp_storage_bytes,
                                                                         d_keys_in,
@@ -239,6 +582,19 @@ struct DeviceRadixSort
                                                                   int end_bit = sizeof(KeyT) * 8,
                                                                   hipStream_t stream = 0)
     {
+        if(detail::single_block_sortable<KeyT>::value && detail::single_block_eligible(num_items))
+        {
+            return detail::single_block_radix_sort<true>(d_temp_storage,
+                                                         temp_storage_bytes,
+                                                         d_keys_in,
+                                                         d_keys_out,
+                                                         d_values_in,
+                                                         d_values_out,
+                                                         static_cast<size_t>(num_items),
+                                                         begin_bit,
+                                                         end_bit,
+                                                         stream);
+        }
         return hipCUDAErrorTohipError(
             ::cub::DeviceRadixSort::SortPairsDescending(d_temp_storage,
                                                         temp_storage_bytes,
@@ -429,6 +785,17 @@ struct DeviceRadixSort
                                                        int         end_bit   = sizeof(KeyT) * 8,
                                                        hipStream_t stream    = 0)
     {
+        if(detail::single_block_sortable<KeyT>::value && detail::single_block_eligible(num_items))
+        {
+            return detail::single_block_radix_sort<false>(d_temp_storage,
+                                                          temp_storage_bytes,
+                                                          d_keys_in,
+                                                          d_keys_out,
+                                                          static_cast<size_t>(num_items),
+                                                          begin_bit,
+                                                          end_bit,
+                                                          stream);
+        }
         return hipCUDAErrorTohipError(::cub::DeviceRadixSort::SortKeys(d_temp_storage,
                                                                        temp_storage_bytes,
                                                                        d_keys_in,
@@ -591,6 +958,17 @@ struct DeviceRadixSort
                                                                  int end_bit = sizeof(KeyT) * 8,
                                                                  hipStream_t stream = 0)
     {
+        if(detail::single_block_sortable<KeyT>::value && detail::single_block_eligible(num_items))
+        {
+            return detail::single_block_radix_sort<true>(d_temp_storage,
+                                                         temp_storage_bytes,
+                                                         d_keys_in,
+                                                         d_keys_out,
+                                                         static_cast<size_t>(num_items),
+                                                         begin_bit,
+                                                         end_bit,
+                                                         stream);
+        }
         return hipCUDAErrorTohipError(::cub::DeviceRadixSort::SortKeysDescending(d_temp_storage,
                                                                                  temp_storage_bytes,
                                                                                  d_keys_in,
@@ -742,6 +1120,379 @@ struct DeviceRadixSort
                                                                                  decomposer,
                                                                                  stream));
     }
+
+    /// \brief Computes the permutation that sorts the keys in ascending order, e.g. to reorder
+    /// many columns by one key with \p GatherColumns.
+    ///
+    /// <tt>d_indices_out[i]</tt> is the input position of the <tt>i</tt>-th smallest key, equal
+    /// keys keep their input order. On the rocPRIM backend the indices are generated while the keys
+    /// are read, on the CUB backend they are materialized in the temporary storage. When
+    /// \p d_keys_out is \p nullptr the sorted keys are discarded, they are then written to the
+    /// temporary storage which grows by <tt>num_items * sizeof(KeyT)</tt> bytes.
+    template<typename KeyT, typename IndexT, typename NumItemsT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t ArgSort(void*       d_temp_storage,
+                                                      size_t&     temp_storage_bytes,
+                                                      const KeyT* d_keys_in,
+                                                      KeyT*       d_keys_out,
+                                                      IndexT*     d_indices_out,
+                                                      NumItemsT   num_items,
+                                                      int         begin_bit = 0,
+                                                      int         end_bit   = sizeof(KeyT) * 8,
+                                                      hipStream_t stream    = 0)
+    {
+        return detail::radix_arg_sort<false>(d_temp_storage,
+                                             temp_storage_bytes,
+                                             d_keys_in,
+                                             d_keys_out,
+                                             d_indices_out,
+                                             num_items,
+                                             begin_bit,
+                                             end_bit,
+                                             stream);
+    }
+
+    /// \brief Computes the permutation that sorts the keys in descending order, see \p ArgSort.
+    template<typename KeyT, typename IndexT, typename NumItemsT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        ArgSortDescending(void*       d_temp_storage,
+                          size_t&     temp_storage_bytes,
+                          const KeyT* d_keys_in,
+                          KeyT*       d_keys_out,
+                          IndexT*     d_indices_out,
+                          NumItemsT   num_items,
+                          int         begin_bit = 0,
+                          int         end_bit   = sizeof(KeyT) * 8,
+                          hipStream_t stream    = 0)
+    {
+        return detail::radix_arg_sort<true>(d_temp_storage,
+                                            temp_storage_bytes,
+                                            d_keys_in,
+                                            d_keys_out,
+                                            d_indices_out,
+                                            num_items,
+                                            begin_bit,
+                                            end_bit,
+                                            stream);
+    }
+
+    /// \brief Applies a permutation to several columns of the same value type:
+    /// <tt>d_columns_out[c][i] = d_columns_in[c][d_indices[i]]</tt>.
+    ///
+    /// \p d_columns_in and \p d_columns_out are device accessible arrays of \p num_columns
+    /// column pointers or iterators. Every index is read once per row for all columns, instead of
+    /// once per column. Columns of different value types are gathered with one call per type.
+    template<typename IndexT, typename InputColumnsT, typename OutputColumnsT, typename NumItemsT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t GatherColumns(void*          d_temp_storage,
+                                                            size_t&        temp_storage_bytes,
+                                                            const IndexT*  d_indices,
+                                                            InputColumnsT  d_columns_in,
+                                                            OutputColumnsT d_columns_out,
+                                                            int            num_columns,
+                                                            NumItemsT      num_items,
+                                                            hipStream_t    stream = 0)
+    {
+        return detail::radix_sort_gather_columns(d_temp_storage,
+                                                 temp_storage_bytes,
+                                                 d_indices,
+                                                 d_columns_in,
+                                                 d_columns_out,
+                                                 num_columns,
+                                                 num_items,
+                                                 stream);
+    }
+
+    /// \brief Computes the permutation that sorts the rows of several columns lexicographically,
+    /// the first column being the most significant. Equal rows keep their order.
+    ///
+    /// \p columns is a host array of \p num_columns descriptors, at most 16. The value range of
+    /// every column is reduced on the device first and copied back, which synchronizes
+    /// \p stream. Each column then takes only the bits of its range, and adjacent columns are
+    /// packed into composite keys of up to 64 bits, or 128 bits when 128-bit integers are
+    /// available. Every composite key takes one stable sort pass, so e.g. four 16-bit columns are
+    /// sorted in one pass instead of four. The rows are reordered with \p GatherColumns.
+    template<typename IndexT, typename NumItemsT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        ArgSortColumns(void*                  d_temp_storage,
+                       size_t&                temp_storage_bytes,
+                       const RadixSortColumn* columns,
+                       int                    num_columns,
+                       IndexT*                d_indices_out,
+                       NumItemsT              num_items,
+                       hipStream_t            stream = 0)
+    {
+        return detail::radix_sort_columns(d_temp_storage,
+                                          temp_storage_bytes,
+                                          columns,
+                                          num_columns,
+                                          d_indices_out,
+                                          num_items,
+                                          stream);
+    }
+
+    /// \brief Computes the permutation that sorts fixed-length byte strings lexicographically,
+    /// comparing the bytes as unsigned values. Equal keys keep their order.
+    ///
+    /// \p d_keys holds \p num_items keys of \p key_bytes bytes each, one after another. The keys
+    /// are sorted most significant first in words of 8 bytes, and every word is sorted only for
+    /// the keys whose preceding bytes are shared with another key. The number of such keys is
+    /// copied back after every word, which synchronizes \p stream, so keys that become unique
+    /// early, e.g. hashes or ids with a long tail, take a single pass.
+    template<typename IndexT, typename NumItemsT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t ArgSortBytes(void*                d_temp_storage,
+                                                           size_t&              temp_storage_bytes,
+                                                           const unsigned char* d_keys,
+                                                           int                  key_bytes,
+                                                           IndexT*              d_indices_out,
+                                                           NumItemsT            num_items,
+                                                           hipStream_t          stream = 0)
+    {
+        return detail::radix_sort_bytes(d_temp_storage,
+                                        temp_storage_bytes,
+                                        d_keys,
+                                        key_bytes,
+                                        d_indices_out,
+                                        num_items,
+                                        stream);
+    }
+
+    /// \brief Computes the distinct keys of \p d_keys_in in ascending order and the number of
+    /// occurrences of each, the result of \p SortKeys followed by
+    /// \p DeviceRunLengthEncode::Encode without writing and reading back the sorted keys.
+    ///
+    /// Every tile of 2048 keys is sorted in LDS and collapsed to one (key, count) pair per
+    /// distinct key before the device sort, so inputs with many repeated keys sort and reduce
+    /// only a fraction of their items. Inputs of more than one tile copy back the number of
+    /// pairs, which synchronizes \p stream. \p CountT must hold the number of occurrences of
+    /// any key. Up to <tt>2^32 - 1</tt> keys are supported.
+    template<typename KeyT, typename CountT, typename NumUniqueOutputIteratorT, typename NumItemsT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        SortKeysAndCount(void*                    d_temp_storage,
+                         size_t&                  temp_storage_bytes,
+                         const KeyT*              d_keys_in,
+                         KeyT*                    d_unique_out,
+                         CountT*                  d_counts_out,
+                         NumUniqueOutputIteratorT d_num_unique_out,
+                         NumItemsT                num_items,
+                         hipStream_t              stream = 0)
+    {
+        return detail::radix_sort_count(d_temp_storage,
+                                        temp_storage_bytes,
+                                        d_keys_in,
+                                        d_unique_out,
+                                        d_counts_out,
+                                        d_num_unique_out,
+                                        num_items,
+                                        stream);
+    }
+
+    /// \brief Sorts like \p SortKeys after narrowing the bit range to the bits that differ
+    /// between the keys, so e.g. 64-bit ids or timestamps that vary in their low 20 to 35 bits
+    /// take only the passes of those bits.
+    ///
+    /// A prepass reduces the OR of every key XOR the first key on the device and copies it back,
+    /// which synchronizes \p stream. Keys of up to 16 bytes, including 128-bit integers, are
+    /// supported.
+    template<typename KeyT, typename NumItemsT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t SortKeysDetectBits(void*       d_temp_storage,
+                                                                 size_t&     temp_storage_bytes,
+                                                                 const KeyT* d_keys_in,
+                                                                 KeyT*       d_keys_out,
+                                                                 NumItemsT   num_items,
+                                                                 hipStream_t stream = 0)
+    {
+        return detail::radix_sort_detected_bits(
+            d_temp_storage,
+            temp_storage_bytes,
+            d_keys_in,
+            num_items,
+            stream,
+            [&](void* d_sort_storage, size_t& sort_bytes, int begin_bit, int end_bit)
+            {
+                return SortKeys(d_sort_storage,
+                                sort_bytes,
+                                d_keys_in,
+                                d_keys_out,
+                                num_items,
+                                begin_bit,
+                                end_bit,
+                                stream);
+            });
+    }
+
+    /// \brief Sorts like \p SortKeysDescending after narrowing the bit range, see
+    /// \p SortKeysDetectBits.
+    template<typename KeyT, typename NumItemsT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        SortKeysDescendingDetectBits(void*       d_temp_storage,
+                                     size_t&     temp_storage_bytes,
+                                     const KeyT* d_keys_in,
+                                     KeyT*       d_keys_out,
+                                     NumItemsT   num_items,
+                                     hipStream_t stream = 0)
+    {
+        return detail::radix_sort_detected_bits(
+            d_temp_storage,
+            temp_storage_bytes,
+            d_keys_in,
+            num_items,
+            stream,
+            [&](void* d_sort_storage, size_t& sort_bytes, int begin_bit, int end_bit)
+            {
+                return SortKeysDescending(d_sort_storage,
+                                          sort_bytes,
+                                          d_keys_in,
+                                          d_keys_out,
+                                          num_items,
+                                          begin_bit,
+                                          end_bit,
+                                          stream);
+            });
+    }
+
+    /// \brief Sorts like \p SortPairs after narrowing the bit range, see
+    /// \p SortKeysDetectBits.
+    template<typename KeyT, typename ValueT, typename NumItemsT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t SortPairsDetectBits(void*         d_temp_storage,
+                                                                  size_t&       temp_storage_bytes,
+                                                                  const KeyT*   d_keys_in,
+                                                                  KeyT*         d_keys_out,
+                                                                  const ValueT* d_values_in,
+                                                                  ValueT*       d_values_out,
+                                                                  NumItemsT     num_items,
+                                                                  hipStream_t   stream = 0)
+    {
+        return detail::radix_sort_detected_bits(
+            d_temp_storage,
+            temp_storage_bytes,
+            d_keys_in,
+            num_items,
+            stream,
+            [&](void* d_sort_storage, size_t& sort_bytes, int begin_bit, int end_bit)
+            {
+                return SortPairs(d_sort_storage,
+                                 sort_bytes,
+                                 d_keys_in,
+                                 d_keys_out,
+                                 d_values_in,
+                                 d_values_out,
+                                 num_items,
+                                 begin_bit,
+                                 end_bit,
+                                 stream);
+            });
+    }
+
+    /// \brief Sorts like \p SortPairsDescending after narrowing the bit range, see
+    /// \p SortKeysDetectBits.
+    template<typename KeyT, typename ValueT, typename NumItemsT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        SortPairsDescendingDetectBits(void*         d_temp_storage,
+                                      size_t&       temp_storage_bytes,
+                                      const KeyT*   d_keys_in,
+                                      KeyT*         d_keys_out,
+                                      const ValueT* d_values_in,
+                                      ValueT*       d_values_out,
+                                      NumItemsT     num_items,
+                                      hipStream_t   stream = 0)
+    {
+        return detail::radix_sort_detected_bits(
+            d_temp_storage,
+            temp_storage_bytes,
+            d_keys_in,
+            num_items,
+            stream,
+            [&](void* d_sort_storage, size_t& sort_bytes, int begin_bit, int end_bit)
+            {
+                return SortPairsDescending(d_sort_storage,
+                                           sort_bytes,
+                                           d_keys_in,
+                                           d_keys_out,
+                                           d_values_in,
+                                           d_values_out,
+                                           num_items,
+                                           begin_bit,
+                                           end_bit,
+                                           stream);
+            });
+    }
+
+    /// \brief Sorts the keys in place with a most significant digit first radix sort, for inputs
+    /// too large to have an output buffer of the same size.
+    ///
+    /// Every level moves the items of each segment directly into the buckets of their 8-bit
+    /// digit, buckets of at most 2048 items are then sorted by one block each in LDS and larger
+    /// buckets are partitioned by the next digit. The auxiliary memory is the state of 256
+    /// buckets for a batch of up to 1024 segments and a list with one segment per 2048 items.
+    /// The sort is not stable, reads the number of segments of every level back, which
+    /// synchronizes \p stream, and supports up to <tt>2^31 - 1</tt> integral or floating point
+    /// keys.
+    template<typename KeyT, typename NumItemsT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t SortKeysInPlace(void*       d_temp_storage,
+                                                              size_t&     temp_storage_bytes,
+                                                              KeyT*       d_keys,
+                                                              NumItemsT   num_items,
+                                                              hipStream_t stream = 0)
+    {
+        return detail::radix_sort_in_place<false>(d_temp_storage,
+                                                  temp_storage_bytes,
+                                                  d_keys,
+                                                  static_cast<::cub::NullType*>(nullptr),
+                                                  num_items,
+                                                  stream);
+    }
+
+    /// \brief Sorts the keys in descending order in place, see \p SortKeysInPlace.
+    template<typename KeyT, typename NumItemsT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        SortKeysDescendingInPlace(void*       d_temp_storage,
+                                  size_t&     temp_storage_bytes,
+                                  KeyT*       d_keys,
+                                  NumItemsT   num_items,
+                                  hipStream_t stream = 0)
+    {
+        return detail::radix_sort_in_place<true>(d_temp_storage,
+                                                 temp_storage_bytes,
+                                                 d_keys,
+                                                 static_cast<::cub::NullType*>(nullptr),
+                                                 num_items,
+                                                 stream);
+    }
+
+    /// \brief Sorts the keys and values in place, see \p SortKeysInPlace.
+    template<typename KeyT, typename ValueT, typename NumItemsT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t SortPairsInPlace(void*       d_temp_storage,
+                                                               size_t&     temp_storage_bytes,
+                                                               KeyT*       d_keys,
+                                                               ValueT*     d_values,
+                                                               NumItemsT   num_items,
+                                                               hipStream_t stream = 0)
+    {
+        return detail::radix_sort_in_place<false>(d_temp_storage,
+                                                  temp_storage_bytes,
+                                                  d_keys,
+                                                  d_values,
+                                                  num_items,
+                                                  stream);
+    }
+
+    /// \brief Sorts the keys and values in descending order in place, see
+    /// \p SortKeysInPlace.
+    template<typename KeyT, typename ValueT, typename NumItemsT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        SortPairsDescendingInPlace(void*       d_temp_storage,
+                                   size_t&     temp_storage_bytes,
+                                   KeyT*       d_keys,
+                                   ValueT*     d_values,
+                                   NumItemsT   num_items,
+                                   hipStream_t stream = 0)
+    {
+        return detail::radix_sort_in_place<true>(d_temp_storage,
+                                                 temp_storage_bytes,
+                                                 d_keys,
+                                                 d_values,
+                                                 num_items,
+                                                 stream);
+    }
 };
 
 END_HIPCUB_NAMESPACE
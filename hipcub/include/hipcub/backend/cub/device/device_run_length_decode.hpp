@@ -0,0 +1,297 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HIPCUB_CUB_DEVICE_DEVICE_RUN_LENGTH_DECODE_HPP_
+#define HIPCUB_CUB_DEVICE_DEVICE_RUN_LENGTH_DECODE_HPP_
+
+#include "../../../config.hpp"
+
+#include "../util_temporary_storage.hpp"
+
+#include <cub/device/device_scan.cuh>
+#include <cub/iterator/transform_input_iterator.cuh>
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace detail
+{
+
+static constexpr unsigned int run_length_decode_block_size       = 256;
+static constexpr unsigned int run_length_decode_items_per_thread = 8;
+static constexpr unsigned int run_length_decode_items_per_tile
+    = run_length_decode_block_size * run_length_decode_items_per_thread;
+static constexpr unsigned int run_length_decode_blocks_per_sm = 4;
+
+struct run_length_decode_offset_op
+{
+    template<class T>
+    __host__ __device__ size_t operator()(const T& length) const
+    {
+        return static_cast<size_t>(length);
+    }
+};
+
+template<class EndOffsetIteratorT>
+__device__ long long run_length_decode_merge_path_search(long long          diagonal,
+                                                         EndOffsetIteratorT run_ends,
+                                                         long long          first,
+                                                         long long          num_runs,
+                                                         long long          num_items)
+{
+    long long split_min = diagonal > num_items ? diagonal - num_items : 0;
+    long long split_max = diagonal < num_runs ? diagonal : num_runs;
+    while(split_min < split_max)
+    {
+        const long long split_pivot = (split_min + split_max) / 2;
+        if(static_cast<long long>(run_ends[split_pivot])
+           <= first + diagonal - split_pivot - 1)
+        {
+            split_min = split_pivot + 1;
+        }
+        else
+        {
+            split_max = split_pivot;
+        }
+    }
+    return split_min;
+}
+
+/// Same merge path decoding as on the rocPRIM backend, CUB does not provide a device-wide
+/// run-length decode.
+template<class ValuesInputIteratorT, class OffsetIteratorT, class OutputIteratorT>
+__global__ __launch_bounds__(run_length_decode_block_size) void run_length_decode_kernel(
+    ValuesInputIteratorT values,
+    OffsetIteratorT      run_offsets,
+    OutputIteratorT      output,
+    unsigned int         num_runs)
+{
+    constexpr unsigned int block_size       = run_length_decode_block_size;
+    constexpr unsigned int items_per_thread = run_length_decode_items_per_thread;
+    constexpr long long    items_per_tile   = run_length_decode_items_per_tile;
+
+    __shared__ long long tile_run_ends[items_per_tile + 1];
+    __shared__ long long tile_coordinates[2];
+
+    const unsigned int flat_id  = threadIdx.x;
+    const auto         run_ends = run_offsets + 1;
+
+    const long long first       = static_cast<long long>(run_offsets[0]);
+    const long long num_items   = static_cast<long long>(run_offsets[num_runs]) - first;
+    const long long path_length = num_runs + num_items;
+    const long long num_tiles   = (path_length + items_per_tile - 1) / items_per_tile;
+
+    for(long long tile = blockIdx.x; tile < num_tiles; tile += gridDim.x)
+    {
+        if(flat_id < 2)
+        {
+            const long long diagonal = (tile + flat_id) * items_per_tile;
+            tile_coordinates[flat_id]
+                = run_length_decode_merge_path_search(diagonal < path_length ? diagonal
+                                                                             : path_length,
+                                                      run_ends,
+                                                      first,
+                                                      num_runs,
+                                                      num_items);
+        }
+        __syncthreads();
+
+        const long long tile_diagonal = tile * items_per_tile;
+        const long long tile_x        = tile_coordinates[0];
+        const long long tile_y        = tile_diagonal - tile_x;
+        const long long tile_runs     = tile_coordinates[1] - tile_x;
+        const long long tile_end      = tile_diagonal + items_per_tile;
+        const long long tile_length
+            = (tile_end < path_length ? tile_end : path_length) - tile_diagonal;
+        const long long tile_items = tile_length - tile_runs;
+
+        for(long long i = flat_id; i <= tile_runs; i += block_size)
+        {
+            tile_run_ends[i] = tile_x + i < num_runs
+                                   ? static_cast<long long>(run_ends[tile_x + i]) - first
+                                   : num_items;
+        }
+        __syncthreads();
+
+        long long thread_diagonal = static_cast<long long>(flat_id) * items_per_thread;
+        thread_diagonal           = thread_diagonal < tile_length ? thread_diagonal : tile_length;
+        long long split_min = thread_diagonal > tile_items ? thread_diagonal - tile_items : 0;
+        long long split_max = thread_diagonal < tile_runs ? thread_diagonal : tile_runs;
+        while(split_min < split_max)
+        {
+            const long long split_pivot = (split_min + split_max) / 2;
+            if(tile_run_ends[split_pivot] <= tile_y + thread_diagonal - split_pivot - 1)
+            {
+                split_min = split_pivot + 1;
+            }
+            else
+            {
+                split_max = split_pivot;
+            }
+        }
+
+        long long x = split_min;
+        long long y = thread_diagonal - split_min;
+        for(unsigned int item = 0; item < items_per_thread && x + y < tile_length; item++)
+        {
+            if(y < tile_items && tile_y + y < tile_run_ends[x])
+            {
+                output[first + tile_y + y] = values[tile_x + x];
+                y++;
+            }
+            else
+            {
+                x++;
+            }
+        }
+        __syncthreads();
+    }
+}
+
+template<class ValuesInputIteratorT, class OffsetIteratorT, class OutputIteratorT>
+inline hipError_t run_length_decode(ValuesInputIteratorT values,
+                                    OffsetIteratorT      run_offsets,
+                                    OutputIteratorT      output,
+                                    unsigned int         num_runs,
+                                    hipStream_t          stream)
+{
+    int        device_id;
+    hipError_t error = hipGetDevice(&device_id);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    int sm_count;
+    error = hipDeviceGetAttribute(&sm_count, hipDeviceAttributeMultiprocessorCount, device_id);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(run_length_decode_kernel),
+                       dim3(sm_count * run_length_decode_blocks_per_sm),
+                       dim3(run_length_decode_block_size),
+                       0,
+                       stream,
+                       values,
+                       run_offsets,
+                       output,
+                       num_runs);
+    return hipGetLastError();
+}
+
+} // namespace detail
+
+struct DeviceRunLengthDecode
+{
+    template<typename ValuesInputIteratorT,
+             typename LengthsInputIteratorT,
+             typename DecodedOutputIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t Decode(void*                  d_temp_storage,
+                                                     size_t&                temp_storage_bytes,
+                                                     ValuesInputIteratorT   d_values_in,
+                                                     LengthsInputIteratorT  d_run_lengths_in,
+                                                     DecodedOutputIteratorT d_decoded_out,
+                                                     int                    num_runs,
+                                                     hipStream_t            stream = 0)
+    {
+        const int runs = num_runs > 0 ? num_runs : 0;
+        const ::cub::TransformInputIterator<size_t,
+                                            detail::run_length_decode_offset_op,
+                                            LengthsInputIteratorT>
+            lengths(d_run_lengths_in, detail::run_length_decode_offset_op());
+
+        size_t      scan_bytes = 0;
+        cudaError_t error      = ::cub::DeviceScan::InclusiveSum(nullptr,
+                                                            scan_bytes,
+                                                            lengths,
+                                                            static_cast<size_t*>(nullptr),
+                                                            runs,
+                                                            stream);
+        if(error != cudaSuccess)
+        {
+            return hipCUDAErrorTohipError(error);
+        }
+
+        void*      allocations[2]      = {};
+        size_t     allocation_sizes[2] = {scan_bytes, (runs + 1) * sizeof(size_t)};
+        hipError_t result
+            = AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes);
+        if(result != hipSuccess || d_temp_storage == nullptr || runs == 0)
+        {
+            return result;
+        }
+
+        size_t* d_run_offsets = static_cast<size_t*>(allocations[1]);
+        result                = hipMemsetAsync(d_run_offsets, 0, sizeof(size_t), stream);
+        if(result != hipSuccess)
+        {
+            return result;
+        }
+        error = ::cub::DeviceScan::InclusiveSum(allocations[0],
+                                                scan_bytes,
+                                                lengths,
+                                                d_run_offsets + 1,
+                                                runs,
+                                                stream);
+        if(error != cudaSuccess)
+        {
+            return hipCUDAErrorTohipError(error);
+        }
+
+        return detail::run_length_decode(d_values_in,
+                                         d_run_offsets,
+                                         d_decoded_out,
+                                         static_cast<unsigned int>(runs),
+                                         stream);
+    }
+
+    template<typename ValuesInputIteratorT,
+             typename OffsetsInputIteratorT,
+             typename DecodedOutputIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t DecodeOffsets(void*   d_temp_storage,
+                                                            size_t& temp_storage_bytes,
+                                                            ValuesInputIteratorT  d_values_in,
+                                                            OffsetsInputIteratorT d_run_offsets_in,
+                                                            DecodedOutputIteratorT d_decoded_out,
+                                                            int                    num_runs,
+                                                            hipStream_t            stream = 0)
+    {
+        if(d_temp_storage == nullptr)
+        {
+            temp_storage_bytes = 4;
+            return hipSuccess;
+        }
+        if(num_runs <= 0)
+        {
+            return hipSuccess;
+        }
+        return detail::run_length_decode(d_values_in,
+                                         d_run_offsets_in,
+                                         d_decoded_out,
+                                         static_cast<unsigned int>(num_runs),
+                                         stream);
+    }
+};
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_CUB_DEVICE_DEVICE_RUN_LENGTH_DECODE_HPP_
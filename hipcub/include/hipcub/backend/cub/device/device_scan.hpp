@@ -32,9 +32,15 @@
 
 #include "../../../config.hpp"
 #include "../../../util_deprecated.hpp"
+#include "../agent/agent_reproducible_scan.hpp"
+#include "../agent/agent_single_block.hpp"
 
 #include <cub/device/device_scan.cuh>
 
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
 BEGIN_HIPCUB_NAMESPACE
 
 class DeviceScan
@@ -109,6 +115,19 @@ public:
                                     int             num_items,
                                     hipStream_t     stream = 0)
     {
+        if(detail::single_block_eligible(num_items))
+        {
+            using InputT = ::cub::detail::value_t<InputIteratorT>;
+            using AccT   = ::cub::detail::accumulator_t<ScanOpT, InputT, InputT>;
+            return detail::single_block_scan<false, AccT>(d_temp_storage,
+                                                          temp_storage_bytes,
+                                                          d_in,
+                                                          d_out,
+                                                          num_items,
+                                                          scan_op,
+                                                          AccT{},
+                                                          stream);
+        }
         return hipCUDAErrorTohipError(::cub::DeviceScan::InclusiveScan(d_temp_storage,
                                                                        temp_storage_bytes,
                                                                        d_in,
@@ -235,6 +254,69 @@ public:
                                        stream);
     }
 
+    /// \brief Computes a device-wide inclusive prefix sum that is bitwise identical on every
+    /// device.
+    ///
+    /// The input is split into tiles of a fixed size and every prefix is added up in a fixed
+    /// order, so unlike \p InclusiveSum the result for floating-point inputs does not depend on
+    /// the device, the grid size or the tuning config, only on the number of items. The scan can
+    /// run in place.
+    template<typename InputIteratorT, typename OutputIteratorT>
+    HIPCUB_RUNTIME_FUNCTION
+    static hipError_t ReproducibleInclusiveSum(void*           d_temp_storage,
+                                               size_t&         temp_storage_bytes,
+                                               InputIteratorT  d_in,
+                                               OutputIteratorT d_out,
+                                               size_t          num_items,
+                                               hipStream_t     stream = 0)
+    {
+        using InputT  = typename std::iterator_traits<InputIteratorT>::value_type;
+        using OutputT = typename std::iterator_traits<OutputIteratorT>::value_type;
+        using AccT    = std::conditional_t<std::is_void<OutputT>::value, InputT, OutputT>;
+
+        if(d_temp_storage == nullptr)
+        {
+            temp_storage_bytes = std::max<size_t>(
+                detail::reproducible_scan_temp_storage_bytes<AccT>(num_items),
+                4);
+            return hipSuccess;
+        }
+        return detail::reproducible_scan<false, AccT>(d_in,
+                                                      d_out,
+                                                      num_items,
+                                                      static_cast<AccT*>(d_temp_storage),
+                                                      stream);
+    }
+
+    /// \brief Computes a device-wide exclusive prefix sum that is bitwise identical on every
+    /// device, see \p ReproducibleInclusiveSum.
+    template<typename InputIteratorT, typename OutputIteratorT>
+    HIPCUB_RUNTIME_FUNCTION
+    static hipError_t ReproducibleExclusiveSum(void*           d_temp_storage,
+                                               size_t&         temp_storage_bytes,
+                                               InputIteratorT  d_in,
+                                               OutputIteratorT d_out,
+                                               size_t          num_items,
+                                               hipStream_t     stream = 0)
+    {
+        using InputT  = typename std::iterator_traits<InputIteratorT>::value_type;
+        using OutputT = typename std::iterator_traits<OutputIteratorT>::value_type;
+        using AccT    = std::conditional_t<std::is_void<OutputT>::value, InputT, OutputT>;
+
+        if(d_temp_storage == nullptr)
+        {
+            temp_storage_bytes = std::max<size_t>(
+                detail::reproducible_scan_temp_storage_bytes<AccT>(num_items),
+                4);
+            return hipSuccess;
+        }
+        return detail::reproducible_scan<true, AccT>(d_in,
+                                                     d_out,
+                                                     num_items,
+                                                     static_cast<AccT*>(d_temp_storage),
+                                                     stream);
+    }
+
     template<typename InputIteratorT,
              typename OutputIteratorT,
              typename ScanOpT,
@@ -249,6 +331,19 @@ public:
                                     int             num_items,
                                     hipStream_t     stream = 0)
     {
+        if(detail::single_block_eligible(num_items))
+        {
+            using InputT = ::cub::detail::value_t<InputIteratorT>;
+            using AccT   = ::cub::detail::accumulator_t<ScanOpT, InitValueT, InputT>;
+            return detail::single_block_scan<true, AccT>(d_temp_storage,
+                                                         temp_storage_bytes,
+                                                         d_in,
+                                                         d_out,
+                                                         num_items,
+                                                         scan_op,
+                                                         static_cast<AccT>(init_value),
+                                                         stream);
+        }
         return hipCUDAErrorTohipError(::cub::DeviceScan::ExclusiveScan(d_temp_storage,
                                                                        temp_storage_bytes,
                                                                        d_in,
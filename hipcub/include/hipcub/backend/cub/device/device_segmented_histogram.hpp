@@ -0,0 +1,372 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef HIPCUB_CUB_DEVICE_DEVICE_SEGMENTED_HISTOGRAM_HPP_
+#define HIPCUB_CUB_DEVICE_DEVICE_SEGMENTED_HISTOGRAM_HPP_
+
+#include "../../../config.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace detail
+{
+
+/// Every segment is counted by one block. Histograms of up to
+/// \p segmented_histogram_shared_max_bins bins are privatised in LDS and written once, larger
+/// ones are counted with atomics directly in the output row of the segment. CUB does not
+/// provide segmented histograms, these are the same kernels as on the rocPRIM backend.
+static constexpr unsigned int segmented_histogram_block_size      = 256;
+static constexpr unsigned int segmented_histogram_shared_max_bins = 2048;
+static constexpr unsigned int segmented_histogram_max_grid_size   = 8192;
+
+template<class SampleT, class LevelT>
+struct segmented_histogram_even_op
+{
+    using common_type = typename std::common_type<LevelT, SampleT>::type;
+
+    common_type  lower_level;
+    common_type  upper_level;
+    unsigned int num_bins;
+
+    HIPCUB_DEVICE bool operator()(const SampleT& sample, unsigned int& bin) const
+    {
+        const common_type value = static_cast<common_type>(sample);
+        if(!(value >= lower_level && value < upper_level))
+        {
+            return false;
+        }
+        bin = to_bin(value, std::is_integral<common_type>{});
+        return true;
+    }
+
+private:
+    HIPCUB_DEVICE unsigned int to_bin(common_type value, std::true_type /* is_integral */) const
+    {
+        return static_cast<unsigned int>(static_cast<uint64_t>(value - lower_level) * num_bins
+                                         / static_cast<uint64_t>(upper_level - lower_level));
+    }
+
+    HIPCUB_DEVICE unsigned int to_bin(common_type value, std::false_type /* is_integral */) const
+    {
+        // Rounding may map values just below the upper level to one bin past the end
+        const unsigned int bin = static_cast<unsigned int>((value - lower_level) * num_bins
+                                                           / (upper_level - lower_level));
+        return bin < num_bins ? bin : num_bins - 1;
+    }
+};
+
+template<class SampleT, class LevelT>
+struct segmented_histogram_range_op
+{
+    const LevelT* levels;
+    unsigned int  num_levels;
+
+    HIPCUB_DEVICE bool operator()(const SampleT& sample, unsigned int& bin) const
+    {
+        if(!(sample >= levels[0] && sample < levels[num_levels - 1]))
+        {
+            return false;
+        }
+        // Index of the last level that is not greater than the sample
+        unsigned int first = 0;
+        unsigned int last  = num_levels - 1;
+        while(last - first > 1)
+        {
+            const unsigned int middle = first + (last - first) / 2;
+            if(sample < levels[middle])
+            {
+                last = middle;
+            }
+            else
+            {
+                first = middle;
+            }
+        }
+        bin = first;
+        return true;
+    }
+};
+
+/// Counts the samples of a segment in LDS, the counters are cleared and written out in full so
+/// the output does not need to be initialized.
+template<class SampleIteratorT,
+         class CounterT,
+         class BeginOffsetIteratorT,
+         class EndOffsetIteratorT,
+         class BinOpT>
+__global__
+    __launch_bounds__(segmented_histogram_block_size) void segmented_histogram_shared_kernel(
+        SampleIteratorT      samples,
+        CounterT*            histograms,
+        BeginOffsetIteratorT begin_offsets,
+        EndOffsetIteratorT   end_offsets,
+        unsigned int         num_segments,
+        unsigned int         num_bins,
+        BinOpT               bin_op)
+{
+    __shared__ unsigned int counters[segmented_histogram_shared_max_bins];
+
+    const unsigned int flat_id = threadIdx.x;
+
+    for(unsigned int segment = blockIdx.x; segment < num_segments;
+        segment += gridDim.x)
+    {
+        for(unsigned int bin = flat_id; bin < num_bins; bin += segmented_histogram_block_size)
+        {
+            counters[bin] = 0;
+        }
+        __syncthreads();
+
+        const auto begin = begin_offsets[segment];
+        const auto end   = end_offsets[segment];
+        for(auto i = begin + flat_id; i < end; i += segmented_histogram_block_size)
+        {
+            unsigned int bin;
+            if(bin_op(samples[i], bin))
+            {
+                atomicAdd(&counters[bin], 1u);
+            }
+        }
+        __syncthreads();
+
+        CounterT* histogram = histograms + static_cast<size_t>(segment) * num_bins;
+        for(unsigned int bin = flat_id; bin < num_bins; bin += segmented_histogram_block_size)
+        {
+            histogram[bin] = static_cast<CounterT>(counters[bin]);
+        }
+        // The counters are cleared for the next segment
+        __syncthreads();
+    }
+}
+
+/// Counts the samples of a segment with atomics in its output row. The block owning the segment
+/// clears the row first, so this is still a single launch.
+template<class SampleIteratorT,
+         class CounterT,
+         class BeginOffsetIteratorT,
+         class EndOffsetIteratorT,
+         class BinOpT>
+__global__
+    __launch_bounds__(segmented_histogram_block_size) void segmented_histogram_global_kernel(
+        SampleIteratorT      samples,
+        CounterT*            histograms,
+        BeginOffsetIteratorT begin_offsets,
+        EndOffsetIteratorT   end_offsets,
+        unsigned int         num_segments,
+        unsigned int         num_bins,
+        BinOpT               bin_op)
+{
+    const unsigned int flat_id = threadIdx.x;
+
+    for(unsigned int segment = blockIdx.x; segment < num_segments;
+        segment += gridDim.x)
+    {
+        CounterT* histogram = histograms + static_cast<size_t>(segment) * num_bins;
+        for(unsigned int bin = flat_id; bin < num_bins; bin += segmented_histogram_block_size)
+        {
+            histogram[bin] = CounterT(0);
+        }
+        __syncthreads();
+
+        const auto begin = begin_offsets[segment];
+        const auto end   = end_offsets[segment];
+        for(auto i = begin + flat_id; i < end; i += segmented_histogram_block_size)
+        {
+            unsigned int bin;
+            if(bin_op(samples[i], bin))
+            {
+                atomicAdd(&histogram[bin], CounterT(1));
+            }
+        }
+    }
+}
+
+template<class SampleIteratorT,
+         class CounterT,
+         class BeginOffsetIteratorT,
+         class EndOffsetIteratorT,
+         class BinOpT>
+inline hipError_t segmented_histogram(void*                d_temp_storage,
+                                      size_t&              temp_storage_bytes,
+                                      SampleIteratorT      samples,
+                                      CounterT*            histograms,
+                                      int                  num_levels,
+                                      int                  num_segments,
+                                      BeginOffsetIteratorT begin_offsets,
+                                      EndOffsetIteratorT   end_offsets,
+                                      BinOpT               bin_op,
+                                      hipStream_t          stream)
+{
+    if(num_levels < 2)
+    {
+        return hipErrorInvalidValue;
+    }
+    if(d_temp_storage == nullptr)
+    {
+        // Make sure user won't try to allocate 0 bytes memory
+        temp_storage_bytes = 1;
+        return hipSuccess;
+    }
+    if(num_segments <= 0)
+    {
+        return hipSuccess;
+    }
+
+    const unsigned int segments  = static_cast<unsigned int>(num_segments);
+    const unsigned int num_bins  = static_cast<unsigned int>(num_levels - 1);
+    const unsigned int grid_size = std::min(segments, segmented_histogram_max_grid_size);
+
+    if(num_bins <= segmented_histogram_shared_max_bins)
+    {
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(segmented_histogram_shared_kernel),
+                           dim3(grid_size),
+                           dim3(segmented_histogram_block_size),
+                           0,
+                           stream,
+                           samples,
+                           histograms,
+                           begin_offsets,
+                           end_offsets,
+                           segments,
+                           num_bins,
+                           bin_op);
+    }
+    else
+    {
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(segmented_histogram_global_kernel),
+                           dim3(grid_size),
+                           dim3(segmented_histogram_block_size),
+                           0,
+                           stream,
+                           samples,
+                           histograms,
+                           begin_offsets,
+                           end_offsets,
+                           segments,
+                           num_bins,
+                           bin_op);
+    }
+
+    return hipGetLastError();
+}
+
+} // namespace detail
+
+/// \brief Computes one histogram per segment in a single launch, segment \p i covers the samples
+/// <tt>[d_begin_offsets[i], d_end_offsets[i])</tt>.
+///
+/// The histograms are written as a row-major <tt>num_segments x (num_levels - 1)</tt> matrix,
+/// the counters of segment \p i start at <tt>d_histogram + i * (num_levels - 1)</tt>. Every row
+/// is overwritten, so \p d_histogram does not need to be initialized. Each segment is counted
+/// by one block, in LDS when there are at most 2048 bins and with global atomics otherwise, so
+/// \p CounterT must support \p atomicAdd in the latter case. Samples outside of the levels are
+/// not counted.
+struct DeviceSegmentedHistogram
+{
+    /// \brief Counts the samples of every segment into <tt>num_levels - 1</tt> bins of equal
+    /// width between \p lower_level (inclusive) and \p upper_level (exclusive).
+    template<typename SampleIteratorT,
+             typename CounterT,
+             typename LevelT,
+             typename BeginOffsetIteratorT,
+             typename EndOffsetIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t HistogramEven(void*                d_temp_storage,
+                                                            size_t&              temp_storage_bytes,
+                                                            SampleIteratorT      d_samples,
+                                                            CounterT*            d_histogram,
+                                                            int                  num_levels,
+                                                            LevelT               lower_level,
+                                                            LevelT               upper_level,
+                                                            int                  num_segments,
+                                                            BeginOffsetIteratorT d_begin_offsets,
+                                                            EndOffsetIteratorT   d_end_offsets,
+                                                            hipStream_t          stream = 0)
+    {
+        using sample_type = typename std::iterator_traits<SampleIteratorT>::value_type;
+        using bin_op_type = detail::segmented_histogram_even_op<sample_type, LevelT>;
+        using common_type = typename bin_op_type::common_type;
+
+        if(!(lower_level < upper_level))
+        {
+            return hipErrorInvalidValue;
+        }
+
+        return detail::segmented_histogram(
+            d_temp_storage,
+            temp_storage_bytes,
+            d_samples,
+            d_histogram,
+            num_levels,
+            num_segments,
+            d_begin_offsets,
+            d_end_offsets,
+            bin_op_type{static_cast<common_type>(lower_level),
+                        static_cast<common_type>(upper_level),
+                        static_cast<unsigned int>(num_levels > 1 ? num_levels - 1 : 0)},
+            stream);
+    }
+
+    /// \brief Counts the samples of every segment into the bins
+    /// <tt>[d_levels[j], d_levels[j + 1])</tt>, \p d_levels must be sorted in ascending order.
+    template<typename SampleIteratorT,
+             typename CounterT,
+             typename LevelT,
+             typename BeginOffsetIteratorT,
+             typename EndOffsetIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        HistogramRange(void*                d_temp_storage,
+                       size_t&              temp_storage_bytes,
+                       SampleIteratorT      d_samples,
+                       CounterT*            d_histogram,
+                       int                  num_levels,
+                       const LevelT*        d_levels,
+                       int                  num_segments,
+                       BeginOffsetIteratorT d_begin_offsets,
+                       EndOffsetIteratorT   d_end_offsets,
+                       hipStream_t          stream = 0)
+    {
+        using sample_type = typename std::iterator_traits<SampleIteratorT>::value_type;
+        using bin_op_type = detail::segmented_histogram_range_op<sample_type, LevelT>;
+
+        return detail::segmented_histogram(d_temp_storage,
+                                           temp_storage_bytes,
+                                           d_samples,
+                                           d_histogram,
+                                           num_levels,
+                                           num_segments,
+                                           d_begin_offsets,
+                                           d_end_offsets,
+                                           bin_op_type{d_levels,
+                                                       static_cast<unsigned int>(num_levels)},
+                                           stream);
+    }
+};
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_CUB_DEVICE_DEVICE_SEGMENTED_HISTOGRAM_HPP_
@@ -34,10 +34,184 @@
 #include "../../../util_deprecated.hpp"
 #include "hipcub/util_deprecated.hpp"
 
+#include "../agent/agent_fixed_segment.hpp"
+
 #include <cub/device/device_segmented_radix_sort.cuh>
+#include <cub/iterator/counting_input_iterator.cuh>
+#include <cub/iterator/transform_input_iterator.cuh>
 
 BEGIN_HIPCUB_NAMESPACE
 
+namespace detail
+{
+
+template<bool Descending, class KeyT, class ValueT, class OffsetIteratorT>
+inline hipError_t fixed_segment_device_radix_sort(void*           d_temp_storage,
+                                                  size_t&         temp_storage_bytes,
+                                                  const KeyT*     keys_input,
+                                                  KeyT*           keys_output,
+                                                  const ValueT*   values_input,
+                                                  ValueT*         values_output,
+                                                  int             num_items,
+                                                  int             num_segments,
+                                                  OffsetIteratorT begin_offsets,
+                                                  int             begin_bit,
+                                                  int             end_bit,
+                                                  hipStream_t     stream)
+{
+    if(Descending)
+    {
+        return hipCUDAErrorTohipError(
+            ::cub::DeviceSegmentedRadixSort::SortPairsDescending(d_temp_storage,
+                                                                 temp_storage_bytes,
+                                                                 keys_input,
+                                                                 keys_output,
+                                                                 values_input,
+                                                                 values_output,
+                                                                 num_items,
+                                                                 num_segments,
+                                                                 begin_offsets,
+                                                                 begin_offsets + 1,
+                                                                 begin_bit,
+                                                                 end_bit,
+                                                                 stream));
+    }
+    return hipCUDAErrorTohipError(
+        ::cub::DeviceSegmentedRadixSort::SortPairs(d_temp_storage,
+                                                   temp_storage_bytes,
+                                                   keys_input,
+                                                   keys_output,
+                                                   values_input,
+                                                   values_output,
+                                                   num_items,
+                                                   num_segments,
+                                                   begin_offsets,
+                                                   begin_offsets + 1,
+                                                   begin_bit,
+                                                   end_bit,
+                                                   stream));
+}
+
+template<bool Descending, class KeyT, class OffsetIteratorT>
+inline hipError_t fixed_segment_device_radix_sort(void*                  d_temp_storage,
+                                                  size_t&                temp_storage_bytes,
+                                                  const KeyT*            keys_input,
+                                                  KeyT*                  keys_output,
+                                                  const ::cub::NullType* /*values_input*/,
+                                                  ::cub::NullType*       /*values_output*/,
+                                                  int                    num_items,
+                                                  int                    num_segments,
+                                                  OffsetIteratorT        begin_offsets,
+                                                  int                    begin_bit,
+                                                  int                    end_bit,
+                                                  hipStream_t            stream)
+{
+    if(Descending)
+    {
+        return hipCUDAErrorTohipError(
+            ::cub::DeviceSegmentedRadixSort::SortKeysDescending(d_temp_storage,
+                                                                temp_storage_bytes,
+                                                                keys_input,
+                                                                keys_output,
+                                                                num_items,
+                                                                num_segments,
+                                                                begin_offsets,
+                                                                begin_offsets + 1,
+                                                                begin_bit,
+                                                                end_bit,
+                                                                stream));
+    }
+    return hipCUDAErrorTohipError(
+        ::cub::DeviceSegmentedRadixSort::SortKeys(d_temp_storage,
+                                                  temp_storage_bytes,
+                                                  keys_input,
+                                                  keys_output,
+                                                  num_items,
+                                                  num_segments,
+                                                  begin_offsets,
+                                                  begin_offsets + 1,
+                                                  begin_bit,
+                                                  end_bit,
+                                                  stream));
+}
+
+/// Sorts \p num_segments segments of \p segment_size keys stored back to back. Pass \p NullType
+/// values to sort only the keys.
+template<bool Descending, class KeyT, class ValueT>
+inline hipError_t fixed_segment_radix_sort(void*         d_temp_storage,
+                                           size_t&       temp_storage_bytes,
+                                           const KeyT*   keys_input,
+                                           KeyT*         keys_output,
+                                           const ValueT* values_input,
+                                           ValueT*       values_output,
+                                           int           num_segments,
+                                           int           segment_size,
+                                           int           begin_bit,
+                                           int           end_bit,
+                                           hipStream_t   stream)
+{
+    if(!single_block_sortable<KeyT>::value || segment_size > fixed_segment_sort_block_max_size)
+    {
+        using offset_op_type = fixed_segment_offset_op<int>;
+        using offset_iterator_type
+            = ::cub::TransformInputIterator<int, offset_op_type, ::cub::CountingInputIterator<int>>;
+
+        const offset_iterator_type begin_offsets(::cub::CountingInputIterator<int>(0),
+                                                 offset_op_type{segment_size});
+        return fixed_segment_device_radix_sort<Descending>(d_temp_storage,
+                                                           temp_storage_bytes,
+                                                           keys_input,
+                                                           keys_output,
+                                                           values_input,
+                                                           values_output,
+                                                           num_segments * segment_size,
+                                                           num_segments,
+                                                           begin_offsets,
+                                                           begin_bit,
+                                                           end_bit,
+                                                           stream);
+    }
+
+    if(d_temp_storage == nullptr)
+    {
+        temp_storage_bytes = single_block_temp_storage_bytes;
+        return hipSuccess;
+    }
+    if(num_segments <= 0 || segment_size == 0)
+    {
+        return hipSuccess;
+    }
+
+    if(segment_size <= fixed_segment_sort_warp_max_size)
+    {
+        return fixed_segment_block_radix_sort<Descending,
+                                              fixed_segment_sort_warp_block_size,
+                                              fixed_segment_sort_warp_items_per_thread>(
+            keys_input,
+            keys_output,
+            values_input,
+            values_output,
+            num_segments,
+            segment_size,
+            begin_bit,
+            end_bit,
+            stream);
+    }
+    return fixed_segment_block_radix_sort<Descending,
+                                          single_block_size,
+                                          single_block_items_per_thread>(keys_input,
+                                                                         keys_output,
+                                                                         values_input,
+                                                                         values_output,
+                                                                         num_segments,
+                                                                         segment_size,
+                                                                         begin_bit,
+                                                                         end_bit,
+                                                                         stream);
+}
+
+} // namespace detail
+
 struct DeviceSegmentedRadixSort
 {
     template<typename KeyT, typename ValueT, typename OffsetIteratorT>
@@ -491,6 +665,120 @@ struct DeviceSegmentedRadixSort
                                   end_bit,
                                   stream);
     }
+
+    /// \brief Same as \p SortPairs for \p num_segments segments of \p segment_size items stored
+    /// back to back. The offsets are computed from the segment index instead of being read from
+    /// memory. Segments of up to 128 items are sorted by blocks of 64 threads and of up to
+    /// 2048 items by blocks of 256 threads, larger segments by the segmented radix sort.
+    template<typename KeyT, typename ValueT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        SortPairsFixedSize(void*         d_temp_storage,
+                           size_t&       temp_storage_bytes,
+                           const KeyT*   d_keys_in,
+                           KeyT*         d_keys_out,
+                           const ValueT* d_values_in,
+                           ValueT*       d_values_out,
+                           int           num_segments,
+                           int           segment_size,
+                           int           begin_bit = 0,
+                           int           end_bit   = sizeof(KeyT) * 8,
+                           hipStream_t   stream    = 0)
+    {
+        return detail::fixed_segment_radix_sort<false>(d_temp_storage,
+                                                       temp_storage_bytes,
+                                                       d_keys_in,
+                                                       d_keys_out,
+                                                       d_values_in,
+                                                       d_values_out,
+                                                       num_segments,
+                                                       segment_size,
+                                                       begin_bit,
+                                                       end_bit,
+                                                       stream);
+    }
+
+    /// \brief Same as \p SortPairsDescending for segments of \p segment_size items, see
+    /// \p SortPairsFixedSize.
+    template<typename KeyT, typename ValueT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        SortPairsDescendingFixedSize(void*         d_temp_storage,
+                                     size_t&       temp_storage_bytes,
+                                     const KeyT*   d_keys_in,
+                                     KeyT*         d_keys_out,
+                                     const ValueT* d_values_in,
+                                     ValueT*       d_values_out,
+                                     int           num_segments,
+                                     int           segment_size,
+                                     int           begin_bit = 0,
+                                     int           end_bit   = sizeof(KeyT) * 8,
+                                     hipStream_t   stream    = 0)
+    {
+        return detail::fixed_segment_radix_sort<true>(d_temp_storage,
+                                                      temp_storage_bytes,
+                                                      d_keys_in,
+                                                      d_keys_out,
+                                                      d_values_in,
+                                                      d_values_out,
+                                                      num_segments,
+                                                      segment_size,
+                                                      begin_bit,
+                                                      end_bit,
+                                                      stream);
+    }
+
+    /// \brief Same as \p SortKeys for segments of \p segment_size keys, see
+    /// \p SortPairsFixedSize.
+    template<typename KeyT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        SortKeysFixedSize(void*       d_temp_storage,
+                          size_t&     temp_storage_bytes,
+                          const KeyT* d_keys_in,
+                          KeyT*       d_keys_out,
+                          int         num_segments,
+                          int         segment_size,
+                          int         begin_bit = 0,
+                          int         end_bit   = sizeof(KeyT) * 8,
+                          hipStream_t stream    = 0)
+    {
+        return detail::fixed_segment_radix_sort<false>(d_temp_storage,
+                                                       temp_storage_bytes,
+                                                       d_keys_in,
+                                                       d_keys_out,
+                                                       static_cast<const ::cub::NullType*>(nullptr),
+                                                       static_cast<::cub::NullType*>(nullptr),
+                                                       num_segments,
+                                                       segment_size,
+                                                       begin_bit,
+                                                       end_bit,
+                                                       stream);
+    }
+
+    /// \brief Same as \p SortKeysDescending for segments of \p segment_size keys, see
+    /// \p SortPairsFixedSize.
+    template<typename KeyT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        SortKeysDescendingFixedSize(void*       d_temp_storage,
+                                    size_t&     temp_storage_bytes,
+                                    const KeyT* d_keys_in,
+                                    KeyT*       d_keys_out,
+                                    int         num_segments,
+                                    int         segment_size,
+                                    int         begin_bit = 0,
+                                    int         end_bit   = sizeof(KeyT) * 8,
+                                    hipStream_t stream    = 0)
+    {
+        return detail::fixed_segment_radix_sort<true>(d_temp_storage,
+                                                      temp_storage_bytes,
+                                                      d_keys_in,
+                                                      d_keys_out,
+                                                      static_cast<const ::cub::NullType*>(nullptr),
+                                                      static_cast<::cub::NullType*>(nullptr),
+                                                      num_segments,
+                                                      segment_size,
+                                                      begin_bit,
+                                                      end_bit,
+                                                      stream);
+    }
 };
 
 END_HIPCUB_NAMESPACE
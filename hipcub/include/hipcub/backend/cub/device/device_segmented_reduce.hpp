@@ -32,11 +32,118 @@
 
 #include "../../../config.hpp"
 #include "../../../util_deprecated.hpp"
+#include "../agent/agent_fixed_segment.hpp"
+#include "../thread/thread_accumulators.hpp"
 
 #include <cub/device/device_segmented_reduce.cuh>
+#include <cub/iterator/counting_input_iterator.cuh>
+#include <cub/iterator/transform_input_iterator.cuh>
+
+#include <iterator>
+#include <type_traits>
 
 BEGIN_HIPCUB_NAMESPACE
 
+namespace detail
+{
+
+/// Reduces \p num_segments segments of \p segment_size items stored back to back. Short segments
+/// are reduced by logical warps without temporary storage, long ones by
+/// \p cub::DeviceSegmentedReduce with offsets computed from the segment index.
+template<class InputIteratorT, class OutputIteratorT, class ReduceOpT, class InitT>
+inline hipError_t fixed_segment_reduce(void*           d_temp_storage,
+                                       size_t&         temp_storage_bytes,
+                                       InputIteratorT  input,
+                                       OutputIteratorT output,
+                                       int             num_segments,
+                                       int             segment_size,
+                                       ReduceOpT       reduce_op,
+                                       InitT           init,
+                                       hipStream_t     stream)
+{
+    using input_type = ::cub::detail::value_t<InputIteratorT>;
+    using acc_type   = ::cub::detail::accumulator_t<ReduceOpT, InitT, input_type>;
+
+    if(segment_size > fixed_segment_reduce_warp_max_size)
+    {
+        using offset_op_type = fixed_segment_offset_op<size_t>;
+        using offset_iterator_type
+            = ::cub::TransformInputIterator<size_t,
+                                            offset_op_type,
+                                            ::cub::CountingInputIterator<size_t>>;
+
+        const offset_iterator_type begin_offsets(::cub::CountingInputIterator<size_t>(0),
+                                                 offset_op_type{
+                                                     static_cast<size_t>(segment_size)});
+        return hipCUDAErrorTohipError(::cub::DeviceSegmentedReduce::Reduce(d_temp_storage,
+                                                                           temp_storage_bytes,
+                                                                           input,
+                                                                           output,
+                                                                           num_segments,
+                                                                           begin_offsets,
+                                                                           begin_offsets + 1,
+                                                                           reduce_op,
+                                                                           init,
+                                                                           stream));
+    }
+
+    if(d_temp_storage == nullptr)
+    {
+        // Make sure user won't try to allocate 0 bytes memory
+        temp_storage_bytes = 1;
+        return hipSuccess;
+    }
+    if(num_segments <= 0)
+    {
+        return hipSuccess;
+    }
+
+    // Vector loads need every segment to start at a multiple of the vector size
+    constexpr unsigned int vector_items = fixed_segment_vector_items<InputIteratorT>::value;
+    const bool             aligned      = vector_items > 1 && segment_size % vector_items == 0
+                         && fixed_segment_is_aligned(input);
+
+    if(segment_size <= 4)
+    {
+        return fixed_segment_warp_reduce<4, 1, acc_type>(input,
+                                                         output,
+                                                         num_segments,
+                                                         segment_size,
+                                                         reduce_op,
+                                                         init,
+                                                         stream);
+    }
+    if(segment_size <= 16)
+    {
+        return fixed_segment_warp_reduce<16, 1, acc_type>(input,
+                                                          output,
+                                                          num_segments,
+                                                          segment_size,
+                                                          reduce_op,
+                                                          init,
+                                                          stream);
+    }
+    if(aligned)
+    {
+        return fixed_segment_warp_reduce<32, vector_items, acc_type>(input,
+                                                                     output,
+                                                                     num_segments,
+                                                                     segment_size,
+                                                                     reduce_op,
+                                                                     init,
+                                                                     stream);
+    }
+    return fixed_segment_warp_reduce<32, 1, acc_type>(input,
+                                                      output,
+                                                      num_segments,
+                                                      segment_size,
+                                                      reduce_op,
+                                                      init,
+                                                      stream);
+}
+
+} // namespace detail
+
 struct DeviceSegmentedReduce
 {
     template<typename InputIteratorT,
@@ -141,6 +248,73 @@ struct DeviceSegmentedReduce
                    stream);
     }
 
+    /// \brief Computes the sum of every segment accumulated in \p AccumT, e.g. \p float for
+    /// \p __half or \p hip_bfloat16 inputs. The input is read once at its own width.
+    template<typename AccumT,
+             typename InputIteratorT,
+             typename OutputIteratorT,
+             typename OffsetIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t MixedPrecisionSum(void*           d_temp_storage,
+                                                                size_t&         temp_storage_bytes,
+                                                                InputIteratorT  d_in,
+                                                                OutputIteratorT d_out,
+                                                                int             num_segments,
+                                                                OffsetIteratorT d_begin_offsets,
+                                                                OffsetIteratorT d_end_offsets,
+                                                                hipStream_t     stream = 0)
+    {
+        using TransformOpT = detail::accumulator_cast_op<AccumT>;
+        return hipCUDAErrorTohipError(::cub::DeviceSegmentedReduce::Reduce(
+            d_temp_storage,
+            temp_storage_bytes,
+            ::cub::TransformInputIterator<AccumT, TransformOpT, InputIteratorT>(d_in,
+                                                                             TransformOpT()),
+            d_out,
+            num_segments,
+            d_begin_offsets,
+            d_end_offsets,
+            ::cub::Sum(),
+            AccumT(0),
+            stream));
+    }
+
+    /// \brief Computes the sum of every segment with compensated (Neumaier) summation in
+    /// \p AccumT, see \p DeviceReduce::CompensatedSum.
+    template<typename AccumT = void,
+             typename InputIteratorT,
+             typename OutputIteratorT,
+             typename OffsetIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t CompensatedSum(void*           d_temp_storage,
+                                                             size_t&         temp_storage_bytes,
+                                                             InputIteratorT  d_in,
+                                                             OutputIteratorT d_out,
+                                                             int             num_segments,
+                                                             OffsetIteratorT d_begin_offsets,
+                                                             OffsetIteratorT d_end_offsets,
+                                                             hipStream_t     stream = 0)
+    {
+        using InputT   = typename std::iterator_traits<InputIteratorT>::value_type;
+        using OutputT  = typename std::iterator_traits<OutputIteratorT>::value_type;
+        using DefaultT = std::conditional_t<std::is_void<OutputT>::value, InputT, OutputT>;
+        using ValueT   = std::conditional_t<std::is_void<AccumT>::value, DefaultT, AccumT>;
+        using AccumulatorT = CompensatedSumAccumulator<ValueT>;
+
+        using TransformOpT = detail::accumulator_cast_op<AccumulatorT>;
+        return hipCUDAErrorTohipError(::cub::DeviceSegmentedReduce::Reduce(
+            d_temp_storage,
+            temp_storage_bytes,
+            ::cub::TransformInputIterator<AccumulatorT, TransformOpT, InputIteratorT>(
+                d_in,
+                TransformOpT()),
+            d_out,
+            num_segments,
+            d_begin_offsets,
+            d_end_offsets,
+            CompensatedSumOp(),
+            AccumulatorT(ValueT(0), ValueT(0)),
+            stream));
+    }
+
     template<typename InputIteratorT, typename OutputIteratorT, typename OffsetIteratorT>
     HIPCUB_RUNTIME_FUNCTION static hipError_t Min(void*           d_temp_storage,
                                                   size_t&         temp_storage_bytes,
@@ -312,6 +486,101 @@ struct DeviceSegmentedReduce
                       d_end_offsets,
                       stream);
     }
+
+    /// \brief Same as \p Reduce for \p num_segments segments of \p segment_size items stored
+    /// back to back, e.g. the rows of a matrix. The offsets are computed from the segment index
+    /// instead of being read from memory. Segments of up to 1024 items are reduced by logical
+    /// warps with loads of 16 bytes if \p d_in is a pointer aligned to whole segments.
+    template<typename InputIteratorT, typename OutputIteratorT, typename ReductionOp, typename T>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t ReduceFixedSize(void*           d_temp_storage,
+                                                              size_t&         temp_storage_bytes,
+                                                              InputIteratorT  d_in,
+                                                              OutputIteratorT d_out,
+                                                              int             num_segments,
+                                                              int             segment_size,
+                                                              ReductionOp     reduction_op,
+                                                              T               initial_value,
+                                                              hipStream_t     stream = 0)
+    {
+        return detail::fixed_segment_reduce(d_temp_storage,
+                                            temp_storage_bytes,
+                                            d_in,
+                                            d_out,
+                                            num_segments,
+                                            segment_size,
+                                            reduction_op,
+                                            initial_value,
+                                            stream);
+    }
+
+    /// \brief Same as \p Sum for segments of \p segment_size items, see \p ReduceFixedSize.
+    template<typename InputIteratorT, typename OutputIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t SumFixedSize(void*           d_temp_storage,
+                                                           size_t&         temp_storage_bytes,
+                                                           InputIteratorT  d_in,
+                                                           OutputIteratorT d_out,
+                                                           int             num_segments,
+                                                           int             segment_size,
+                                                           hipStream_t     stream = 0)
+    {
+        using input_type = ::cub::detail::value_t<InputIteratorT>;
+
+        return ReduceFixedSize(d_temp_storage,
+                               temp_storage_bytes,
+                               d_in,
+                               d_out,
+                               num_segments,
+                               segment_size,
+                               ::cub::Sum(),
+                               input_type(),
+                               stream);
+    }
+
+    /// \brief Same as \p Min for segments of \p segment_size items, see \p ReduceFixedSize.
+    template<typename InputIteratorT, typename OutputIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t MinFixedSize(void*           d_temp_storage,
+                                                           size_t&         temp_storage_bytes,
+                                                           InputIteratorT  d_in,
+                                                           OutputIteratorT d_out,
+                                                           int             num_segments,
+                                                           int             segment_size,
+                                                           hipStream_t     stream = 0)
+    {
+        using input_type = ::cub::detail::value_t<InputIteratorT>;
+
+        return ReduceFixedSize(d_temp_storage,
+                               temp_storage_bytes,
+                               d_in,
+                               d_out,
+                               num_segments,
+                               segment_size,
+                               ::cub::Min(),
+                               ::cub::Traits<input_type>::Max(),
+                               stream);
+    }
+
+    /// \brief Same as \p Max for segments of \p segment_size items, see \p ReduceFixedSize.
+    template<typename InputIteratorT, typename OutputIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t MaxFixedSize(void*           d_temp_storage,
+                                                           size_t&         temp_storage_bytes,
+                                                           InputIteratorT  d_in,
+                                                           OutputIteratorT d_out,
+                                                           int             num_segments,
+                                                           int             segment_size,
+                                                           hipStream_t     stream = 0)
+    {
+        using input_type = ::cub::detail::value_t<InputIteratorT>;
+
+        return ReduceFixedSize(d_temp_storage,
+                               temp_storage_bytes,
+                               d_in,
+                               d_out,
+                               num_segments,
+                               segment_size,
+                               ::cub::Max(),
+                               ::cub::Traits<input_type>::Lowest(),
+                               stream);
+    }
 };
 
 END_HIPCUB_NAMESPACE
@@ -33,6 +33,8 @@
 #include "../../../config.hpp"
 #include "../../../util_deprecated.hpp"
 
+#include "../agent/agent_single_block.hpp"
+
 #include <cub/device/device_select.cuh>
 
 #include <type_traits>
@@ -56,6 +58,18 @@ public:
                               int64_t              num_items,
                               hipStream_t          stream = 0)
     {
+        if(detail::single_block_eligible(num_items))
+        {
+            return detail::single_block_select(
+                d_temp_storage,
+                temp_storage_bytes,
+                d_in,
+                d_out,
+                d_num_selected_out,
+                static_cast<size_t>(num_items),
+                detail::single_block_select_flagged<FlagIterator>{d_flags},
+                stream);
+        }
         return hipCUDAErrorTohipError(::cub::DeviceSelect::Flagged(d_temp_storage,
                                                                    temp_storage_bytes,
                                                                    d_in,
@@ -147,6 +161,18 @@ public:
                          SelectOp             select_op,
                          hipStream_t          stream = 0)
     {
+        if(detail::single_block_eligible(num_items))
+        {
+            return detail::single_block_select(
+                d_temp_storage,
+                temp_storage_bytes,
+                d_in,
+                d_out,
+                d_num_selected_out,
+                static_cast<size_t>(num_items),
+                detail::single_block_select_if<SelectOp>{select_op},
+                stream);
+        }
         return hipCUDAErrorTohipError(::cub::DeviceSelect::If(d_temp_storage,
                                                               temp_storage_bytes,
                                                               d_in,
@@ -0,0 +1,762 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HIPCUB_CUB_DEVICE_DEVICE_SET_OPERATIONS_HPP_
+#define HIPCUB_CUB_DEVICE_DEVICE_SET_OPERATIONS_HPP_
+
+#include "../../../config.hpp"
+
+#include "../agent/agent_merge_path.hpp"
+#include "../agent/single_pass_scan_operators.hpp"
+#include "../util_temporary_storage.hpp"
+
+#include <cub/block/block_scan.cuh>
+#include <cub/thread/thread_operators.cuh>
+#include <cub/util_type.cuh>
+
+#include <iterator>
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace detail
+{
+
+static constexpr unsigned int set_operation_block_size       = 256;
+static constexpr unsigned int set_operation_items_per_thread = 8;
+static constexpr unsigned int set_operation_items_per_tile
+    = set_operation_block_size * set_operation_items_per_thread;
+
+enum class set_operation
+{
+    set_intersection,
+    set_union,
+    set_difference,
+    set_symmetric_difference
+};
+
+/// The multiset semantics of the standard library: an item whose key occurs \p other_count
+/// times in the other sequence is selected depending on its \p rank among the equal keys of its
+/// own sequence.
+template<set_operation Op>
+HIPCUB_DEVICE HIPCUB_FORCEINLINE bool
+    set_operation_select(bool from_first, size_t rank, size_t other_count)
+{
+    switch(Op)
+    {
+        case set_operation::set_intersection: return from_first && rank < other_count;
+        case set_operation::set_union: return from_first || rank >= other_count;
+        case set_operation::set_difference: return from_first && rank >= other_count;
+        case set_operation::set_symmetric_difference:
+        default: return rank >= other_count;
+    }
+}
+
+/// Number of items before \p index which are equal to \p key. Gallops backwards, so the cost
+/// only depends on the length of the run of equal keys.
+template<class KeysIteratorT, class KeyT, class CompareOpT>
+HIPCUB_DEVICE HIPCUB_FORCEINLINE size_t set_operation_count_equal_before(KeysIteratorT keys,
+                                                                         size_t        index,
+                                                                         const KeyT&   key,
+                                                                         CompareOpT    compare_op)
+{
+    if(index == 0 || compare_op(keys[index - 1], key))
+    {
+        return 0;
+    }
+    size_t count_min = 1;
+    size_t count_max = 1;
+    while(count_max < index && !compare_op(keys[index - count_max - 1], key))
+    {
+        count_min = count_max + 1;
+        count_max = 2 * count_max + 1 < index ? 2 * count_max + 1 : index;
+    }
+    while(count_min < count_max)
+    {
+        const size_t count_pivot = (count_min + count_max + 1) / 2;
+        if(!compare_op(keys[index - count_pivot], key))
+        {
+            count_min = count_pivot;
+        }
+        else
+        {
+            count_max = count_pivot - 1;
+        }
+    }
+    return count_min;
+}
+
+/// Number of items starting at \p index which are equal to \p key. Gallops forwards.
+template<class KeysIteratorT, class KeyT, class CompareOpT>
+HIPCUB_DEVICE HIPCUB_FORCEINLINE size_t set_operation_count_equal_from(KeysIteratorT keys,
+                                                                       size_t        index,
+                                                                       size_t        size,
+                                                                       const KeyT&   key,
+                                                                       CompareOpT    compare_op)
+{
+    if(index >= size || compare_op(key, keys[index]))
+    {
+        return 0;
+    }
+    const size_t remaining = size - index;
+    size_t       count_min = 1;
+    size_t       count_max = 1;
+    while(count_max < remaining && !compare_op(key, keys[index + count_max]))
+    {
+        count_min = count_max + 1;
+        count_max = 2 * count_max + 1 < remaining ? 2 * count_max + 1 : remaining;
+    }
+    while(count_min < count_max)
+    {
+        const size_t count_pivot = (count_min + count_max + 1) / 2;
+        if(!compare_op(key, keys[index + count_pivot - 1]))
+        {
+            count_min = count_pivot;
+        }
+        else
+        {
+            count_max = count_pivot - 1;
+        }
+    }
+    return count_min;
+}
+
+template<class KeyT>
+struct set_operation_storage
+{
+    using block_scan_type = ::cub::BlockScan<unsigned int, set_operation_block_size>;
+    using tile_prefix_type
+        = TilePrefixCallbackOp<unsigned int, ::cub::Sum, ScanTileState<unsigned int>>;
+
+    // The items of the first sequence followed by the items of the second sequence
+    KeyT         keys[set_operation_items_per_tile];
+    size_t       tile_splits[2];
+    unsigned int tile;
+
+    typename block_scan_type::TempStorage  scan;
+    typename tile_prefix_type::TempStorage prefix;
+};
+
+template<class NumSelectedIteratorT>
+__global__ __launch_bounds__(set_operation_block_size) void set_operation_init_kernel(
+    ScanTileState<unsigned int> tile_state,
+    unsigned int*               tile_counter,
+    unsigned int                num_tiles,
+    NumSelectedIteratorT        num_selected_out)
+{
+    tile_state.InitializeStatus(num_tiles);
+    if(blockIdx.x == 0 && threadIdx.x == 0)
+    {
+        *tile_counter = 0;
+        if(num_tiles == 0)
+        {
+            *num_selected_out = 0;
+        }
+    }
+}
+
+/// Every tile covers a fixed number of steps of the merge path of both sequences. The tile is
+/// staged in LDS and every thread walks its own part of the path, deciding for every item if it
+/// is selected from the rank of its key among the equal keys of its sequence and the number of
+/// equal keys in the other sequence. The selected items are compacted with a block scan and a
+/// decoupled look-back over the tiles, which are processed in the order they are started.
+template<set_operation Op,
+         bool          WithValues,
+         class KeysIterator1T,
+         class ValuesIterator1T,
+         class KeysIterator2T,
+         class ValuesIterator2T,
+         class KeysOutputIteratorT,
+         class ValuesOutputIteratorT,
+         class NumSelectedIteratorT,
+         class CompareOpT>
+__global__ __launch_bounds__(set_operation_block_size) void set_operation_kernel(
+    KeysIterator1T              keys1,
+    ValuesIterator1T            values1,
+    size_t                      num_items1,
+    KeysIterator2T              keys2,
+    ValuesIterator2T            values2,
+    size_t                      num_items2,
+    KeysOutputIteratorT         keys_out,
+    ValuesOutputIteratorT       values_out,
+    NumSelectedIteratorT        num_selected_out,
+    ScanTileState<unsigned int> tile_state,
+    unsigned int*               tile_counter,
+    unsigned int                num_tiles,
+    CompareOpT                  compare_op)
+{
+    using key_type         = typename std::iterator_traits<KeysIterator1T>::value_type;
+    using storage_type     = set_operation_storage<key_type>;
+    using block_scan_type  = typename storage_type::block_scan_type;
+    using tile_prefix_type = typename storage_type::tile_prefix_type;
+
+    constexpr unsigned int block_size       = set_operation_block_size;
+    constexpr unsigned int items_per_thread = set_operation_items_per_thread;
+    constexpr unsigned int items_per_tile   = set_operation_items_per_tile;
+
+    __shared__ ::cub::Uninitialized<storage_type> storage_raw;
+    storage_type& storage = storage_raw.Alias();
+
+    const unsigned int flat_id = threadIdx.x;
+    if(flat_id == 0)
+    {
+        storage.tile = atomicAdd(tile_counter, 1u);
+    }
+    __syncthreads();
+
+    const unsigned int tile        = storage.tile;
+    const size_t       path_length = num_items1 + num_items2;
+    const size_t       tile_offset = static_cast<size_t>(tile) * items_per_tile;
+    const unsigned int tile_items  = path_length - tile_offset < items_per_tile
+                                         ? static_cast<unsigned int>(path_length - tile_offset)
+                                         : items_per_tile;
+
+    if(flat_id < 2)
+    {
+        storage.tile_splits[flat_id] = merge_path_search(tile_offset + flat_id * tile_items,
+                                                         keys1,
+                                                         num_items1,
+                                                         keys2,
+                                                         num_items2,
+                                                         compare_op);
+    }
+    __syncthreads();
+
+    const size_t       first_offset  = storage.tile_splits[0];
+    const size_t       second_offset = tile_offset - first_offset;
+    const unsigned int first_items
+        = static_cast<unsigned int>(storage.tile_splits[1] - first_offset);
+    const unsigned int second_items = tile_items - first_items;
+
+    for(unsigned int i = flat_id; i < tile_items; i += block_size)
+    {
+        storage.keys[i] = i < first_items ? keys1[first_offset + i]
+                                          : keys2[second_offset + i - first_items];
+    }
+    __syncthreads();
+
+    const key_type*    tile_keys1      = storage.keys;
+    const key_type*    tile_keys2      = storage.keys + first_items;
+    const unsigned int thread_diagonal
+        = flat_id * items_per_thread < tile_items ? flat_id * items_per_thread : tile_items;
+
+    unsigned int i = merge_path_search(thread_diagonal,
+                                       tile_keys1,
+                                       first_items,
+                                       tile_keys2,
+                                       second_items,
+                                       compare_op);
+    unsigned int j = thread_diagonal - i;
+
+    // The keys of a run of equal keys of one sequence are consecutive on the path, so the
+    // searches are only repeated when a new run starts.
+    bool     run_valid = false;
+    bool     run_from_first;
+    key_type run_key;
+    size_t   run_start;
+    size_t   run_other_count;
+
+    unsigned int tile_indices[items_per_thread];
+    bool         selected[items_per_thread];
+    unsigned int selected_count = 0;
+
+    for(unsigned int item = 0; item < items_per_thread; item++)
+    {
+        selected[item] = false;
+        if(thread_diagonal + item >= tile_items)
+        {
+            continue;
+        }
+
+        const bool from_first
+            = j >= second_items || (i < first_items && !compare_op(tile_keys2[j], tile_keys1[i]));
+        const unsigned int tile_index = from_first ? i : first_items + j;
+        const key_type     key        = storage.keys[tile_index];
+        const size_t       index      = from_first ? first_offset + i : second_offset + j;
+
+        if(!run_valid || run_from_first != from_first || compare_op(run_key, key))
+        {
+            run_valid      = true;
+            run_from_first = from_first;
+            run_key        = key;
+            // All equal keys of the first sequence come before the ones of the second sequence
+            run_other_count
+                = from_first ? set_operation_count_equal_from(keys2,
+                                                              second_offset + j,
+                                                              num_items2,
+                                                              key,
+                                                              compare_op)
+                             : set_operation_count_equal_before(keys1,
+                                                                first_offset + i,
+                                                                key,
+                                                                compare_op);
+            run_start = index;
+            if(run_other_count > 0)
+            {
+                run_start -= from_first
+                                 ? set_operation_count_equal_before(keys1, index, key, compare_op)
+                                 : set_operation_count_equal_before(keys2, index, key, compare_op);
+            }
+        }
+
+        selected[item] = set_operation_select<Op>(from_first, index - run_start, run_other_count);
+        tile_indices[item] = tile_index;
+        selected_count += selected[item] ? 1 : 0;
+        if(from_first)
+        {
+            i++;
+        }
+        else
+        {
+            j++;
+        }
+    }
+
+    unsigned int output_offset;
+    if(tile == 0)
+    {
+        unsigned int tile_selected;
+        block_scan_type(storage.scan).ExclusiveSum(selected_count, output_offset, tile_selected);
+        if(flat_id == 0)
+        {
+            tile_state.SetInclusive(0, tile_selected);
+            if(num_tiles == 1)
+            {
+                *num_selected_out = tile_selected;
+            }
+        }
+    }
+    else
+    {
+        tile_prefix_type prefix_op(tile_state, storage.prefix, ::cub::Sum(), tile);
+        block_scan_type(storage.scan).ExclusiveSum(selected_count, output_offset, prefix_op);
+        if(flat_id == 0 && tile == num_tiles - 1)
+        {
+            *num_selected_out = prefix_op.GetInclusivePrefix();
+        }
+    }
+
+    for(unsigned int item = 0; item < items_per_thread; item++)
+    {
+        if(selected[item])
+        {
+            const unsigned int tile_index = tile_indices[item];
+            keys_out[output_offset]       = storage.keys[tile_index];
+            if HIPCUB_IF_CONSTEXPR(WithValues)
+            {
+                values_out[output_offset]
+                    = tile_index < first_items
+                          ? values1[first_offset + tile_index]
+                          : values2[second_offset + tile_index - first_items];
+            }
+            output_offset++;
+        }
+    }
+}
+
+template<set_operation Op,
+         bool          WithValues,
+         class KeysIterator1T,
+         class ValuesIterator1T,
+         class KeysIterator2T,
+         class ValuesIterator2T,
+         class KeysOutputIteratorT,
+         class ValuesOutputIteratorT,
+         class NumSelectedIteratorT,
+         class CompareOpT>
+inline hipError_t set_operation_impl(void*                 d_temp_storage,
+                                     size_t&               temp_storage_bytes,
+                                     KeysIterator1T        keys1,
+                                     ValuesIterator1T      values1,
+                                     int                   num_items1,
+                                     KeysIterator2T        keys2,
+                                     ValuesIterator2T      values2,
+                                     int                   num_items2,
+                                     KeysOutputIteratorT   keys_out,
+                                     ValuesOutputIteratorT values_out,
+                                     NumSelectedIteratorT  num_selected_out,
+                                     CompareOpT            compare_op,
+                                     hipStream_t           stream)
+{
+    const size_t       size1     = num_items1 > 0 ? static_cast<size_t>(num_items1) : 0;
+    const size_t       size2     = num_items2 > 0 ? static_cast<size_t>(num_items2) : 0;
+    const unsigned int num_tiles = static_cast<unsigned int>(
+        (size1 + size2 + set_operation_items_per_tile - 1) / set_operation_items_per_tile);
+
+    size_t     tile_state_bytes = 0;
+    hipError_t error
+        = ScanTileState<unsigned int>::AllocationSize(num_tiles > 0 ? num_tiles : 1u,
+                                                      tile_state_bytes);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    void*  allocations[2]      = {};
+    size_t allocation_sizes[2] = {tile_state_bytes, sizeof(unsigned int)};
+    error = AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes);
+    if(error != hipSuccess || d_temp_storage == nullptr)
+    {
+        return error;
+    }
+
+    ScanTileState<unsigned int> tile_state;
+    error = tile_state.Init(num_tiles > 0 ? num_tiles : 1u, allocations[0], tile_state_bytes);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    unsigned int* tile_counter = static_cast<unsigned int*>(allocations[1]);
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(set_operation_init_kernel),
+                       dim3((num_tiles + set_operation_block_size) / set_operation_block_size),
+                       dim3(set_operation_block_size),
+                       0,
+                       stream,
+                       tile_state,
+                       tile_counter,
+                       num_tiles,
+                       num_selected_out);
+    error = hipGetLastError();
+    if(error != hipSuccess || num_tiles == 0)
+    {
+        return error;
+    }
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(set_operation_kernel<Op, WithValues>),
+                       dim3(num_tiles),
+                       dim3(set_operation_block_size),
+                       0,
+                       stream,
+                       keys1,
+                       values1,
+                       size1,
+                       keys2,
+                       values2,
+                       size2,
+                       keys_out,
+                       values_out,
+                       num_selected_out,
+                       tile_state,
+                       tile_counter,
+                       num_tiles,
+                       compare_op);
+    return hipGetLastError();
+}
+
+} // namespace detail
+
+/// Same single-pass merge path selection as on the rocPRIM backend, CUB does not provide set
+/// operations.
+struct DeviceSetOperations
+{
+    template<typename KeysInputIterator1T,
+             typename KeysInputIterator2T,
+             typename KeysOutputIteratorT,
+             typename NumSelectedIteratorT,
+             typename CompareOpT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        IntersectionKeys(void*                d_temp_storage,
+                         size_t&              temp_storage_bytes,
+                         KeysInputIterator1T  d_keys_in1,
+                         int                  num_items1,
+                         KeysInputIterator2T  d_keys_in2,
+                         int                  num_items2,
+                         KeysOutputIteratorT  d_keys_out,
+                         NumSelectedIteratorT d_num_selected_out,
+                         CompareOpT           compare_op,
+                         hipStream_t          stream = 0)
+    {
+        return detail::set_operation_impl<detail::set_operation::set_intersection, false>(
+            d_temp_storage,
+            temp_storage_bytes,
+            d_keys_in1,
+            static_cast<::cub::NullType*>(nullptr),
+            num_items1,
+            d_keys_in2,
+            static_cast<::cub::NullType*>(nullptr),
+            num_items2,
+            d_keys_out,
+            static_cast<::cub::NullType*>(nullptr),
+            d_num_selected_out,
+            compare_op,
+            stream);
+    }
+
+    template<typename KeysInputIterator1T,
+             typename ValuesInputIterator1T,
+             typename KeysInputIterator2T,
+             typename ValuesInputIterator2T,
+             typename KeysOutputIteratorT,
+             typename ValuesOutputIteratorT,
+             typename NumSelectedIteratorT,
+             typename CompareOpT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        IntersectionPairs(void*                 d_temp_storage,
+                          size_t&               temp_storage_bytes,
+                          KeysInputIterator1T   d_keys_in1,
+                          ValuesInputIterator1T d_values_in1,
+                          int                   num_items1,
+                          KeysInputIterator2T   d_keys_in2,
+                          ValuesInputIterator2T d_values_in2,
+                          int                   num_items2,
+                          KeysOutputIteratorT   d_keys_out,
+                          ValuesOutputIteratorT d_values_out,
+                          NumSelectedIteratorT  d_num_selected_out,
+                          CompareOpT            compare_op,
+                          hipStream_t           stream = 0)
+    {
+        return detail::set_operation_impl<detail::set_operation::set_intersection, true>(
+            d_temp_storage,
+            temp_storage_bytes,
+            d_keys_in1,
+            d_values_in1,
+            num_items1,
+            d_keys_in2,
+            d_values_in2,
+            num_items2,
+            d_keys_out,
+            d_values_out,
+            d_num_selected_out,
+            compare_op,
+            stream);
+    }
+
+    template<typename KeysInputIterator1T,
+             typename KeysInputIterator2T,
+             typename KeysOutputIteratorT,
+             typename NumSelectedIteratorT,
+             typename CompareOpT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        UnionKeys(void*                d_temp_storage,
+                  size_t&              temp_storage_bytes,
+                  KeysInputIterator1T  d_keys_in1,
+                  int                  num_items1,
+                  KeysInputIterator2T  d_keys_in2,
+                  int                  num_items2,
+                  KeysOutputIteratorT  d_keys_out,
+                  NumSelectedIteratorT d_num_selected_out,
+                  CompareOpT           compare_op,
+                  hipStream_t          stream = 0)
+    {
+        return detail::set_operation_impl<detail::set_operation::set_union, false>(
+            d_temp_storage,
+            temp_storage_bytes,
+            d_keys_in1,
+            static_cast<::cub::NullType*>(nullptr),
+            num_items1,
+            d_keys_in2,
+            static_cast<::cub::NullType*>(nullptr),
+            num_items2,
+            d_keys_out,
+            static_cast<::cub::NullType*>(nullptr),
+            d_num_selected_out,
+            compare_op,
+            stream);
+    }
+
+    template<typename KeysInputIterator1T,
+             typename ValuesInputIterator1T,
+             typename KeysInputIterator2T,
+             typename ValuesInputIterator2T,
+             typename KeysOutputIteratorT,
+             typename ValuesOutputIteratorT,
+             typename NumSelectedIteratorT,
+             typename CompareOpT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        UnionPairs(void*                 d_temp_storage,
+                   size_t&               temp_storage_bytes,
+                   KeysInputIterator1T   d_keys_in1,
+                   ValuesInputIterator1T d_values_in1,
+                   int                   num_items1,
+                   KeysInputIterator2T   d_keys_in2,
+                   ValuesInputIterator2T d_values_in2,
+                   int                   num_items2,
+                   KeysOutputIteratorT   d_keys_out,
+                   ValuesOutputIteratorT d_values_out,
+                   NumSelectedIteratorT  d_num_selected_out,
+                   CompareOpT            compare_op,
+                   hipStream_t           stream = 0)
+    {
+        return detail::set_operation_impl<detail::set_operation::set_union, true>(
+            d_temp_storage,
+            temp_storage_bytes,
+            d_keys_in1,
+            d_values_in1,
+            num_items1,
+            d_keys_in2,
+            d_values_in2,
+            num_items2,
+            d_keys_out,
+            d_values_out,
+            d_num_selected_out,
+            compare_op,
+            stream);
+    }
+
+    template<typename KeysInputIterator1T,
+             typename KeysInputIterator2T,
+             typename KeysOutputIteratorT,
+             typename NumSelectedIteratorT,
+             typename CompareOpT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        DifferenceKeys(void*                d_temp_storage,
+                       size_t&              temp_storage_bytes,
+                       KeysInputIterator1T  d_keys_in1,
+                       int                  num_items1,
+                       KeysInputIterator2T  d_keys_in2,
+                       int                  num_items2,
+                       KeysOutputIteratorT  d_keys_out,
+                       NumSelectedIteratorT d_num_selected_out,
+                       CompareOpT           compare_op,
+                       hipStream_t          stream = 0)
+    {
+        return detail::set_operation_impl<detail::set_operation::set_difference, false>(
+            d_temp_storage,
+            temp_storage_bytes,
+            d_keys_in1,
+            static_cast<::cub::NullType*>(nullptr),
+            num_items1,
+            d_keys_in2,
+            static_cast<::cub::NullType*>(nullptr),
+            num_items2,
+            d_keys_out,
+            static_cast<::cub::NullType*>(nullptr),
+            d_num_selected_out,
+            compare_op,
+            stream);
+    }
+
+    template<typename KeysInputIterator1T,
+             typename ValuesInputIterator1T,
+             typename KeysInputIterator2T,
+             typename ValuesInputIterator2T,
+             typename KeysOutputIteratorT,
+             typename ValuesOutputIteratorT,
+             typename NumSelectedIteratorT,
+             typename CompareOpT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        DifferencePairs(void*                 d_temp_storage,
+                        size_t&               temp_storage_bytes,
+                        KeysInputIterator1T   d_keys_in1,
+                        ValuesInputIterator1T d_values_in1,
+                        int                   num_items1,
+                        KeysInputIterator2T   d_keys_in2,
+                        ValuesInputIterator2T d_values_in2,
+                        int                   num_items2,
+                        KeysOutputIteratorT   d_keys_out,
+                        ValuesOutputIteratorT d_values_out,
+                        NumSelectedIteratorT  d_num_selected_out,
+                        CompareOpT            compare_op,
+                        hipStream_t           stream = 0)
+    {
+        return detail::set_operation_impl<detail::set_operation::set_difference, true>(
+            d_temp_storage,
+            temp_storage_bytes,
+            d_keys_in1,
+            d_values_in1,
+            num_items1,
+            d_keys_in2,
+            d_values_in2,
+            num_items2,
+            d_keys_out,
+            d_values_out,
+            d_num_selected_out,
+            compare_op,
+            stream);
+    }
+
+    template<typename KeysInputIterator1T,
+             typename KeysInputIterator2T,
+             typename KeysOutputIteratorT,
+             typename NumSelectedIteratorT,
+             typename CompareOpT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        SymmetricDifferenceKeys(void*                d_temp_storage,
+                                size_t&              temp_storage_bytes,
+                                KeysInputIterator1T  d_keys_in1,
+                                int                  num_items1,
+                                KeysInputIterator2T  d_keys_in2,
+                                int                  num_items2,
+                                KeysOutputIteratorT  d_keys_out,
+                                NumSelectedIteratorT d_num_selected_out,
+                                CompareOpT           compare_op,
+                                hipStream_t          stream = 0)
+    {
+        return detail::set_operation_impl<detail::set_operation::set_symmetric_difference, false>(
+            d_temp_storage,
+            temp_storage_bytes,
+            d_keys_in1,
+            static_cast<::cub::NullType*>(nullptr),
+            num_items1,
+            d_keys_in2,
+            static_cast<::cub::NullType*>(nullptr),
+            num_items2,
+            d_keys_out,
+            static_cast<::cub::NullType*>(nullptr),
+            d_num_selected_out,
+            compare_op,
+            stream);
+    }
+
+    template<typename KeysInputIterator1T,
+             typename ValuesInputIterator1T,
+             typename KeysInputIterator2T,
+             typename ValuesInputIterator2T,
+             typename KeysOutputIteratorT,
+             typename ValuesOutputIteratorT,
+             typename NumSelectedIteratorT,
+             typename CompareOpT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        SymmetricDifferencePairs(void*                 d_temp_storage,
+                                 size_t&               temp_storage_bytes,
+                                 KeysInputIterator1T   d_keys_in1,
+                                 ValuesInputIterator1T d_values_in1,
+                                 int                   num_items1,
+                                 KeysInputIterator2T   d_keys_in2,
+                                 ValuesInputIterator2T d_values_in2,
+                                 int                   num_items2,
+                                 KeysOutputIteratorT   d_keys_out,
+                                 ValuesOutputIteratorT d_values_out,
+                                 NumSelectedIteratorT  d_num_selected_out,
+                                 CompareOpT            compare_op,
+                                 hipStream_t           stream = 0)
+    {
+        return detail::set_operation_impl<detail::set_operation::set_symmetric_difference, true>(
+            d_temp_storage,
+            temp_storage_bytes,
+            d_keys_in1,
+            d_values_in1,
+            num_items1,
+            d_keys_in2,
+            d_values_in2,
+            num_items2,
+            d_keys_out,
+            d_values_out,
+            d_num_selected_out,
+            compare_op,
+            stream);
+    }
+};
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_CUB_DEVICE_DEVICE_SET_OPERATIONS_HPP_
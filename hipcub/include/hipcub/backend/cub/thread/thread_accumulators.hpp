@@ -0,0 +1,105 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HIPCUB_CUB_THREAD_THREAD_ACCUMULATORS_HPP_
+#define HIPCUB_CUB_THREAD_THREAD_ACCUMULATORS_HPP_
+
+#include "../../../config.hpp"
+
+BEGIN_HIPCUB_NAMESPACE
+
+/// \brief Running sum with a compensation term that holds the rounding error of the additions.
+///
+/// Combine accumulators with \p CompensatedSumOp, e.g. as the item type of \p BlockReduce or
+/// \p WarpReduce. Converting the accumulator to \p T returns the compensated sum. The
+/// compensation does not survive fast-math reassociation of floating-point additions.
+template<class T>
+struct CompensatedSumAccumulator
+{
+    using value_type = T;
+
+    T sum;
+    T compensation;
+
+    CompensatedSumAccumulator() = default;
+
+    /// Converts \p value to \p T, e.g. a \p __half input to a \p float accumulator.
+    template<class U>
+    HIPCUB_HOST_DEVICE explicit CompensatedSumAccumulator(const U& value)
+        : sum(static_cast<T>(value)), compensation(T(0))
+    {}
+
+    HIPCUB_HOST_DEVICE CompensatedSumAccumulator(T sum, T compensation)
+        : sum(sum), compensation(compensation)
+    {}
+
+    HIPCUB_HOST_DEVICE T Value() const
+    {
+        return sum + compensation;
+    }
+
+    HIPCUB_HOST_DEVICE operator T() const
+    {
+        return Value();
+    }
+};
+
+/// \brief Adds two \p CompensatedSumAccumulator with Neumaier's variant of Kahan summation.
+///
+/// Unlike Kahan's algorithm the error of the addition is also captured when the new term is
+/// larger than the running sum, and the operator is commutative so it can be used by tree
+/// reductions.
+struct CompensatedSumOp
+{
+    template<class T>
+    HIPCUB_HOST_DEVICE inline CompensatedSumAccumulator<T>
+        operator()(const CompensatedSumAccumulator<T>& a,
+                   const CompensatedSumAccumulator<T>& b) const
+    {
+        const T sum   = a.sum + b.sum;
+        const T abs_a = a.sum < T(0) ? -a.sum : a.sum;
+        const T abs_b = b.sum < T(0) ? -b.sum : b.sum;
+        const T error = abs_a >= abs_b ? (a.sum - sum) + b.sum : (b.sum - sum) + a.sum;
+        return CompensatedSumAccumulator<T>(sum, (a.compensation + b.compensation) + error);
+    }
+};
+
+namespace detail
+{
+
+/// Converts input items to the accumulator type in registers, so the input is read once at its
+/// own width.
+template<class AccumT>
+struct accumulator_cast_op
+{
+    template<class T>
+    HIPCUB_HOST_DEVICE inline AccumT operator()(const T& value) const
+    {
+        return AccumT(value);
+    }
+};
+
+} // namespace detail
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_CUB_THREAD_THREAD_ACCUMULATORS_HPP_
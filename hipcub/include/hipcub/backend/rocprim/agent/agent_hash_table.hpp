@@ -0,0 +1,176 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HIPCUB_ROCPRIM_AGENT_AGENT_HASH_TABLE_HPP_
+#define HIPCUB_ROCPRIM_AGENT_AGENT_HASH_TABLE_HPP_
+
+#include "../../../config.hpp"
+
+#include <stddef.h>
+#include <string.h>
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace detail
+{
+
+/// Open-addressing hash tables with linear probing whose slots hold the index of an item with
+/// the key of the slot instead of the key itself. Keys are compared by reading the items, so the
+/// same tables work for any key type and every slot is claimed with a single 32-bit CAS.
+static constexpr unsigned int hash_table_empty_slot = 0xFFFFFFFFu;
+
+/// Returns the number of slots of a global table for \p num_items keys, a power of two which
+/// keeps the load factor at most 0.5.
+HIPCUB_HOST_DEVICE HIPCUB_FORCEINLINE size_t hash_table_capacity(size_t num_items)
+{
+    size_t capacity = 16;
+    while(capacity < 2 * num_items)
+    {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+template<class KeyT>
+HIPCUB_HOST_DEVICE HIPCUB_FORCEINLINE KeyT hash_table_normalize(const KeyT& key)
+{
+    return key;
+}
+
+// -0.0 and 0.0 compare equal, so they must hash equally, and every NaN hashes like one
+// canonical quiet NaN so hash_table_key_equality can treat all of them as the same key
+HIPCUB_HOST_DEVICE HIPCUB_FORCEINLINE float hash_table_normalize(float key)
+{
+    if(key != key)
+    {
+        const unsigned int bits = 0x7FC00000u;
+        memcpy(&key, &bits, sizeof(key));
+        return key;
+    }
+    return key == 0.0f ? 0.0f : key;
+}
+
+HIPCUB_HOST_DEVICE HIPCUB_FORCEINLINE double hash_table_normalize(double key)
+{
+    if(key != key)
+    {
+        const unsigned long long bits = 0x7FF8000000000000ull;
+        memcpy(&key, &bits, sizeof(key));
+        return key;
+    }
+    return key == 0.0 ? 0.0 : key;
+}
+
+/// Compares keys with \p == but treats keys which are not equal to themselves, like NaN, as
+/// equal to each other, so every lookup of such a key finds the slot it was inserted into.
+struct hash_table_key_equality
+{
+    template<class KeyT>
+    HIPCUB_HOST_DEVICE HIPCUB_FORCEINLINE bool operator()(const KeyT& lhs, const KeyT& rhs) const
+    {
+        return lhs == rhs || (!(lhs == lhs) && !(rhs == rhs));
+    }
+};
+
+/// FNV-1a over the object representation of the key finished with the murmur3 mixer, so
+/// consecutive integers are spread over the whole table.
+struct hash_table_default_hash
+{
+    template<class KeyT>
+    HIPCUB_HOST_DEVICE HIPCUB_FORCEINLINE unsigned int operator()(const KeyT& key) const
+    {
+        const KeyT           normalized = hash_table_normalize(key);
+        const unsigned char* bytes      = reinterpret_cast<const unsigned char*>(&normalized);
+
+        unsigned int hash = 2166136261u;
+        for(size_t i = 0; i < sizeof(KeyT); i++)
+        {
+            hash = (hash ^ bytes[i]) * 16777619u;
+        }
+        hash ^= hash >> 16;
+        hash *= 0x85ebca6bu;
+        hash ^= hash >> 13;
+        hash *= 0xc2b2ae35u;
+        hash ^= hash >> 16;
+        return hash;
+    }
+};
+
+/// Inserts \p key, the key of item \p index of \p keys, into the table and returns its slot. If
+/// the key is already present the slot keeps the index of the item which claimed it. Returns
+/// \p capacity if neither the key nor an empty slot is found within \p max_probes slots.
+template<class KeysIteratorT, class KeyT, class EqualityOpT>
+HIPCUB_DEVICE HIPCUB_FORCEINLINE size_t hash_table_insert(unsigned int* slots,
+                                                          size_t        capacity,
+                                                          KeysIteratorT keys,
+                                                          const KeyT&   key,
+                                                          unsigned int  index,
+                                                          unsigned int  hash,
+                                                          EqualityOpT   equality_op,
+                                                          size_t        max_probes)
+{
+    size_t slot = hash & (capacity - 1);
+    for(size_t probe = 0; probe < max_probes; probe++)
+    {
+        const unsigned int claimed = atomicCAS(&slots[slot], hash_table_empty_slot, index);
+        if(claimed == hash_table_empty_slot || equality_op(keys[claimed], key))
+        {
+            return slot;
+        }
+        slot = (slot + 1) & (capacity - 1);
+    }
+    return capacity;
+}
+
+/// Returns the slot of \p key, or \p capacity if it is not within \p max_probes slots. The
+/// table must not be modified concurrently.
+template<class KeysIteratorT, class KeyT, class EqualityOpT>
+HIPCUB_DEVICE HIPCUB_FORCEINLINE size_t hash_table_find(const unsigned int* slots,
+                                                        size_t              capacity,
+                                                        KeysIteratorT       keys,
+                                                        const KeyT&         key,
+                                                        unsigned int        hash,
+                                                        EqualityOpT         equality_op,
+                                                        size_t              max_probes)
+{
+    size_t slot = hash & (capacity - 1);
+    for(size_t probe = 0; probe < max_probes; probe++)
+    {
+        const unsigned int claimed = slots[slot];
+        if(claimed == hash_table_empty_slot)
+        {
+            return capacity;
+        }
+        if(equality_op(keys[claimed], key))
+        {
+            return slot;
+        }
+        slot = (slot + 1) & (capacity - 1);
+    }
+    return capacity;
+}
+
+} // namespace detail
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_ROCPRIM_AGENT_AGENT_HASH_TABLE_HPP_
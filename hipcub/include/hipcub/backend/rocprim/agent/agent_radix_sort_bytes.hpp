@@ -0,0 +1,536 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HIPCUB_ROCPRIM_AGENT_AGENT_RADIX_SORT_BYTES_HPP_
+#define HIPCUB_ROCPRIM_AGENT_AGENT_RADIX_SORT_BYTES_HPP_
+
+#include "../../../config.hpp"
+
+#include "../util_sync.hpp"
+#include "../util_temporary_storage.hpp"
+
+#include <rocprim/device/device_radix_sort.hpp>
+#include <rocprim/device/device_scan.hpp>
+#include <rocprim/device/device_select.hpp>
+#include <rocprim/functional.hpp>
+#include <rocprim/intrinsics.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace detail
+{
+
+static constexpr unsigned int radix_sort_bytes_block_size = 256;
+static constexpr unsigned int radix_sort_bytes_word_bytes = 8;
+
+/// Returns the global index of the calling thread in a one-dimensional grid.
+HIPCUB_DEVICE HIPCUB_FORCEINLINE size_t radix_sort_bytes_index()
+{
+    return static_cast<size_t>(::rocprim::detail::block_id<0>()) * radix_sort_bytes_block_size
+           + ::rocprim::detail::block_thread_id<0>();
+}
+
+template<class IndexT>
+__global__ __launch_bounds__(radix_sort_bytes_block_size) void radix_sort_bytes_sequence_kernel(
+    IndexT* indices, size_t size)
+{
+    const size_t i = radix_sort_bytes_index();
+    if(i < size)
+    {
+        indices[i] = static_cast<IndexT>(i);
+    }
+}
+
+/// Loads the bytes <tt>[offset, offset + 8)</tt> of the key at every unresolved position as a
+/// big-endian word, so the words compare like the bytes. Bytes past the key are zero.
+template<class IndexT>
+__global__ __launch_bounds__(radix_sort_bytes_block_size) void radix_sort_bytes_load_kernel(
+    const unsigned char* keys,
+    unsigned int         key_bytes,
+    unsigned int         offset,
+    const IndexT*        permutation,
+    const IndexT*        positions,
+    uint64_t*            words,
+    size_t               size)
+{
+    const size_t i = radix_sort_bytes_index();
+    if(i >= size)
+    {
+        return;
+    }
+
+    const unsigned char* key
+        = keys + static_cast<size_t>(permutation[positions[i]]) * key_bytes + offset;
+    const unsigned int available = ::rocprim::min(key_bytes - offset, radix_sort_bytes_word_bytes);
+
+    uint64_t word = 0;
+    for(unsigned int byte = 0; byte < radix_sort_bytes_word_bytes; byte++)
+    {
+        word = (word << 8) | (byte < available ? key[byte] : 0u);
+    }
+    words[i] = word;
+}
+
+template<class IndexT>
+__global__ __launch_bounds__(radix_sort_bytes_block_size) void radix_sort_bytes_gather_kernel(
+    const IndexT* input, const IndexT* order, IndexT* output, size_t size)
+{
+    const size_t i = radix_sort_bytes_index();
+    if(i < size)
+    {
+        output[i] = input[order[i]];
+    }
+}
+
+/// Reads the rows and words of the unresolved positions in their new order. The rows are read
+/// from the permutation before any of them is overwritten by the scatter kernel.
+template<class IndexT>
+__global__ __launch_bounds__(radix_sort_bytes_block_size) void radix_sort_bytes_reorder_kernel(
+    const IndexT*   permutation,
+    const IndexT*   positions,
+    const IndexT*   order,
+    const uint64_t* words,
+    IndexT*         rows,
+    uint64_t*       sorted_words,
+    size_t          size)
+{
+    const size_t i = radix_sort_bytes_index();
+    if(i < size)
+    {
+        const IndexT source = order[i];
+        rows[i]             = permutation[positions[source]];
+        sorted_words[i]     = words[source];
+    }
+}
+
+/// Writes the reordered rows back to their positions in the permutation. Items whose group and
+/// word differ from the previous item start a new group, the position of its first item becomes
+/// its group. Items that are alone in their new group are resolved and are not flagged.
+template<class IndexT>
+__global__ __launch_bounds__(radix_sort_bytes_block_size) void radix_sort_bytes_scatter_kernel(
+    IndexT*         permutation,
+    const IndexT*   positions,
+    const IndexT*   rows,
+    const IndexT*   groups,
+    const uint64_t* sorted_words,
+    IndexT*         group_starts,
+    unsigned char*  unresolved,
+    size_t          size)
+{
+    const size_t i = radix_sort_bytes_index();
+    if(i >= size)
+    {
+        return;
+    }
+
+    permutation[positions[i]] = rows[i];
+
+    const bool head
+        = i == 0 || groups[i] != groups[i - 1] || sorted_words[i] != sorted_words[i - 1];
+    const bool next_head
+        = i + 1 == size || groups[i + 1] != groups[i] || sorted_words[i + 1] != sorted_words[i];
+    group_starts[i] = head ? positions[i] : IndexT(0);
+    unresolved[i]   = !(head && next_head);
+}
+
+/// Returns the number of bits that hold every value below \p size.
+inline unsigned int radix_sort_bytes_bits(size_t size)
+{
+    unsigned int bits = 1;
+    while(bits < sizeof(size_t) * 8 && (size - 1) >> bits != 0)
+    {
+        bits++;
+    }
+    return bits;
+}
+
+template<class IndexT>
+inline hipError_t radix_sort_bytes_storage_bytes(size_t& storage_bytes, size_t size)
+{
+    size_t     words_bytes = 0;
+    hipError_t error       = ::rocprim::radix_sort_pairs(nullptr,
+                                                   words_bytes,
+                                                   static_cast<uint64_t*>(nullptr),
+                                                   static_cast<uint64_t*>(nullptr),
+                                                   static_cast<const IndexT*>(nullptr),
+                                                   static_cast<IndexT*>(nullptr),
+                                                   size);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    size_t groups_bytes = 0;
+    error               = ::rocprim::radix_sort_pairs(nullptr,
+                                          groups_bytes,
+                                          static_cast<IndexT*>(nullptr),
+                                          static_cast<IndexT*>(nullptr),
+                                          static_cast<const IndexT*>(nullptr),
+                                          static_cast<IndexT*>(nullptr),
+                                          size);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    size_t scan_bytes = 0;
+    error             = ::rocprim::inclusive_scan(nullptr,
+                                      scan_bytes,
+                                      static_cast<const IndexT*>(nullptr),
+                                      static_cast<IndexT*>(nullptr),
+                                      size,
+                                      ::rocprim::maximum<IndexT>());
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    size_t select_bytes = 0;
+    error               = ::rocprim::select(nullptr,
+                              select_bytes,
+                              static_cast<const IndexT*>(nullptr),
+                              static_cast<const unsigned char*>(nullptr),
+                              static_cast<IndexT*>(nullptr),
+                              static_cast<size_t*>(nullptr),
+                              size);
+    storage_bytes       = std::max({words_bytes, groups_bytes, scan_bytes, select_bytes});
+    return error;
+}
+
+/// Sorts fixed-length byte strings most significant word first. Every level sorts only the
+/// positions whose prefix so far is shared with another key: their next 8 bytes are sorted as
+/// words and stably by the group of equal prefixes they belong to, the rows are written back to
+/// the positions of the group, and the positions that are now alone in their group are dropped.
+/// The number of unresolved positions is copied back after every level, which synchronizes the
+/// stream, and the sort ends as soon as it is zero or the bytes run out.
+template<class IndexT, class NumItemsT>
+inline hipError_t radix_sort_bytes(void*                d_temp_storage,
+                                   size_t&              temp_storage_bytes,
+                                   const unsigned char* keys,
+                                   int                  key_bytes,
+                                   IndexT*              indices_output,
+                                   NumItemsT            num_items,
+                                   hipStream_t          stream)
+{
+    if(key_bytes < 0)
+    {
+        return hipErrorInvalidValue;
+    }
+    const size_t size = num_items > 0 ? static_cast<size_t>(num_items) : 0;
+
+    size_t     storage_bytes = 0;
+    hipError_t error         = radix_sort_bytes_storage_bytes<IndexT>(storage_bytes, size);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    // Storage, sequence, positions, spare positions, groups, group keys, sorted group keys,
+    // order, sorted order, rows, words, sorted words, flags and the count
+    void*  allocations[14]      = {};
+    size_t allocation_sizes[14] = {storage_bytes,
+                                   size * sizeof(IndexT),
+                                   size * sizeof(IndexT),
+                                   size * sizeof(IndexT),
+                                   size * sizeof(IndexT),
+                                   size * sizeof(IndexT),
+                                   size * sizeof(IndexT),
+                                   size * sizeof(IndexT),
+                                   size * sizeof(IndexT),
+                                   size * sizeof(IndexT),
+                                   size * sizeof(uint64_t),
+                                   size * sizeof(uint64_t),
+                                   size * sizeof(unsigned char),
+                                   sizeof(size_t)};
+    error = AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes);
+    if(error != hipSuccess || d_temp_storage == nullptr || size == 0)
+    {
+        return error;
+    }
+
+    IndexT*        d_sequence     = static_cast<IndexT*>(allocations[1]);
+    IndexT*        d_positions    = static_cast<IndexT*>(allocations[2]);
+    IndexT*        d_spare        = static_cast<IndexT*>(allocations[3]);
+    IndexT*        d_groups       = static_cast<IndexT*>(allocations[4]);
+    IndexT*        d_group_keys   = static_cast<IndexT*>(allocations[5]);
+    IndexT*        d_sorted_group = static_cast<IndexT*>(allocations[6]);
+    IndexT*        d_order        = static_cast<IndexT*>(allocations[7]);
+    IndexT*        d_sorted_order = static_cast<IndexT*>(allocations[8]);
+    IndexT*        d_rows         = static_cast<IndexT*>(allocations[9]);
+    uint64_t*      d_words        = static_cast<uint64_t*>(allocations[10]);
+    uint64_t*      d_sorted_words = static_cast<uint64_t*>(allocations[11]);
+    unsigned char* d_unresolved   = static_cast<unsigned char*>(allocations[12]);
+    size_t*        d_count        = static_cast<size_t*>(allocations[13]);
+
+    const size_t grid_size
+        = ::rocprim::detail::ceiling_div(size, size_t(radix_sort_bytes_block_size));
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(radix_sort_bytes_sequence_kernel),
+                       dim3(grid_size),
+                       dim3(radix_sort_bytes_block_size),
+                       0,
+                       stream,
+                       indices_output,
+                       size);
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("radix_sort_bytes_sequence_kernel", size, start);
+
+    if(size == 1)
+    {
+        return hipSuccess;
+    }
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(radix_sort_bytes_sequence_kernel),
+                       dim3(grid_size),
+                       dim3(radix_sort_bytes_block_size),
+                       0,
+                       stream,
+                       d_sequence,
+                       size);
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("radix_sort_bytes_sequence_kernel", size, start);
+
+    // All positions start unresolved in one group
+    error = hipMemcpyAsync(d_positions,
+                           d_sequence,
+                           size * sizeof(IndexT),
+                           hipMemcpyDeviceToDevice,
+                           stream);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    error = hipMemsetAsync(d_groups, 0, size * sizeof(IndexT), stream);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    const unsigned int group_bits = radix_sort_bytes_bits(size);
+
+    size_t unresolved = size;
+    for(unsigned int offset = 0; offset < static_cast<unsigned int>(key_bytes) && unresolved > 0;
+        offset += radix_sort_bytes_word_bytes)
+    {
+        const size_t level_grid_size
+            = ::rocprim::detail::ceiling_div(unresolved, size_t(radix_sort_bytes_block_size));
+        const unsigned int available
+            = std::min(static_cast<unsigned int>(key_bytes) - offset, radix_sort_bytes_word_bytes);
+        const unsigned int begin_bit = (radix_sort_bytes_word_bytes - available) * 8;
+
+        if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+        {
+            start = std::chrono::high_resolution_clock::now();
+        }
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(radix_sort_bytes_load_kernel),
+                           dim3(level_grid_size),
+                           dim3(radix_sort_bytes_block_size),
+                           0,
+                           stream,
+                           keys,
+                           static_cast<unsigned int>(key_bytes),
+                           offset,
+                           indices_output,
+                           d_positions,
+                           d_words,
+                           unresolved);
+        HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("radix_sort_bytes_load_kernel",
+                                                   unresolved,
+                                                   start);
+
+        // Only the loaded bytes of the word take part in the sort
+        error = ::rocprim::radix_sort_pairs(allocations[0],
+                                            storage_bytes,
+                                            d_words,
+                                            d_sorted_words,
+                                            d_sequence,
+                                            d_order,
+                                            unresolved,
+                                            begin_bit,
+                                            radix_sort_bytes_word_bytes * 8,
+                                            stream,
+                                            HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+
+        // The groups are sorted positions, so a stable sort by group keeps the order of the words
+        // within every group. All positions share one group on the first level.
+        const IndexT* order = d_order;
+        if(offset > 0)
+        {
+            if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+            {
+                start = std::chrono::high_resolution_clock::now();
+            }
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(radix_sort_bytes_gather_kernel),
+                               dim3(level_grid_size),
+                               dim3(radix_sort_bytes_block_size),
+                               0,
+                               stream,
+                               d_groups,
+                               d_order,
+                               d_group_keys,
+                               unresolved);
+            HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("radix_sort_bytes_gather_kernel",
+                                                       unresolved,
+                                                       start);
+
+            error = ::rocprim::radix_sort_pairs(allocations[0],
+                                                storage_bytes,
+                                                d_group_keys,
+                                                d_sorted_group,
+                                                d_order,
+                                                d_sorted_order,
+                                                unresolved,
+                                                0,
+                                                group_bits,
+                                                stream,
+                                                HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+            if(error != hipSuccess)
+            {
+                return error;
+            }
+            order = d_sorted_order;
+        }
+
+        if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+        {
+            start = std::chrono::high_resolution_clock::now();
+        }
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(radix_sort_bytes_reorder_kernel),
+                           dim3(level_grid_size),
+                           dim3(radix_sort_bytes_block_size),
+                           0,
+                           stream,
+                           indices_output,
+                           d_positions,
+                           order,
+                           d_words,
+                           d_rows,
+                           d_sorted_words,
+                           unresolved);
+        HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("radix_sort_bytes_reorder_kernel",
+                                                   unresolved,
+                                                   start);
+
+        if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+        {
+            start = std::chrono::high_resolution_clock::now();
+        }
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(radix_sort_bytes_scatter_kernel),
+                           dim3(level_grid_size),
+                           dim3(radix_sort_bytes_block_size),
+                           0,
+                           stream,
+                           indices_output,
+                           d_positions,
+                           d_rows,
+                           d_groups,
+                           d_sorted_words,
+                           d_group_keys,
+                           d_unresolved,
+                           unresolved);
+        HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("radix_sort_bytes_scatter_kernel",
+                                                   unresolved,
+                                                   start);
+
+        if(offset + radix_sort_bytes_word_bytes >= static_cast<unsigned int>(key_bytes))
+        {
+            break;
+        }
+
+        // The positions increase, so a running maximum gives every item the start of its group
+        error = ::rocprim::inclusive_scan(allocations[0],
+                                          storage_bytes,
+                                          d_group_keys,
+                                          d_sorted_group,
+                                          unresolved,
+                                          ::rocprim::maximum<IndexT>(),
+                                          stream,
+                                          HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        error = ::rocprim::select(allocations[0],
+                                  storage_bytes,
+                                  d_sorted_group,
+                                  d_unresolved,
+                                  d_groups,
+                                  d_count,
+                                  unresolved,
+                                  stream,
+                                  HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        error = ::rocprim::select(allocations[0],
+                                  storage_bytes,
+                                  d_positions,
+                                  d_unresolved,
+                                  d_spare,
+                                  d_count,
+                                  unresolved,
+                                  stream,
+                                  HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        std::swap(d_positions, d_spare);
+
+        error = hipMemcpyAsync(&unresolved,
+                               d_count,
+                               sizeof(size_t),
+                               hipMemcpyDeviceToHost,
+                               stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        error = hipStreamSynchronize(stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+    }
+
+    return hipSuccess;
+}
+
+} // namespace detail
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_ROCPRIM_AGENT_AGENT_RADIX_SORT_BYTES_HPP_
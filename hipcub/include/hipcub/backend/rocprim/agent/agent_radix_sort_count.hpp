@@ -0,0 +1,315 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HIPCUB_ROCPRIM_AGENT_AGENT_RADIX_SORT_COUNT_HPP_
+#define HIPCUB_ROCPRIM_AGENT_AGENT_RADIX_SORT_COUNT_HPP_
+
+#include "../../../config.hpp"
+
+#include "../block/block_discontinuity.hpp"
+#include "../block/block_radix_sort.hpp"
+#include "../block/block_scan.hpp"
+#include "../thread/thread_operators.hpp"
+#include "../util_temporary_storage.hpp"
+#include "agent_single_block.hpp"
+
+#include <rocprim/device/device_radix_sort.hpp>
+#include <rocprim/device/device_reduce_by_key.hpp>
+#include <rocprim/functional.hpp>
+#include <rocprim/intrinsics.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace detail
+{
+
+/// Sorts a tile of \p single_block_max_items keys in LDS and writes one (key, count) pair per
+/// distinct key of the tile. With \p partial_count the pairs of every tile are appended at an
+/// offset reserved with an atomic, otherwise the grid is a single tile whose pairs are the final
+/// result and its number of pairs is written to \p num_unique_output.
+template<class KeyT, class CountT, class NumUniqueOutputIteratorT>
+__global__ __launch_bounds__(single_block_size) void radix_sort_count_tile_kernel(
+    const KeyT*              keys_input,
+    KeyT*                    unique_output,
+    CountT*                  counts_output,
+    unsigned int*            partial_count,
+    NumUniqueOutputIteratorT num_unique_output,
+    unsigned int             size)
+{
+    using block_sort_type = BlockRadixSort<KeyT, single_block_size, single_block_items_per_thread>;
+    using block_flag_type = BlockDiscontinuity<KeyT, single_block_size>;
+    using block_scan_type = BlockScan<unsigned int, single_block_size>;
+
+    __shared__ ::rocprim::detail::raw_storage<typename block_sort_type::TempStorage> sort_storage;
+    __shared__ ::rocprim::detail::raw_storage<typename block_flag_type::TempStorage> flag_storage;
+    __shared__ ::rocprim::detail::raw_storage<typename block_scan_type::TempStorage> scan_storage;
+    __shared__ unsigned int run_starts[single_block_max_items + 1];
+    __shared__ unsigned int tile_offset;
+
+    const unsigned int flat_id   = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int tile_base = ::rocprim::detail::block_id<0>() * single_block_max_items;
+    const unsigned int valid     = ::rocprim::min(size - tile_base, single_block_max_items);
+    const KeyT         padding   = single_block_radix_sort_padding<false, KeyT>();
+
+    KeyT keys[single_block_items_per_thread];
+    for(unsigned int item = 0; item < single_block_items_per_thread; item++)
+    {
+        const unsigned int i = flat_id * single_block_items_per_thread + item;
+        keys[item]           = i < valid ? keys_input[tile_base + i] : padding;
+    }
+
+    // The padding sorts after every key, so the first valid items of the tile are its keys
+    block_sort_type(sort_storage.get()).Sort(keys);
+
+    unsigned int heads[single_block_items_per_thread];
+    block_flag_type(flag_storage.get()).FlagHeads(heads, keys, Inequality());
+    for(unsigned int item = 0; item < single_block_items_per_thread; item++)
+    {
+        const unsigned int i = flat_id * single_block_items_per_thread + item;
+        heads[item]          = i < valid ? heads[item] : 0u;
+    }
+
+    unsigned int runs[single_block_items_per_thread];
+    unsigned int num_runs;
+    block_scan_type(scan_storage.get()).ExclusiveSum(heads, runs, num_runs);
+
+    for(unsigned int item = 0; item < single_block_items_per_thread; item++)
+    {
+        if(heads[item])
+        {
+            run_starts[runs[item]] = flat_id * single_block_items_per_thread + item;
+        }
+    }
+    if(flat_id == 0)
+    {
+        run_starts[num_runs] = valid;
+        if(partial_count != nullptr)
+        {
+            tile_offset = atomicAdd(partial_count, num_runs);
+        }
+        else
+        {
+            tile_offset        = 0;
+            *num_unique_output = num_runs;
+        }
+    }
+    ::rocprim::syncthreads();
+
+    for(unsigned int item = 0; item < single_block_items_per_thread; item++)
+    {
+        if(heads[item])
+        {
+            const unsigned int i      = flat_id * single_block_items_per_thread + item;
+            const unsigned int output = tile_offset + runs[item];
+            unique_output[output]     = keys[item];
+            counts_output[output]     = static_cast<CountT>(run_starts[runs[item] + 1] - i);
+        }
+    }
+}
+
+/// Computes the unique keys of \p keys_input in ascending order and the number of occurrences of
+/// each. Every tile is first collapsed to one (key, count) pair per distinct key, so the device
+/// sort and the reduction by key only process those pairs. Inputs of at most one tile take a
+/// single launch; larger inputs synchronize the stream once to read the number of pairs.
+template<class KeyT, class CountT, class NumUniqueOutputIteratorT, class NumItemsT>
+inline hipError_t radix_sort_count(void*                    d_temp_storage,
+                                   size_t&                  temp_storage_bytes,
+                                   const KeyT*              keys_input,
+                                   KeyT*                    unique_output,
+                                   CountT*                  counts_output,
+                                   NumUniqueOutputIteratorT num_unique_output,
+                                   NumItemsT                num_items,
+                                   hipStream_t              stream)
+{
+    static_assert(single_block_sortable<KeyT>::value,
+                  "Integral keys of up to 8 bytes, float and double keys are supported");
+
+    // Positions and counts within the input are 32-bit values
+    if(static_cast<long long>(num_items) < 0
+       || static_cast<unsigned long long>(num_items) > std::numeric_limits<unsigned int>::max())
+    {
+        return hipErrorInvalidValue;
+    }
+    const unsigned int size         = static_cast<unsigned int>(num_items);
+    // The tile count is computed in 64 bits as rounding up wraps for sizes close to 2^32
+    const unsigned int tiles        = static_cast<unsigned int>(
+        (static_cast<size_t>(size) + single_block_max_items - 1) / single_block_max_items);
+    const size_t       partial_size = tiles > 1 ? size : 0;
+
+    size_t     sort_bytes   = 0;
+    size_t     reduce_bytes = 0;
+    hipError_t error        = hipSuccess;
+    if(tiles > 1)
+    {
+        error = ::rocprim::radix_sort_pairs(nullptr,
+                                            sort_bytes,
+                                            static_cast<const KeyT*>(nullptr),
+                                            static_cast<KeyT*>(nullptr),
+                                            static_cast<const CountT*>(nullptr),
+                                            static_cast<CountT*>(nullptr),
+                                            size);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        error = ::rocprim::reduce_by_key(nullptr,
+                                         reduce_bytes,
+                                         static_cast<const KeyT*>(nullptr),
+                                         static_cast<const CountT*>(nullptr),
+                                         size,
+                                         unique_output,
+                                         counts_output,
+                                         num_unique_output,
+                                         ::rocprim::plus<CountT>(),
+                                         ::rocprim::equal_to<KeyT>());
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+    }
+
+    // Storage, the pairs of the tiles, the sorted pairs and the number of pairs
+    void*  allocations[6]      = {};
+    size_t allocation_sizes[6] = {std::max(sort_bytes, reduce_bytes),
+                                  partial_size * sizeof(KeyT),
+                                  partial_size * sizeof(CountT),
+                                  partial_size * sizeof(KeyT),
+                                  partial_size * sizeof(CountT),
+                                  sizeof(unsigned int)};
+    error = AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes);
+    if(error != hipSuccess || d_temp_storage == nullptr)
+    {
+        return error;
+    }
+
+    KeyT*         d_partial_keys   = static_cast<KeyT*>(allocations[1]);
+    CountT*       d_partial_counts = static_cast<CountT*>(allocations[2]);
+    KeyT*         d_sorted_keys    = static_cast<KeyT*>(allocations[3]);
+    CountT*       d_sorted_counts  = static_cast<CountT*>(allocations[4]);
+    unsigned int* d_partial_count  = static_cast<unsigned int*>(allocations[5]);
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    // Empty inputs also take the single tile path, which writes zero unique keys
+    if(tiles <= 1)
+    {
+        if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+        {
+            start = std::chrono::high_resolution_clock::now();
+        }
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(radix_sort_count_tile_kernel<KeyT, CountT, NumUniqueOutputIteratorT>),
+            dim3(1),
+            dim3(single_block_size),
+            0,
+            stream,
+            keys_input,
+            unique_output,
+            counts_output,
+            static_cast<unsigned int*>(nullptr),
+            num_unique_output,
+            size);
+        HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("radix_sort_count_tile_kernel", size, start);
+        return hipSuccess;
+    }
+
+    error = hipMemsetAsync(d_partial_count, 0, sizeof(unsigned int), stream);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(radix_sort_count_tile_kernel<KeyT, CountT, NumUniqueOutputIteratorT>),
+        dim3(tiles),
+        dim3(single_block_size),
+        0,
+        stream,
+        keys_input,
+        d_partial_keys,
+        d_partial_counts,
+        d_partial_count,
+        num_unique_output,
+        size);
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("radix_sort_count_tile_kernel", size, start);
+
+    unsigned int partial_count = 0;
+    error                      = hipMemcpyAsync(&partial_count,
+                                                d_partial_count,
+                                                sizeof(unsigned int),
+                                                hipMemcpyDeviceToHost,
+                                                stream);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    error = hipStreamSynchronize(stream);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    size_t storage_bytes = allocation_sizes[0];
+    error                = ::rocprim::radix_sort_pairs(allocations[0],
+                                                       storage_bytes,
+                                                       d_partial_keys,
+                                                       d_sorted_keys,
+                                                       d_partial_counts,
+                                                       d_sorted_counts,
+                                                       partial_count,
+                                                       0,
+                                                       static_cast<unsigned int>(sizeof(KeyT) * 8),
+                                                       stream,
+                                                       HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    storage_bytes = allocation_sizes[0];
+    return ::rocprim::reduce_by_key(allocations[0],
+                                    storage_bytes,
+                                    d_sorted_keys,
+                                    d_sorted_counts,
+                                    partial_count,
+                                    unique_output,
+                                    counts_output,
+                                    num_unique_output,
+                                    ::rocprim::plus<CountT>(),
+                                    ::rocprim::equal_to<KeyT>(),
+                                    stream,
+                                    HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+}
+
+} // namespace detail
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_ROCPRIM_AGENT_AGENT_RADIX_SORT_COUNT_HPP_
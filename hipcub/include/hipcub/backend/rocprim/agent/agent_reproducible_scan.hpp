@@ -0,0 +1,332 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HIPCUB_ROCPRIM_AGENT_AGENT_REPRODUCIBLE_SCAN_HPP_
+#define HIPCUB_ROCPRIM_AGENT_AGENT_REPRODUCIBLE_SCAN_HPP_
+
+#include "../../../config.hpp"
+
+#include "../util_sync.hpp"
+
+#include <rocprim/detail/various.hpp>
+#include <rocprim/intrinsics.hpp>
+
+#include <chrono>
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace detail
+{
+
+/// The tile decomposition of the reproducible reduce and scan is fixed and doesn't depend on the
+/// device, so the order of the additions only depends on the number of items.
+static constexpr unsigned int reproducible_scan_block_size       = 256;
+static constexpr unsigned int reproducible_scan_items_per_thread = 16;
+static constexpr unsigned int reproducible_scan_items_per_tile
+    = reproducible_scan_block_size * reproducible_scan_items_per_thread;
+
+template<class AccT>
+struct reproducible_scan_storage
+{
+    AccT items[reproducible_scan_items_per_tile];
+    AccT thread_totals[reproducible_scan_block_size];
+};
+
+/// Loads a tile in a striped arrangement and transposes it through LDS, so every thread owns
+/// \p reproducible_scan_items_per_thread consecutive items. Items past \p size are zero.
+template<class InputIteratorT, class AccT>
+HIPCUB_DEVICE void reproducible_scan_load_tile(InputIteratorT input,
+                                               size_t         size,
+                                               AccT (&items)[reproducible_scan_items_per_thread],
+                                               reproducible_scan_storage<AccT>& storage)
+{
+    constexpr unsigned int block_size       = reproducible_scan_block_size;
+    constexpr unsigned int items_per_thread = reproducible_scan_items_per_thread;
+    constexpr size_t       items_per_tile   = reproducible_scan_items_per_tile;
+
+    const unsigned int flat_id     = ::rocprim::detail::block_thread_id<0>();
+    const size_t       tile_offset = ::rocprim::detail::block_id<0>() * items_per_tile;
+    const size_t       valid = size - tile_offset < items_per_tile ? size - tile_offset
+                                                                   : items_per_tile;
+
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        const unsigned int index = i * block_size + flat_id;
+        storage.items[index]     = index < valid ? static_cast<AccT>(input[tile_offset + index])
+                                                 : AccT(0);
+    }
+    ::rocprim::syncthreads();
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        items[i] = storage.items[flat_id * items_per_thread + i];
+    }
+    ::rocprim::syncthreads();
+}
+
+/// Scans a tile in an order that only depends on the tile size: every thread scans its own items
+/// sequentially and the thread totals are combined by a Kogge-Stone scan in LDS. Warp-level
+/// primitives are not used, so the wavefront size of the device does not change the result.
+/// Returns the total of the tile.
+template<bool Exclusive, class AccT>
+HIPCUB_DEVICE AccT reproducible_scan_tile(AccT (&items)[reproducible_scan_items_per_thread],
+                                          AccT* thread_totals)
+{
+    constexpr unsigned int block_size       = reproducible_scan_block_size;
+    constexpr unsigned int items_per_thread = reproducible_scan_items_per_thread;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+
+    for(unsigned int i = 1; i < items_per_thread; i++)
+    {
+        items[i] = items[i - 1] + items[i];
+    }
+    thread_totals[flat_id] = items[items_per_thread - 1];
+    ::rocprim::syncthreads();
+
+    for(unsigned int distance = 1; distance < block_size; distance <<= 1)
+    {
+        const AccT previous = flat_id >= distance ? thread_totals[flat_id - distance] : AccT(0);
+        ::rocprim::syncthreads();
+        if(flat_id >= distance)
+        {
+            thread_totals[flat_id] = previous + thread_totals[flat_id];
+        }
+        ::rocprim::syncthreads();
+    }
+
+    const AccT prefix = flat_id == 0 ? AccT(0) : thread_totals[flat_id - 1];
+    const AccT total  = thread_totals[block_size - 1];
+    ::rocprim::syncthreads();
+
+    if(Exclusive)
+    {
+        for(unsigned int i = items_per_thread - 1; i > 0; i--)
+        {
+            items[i] = prefix + items[i - 1];
+        }
+        items[0] = prefix;
+    }
+    else
+    {
+        for(unsigned int i = 0; i < items_per_thread; i++)
+        {
+            items[i] = prefix + items[i];
+        }
+    }
+    return total;
+}
+
+/// Writes the total of every tile to \p tile_totals.
+template<class InputIteratorT, class OutputIteratorT, class AccT>
+__global__ __launch_bounds__(reproducible_scan_block_size) void reproducible_scan_totals_kernel(
+    InputIteratorT input, OutputIteratorT tile_totals, size_t size)
+{
+    __shared__ ::rocprim::detail::raw_storage<reproducible_scan_storage<AccT>> storage;
+
+    AccT items[reproducible_scan_items_per_thread];
+    reproducible_scan_load_tile(input, size, items, storage.get());
+    const AccT total = reproducible_scan_tile<false>(items, storage.get().thread_totals);
+    if(::rocprim::detail::block_thread_id<0>() == 0)
+    {
+        tile_totals[::rocprim::detail::block_id<0>()] = total;
+    }
+}
+
+/// Scans every tile and adds the exclusive prefix of the tile, if \p tile_prefixes is not null.
+/// Every block reads its whole tile before writing it, so the scan can run in place.
+template<bool Exclusive, class InputIteratorT, class OutputIteratorT, class AccT>
+__global__ __launch_bounds__(reproducible_scan_block_size) void reproducible_scan_kernel(
+    InputIteratorT input, OutputIteratorT output, const AccT* tile_prefixes, size_t size)
+{
+    constexpr unsigned int block_size       = reproducible_scan_block_size;
+    constexpr unsigned int items_per_thread = reproducible_scan_items_per_thread;
+    constexpr size_t       items_per_tile   = reproducible_scan_items_per_tile;
+
+    __shared__ ::rocprim::detail::raw_storage<reproducible_scan_storage<AccT>> storage;
+
+    const unsigned int flat_id     = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int tile_id     = ::rocprim::detail::block_id<0>();
+    const size_t       tile_offset = static_cast<size_t>(tile_id) * items_per_tile;
+    const size_t       valid = size - tile_offset < items_per_tile ? size - tile_offset
+                                                                   : items_per_tile;
+
+    AccT items[items_per_thread];
+    reproducible_scan_load_tile(input, size, items, storage.get());
+    reproducible_scan_tile<Exclusive>(items, storage.get().thread_totals);
+
+    const AccT tile_prefix = tile_prefixes == nullptr ? AccT(0) : tile_prefixes[tile_id];
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        storage.get().items[flat_id * items_per_thread + i] = tile_prefix + items[i];
+    }
+    ::rocprim::syncthreads();
+    for(unsigned int i = 0; i < items_per_thread; i++)
+    {
+        const unsigned int index = i * block_size + flat_id;
+        if(index < valid)
+        {
+            output[tile_offset + index] = storage.get().items[index];
+        }
+    }
+}
+
+inline size_t reproducible_scan_tiles(size_t size)
+{
+    return (size + reproducible_scan_items_per_tile - 1) / reproducible_scan_items_per_tile;
+}
+
+/// Returns the size of the tile totals of every level of the reduction of \p size items.
+template<class AccT>
+inline size_t reproducible_scan_temp_storage_bytes(size_t size)
+{
+    size_t bytes = 0;
+    while(size > reproducible_scan_items_per_tile)
+    {
+        size = reproducible_scan_tiles(size);
+        bytes += size * sizeof(AccT);
+    }
+    return bytes;
+}
+
+/// Reduces the tiles level by level until a single tile is left, \p tile_totals must hold
+/// \p reproducible_scan_temp_storage_bytes(size) bytes.
+template<class AccT, class InputIteratorT, class OutputIteratorT>
+inline hipError_t reproducible_reduce(InputIteratorT  input,
+                                      OutputIteratorT output,
+                                      size_t          size,
+                                      AccT*           tile_totals,
+                                      hipStream_t     stream)
+{
+    const size_t tiles = reproducible_scan_tiles(size);
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    if(tiles <= 1)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(reproducible_scan_totals_kernel<InputIteratorT, OutputIteratorT, AccT>),
+            dim3(1),
+            dim3(reproducible_scan_block_size),
+            0,
+            stream,
+            input,
+            output,
+            size);
+        HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("reproducible_scan_totals_kernel", size, start);
+        return hipSuccess;
+    }
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(reproducible_scan_totals_kernel<InputIteratorT, AccT*, AccT>),
+        dim3(tiles),
+        dim3(reproducible_scan_block_size),
+        0,
+        stream,
+        input,
+        tile_totals,
+        size);
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("reproducible_scan_totals_kernel", size, start);
+
+    return reproducible_reduce<AccT>(static_cast<const AccT*>(tile_totals),
+                                     output,
+                                     tiles,
+                                     tile_totals + tiles,
+                                     stream);
+}
+
+/// Scans the tile totals recursively with the same decomposition and then scans every tile
+/// starting from its prefix, \p tile_totals must hold
+/// \p reproducible_scan_temp_storage_bytes(size) bytes.
+template<bool Exclusive, class AccT, class InputIteratorT, class OutputIteratorT>
+inline hipError_t reproducible_scan(InputIteratorT  input,
+                                    OutputIteratorT output,
+                                    size_t          size,
+                                    AccT*           tile_totals,
+                                    hipStream_t     stream)
+{
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+    const size_t tiles = reproducible_scan_tiles(size);
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    const AccT* tile_prefixes = nullptr;
+    if(tiles > 1)
+    {
+        if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+        {
+            start = std::chrono::high_resolution_clock::now();
+        }
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(reproducible_scan_totals_kernel<InputIteratorT, AccT*, AccT>),
+            dim3(tiles),
+            dim3(reproducible_scan_block_size),
+            0,
+            stream,
+            input,
+            tile_totals,
+            size);
+        HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("reproducible_scan_totals_kernel", size, start);
+
+        hipError_t error = reproducible_scan<true, AccT>(static_cast<const AccT*>(tile_totals),
+                                                         tile_totals,
+                                                         tiles,
+                                                         tile_totals + tiles,
+                                                         stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        tile_prefixes = tile_totals;
+    }
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(
+            reproducible_scan_kernel<Exclusive, InputIteratorT, OutputIteratorT, AccT>),
+        dim3(tiles),
+        dim3(reproducible_scan_block_size),
+        0,
+        stream,
+        input,
+        output,
+        tile_prefixes,
+        size);
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("reproducible_scan_kernel", size, start);
+
+    return hipSuccess;
+}
+
+} // namespace detail
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_ROCPRIM_AGENT_AGENT_REPRODUCIBLE_SCAN_HPP_
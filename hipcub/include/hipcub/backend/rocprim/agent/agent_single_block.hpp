@@ -0,0 +1,550 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HIPCUB_ROCPRIM_AGENT_AGENT_SINGLE_BLOCK_HPP_
+#define HIPCUB_ROCPRIM_AGENT_AGENT_SINGLE_BLOCK_HPP_
+
+#include "../../../config.hpp"
+
+#include "../block/block_radix_sort.hpp"
+#include "../block/block_reduce.hpp"
+#include "../block/block_scan.hpp"
+#include "../util_sync.hpp"
+#include "../util_type.hpp"
+
+#include <rocprim/detail/various.hpp>
+#include <rocprim/intrinsics.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace detail
+{
+
+/// Inputs of at most \p single_block_max_items items are processed by a single block with the
+/// block primitives, so a call is one kernel launch instead of the multi-kernel dispatch of the
+/// device algorithms. The single block paths don't use temporary storage.
+static constexpr unsigned int single_block_size             = 256;
+static constexpr unsigned int single_block_items_per_thread = 8;
+static constexpr unsigned int single_block_max_items
+    = single_block_size * single_block_items_per_thread;
+/// Make sure user won't try to allocate 0 bytes memory
+static constexpr size_t single_block_temp_storage_bytes = 1;
+
+template<class NumItemsT>
+HIPCUB_HOST_DEVICE HIPCUB_FORCEINLINE bool single_block_eligible(NumItemsT num_items)
+{
+    // Negative sizes wrap around and are left to the device algorithms
+    return static_cast<size_t>(num_items) <= single_block_max_items;
+}
+
+/// Keys the block radix sort can pad with \p Traits<KeyT>::MAX_KEY and \p LOWEST_KEY.
+template<class KeyT>
+struct single_block_sortable
+    : std::integral_constant<bool,
+                             (std::is_integral<KeyT>::value && !std::is_same<KeyT, bool>::value
+                              && sizeof(KeyT) <= sizeof(long long))
+                                 || std::is_same<KeyT, float>::value
+                                 || std::is_same<KeyT, double>::value>
+{};
+
+/// Every thread reduces its consecutive items first, so the order of the operands is the same as
+/// in the input and \p reduce_op doesn't need to be commutative.
+template<class AccT, class InputIteratorT, class OutputIteratorT, class ReduceOpT, class InitT>
+__global__ __launch_bounds__(single_block_size) void single_block_reduce_kernel(
+    InputIteratorT  input,
+    OutputIteratorT output,
+    unsigned int    size,
+    ReduceOpT       reduce_op,
+    InitT           init)
+{
+    using block_reduce_type = BlockReduce<AccT, single_block_size>;
+
+    __shared__ ::rocprim::detail::raw_storage<typename block_reduce_type::TempStorage> storage;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int begin   = flat_id * single_block_items_per_thread;
+    const unsigned int end     = ::rocprim::min(begin + single_block_items_per_thread, size);
+
+    AccT thread_aggregate{};
+    if(begin < end)
+    {
+        thread_aggregate = static_cast<AccT>(input[begin]);
+        for(unsigned int i = begin + 1; i < end; i++)
+        {
+            thread_aggregate = reduce_op(thread_aggregate, static_cast<AccT>(input[i]));
+        }
+    }
+
+    const int valid_threads = static_cast<int>(
+        (size + single_block_items_per_thread - 1) / single_block_items_per_thread);
+    const AccT aggregate
+        = block_reduce_type(storage.get()).Reduce(thread_aggregate, reduce_op, valid_threads);
+    if(flat_id == 0)
+    {
+        *output = size > 0 ? reduce_op(static_cast<AccT>(init), aggregate)
+                           : static_cast<AccT>(init);
+    }
+}
+
+/// Items past \p size repeat the last item, they take part in the scan but are not written. All
+/// items are loaded before the first barrier of the scan, so the scan can run in place.
+template<bool Exclusive, class AccT, class InputIteratorT, class OutputIteratorT, class ScanOpT>
+__global__ __launch_bounds__(single_block_size) void single_block_scan_kernel(
+    InputIteratorT input, OutputIteratorT output, unsigned int size, ScanOpT scan_op, AccT init)
+{
+    using block_scan_type = BlockScan<AccT, single_block_size>;
+
+    __shared__ ::rocprim::detail::raw_storage<typename block_scan_type::TempStorage> storage;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+
+    AccT items[single_block_items_per_thread];
+    for(unsigned int item = 0; item < single_block_items_per_thread; item++)
+    {
+        const unsigned int i = flat_id * single_block_items_per_thread + item;
+        items[item]          = input[i < size ? i : size - 1];
+    }
+
+    if(Exclusive)
+    {
+        block_scan_type(storage.get()).ExclusiveScan(items, items, init, scan_op);
+    }
+    else
+    {
+        block_scan_type(storage.get()).InclusiveScan(items, items, scan_op);
+    }
+
+    for(unsigned int item = 0; item < single_block_items_per_thread; item++)
+    {
+        const unsigned int i = flat_id * single_block_items_per_thread + item;
+        if(i < size)
+        {
+            output[i] = items[item];
+        }
+    }
+}
+
+template<class SelectOpT>
+struct single_block_select_if
+{
+    SelectOpT select_op;
+
+    template<class T>
+    HIPCUB_DEVICE HIPCUB_FORCEINLINE bool operator()(unsigned int /*index*/, const T& item) const
+    {
+        return static_cast<bool>(select_op(item));
+    }
+};
+
+template<class FlagIteratorT>
+struct single_block_select_flagged
+{
+    FlagIteratorT flags;
+
+    template<class T>
+    HIPCUB_DEVICE HIPCUB_FORCEINLINE bool operator()(unsigned int index, const T& /*item*/) const
+    {
+        return static_cast<bool>(flags[index]);
+    }
+};
+
+/// Compacts the selected items with a block-wide exclusive sum of the selection counts of the
+/// threads. The selected items keep their order and none is written before all are loaded, so
+/// the selection can run in place.
+template<class InputIteratorT,
+         class OutputIteratorT,
+         class NumSelectedIteratorT,
+         class SelectorT>
+__global__ __launch_bounds__(single_block_size) void single_block_select_kernel(
+    InputIteratorT       input,
+    OutputIteratorT      output,
+    NumSelectedIteratorT num_selected_out,
+    unsigned int         size,
+    SelectorT            selector)
+{
+    using value_type      = typename std::iterator_traits<InputIteratorT>::value_type;
+    using block_scan_type = BlockScan<unsigned int, single_block_size>;
+
+    __shared__ ::rocprim::detail::raw_storage<typename block_scan_type::TempStorage> storage;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+
+    value_type   items[single_block_items_per_thread];
+    bool         selected[single_block_items_per_thread];
+    unsigned int thread_count = 0;
+    for(unsigned int item = 0; item < single_block_items_per_thread; item++)
+    {
+        const unsigned int i = flat_id * single_block_items_per_thread + item;
+        selected[item]       = false;
+        if(i < size)
+        {
+            items[item]    = input[i];
+            selected[item] = selector(i, items[item]);
+            thread_count += selected[item] ? 1 : 0;
+        }
+    }
+
+    unsigned int thread_offset;
+    unsigned int total;
+    block_scan_type(storage.get()).ExclusiveSum(thread_count, thread_offset, total);
+
+    for(unsigned int item = 0; item < single_block_items_per_thread; item++)
+    {
+        if(selected[item])
+        {
+            output[thread_offset++] = items[item];
+        }
+    }
+    if(flat_id == 0)
+    {
+        *num_selected_out = total;
+    }
+}
+
+/// Items past the end are padded with the largest key in the sort order, since the sort is
+/// stable they stay behind the valid items even if those have the same digits.
+template<bool Descending, class KeyT>
+HIPCUB_DEVICE HIPCUB_FORCEINLINE KeyT single_block_radix_sort_padding()
+{
+    using bits_type = typename Traits<KeyT>::UnsignedBits;
+
+    const bits_type bits = Descending ? bits_type(Traits<KeyT>::LOWEST_KEY)
+                                      : bits_type(Traits<KeyT>::MAX_KEY);
+    KeyT            key;
+    memcpy(&key, &bits, sizeof(KeyT));
+    return key;
+}
+
+template<bool Descending, class BlockSortT, unsigned int ItemsPerThread, class KeyT, class ValueT>
+HIPCUB_DEVICE HIPCUB_FORCEINLINE void
+    single_block_radix_sort_items(BlockSortT& block_sort,
+                                  KeyT (&keys)[ItemsPerThread],
+                                  ValueT (&values)[ItemsPerThread],
+                                  int begin_bit,
+                                  int end_bit)
+{
+    if(Descending)
+    {
+        block_sort.SortDescendingBlockedToStriped(keys, values, begin_bit, end_bit);
+    }
+    else
+    {
+        block_sort.SortBlockedToStriped(keys, values, begin_bit, end_bit);
+    }
+}
+
+template<bool Descending, class BlockSortT, unsigned int ItemsPerThread, class KeyT>
+HIPCUB_DEVICE HIPCUB_FORCEINLINE void
+    single_block_radix_sort_items(BlockSortT& block_sort,
+                                  KeyT (&keys)[ItemsPerThread],
+                                  NullType (&/*values*/)[ItemsPerThread],
+                                  int begin_bit,
+                                  int end_bit)
+{
+    if(Descending)
+    {
+        block_sort.SortDescendingBlockedToStriped(keys, begin_bit, end_bit);
+    }
+    else
+    {
+        block_sort.SortBlockedToStriped(keys, begin_bit, end_bit);
+    }
+}
+
+/// Sorts the keys, and the values unless \p ValueT is \p NullType, with a stable block radix
+/// sort and stores them in the striped arrangement, so the stores are coalesced.
+template<bool Descending, class KeyT, class ValueT>
+__global__ __launch_bounds__(single_block_size) void single_block_radix_sort_kernel(
+    const KeyT*   keys_input,
+    KeyT*         keys_output,
+    const ValueT* values_input,
+    ValueT*       values_output,
+    unsigned int  size,
+    int           begin_bit,
+    int           end_bit)
+{
+    constexpr bool with_values = !std::is_same<ValueT, NullType>::value;
+    using block_sort_type
+        = BlockRadixSort<KeyT, single_block_size, single_block_items_per_thread, ValueT>;
+
+    __shared__ ::rocprim::detail::raw_storage<typename block_sort_type::TempStorage> storage;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const KeyT         padding = single_block_radix_sort_padding<Descending, KeyT>();
+
+    KeyT   keys[single_block_items_per_thread];
+    ValueT values[single_block_items_per_thread];
+    for(unsigned int item = 0; item < single_block_items_per_thread; item++)
+    {
+        const unsigned int i = flat_id * single_block_items_per_thread + item;
+        keys[item]           = i < size ? keys_input[i] : padding;
+        if(with_values && i < size)
+        {
+            values[item] = values_input[i];
+        }
+    }
+
+    block_sort_type block_sort(storage.get());
+    single_block_radix_sort_items<Descending>(block_sort, keys, values, begin_bit, end_bit);
+
+    for(unsigned int item = 0; item < single_block_items_per_thread; item++)
+    {
+        const unsigned int i = item * single_block_size + flat_id;
+        if(i < size)
+        {
+            keys_output[i] = keys[item];
+            if(with_values)
+            {
+                values_output[i] = values[item];
+            }
+        }
+    }
+}
+
+/// \p size must not exceed \p single_block_max_items, \p init is combined with the aggregate of
+/// the items and written on its own for an empty input.
+template<class AccT, class InputIteratorT, class OutputIteratorT, class ReduceOpT, class InitT>
+inline hipError_t single_block_reduce(void*           d_temp_storage,
+                                      size_t&         temp_storage_bytes,
+                                      InputIteratorT  input,
+                                      OutputIteratorT output,
+                                      size_t          size,
+                                      ReduceOpT       reduce_op,
+                                      InitT           init,
+                                      hipStream_t     stream)
+{
+    if(d_temp_storage == nullptr)
+    {
+        temp_storage_bytes = single_block_temp_storage_bytes;
+        return hipSuccess;
+    }
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(
+            single_block_reduce_kernel<AccT, InputIteratorT, OutputIteratorT, ReduceOpT, InitT>),
+        dim3(1),
+        dim3(single_block_size),
+        0,
+        stream,
+        input,
+        output,
+        static_cast<unsigned int>(size),
+        reduce_op,
+        init);
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("single_block_reduce_kernel", size, start);
+
+    return hipSuccess;
+}
+
+/// \p size must not exceed \p single_block_max_items, \p init is only used by the exclusive scan.
+template<bool Exclusive, class AccT, class InputIteratorT, class OutputIteratorT, class ScanOpT>
+inline hipError_t single_block_scan(void*           d_temp_storage,
+                                    size_t&         temp_storage_bytes,
+                                    InputIteratorT  input,
+                                    OutputIteratorT output,
+                                    size_t          size,
+                                    ScanOpT         scan_op,
+                                    AccT            init,
+                                    hipStream_t     stream)
+{
+    if(d_temp_storage == nullptr)
+    {
+        temp_storage_bytes = single_block_temp_storage_bytes;
+        return hipSuccess;
+    }
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(
+            single_block_scan_kernel<Exclusive, AccT, InputIteratorT, OutputIteratorT, ScanOpT>),
+        dim3(1),
+        dim3(single_block_size),
+        0,
+        stream,
+        input,
+        output,
+        static_cast<unsigned int>(size),
+        scan_op,
+        init);
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("single_block_scan_kernel", size, start);
+
+    return hipSuccess;
+}
+
+/// \p size must not exceed \p single_block_max_items, the number of selected items is written
+/// even for an empty input.
+template<class InputIteratorT,
+         class OutputIteratorT,
+         class NumSelectedIteratorT,
+         class SelectorT>
+inline hipError_t single_block_select(void*                d_temp_storage,
+                                      size_t&              temp_storage_bytes,
+                                      InputIteratorT       input,
+                                      OutputIteratorT      output,
+                                      NumSelectedIteratorT num_selected_out,
+                                      size_t               size,
+                                      SelectorT            selector,
+                                      hipStream_t          stream)
+{
+    if(d_temp_storage == nullptr)
+    {
+        temp_storage_bytes = single_block_temp_storage_bytes;
+        return hipSuccess;
+    }
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(single_block_select_kernel<InputIteratorT,
+                                                                  OutputIteratorT,
+                                                                  NumSelectedIteratorT,
+                                                                  SelectorT>),
+                       dim3(1),
+                       dim3(single_block_size),
+                       0,
+                       stream,
+                       input,
+                       output,
+                       num_selected_out,
+                       static_cast<unsigned int>(size),
+                       selector);
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("single_block_select_kernel", size, start);
+
+    return hipSuccess;
+}
+
+/// \p size must not exceed \p single_block_max_items and \p KeyT must be
+/// \p single_block_sortable. The overload without values sorts only the keys.
+template<bool Descending, class KeyT, class ValueT>
+inline auto single_block_radix_sort(void*         d_temp_storage,
+                                    size_t&       temp_storage_bytes,
+                                    const KeyT*   keys_input,
+                                    KeyT*         keys_output,
+                                    const ValueT* values_input,
+                                    ValueT*       values_output,
+                                    size_t        size,
+                                    int           begin_bit,
+                                    int           end_bit,
+                                    hipStream_t   stream)
+    -> std::enable_if_t<single_block_sortable<KeyT>::value, hipError_t>
+{
+    if(d_temp_storage == nullptr)
+    {
+        temp_storage_bytes = single_block_temp_storage_bytes;
+        return hipSuccess;
+    }
+    if(size == 0)
+    {
+        return hipSuccess;
+    }
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(single_block_radix_sort_kernel<Descending, KeyT, ValueT>),
+        dim3(1),
+        dim3(single_block_size),
+        0,
+        stream,
+        keys_input,
+        keys_output,
+        values_input,
+        values_output,
+        static_cast<unsigned int>(size),
+        begin_bit,
+        end_bit);
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("single_block_radix_sort_kernel", size, start);
+
+    return hipSuccess;
+}
+
+// Never called, the callers check single_block_sortable first
+template<bool Descending, class KeyT, class ValueT>
+inline auto single_block_radix_sort(void*,
+                                    size_t&,
+                                    const KeyT*,
+                                    KeyT*,
+                                    const ValueT*,
+                                    ValueT*,
+                                    size_t,
+                                    int,
+                                    int,
+                                    hipStream_t)
+    -> std::enable_if_t<!single_block_sortable<KeyT>::value, hipError_t>
+{
+    return hipErrorInvalidValue;
+}
+
+template<bool Descending, class KeyT>
+inline hipError_t single_block_radix_sort(void*       d_temp_storage,
+                                          size_t&     temp_storage_bytes,
+                                          const KeyT* keys_input,
+                                          KeyT*       keys_output,
+                                          size_t      size,
+                                          int         begin_bit,
+                                          int         end_bit,
+                                          hipStream_t stream)
+{
+    return single_block_radix_sort<Descending>(d_temp_storage,
+                                               temp_storage_bytes,
+                                               keys_input,
+                                               keys_output,
+                                               static_cast<const NullType*>(nullptr),
+                                               static_cast<NullType*>(nullptr),
+                                               size,
+                                               begin_bit,
+                                               end_bit,
+                                               stream);
+}
+
+} // namespace detail
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_ROCPRIM_AGENT_AGENT_SINGLE_BLOCK_HPP_
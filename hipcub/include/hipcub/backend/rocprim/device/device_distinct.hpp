@@ -0,0 +1,544 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HIPCUB_ROCPRIM_DEVICE_DEVICE_DISTINCT_HPP_
+#define HIPCUB_ROCPRIM_DEVICE_DEVICE_DISTINCT_HPP_
+
+#include "../../../config.hpp"
+
+#include "../agent/agent_hash_table.hpp"
+#include "../agent/single_pass_scan_operators.hpp"
+#include "../block/block_scan.hpp"
+#include "../thread/thread_operators.hpp"
+#include "../util_sync.hpp"
+#include "../util_temporary_storage.hpp"
+
+#include <rocprim/detail/various.hpp>
+#include <rocprim/intrinsics.hpp>
+#include <rocprim/types.hpp>
+
+#include <chrono>
+#include <iterator>
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace detail
+{
+
+static constexpr unsigned int distinct_block_size       = 256;
+static constexpr unsigned int distinct_items_per_thread = 4;
+static constexpr unsigned int distinct_items_per_tile
+    = distinct_block_size * distinct_items_per_thread;
+/// Slots of the LDS table of a tile, twice the number of items keeps the load factor at 0.5.
+static constexpr unsigned int distinct_local_capacity = 2 * distinct_items_per_tile;
+
+template<class KeyT>
+struct distinct_storage
+{
+    using block_scan_type  = BlockScan<unsigned int, distinct_block_size>;
+    using tile_prefix_type = TilePrefixCallbackOp<unsigned int, Sum, ScanTileState<unsigned int>>;
+
+    KeyT         keys[distinct_items_per_tile];
+    unsigned int slots[distinct_local_capacity];
+    unsigned int counts[distinct_local_capacity];
+    unsigned int tile;
+
+    typename block_scan_type::TempStorage  scan;
+    typename tile_prefix_type::TempStorage prefix;
+};
+
+/// Deduplicates the keys of a tile in an LDS table. Afterwards the slot of every key holds the
+/// position of its first occurrence in the tile and, if \p WithCounts, the number of its
+/// occurrences. Only the first occurrences are inserted into the global table, which makes
+/// low-cardinality inputs almost free of global atomics.
+template<bool WithCounts, class KeysIteratorT, class KeyT>
+HIPCUB_DEVICE HIPCUB_FORCEINLINE void
+    distinct_aggregate_tile(KeysIteratorT           keys,
+                            size_t                  tile_offset,
+                            unsigned int            tile_items,
+                            distinct_storage<KeyT>& storage,
+                            unsigned int (&local_slots)[distinct_items_per_thread],
+                            unsigned int (&hashes)[distinct_items_per_thread])
+{
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+
+    for(unsigned int i = flat_id; i < distinct_local_capacity; i += distinct_block_size)
+    {
+        storage.slots[i] = hash_table_empty_slot;
+        if HIPCUB_IF_CONSTEXPR(WithCounts)
+        {
+            storage.counts[i] = 0;
+        }
+    }
+    for(unsigned int item = 0; item < distinct_items_per_thread; item++)
+    {
+        const unsigned int i = item * distinct_block_size + flat_id;
+        if(i < tile_items)
+        {
+            storage.keys[i] = keys[tile_offset + i];
+        }
+    }
+    ::rocprim::syncthreads();
+
+    for(unsigned int item = 0; item < distinct_items_per_thread; item++)
+    {
+        const unsigned int i = item * distinct_block_size + flat_id;
+        if(i < tile_items)
+        {
+            const KeyT key    = storage.keys[i];
+            hashes[item]      = hash_table_default_hash()(key);
+            local_slots[item] = static_cast<unsigned int>(
+                hash_table_insert(storage.slots,
+                                  distinct_local_capacity,
+                                  storage.keys,
+                                  key,
+                                  i,
+                                  hashes[item],
+                                  hash_table_key_equality(),
+                                  distinct_local_capacity));
+            atomicMin(&storage.slots[local_slots[item]], i);
+            if HIPCUB_IF_CONSTEXPR(WithCounts)
+            {
+                atomicAdd(&storage.counts[local_slots[item]], 1u);
+            }
+        }
+    }
+    ::rocprim::syncthreads();
+}
+
+template<bool WithCounts, class NumDistinctIteratorT>
+__global__ __launch_bounds__(distinct_block_size) void distinct_init_kernel(
+    ScanTileState<unsigned int> tile_state,
+    unsigned int*               tile_counter,
+    unsigned int                num_tiles,
+    NumDistinctIteratorT        num_distinct_out,
+    unsigned int*               table_slots,
+    unsigned int*               table_counts,
+    size_t                      table_capacity)
+{
+    const size_t flat_id = static_cast<size_t>(::rocprim::detail::block_id<0>())
+                               * distinct_block_size
+                           + ::rocprim::detail::block_thread_id<0>();
+    // The table has more slots than there are tiles
+    tile_state.InitializeStatus(num_tiles);
+    if(flat_id == 0)
+    {
+        *tile_counter = 0;
+        if(num_tiles == 0)
+        {
+            *num_distinct_out = 0;
+        }
+    }
+    if(flat_id < table_capacity)
+    {
+        table_slots[flat_id] = hash_table_empty_slot;
+        if HIPCUB_IF_CONSTEXPR(WithCounts)
+        {
+            table_counts[flat_id] = 0;
+        }
+    }
+}
+
+/// Inserts the first occurrence of every key of the tile into the global table, the slot ends up
+/// with the smallest index of the key in the whole input.
+template<bool WithCounts, class KeysIteratorT>
+__global__ __launch_bounds__(distinct_block_size) void distinct_insert_kernel(
+    KeysIteratorT keys,
+    size_t        num_items,
+    unsigned int* table_slots,
+    unsigned int* table_counts,
+    size_t        table_capacity)
+{
+    using key_type     = typename std::iterator_traits<KeysIteratorT>::value_type;
+    using storage_type = distinct_storage<key_type>;
+
+    __shared__ ::rocprim::detail::raw_storage<storage_type> storage_raw;
+    storage_type& storage = storage_raw.get();
+
+    const unsigned int flat_id     = ::rocprim::detail::block_thread_id<0>();
+    const size_t       tile_offset
+        = static_cast<size_t>(::rocprim::detail::block_id<0>()) * distinct_items_per_tile;
+    const unsigned int tile_items = static_cast<unsigned int>(
+        ::rocprim::min<size_t>(distinct_items_per_tile, num_items - tile_offset));
+
+    unsigned int local_slots[distinct_items_per_thread];
+    unsigned int hashes[distinct_items_per_thread];
+    distinct_aggregate_tile<WithCounts>(keys,
+                                        tile_offset,
+                                        tile_items,
+                                        storage,
+                                        local_slots,
+                                        hashes);
+
+    for(unsigned int item = 0; item < distinct_items_per_thread; item++)
+    {
+        const unsigned int i = item * distinct_block_size + flat_id;
+        if(i < tile_items && storage.slots[local_slots[item]] == i)
+        {
+            const unsigned int index = static_cast<unsigned int>(tile_offset + i);
+            const size_t       slot  = hash_table_insert(table_slots,
+                                                  table_capacity,
+                                                  keys,
+                                                  storage.keys[i],
+                                                  index,
+                                                  hashes[item],
+                                                  hash_table_key_equality(),
+                                                  table_capacity);
+            atomicMin(&table_slots[slot], index);
+            if HIPCUB_IF_CONSTEXPR(WithCounts)
+            {
+                atomicAdd(&table_counts[slot], storage.counts[local_slots[item]]);
+            }
+        }
+    }
+}
+
+/// Selects every item which is the first occurrence of its key in the input and compacts the
+/// selected items in input order with a block scan and a decoupled look-back.
+template<bool WithIndices,
+         bool WithCounts,
+         class KeysIteratorT,
+         class KeysOutputIteratorT,
+         class IndicesOutputIteratorT,
+         class CountsOutputIteratorT,
+         class NumDistinctIteratorT>
+__global__ __launch_bounds__(distinct_block_size) void distinct_select_kernel(
+    KeysIteratorT               keys,
+    size_t                      num_items,
+    const unsigned int*         table_slots,
+    const unsigned int*         table_counts,
+    size_t                      table_capacity,
+    KeysOutputIteratorT         keys_out,
+    IndicesOutputIteratorT      first_indices_out,
+    CountsOutputIteratorT       counts_out,
+    NumDistinctIteratorT        num_distinct_out,
+    ScanTileState<unsigned int> tile_state,
+    unsigned int*               tile_counter,
+    unsigned int                num_tiles)
+{
+    using key_type         = typename std::iterator_traits<KeysIteratorT>::value_type;
+    using storage_type     = distinct_storage<key_type>;
+    using block_scan_type  = typename storage_type::block_scan_type;
+    using tile_prefix_type = typename storage_type::tile_prefix_type;
+
+    __shared__ ::rocprim::detail::raw_storage<storage_type> storage_raw;
+    storage_type& storage = storage_raw.get();
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    if(flat_id == 0)
+    {
+        storage.tile = atomicAdd(tile_counter, 1u);
+    }
+    ::rocprim::syncthreads();
+
+    const unsigned int tile        = storage.tile;
+    const size_t       tile_offset = static_cast<size_t>(tile) * distinct_items_per_tile;
+    const unsigned int tile_items  = static_cast<unsigned int>(
+        ::rocprim::min<size_t>(distinct_items_per_tile, num_items - tile_offset));
+
+    // Same tiles as the insertion, so only the first occurrences in the tile can be selected
+    unsigned int local_slots[distinct_items_per_thread];
+    unsigned int hashes[distinct_items_per_thread];
+    distinct_aggregate_tile<false>(keys, tile_offset, tile_items, storage, local_slots, hashes);
+
+    bool         selected[distinct_items_per_thread];
+    size_t       slots[distinct_items_per_thread];
+    unsigned int selected_count = 0;
+    for(unsigned int item = 0; item < distinct_items_per_thread; item++)
+    {
+        const unsigned int i = item * distinct_block_size + flat_id;
+        selected[item]       = false;
+        if(i < tile_items && storage.slots[local_slots[item]] == i)
+        {
+            slots[item]    = hash_table_find(table_slots,
+                                          table_capacity,
+                                          keys,
+                                          storage.keys[i],
+                                          hashes[item],
+                                          hash_table_key_equality(),
+                                          table_capacity);
+            // Only selected items read table_counts, so the range check guards both reads
+            selected[item] = slots[item] < table_capacity
+                             && table_slots[slots[item]] == tile_offset + i;
+            selected_count += selected[item] ? 1 : 0;
+        }
+    }
+
+    unsigned int output_offset;
+    if(tile == 0)
+    {
+        unsigned int tile_selected;
+        block_scan_type(storage.scan).ExclusiveSum(selected_count, output_offset, tile_selected);
+        if(flat_id == 0)
+        {
+            tile_state.SetInclusive(0, tile_selected);
+            if(num_tiles == 1)
+            {
+                *num_distinct_out = tile_selected;
+            }
+        }
+    }
+    else
+    {
+        tile_prefix_type prefix_op(tile_state, storage.prefix, Sum(), tile);
+        block_scan_type(storage.scan).ExclusiveSum(selected_count, output_offset, prefix_op);
+        if(flat_id == 0 && tile == num_tiles - 1)
+        {
+            *num_distinct_out = prefix_op.GetInclusivePrefix();
+        }
+    }
+
+    for(unsigned int item = 0; item < distinct_items_per_thread; item++)
+    {
+        if(selected[item])
+        {
+            const unsigned int i    = item * distinct_block_size + flat_id;
+            keys_out[output_offset] = storage.keys[i];
+            if HIPCUB_IF_CONSTEXPR(WithIndices)
+            {
+                first_indices_out[output_offset] = static_cast<unsigned int>(tile_offset + i);
+            }
+            if HIPCUB_IF_CONSTEXPR(WithCounts)
+            {
+                counts_out[output_offset] = table_counts[slots[item]];
+            }
+            output_offset++;
+        }
+    }
+}
+
+template<bool WithIndices,
+         bool WithCounts,
+         class KeysIteratorT,
+         class KeysOutputIteratorT,
+         class IndicesOutputIteratorT,
+         class CountsOutputIteratorT,
+         class NumDistinctIteratorT>
+inline hipError_t distinct(void*                  d_temp_storage,
+                           size_t&                temp_storage_bytes,
+                           KeysIteratorT          keys,
+                           KeysOutputIteratorT    keys_out,
+                           IndicesOutputIteratorT first_indices_out,
+                           CountsOutputIteratorT  counts_out,
+                           NumDistinctIteratorT   num_distinct_out,
+                           int                    num_items,
+                           hipStream_t            stream)
+{
+    const size_t       size      = num_items > 0 ? static_cast<size_t>(num_items) : 0;
+    const unsigned int num_tiles = static_cast<unsigned int>(
+        (size + distinct_items_per_tile - 1) / distinct_items_per_tile);
+    const size_t table_capacity = hash_table_capacity(size);
+
+    size_t     tile_state_bytes = 0;
+    hipError_t error
+        = ScanTileState<unsigned int>::AllocationSize(::rocprim::max(num_tiles, 1u),
+                                                      tile_state_bytes);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    void*  allocations[4]      = {};
+    size_t allocation_sizes[4] = {tile_state_bytes,
+                                  sizeof(unsigned int),
+                                  table_capacity * sizeof(unsigned int),
+                                  WithCounts ? table_capacity * sizeof(unsigned int) : 0};
+    error = AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes);
+    if(error != hipSuccess || d_temp_storage == nullptr)
+    {
+        return error;
+    }
+
+    ScanTileState<unsigned int> tile_state;
+    error = tile_state.Init(::rocprim::max(num_tiles, 1u), allocations[0], tile_state_bytes);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    unsigned int* tile_counter = static_cast<unsigned int*>(allocations[1]);
+    unsigned int* table_slots  = static_cast<unsigned int*>(allocations[2]);
+    unsigned int* table_counts = static_cast<unsigned int*>(allocations[3]);
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(distinct_init_kernel<WithCounts>),
+                       dim3((table_capacity + distinct_block_size - 1) / distinct_block_size),
+                       dim3(distinct_block_size),
+                       0,
+                       stream,
+                       tile_state,
+                       tile_counter,
+                       num_tiles,
+                       num_distinct_out,
+                       table_slots,
+                       table_counts,
+                       table_capacity);
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("distinct_init_kernel", table_capacity, start);
+
+    if(num_tiles == 0)
+    {
+        return hipSuccess;
+    }
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(distinct_insert_kernel<WithCounts>),
+                       dim3(num_tiles),
+                       dim3(distinct_block_size),
+                       0,
+                       stream,
+                       keys,
+                       size,
+                       table_slots,
+                       table_counts,
+                       table_capacity);
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("distinct_insert_kernel", size, start);
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(distinct_select_kernel<WithIndices, WithCounts>),
+                       dim3(num_tiles),
+                       dim3(distinct_block_size),
+                       0,
+                       stream,
+                       keys,
+                       size,
+                       table_slots,
+                       table_counts,
+                       table_capacity,
+                       keys_out,
+                       first_indices_out,
+                       counts_out,
+                       num_distinct_out,
+                       tile_state,
+                       tile_counter,
+                       num_tiles);
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("distinct_select_kernel", size, start);
+
+    return hipSuccess;
+}
+
+} // namespace detail
+
+/// \brief Removes all duplicate keys of an unsorted sequence, not only consecutive ones as
+/// \p DeviceSelect::Unique does, without sorting it first.
+///
+/// The keys are inserted into an open-addressing hash table in global memory with twice as many
+/// slots as there are items, after they are deduplicated per tile in an LDS table. A second pass
+/// selects the first occurrence of every key, so the distinct keys are written in the order of
+/// their first occurrence and the output is deterministic. Keys are compared with \p ==
+/// and hashed by their object representation, with -0.0 and 0.0 hashing equally. Keys which
+/// are not equal to themselves, like NaN, are all treated as one key.
+struct DeviceDistinct
+{
+    /// \brief Writes every distinct key of \p d_keys_in once to \p d_keys_out and their number
+    /// to \p d_num_distinct_out.
+    template<typename KeysInputIteratorT,
+             typename KeysOutputIteratorT,
+             typename NumDistinctIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t Distinct(void*                d_temp_storage,
+                                                       size_t&              temp_storage_bytes,
+                                                       KeysInputIteratorT   d_keys_in,
+                                                       KeysOutputIteratorT  d_keys_out,
+                                                       NumDistinctIteratorT d_num_distinct_out,
+                                                       int                  num_items,
+                                                       hipStream_t          stream = 0)
+    {
+        return detail::distinct<false, false>(d_temp_storage,
+                                              temp_storage_bytes,
+                                              d_keys_in,
+                                              d_keys_out,
+                                              static_cast<::rocprim::empty_type*>(nullptr),
+                                              static_cast<::rocprim::empty_type*>(nullptr),
+                                              d_num_distinct_out,
+                                              num_items,
+                                              stream);
+    }
+
+    /// \brief Same as \p Distinct, additionally writes to \p d_first_indices_out the index of
+    /// the first occurrence of every distinct key.
+    template<typename KeysInputIteratorT,
+             typename KeysOutputIteratorT,
+             typename IndicesOutputIteratorT,
+             typename NumDistinctIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        DistinctWithIndices(void*                  d_temp_storage,
+                            size_t&                temp_storage_bytes,
+                            KeysInputIteratorT     d_keys_in,
+                            KeysOutputIteratorT    d_keys_out,
+                            IndicesOutputIteratorT d_first_indices_out,
+                            NumDistinctIteratorT   d_num_distinct_out,
+                            int                    num_items,
+                            hipStream_t            stream = 0)
+    {
+        return detail::distinct<true, false>(d_temp_storage,
+                                             temp_storage_bytes,
+                                             d_keys_in,
+                                             d_keys_out,
+                                             d_first_indices_out,
+                                             static_cast<::rocprim::empty_type*>(nullptr),
+                                             d_num_distinct_out,
+                                             num_items,
+                                             stream);
+    }
+
+    /// \brief Same as \p DistinctWithIndices, additionally writes to \p d_counts_out the number
+    /// of occurrences of every distinct key.
+    template<typename KeysInputIteratorT,
+             typename KeysOutputIteratorT,
+             typename IndicesOutputIteratorT,
+             typename CountsOutputIteratorT,
+             typename NumDistinctIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t
+        DistinctWithCounts(void*                  d_temp_storage,
+                           size_t&                temp_storage_bytes,
+                           KeysInputIteratorT     d_keys_in,
+                           KeysOutputIteratorT    d_keys_out,
+                           IndicesOutputIteratorT d_first_indices_out,
+                           CountsOutputIteratorT  d_counts_out,
+                           NumDistinctIteratorT   d_num_distinct_out,
+                           int                    num_items,
+                           hipStream_t            stream = 0)
+    {
+        return detail::distinct<true, true>(d_temp_storage,
+                                            temp_storage_bytes,
+                                            d_keys_in,
+                                            d_keys_out,
+                                            d_first_indices_out,
+                                            d_counts_out,
+                                            d_num_distinct_out,
+                                            num_items,
+                                            stream);
+    }
+};
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_ROCPRIM_DEVICE_DEVICE_DISTINCT_HPP_
@@ -0,0 +1,683 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HIPCUB_ROCPRIM_DEVICE_DEVICE_FIND_HPP_
+#define HIPCUB_ROCPRIM_DEVICE_DEVICE_FIND_HPP_
+
+#include "../../../config.hpp"
+
+#include "../util_sync.hpp"
+#include "../util_temporary_storage.hpp"
+
+#include <rocprim/detail/various.hpp>
+#include <rocprim/device/device_merge_sort.hpp>
+#include <rocprim/intrinsics.hpp>
+#include <rocprim/iterator/counting_iterator.hpp>
+
+#include <chrono>
+#include <iterator>
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace detail
+{
+
+static constexpr unsigned int find_bounds_block_size       = 256;
+static constexpr unsigned int find_bounds_items_per_thread = 4;
+static constexpr unsigned int find_bounds_items_per_tile
+    = find_bounds_block_size * find_bounds_items_per_thread;
+/// Size of the LDS cache of the haystack slice searched by a tile of needles.
+static constexpr unsigned int find_bounds_window_bytes = 16384;
+
+/// Returns true if the bound of \p needle lies after \p item.
+template<bool Upper, class T, class NeedleT, class CompareOpT>
+HIPCUB_DEVICE HIPCUB_FORCEINLINE bool
+    find_bound_after(const T& item, const NeedleT& needle, CompareOpT compare_op)
+{
+    return Upper ? !compare_op(needle, item) : compare_op(item, needle);
+}
+
+/// Branchless binary search: the number of iterations only depends on \p size and the comparison
+/// result only selects the step, so the threads of a wavefront searching the same range never
+/// diverge.
+template<bool Upper, class RandomAccessIteratorT, class NeedleT, class CompareOpT>
+HIPCUB_DEVICE HIPCUB_FORCEINLINE size_t find_bound_branchless(RandomAccessIteratorT first,
+                                                              size_t                size,
+                                                              const NeedleT&        needle,
+                                                              CompareOpT            compare_op)
+{
+    if(size == 0)
+    {
+        return 0;
+    }
+    size_t base = 0;
+    while(size > 1)
+    {
+        const size_t half = size / 2;
+        base += find_bound_after<Upper>(first[base + half], needle, compare_op) ? half : 0;
+        size -= half;
+    }
+    return base + (find_bound_after<Upper>(first[base], needle, compare_op) ? 1 : 0);
+}
+
+template<class HaystackT>
+struct find_bounds_storage
+{
+    static constexpr unsigned int window_capacity
+        = find_bounds_window_bytes / sizeof(HaystackT) > 0
+              ? find_bounds_window_bytes / sizeof(HaystackT)
+              : 1;
+
+    HaystackT window[window_capacity];
+    size_t    window_bounds[2];
+};
+
+template<bool Upper,
+         class WindowIteratorT,
+         class NeedleT,
+         class IndexT,
+         class OutputIteratorT,
+         class OffsetT,
+         class CompareOpT>
+HIPCUB_DEVICE HIPCUB_FORCEINLINE void find_bounds_tile(WindowIteratorT window,
+                                                       size_t          window_begin,
+                                                       size_t          window_size,
+                                                       const NeedleT*  tile_needles,
+                                                       const IndexT*   tile_indices,
+                                                       size_t          tile_size,
+                                                       OutputIteratorT output,
+                                                       CompareOpT      compare_op)
+{
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    for(unsigned int item = 0; item < find_bounds_items_per_thread; item++)
+    {
+        const size_t i = item * find_bounds_block_size + flat_id;
+        if(i < tile_size)
+        {
+            const size_t bound
+                = find_bound_branchless<Upper>(window, window_size, tile_needles[i], compare_op);
+            output[tile_indices[i]] = static_cast<OffsetT>(window_begin + bound);
+        }
+    }
+}
+
+/// Every block searches a contiguous range of the sorted needles. The bounds of all of them lie
+/// between the bounds of the first and the last needle of the tile, so only that slice of the
+/// haystack is searched and, if it fits, it is cached in LDS first.
+template<bool Upper,
+         class HaystackIteratorT,
+         class NeedleT,
+         class IndexT,
+         class OutputIteratorT,
+         class OffsetT,
+         class CompareOpT>
+__global__ __launch_bounds__(find_bounds_block_size) void find_bounds_kernel(
+    HaystackIteratorT haystack,
+    size_t            haystack_size,
+    const NeedleT*    sorted_needles,
+    const IndexT*     needle_indices,
+    size_t            num_needles,
+    OutputIteratorT   output,
+    CompareOpT        compare_op)
+{
+    using haystack_type = typename std::iterator_traits<HaystackIteratorT>::value_type;
+    using storage_type  = find_bounds_storage<haystack_type>;
+
+    __shared__ ::rocprim::detail::raw_storage<storage_type> storage_raw;
+    storage_type& storage = storage_raw.get();
+
+    const unsigned int flat_id     = ::rocprim::detail::block_thread_id<0>();
+    const size_t       tile_offset
+        = static_cast<size_t>(::rocprim::detail::block_id<0>()) * find_bounds_items_per_tile;
+    const size_t tile_size
+        = ::rocprim::min<size_t>(find_bounds_items_per_tile, num_needles - tile_offset);
+
+    if(flat_id < 2)
+    {
+        const NeedleT& needle = sorted_needles[tile_offset + flat_id * (tile_size - 1)];
+        storage.window_bounds[flat_id]
+            = find_bound_branchless<Upper>(haystack, haystack_size, needle, compare_op);
+    }
+    ::rocprim::syncthreads();
+
+    const size_t window_begin = storage.window_bounds[0];
+    const size_t window_size  = storage.window_bounds[1] - window_begin;
+
+    if(window_size <= storage_type::window_capacity)
+    {
+        for(size_t i = flat_id; i < window_size; i += find_bounds_block_size)
+        {
+            storage.window[i] = haystack[window_begin + i];
+        }
+        ::rocprim::syncthreads();
+
+        find_bounds_tile<Upper, haystack_type*, NeedleT, IndexT, OutputIteratorT, OffsetT>(
+            storage.window,
+            window_begin,
+            window_size,
+            sorted_needles + tile_offset,
+            needle_indices + tile_offset,
+            tile_size,
+            output,
+            compare_op);
+    }
+    else
+    {
+        // Sparse needles, the slice is still narrower than the whole haystack
+        find_bounds_tile<Upper, HaystackIteratorT, NeedleT, IndexT, OutputIteratorT, OffsetT>(
+            haystack + window_begin,
+            window_begin,
+            window_size,
+            sorted_needles + tile_offset,
+            needle_indices + tile_offset,
+            tile_size,
+            output,
+            compare_op);
+    }
+}
+
+template<bool Upper,
+         class HaystackIteratorT,
+         class NeedlesIteratorT,
+         class OutputIteratorT,
+         class OffsetT,
+         class IndexT,
+         class CompareOpT>
+inline hipError_t find_bounds(void*             d_temp_storage,
+                              size_t&           temp_storage_bytes,
+                              HaystackIteratorT haystack,
+                              OffsetT           haystack_size,
+                              NeedlesIteratorT  needles,
+                              IndexT            num_needles,
+                              OutputIteratorT   output,
+                              CompareOpT        compare_op,
+                              hipStream_t       stream)
+{
+    using needle_type = typename std::iterator_traits<NeedlesIteratorT>::value_type;
+
+    const size_t size           = num_needles > 0 ? static_cast<size_t>(num_needles) : 0;
+    const size_t haystack_items = haystack_size > 0 ? static_cast<size_t>(haystack_size) : 0;
+
+    const ::rocprim::counting_iterator<IndexT> indices(0);
+
+    size_t     sort_bytes = 0;
+    hipError_t error      = ::rocprim::merge_sort(nullptr,
+                                             sort_bytes,
+                                             needles,
+                                             static_cast<needle_type*>(nullptr),
+                                             indices,
+                                             static_cast<IndexT*>(nullptr),
+                                             size,
+                                             compare_op,
+                                             stream,
+                                             HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    void*  allocations[3] = {};
+    size_t allocation_sizes[3]
+        = {sort_bytes, size * sizeof(needle_type), size * sizeof(IndexT)};
+    error = AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes);
+    if(error != hipSuccess || d_temp_storage == nullptr || size == 0)
+    {
+        return error;
+    }
+
+    needle_type* sorted_needles = static_cast<needle_type*>(allocations[1]);
+    IndexT*      needle_indices = static_cast<IndexT*>(allocations[2]);
+
+    error = ::rocprim::merge_sort(allocations[0],
+                                  sort_bytes,
+                                  needles,
+                                  sorted_needles,
+                                  indices,
+                                  needle_indices,
+                                  size,
+                                  compare_op,
+                                  stream,
+                                  HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    const size_t tiles = (size + find_bounds_items_per_tile - 1) / find_bounds_items_per_tile;
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(find_bounds_kernel<Upper,
+                                           HaystackIteratorT,
+                                           needle_type,
+                                           IndexT,
+                                           OutputIteratorT,
+                                           OffsetT,
+                                           CompareOpT>),
+        dim3(tiles),
+        dim3(find_bounds_block_size),
+        0,
+        stream,
+        haystack,
+        haystack_items,
+        sorted_needles,
+        needle_indices,
+        size,
+        output,
+        compare_op);
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("find_bounds_kernel", size, start);
+
+    return hipSuccess;
+}
+
+static constexpr unsigned int find_if_block_size       = 256;
+static constexpr unsigned int find_if_items_per_thread = 16;
+static constexpr unsigned int find_if_items_per_tile
+    = find_if_block_size * find_if_items_per_thread;
+static constexpr unsigned int find_if_blocks_per_cu = 4;
+
+/// Global state of a predicate search, the smallest matching index found so far and the
+/// counter handing out tiles in increasing order.
+struct find_if_state
+{
+    unsigned long long first_match;
+    unsigned long long tile_counter;
+};
+
+template<class PredicateT>
+struct find_if_negate_op
+{
+    PredicateT predicate;
+
+    template<class T>
+    HIPCUB_HOST_DEVICE HIPCUB_FORCEINLINE bool operator()(const T& item) const
+    {
+        return !predicate(item);
+    }
+};
+
+/// Writes the index of the first match, or \p num_items if there is none.
+template<class OffsetT>
+struct find_if_index_op
+{
+    HIPCUB_DEVICE HIPCUB_FORCEINLINE OffsetT operator()(unsigned long long first_match,
+                                                        unsigned long long /*num_items*/) const
+    {
+        return static_cast<OffsetT>(first_match);
+    }
+};
+
+/// Writes whether there is a match, negated for \p DeviceFind::AllOf and \p NoneOf.
+template<bool Found>
+struct find_if_found_op
+{
+    HIPCUB_DEVICE HIPCUB_FORCEINLINE bool operator()(unsigned long long first_match,
+                                                     unsigned long long num_items) const
+    {
+        return (first_match < num_items) == Found;
+    }
+};
+
+static __global__ __launch_bounds__(1) void find_if_init_kernel(find_if_state*     state,
+                                                                unsigned long long num_items)
+{
+    state->first_match  = num_items;
+    state->tile_counter = 0;
+}
+
+/// Persistent blocks take tiles in increasing order. A tile is only skipped when a match before
+/// its first item is already published, so the smallest published index is the first match.
+template<class InputIteratorT, class PredicateT>
+__global__ __launch_bounds__(find_if_block_size) void find_if_kernel(InputIteratorT     input,
+                                                                     unsigned long long num_items,
+                                                                     find_if_state*     state,
+                                                                     PredicateT         predicate)
+{
+    constexpr unsigned int block_size       = find_if_block_size;
+    constexpr unsigned int items_per_thread = find_if_items_per_thread;
+    constexpr unsigned int items_per_tile   = find_if_items_per_tile;
+
+    __shared__ unsigned long long tile_offset;
+    __shared__ unsigned long long block_match;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+
+    while(true)
+    {
+        if(flat_id == 0)
+        {
+            // A stale value of the published match only costs loading a tile which is not needed
+            const unsigned long long first_match
+                = *static_cast<volatile unsigned long long*>(&state->first_match);
+            tile_offset = atomicAdd(&state->tile_counter, 1ull) * items_per_tile;
+            block_match = num_items;
+            if(tile_offset >= first_match)
+            {
+                tile_offset = num_items;
+            }
+        }
+        ::rocprim::syncthreads();
+
+        const unsigned long long offset = tile_offset;
+        if(offset >= num_items)
+        {
+            return;
+        }
+
+        unsigned long long thread_match = num_items;
+        for(unsigned int item = 0; item < items_per_thread; item++)
+        {
+            const unsigned long long i = offset + item * block_size + flat_id;
+            if(i < num_items && i < thread_match && predicate(input[i]))
+            {
+                thread_match = i;
+            }
+        }
+        if(thread_match < num_items)
+        {
+            atomicMin(&block_match, thread_match);
+        }
+        ::rocprim::syncthreads();
+
+        const unsigned long long match = block_match;
+        if(match < num_items)
+        {
+            if(flat_id == 0)
+            {
+                atomicMin(&state->first_match, match);
+            }
+            // Every tile this block could take later comes after the match
+            return;
+        }
+        ::rocprim::syncthreads();
+    }
+}
+
+template<class OutputIteratorT, class OutputOpT>
+__global__ __launch_bounds__(1) void find_if_output_kernel(const find_if_state* state,
+                                                           unsigned long long   num_items,
+                                                           OutputIteratorT      output,
+                                                           OutputOpT            output_op)
+{
+    *output = output_op(state->first_match, num_items);
+}
+
+template<class InputIteratorT, class OutputIteratorT, class PredicateT, class OutputOpT>
+inline hipError_t find_if(void*           d_temp_storage,
+                          size_t&         temp_storage_bytes,
+                          InputIteratorT  input,
+                          OutputIteratorT output,
+                          PredicateT      predicate,
+                          size_t          num_items,
+                          OutputOpT       output_op,
+                          hipStream_t     stream)
+{
+    if(d_temp_storage == nullptr)
+    {
+        temp_storage_bytes = sizeof(find_if_state);
+        return hipSuccess;
+    }
+
+    int        device_id;
+    hipError_t error = hipGetDevice(&device_id);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    int compute_units;
+    error = hipDeviceGetAttribute(&compute_units,
+                                  hipDeviceAttributeMultiprocessorCount,
+                                  device_id);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    find_if_state* state = static_cast<find_if_state*>(d_temp_storage);
+    const size_t   tiles = (num_items + find_if_items_per_tile - 1) / find_if_items_per_tile;
+    const size_t   grid_size
+        = ::rocprim::min<size_t>(tiles, compute_units * find_if_blocks_per_cu);
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(find_if_init_kernel, dim3(1), dim3(1), 0, stream, state, num_items);
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("find_if_init_kernel", 1, start);
+
+    if(grid_size > 0)
+    {
+        if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+        {
+            start = std::chrono::high_resolution_clock::now();
+        }
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(find_if_kernel),
+                           dim3(grid_size),
+                           dim3(find_if_block_size),
+                           0,
+                           stream,
+                           input,
+                           num_items,
+                           state,
+                           predicate);
+        HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("find_if_kernel", num_items, start);
+    }
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(find_if_output_kernel),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       stream,
+                       state,
+                       num_items,
+                       output,
+                       output_op);
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("find_if_output_kernel", 1, start);
+
+    return hipSuccess;
+}
+
+} // namespace detail
+
+/// \brief Batched binary search of many needles in a sorted haystack and early-exit searches
+/// for the first item matching a predicate.
+///
+/// The needles are sorted together with their positions first, so every block searches a
+/// contiguous range of needles in the slice of the haystack they fall into. The slice is cached
+/// in LDS when it fits and searched with a branchless binary search. The results are written
+/// in the original order of the needles, which don't have to be sorted.
+///
+/// For \p LowerBound and \p UpperBound, \p compare_op must order the haystack and be callable
+/// with any combination of a haystack item and a needle.
+struct DeviceFind
+{
+    /// \brief Writes for every needle the index of the first item of \p d_haystack which is not
+    /// ordered before it, or \p haystack_size if there is none.
+    template<typename HaystackIteratorT,
+             typename HaystackNumItemsT,
+             typename NeedlesIteratorT,
+             typename NeedlesNumItemsT,
+             typename OutputIteratorT,
+             typename CompareOpT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t LowerBound(void*             d_temp_storage,
+                                                         size_t&           temp_storage_bytes,
+                                                         HaystackIteratorT d_haystack,
+                                                         HaystackNumItemsT haystack_size,
+                                                         NeedlesIteratorT  d_needles,
+                                                         NeedlesNumItemsT  num_needles,
+                                                         OutputIteratorT   d_output,
+                                                         CompareOpT        compare_op,
+                                                         hipStream_t       stream = 0)
+    {
+        return detail::find_bounds<false>(d_temp_storage,
+                                          temp_storage_bytes,
+                                          d_haystack,
+                                          haystack_size,
+                                          d_needles,
+                                          num_needles,
+                                          d_output,
+                                          compare_op,
+                                          stream);
+    }
+
+    /// \brief Writes for every needle the index of the first item of \p d_haystack which is
+    /// ordered after it, or \p haystack_size if there is none.
+    template<typename HaystackIteratorT,
+             typename HaystackNumItemsT,
+             typename NeedlesIteratorT,
+             typename NeedlesNumItemsT,
+             typename OutputIteratorT,
+             typename CompareOpT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t UpperBound(void*             d_temp_storage,
+                                                         size_t&           temp_storage_bytes,
+                                                         HaystackIteratorT d_haystack,
+                                                         HaystackNumItemsT haystack_size,
+                                                         NeedlesIteratorT  d_needles,
+                                                         NeedlesNumItemsT  num_needles,
+                                                         OutputIteratorT   d_output,
+                                                         CompareOpT        compare_op,
+                                                         hipStream_t       stream = 0)
+    {
+        return detail::find_bounds<true>(d_temp_storage,
+                                         temp_storage_bytes,
+                                         d_haystack,
+                                         haystack_size,
+                                         d_needles,
+                                         num_needles,
+                                         d_output,
+                                         compare_op,
+                                         stream);
+    }
+
+    /// \brief Writes to \p d_out the index of the first item of \p d_in for which \p predicate
+    /// returns true, or \p num_items if there is none.
+    ///
+    /// Tiles are processed in increasing order and the index of a match is published as soon as
+    /// it is found, blocks stop loading the tiles after it. The input is read only up to the
+    /// first match, rounded up to whole tiles in flight.
+    template<typename InputIteratorT,
+             typename OutputIteratorT,
+             typename PredicateT,
+             typename NumItemsT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t FindIf(void*           d_temp_storage,
+                                                     size_t&         temp_storage_bytes,
+                                                     InputIteratorT  d_in,
+                                                     OutputIteratorT d_out,
+                                                     PredicateT      predicate,
+                                                     NumItemsT       num_items,
+                                                     hipStream_t     stream = 0)
+    {
+        return detail::find_if(d_temp_storage,
+                               temp_storage_bytes,
+                               d_in,
+                               d_out,
+                               predicate,
+                               num_items > 0 ? static_cast<size_t>(num_items) : 0,
+                               detail::find_if_index_op<NumItemsT>(),
+                               stream);
+    }
+
+    /// \brief Writes to \p d_out whether \p predicate returns true for any item of \p d_in.
+    template<typename InputIteratorT,
+             typename OutputIteratorT,
+             typename PredicateT,
+             typename NumItemsT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t AnyOf(void*           d_temp_storage,
+                                                    size_t&         temp_storage_bytes,
+                                                    InputIteratorT  d_in,
+                                                    OutputIteratorT d_out,
+                                                    PredicateT      predicate,
+                                                    NumItemsT       num_items,
+                                                    hipStream_t     stream = 0)
+    {
+        return detail::find_if(d_temp_storage,
+                               temp_storage_bytes,
+                               d_in,
+                               d_out,
+                               predicate,
+                               num_items > 0 ? static_cast<size_t>(num_items) : 0,
+                               detail::find_if_found_op<true>(),
+                               stream);
+    }
+
+    /// \brief Writes to \p d_out whether \p predicate returns true for all items of \p d_in,
+    /// true for an empty input.
+    template<typename InputIteratorT,
+             typename OutputIteratorT,
+             typename PredicateT,
+             typename NumItemsT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t AllOf(void*           d_temp_storage,
+                                                    size_t&         temp_storage_bytes,
+                                                    InputIteratorT  d_in,
+                                                    OutputIteratorT d_out,
+                                                    PredicateT      predicate,
+                                                    NumItemsT       num_items,
+                                                    hipStream_t     stream = 0)
+    {
+        return detail::find_if(d_temp_storage,
+                               temp_storage_bytes,
+                               d_in,
+                               d_out,
+                               detail::find_if_negate_op<PredicateT>{predicate},
+                               num_items > 0 ? static_cast<size_t>(num_items) : 0,
+                               detail::find_if_found_op<false>(),
+                               stream);
+    }
+
+    /// \brief Writes to \p d_out whether \p predicate returns false for all items of \p d_in.
+    template<typename InputIteratorT,
+             typename OutputIteratorT,
+             typename PredicateT,
+             typename NumItemsT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t NoneOf(void*           d_temp_storage,
+                                                     size_t&         temp_storage_bytes,
+                                                     InputIteratorT  d_in,
+                                                     OutputIteratorT d_out,
+                                                     PredicateT      predicate,
+                                                     NumItemsT       num_items,
+                                                     hipStream_t     stream = 0)
+    {
+        return detail::find_if(d_temp_storage,
+                               temp_storage_bytes,
+                               d_in,
+                               d_out,
+                               predicate,
+                               num_items > 0 ? static_cast<size_t>(num_items) : 0,
+                               detail::find_if_found_op<false>(),
+                               stream);
+    }
+};
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_ROCPRIM_DEVICE_DEVICE_FIND_HPP_
@@ -0,0 +1,108 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HIPCUB_ROCPRIM_DEVICE_DEVICE_MERGE_HPP_
+#define HIPCUB_ROCPRIM_DEVICE_DEVICE_MERGE_HPP_
+
+#include "../../../config.hpp"
+
+#include "../util_sync.hpp"
+
+#include <rocprim/device/device_merge.hpp>
+
+BEGIN_HIPCUB_NAMESPACE
+
+/// \brief Merges two sequences which are already sorted by the same comparator.
+///
+/// The sequences are partitioned with merge path so the merge is a single linear pass instead of
+/// sorting the concatenation again. Equal keys of the first sequence precede the ones of the
+/// second sequence.
+struct DeviceMerge
+{
+    /// \brief Merges the keys \p d_keys_in1 and \p d_keys_in2 into \p d_keys_out, which must hold
+    /// <tt>num_keys1 + num_keys2</tt> items.
+    template<typename KeyIteratorIn1T,
+             typename KeyIteratorIn2T,
+             typename KeyIteratorOutT,
+             typename CompareOpT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t MergeKeys(void*           d_temp_storage,
+                                                        size_t&         temp_storage_bytes,
+                                                        KeyIteratorIn1T d_keys_in1,
+                                                        int             num_keys1,
+                                                        KeyIteratorIn2T d_keys_in2,
+                                                        int             num_keys2,
+                                                        KeyIteratorOutT d_keys_out,
+                                                        CompareOpT      compare_op,
+                                                        hipStream_t     stream = 0)
+    {
+        return ::rocprim::merge(d_temp_storage,
+                                temp_storage_bytes,
+                                d_keys_in1,
+                                d_keys_in2,
+                                d_keys_out,
+                                static_cast<size_t>(num_keys1 > 0 ? num_keys1 : 0),
+                                static_cast<size_t>(num_keys2 > 0 ? num_keys2 : 0),
+                                compare_op,
+                                stream,
+                                HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+    }
+
+    /// \brief Merges the key-value pairs of both sequences by key.
+    template<typename KeyIteratorIn1T,
+             typename ValueIteratorIn1T,
+             typename KeyIteratorIn2T,
+             typename ValueIteratorIn2T,
+             typename KeyIteratorOutT,
+             typename ValueIteratorOutT,
+             typename CompareOpT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t MergePairs(void*             d_temp_storage,
+                                                         size_t&           temp_storage_bytes,
+                                                         KeyIteratorIn1T   d_keys_in1,
+                                                         ValueIteratorIn1T d_values_in1,
+                                                         int               num_keys1,
+                                                         KeyIteratorIn2T   d_keys_in2,
+                                                         ValueIteratorIn2T d_values_in2,
+                                                         int               num_keys2,
+                                                         KeyIteratorOutT   d_keys_out,
+                                                         ValueIteratorOutT d_values_out,
+                                                         CompareOpT        compare_op,
+                                                         hipStream_t       stream = 0)
+    {
+        return ::rocprim::merge(d_temp_storage,
+                                temp_storage_bytes,
+                                d_keys_in1,
+                                d_keys_in2,
+                                d_keys_out,
+                                d_values_in1,
+                                d_values_in2,
+                                d_values_out,
+                                static_cast<size_t>(num_keys1 > 0 ? num_keys1 : 0),
+                                static_cast<size_t>(num_keys2 > 0 ? num_keys2 : 0),
+                                compare_op,
+                                stream,
+                                HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+    }
+};
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_ROCPRIM_DEVICE_DEVICE_MERGE_HPP_
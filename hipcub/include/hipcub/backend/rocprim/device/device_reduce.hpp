@@ -33,7 +33,10 @@
 #include "../../../config.hpp"
 
 #include "../../../util_deprecated.hpp"
+#include "../agent/agent_reproducible_scan.hpp"
+#include "../agent/agent_single_block.hpp"
 #include "../iterator/arg_index_input_iterator.hpp"
+#include "../thread/thread_accumulators.hpp"
 #include "../thread/thread_operators.hpp"
 
 #include <rocprim/device/device_reduce.hpp>
@@ -43,8 +46,10 @@
 #include <hip/hip_bfloat16.h> // hip_bfloat16
 #include <hip/hip_fp16.h> // __half
 
+#include <algorithm>
 #include <iterator>
 #include <limits>
+#include <type_traits>
 
 BEGIN_HIPCUB_NAMESPACE
 namespace detail
@@ -162,6 +167,191 @@ inline hip_bfloat16 get_max_special_value<hip_bfloat16>()
 
 } // namespace detail
 
+/// \brief Selects the statistics computed by \p DeviceReduce::Statistics.
+enum ReduceStatisticsFlags : unsigned int
+{
+    REDUCE_STATISTICS_SUM         = 1u << 0,
+    REDUCE_STATISTICS_SUM_SQUARES = 1u << 1,
+    REDUCE_STATISTICS_MIN         = 1u << 2,
+    REDUCE_STATISTICS_MAX         = 1u << 3,
+    REDUCE_STATISTICS_ARG_MIN     = 1u << 4,
+    REDUCE_STATISTICS_ARG_MAX     = 1u << 5,
+    REDUCE_STATISTICS_VARIANCE    = 1u << 6,
+    REDUCE_STATISTICS_NAN_COUNT   = 1u << 7,
+    REDUCE_STATISTICS_ALL         = (1u << 8) - 1
+};
+
+/// \brief Result of \p DeviceReduce::Statistics.
+///
+/// \p count is always computed and excludes NaN items, which are only reflected by
+/// \p nan_count. Fields of statistics that were not selected keep their identity values.
+/// \p min, \p max and the arg fields are meaningful only if \p count is not zero.
+/// \tparam T - Type of the input items.
+/// \tparam AccumT - Type used to accumulate the sums, the mean and the squared deviations.
+template<class T, class AccumT = double>
+struct ReduceStatistics
+{
+    using value_type = T;
+    using accum_type = AccumT;
+
+    size_t count;
+    size_t nan_count;
+    AccumT sum;
+    AccumT sum_squares;
+    /// Running mean and sum of squared deviations from it (Welford).
+    AccumT mean;
+    AccumT m2;
+    T      min;
+    T      max;
+    size_t arg_min;
+    size_t arg_max;
+
+    HIPCUB_HOST_DEVICE AccumT Variance() const
+    {
+        return count > 0 ? m2 / static_cast<AccumT>(count) : AccumT(0);
+    }
+
+    HIPCUB_HOST_DEVICE AccumT SampleVariance() const
+    {
+        return count > 1 ? m2 / static_cast<AccumT>(count - 1) : AccumT(0);
+    }
+};
+
+namespace detail
+{
+
+template<class StatisticsT>
+HIPCUB_HOST_DEVICE inline StatisticsT reduce_statistics_identity()
+{
+    using T      = typename StatisticsT::value_type;
+    using AccumT = typename StatisticsT::accum_type;
+
+    StatisticsT result;
+    result.count       = 0;
+    result.nan_count   = 0;
+    result.sum         = AccumT(0);
+    result.sum_squares = AccumT(0);
+    result.mean        = AccumT(0);
+    result.m2          = AccumT(0);
+    result.min         = get_max_value<T>();
+    result.max         = get_lowest_value<T>();
+    result.arg_min     = 0;
+    result.arg_max     = 0;
+    return result;
+}
+
+/// Converts an item with its index to the statistics of a single item.
+template<unsigned int Flags, class StatisticsT>
+struct reduce_statistics_transform_op
+{
+    template<class IndexedValueT>
+    HIPCUB_HOST_DEVICE StatisticsT operator()(const IndexedValueT& item) const
+    {
+        using AccumT = typename StatisticsT::accum_type;
+
+        StatisticsT  result = reduce_statistics_identity<StatisticsT>();
+        const AccumT value  = static_cast<AccumT>(item.value);
+        // Only NaN compares unequal to itself, integral types never take this branch
+        if(value != value)
+        {
+            if HIPCUB_IF_CONSTEXPR(Flags & REDUCE_STATISTICS_NAN_COUNT)
+            {
+                result.nan_count = 1;
+            }
+            return result;
+        }
+        result.count = 1;
+        if HIPCUB_IF_CONSTEXPR(Flags & REDUCE_STATISTICS_SUM)
+        {
+            result.sum = value;
+        }
+        if HIPCUB_IF_CONSTEXPR(Flags & REDUCE_STATISTICS_SUM_SQUARES)
+        {
+            result.sum_squares = value * value;
+        }
+        if HIPCUB_IF_CONSTEXPR(Flags & REDUCE_STATISTICS_VARIANCE)
+        {
+            result.mean = value;
+        }
+        if HIPCUB_IF_CONSTEXPR(Flags & (REDUCE_STATISTICS_MIN | REDUCE_STATISTICS_ARG_MIN))
+        {
+            result.min     = item.value;
+            result.arg_min = static_cast<size_t>(item.key);
+        }
+        if HIPCUB_IF_CONSTEXPR(Flags & (REDUCE_STATISTICS_MAX | REDUCE_STATISTICS_ARG_MAX))
+        {
+            result.max     = item.value;
+            result.arg_max = static_cast<size_t>(item.key);
+        }
+        return result;
+    }
+};
+
+/// Merges two partial statistics. Variance uses the parallel form of Welford's algorithm
+/// (Chan et al.), ties of min and max resolve to the lower index so the result does not depend
+/// on the order of the reduction.
+template<unsigned int Flags, class StatisticsT>
+struct reduce_statistics_op
+{
+    HIPCUB_HOST_DEVICE StatisticsT operator()(const StatisticsT& a, const StatisticsT& b) const
+    {
+        using AccumT = typename StatisticsT::accum_type;
+
+        StatisticsT result = a;
+        result.count       = a.count + b.count;
+        if HIPCUB_IF_CONSTEXPR(Flags & REDUCE_STATISTICS_NAN_COUNT)
+        {
+            result.nan_count = a.nan_count + b.nan_count;
+        }
+        if HIPCUB_IF_CONSTEXPR(Flags & REDUCE_STATISTICS_SUM)
+        {
+            result.sum = a.sum + b.sum;
+        }
+        if HIPCUB_IF_CONSTEXPR(Flags & REDUCE_STATISTICS_SUM_SQUARES)
+        {
+            result.sum_squares = a.sum_squares + b.sum_squares;
+        }
+        if HIPCUB_IF_CONSTEXPR(Flags & REDUCE_STATISTICS_VARIANCE)
+        {
+            if(a.count == 0 || b.count == 0)
+            {
+                result.mean = a.count == 0 ? b.mean : a.mean;
+                result.m2   = a.count == 0 ? b.m2 : a.m2;
+            }
+            else
+            {
+                const AccumT count_a = static_cast<AccumT>(a.count);
+                const AccumT count_b = static_cast<AccumT>(b.count);
+                const AccumT count   = static_cast<AccumT>(result.count);
+                const AccumT delta   = b.mean - a.mean;
+                result.mean          = a.mean + delta * (count_b / count);
+                result.m2            = a.m2 + b.m2 + delta * delta * (count_a * count_b / count);
+            }
+        }
+        if HIPCUB_IF_CONSTEXPR(Flags & (REDUCE_STATISTICS_MIN | REDUCE_STATISTICS_ARG_MIN))
+        {
+            if(b.count != 0
+               && (a.count == 0 || b.min < a.min || (!(a.min < b.min) && b.arg_min < a.arg_min)))
+            {
+                result.min     = b.min;
+                result.arg_min = b.arg_min;
+            }
+        }
+        if HIPCUB_IF_CONSTEXPR(Flags & (REDUCE_STATISTICS_MAX | REDUCE_STATISTICS_ARG_MAX))
+        {
+            if(b.count != 0
+               && (a.count == 0 || a.max < b.max || (!(b.max < a.max) && b.arg_max < a.arg_max)))
+            {
+                result.max     = b.max;
+                result.arg_max = b.arg_max;
+            }
+        }
+        return result;
+    }
+};
+
+} // namespace detail
+
 class DeviceReduce
 {
 public:
@@ -179,17 +369,30 @@ public:
                                                      T               init,
                                                      hipStream_t     stream = 0)
     {
-        return ::rocprim::reduce(
-            d_temp_storage,
-            temp_storage_bytes,
-            d_in,
-            d_out,
-            init,
-            num_items,
-            ::hipcub::detail::convert_binary_result_type<T, InputIteratorT, OutputIteratorT>(
-                reduction_op),
-            stream,
-            HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+        const auto op
+            = ::hipcub::detail::convert_binary_result_type<T, InputIteratorT, OutputIteratorT>(
+                reduction_op);
+        if(detail::single_block_eligible(num_items))
+        {
+            using AccT = typename decltype(op)::accum_type;
+            return detail::single_block_reduce<AccT>(d_temp_storage,
+                                                     temp_storage_bytes,
+                                                     d_in,
+                                                     d_out,
+                                                     static_cast<size_t>(num_items),
+                                                     op,
+                                                     init,
+                                                     stream);
+        }
+        return ::rocprim::reduce(d_temp_storage,
+                                 temp_storage_bytes,
+                                 d_in,
+                                 d_out,
+                                 init,
+                                 num_items,
+                                 op,
+                                 stream,
+                                 HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
     }
 
     template<typename InputIteratorT,
@@ -254,6 +457,104 @@ public:
         return Sum(d_temp_storage, temp_storage_bytes, d_in, d_out, num_items, stream);
     }
 
+    /// \brief Computes a device-wide sum that is bitwise identical on every device.
+    ///
+    /// The input is split into tiles of a fixed size and every tile is added up in a fixed order,
+    /// so unlike \p Sum the result for floating-point inputs does not depend on the device, the
+    /// grid size or the tuning config, only on the number of items. It is slower than \p Sum.
+    template<typename InputIteratorT, typename OutputIteratorT, typename NumItemsT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t ReproducibleSum(void*           d_temp_storage,
+                                                              size_t&         temp_storage_bytes,
+                                                              InputIteratorT  d_in,
+                                                              OutputIteratorT d_out,
+                                                              NumItemsT       num_items,
+                                                              hipStream_t     stream = 0)
+    {
+        using InputT  = typename std::iterator_traits<InputIteratorT>::value_type;
+        using OutputT = typename std::iterator_traits<OutputIteratorT>::value_type;
+        using AccT    = hipcub::detail::non_void_value_t<OutputT, InputT>;
+
+        const size_t size = static_cast<size_t>(num_items);
+        if(d_temp_storage == nullptr)
+        {
+            temp_storage_bytes = std::max<size_t>(
+                detail::reproducible_scan_temp_storage_bytes<AccT>(size),
+                4);
+            return hipSuccess;
+        }
+        return detail::reproducible_reduce<AccT>(d_in,
+                                                 d_out,
+                                                 size,
+                                                 static_cast<AccT*>(d_temp_storage),
+                                                 stream);
+    }
+
+    /// \brief Computes a device-wide sum accumulated in \p AccumT, e.g. \p float for \p __half
+    /// or \p hip_bfloat16 inputs.
+    ///
+    /// Items are converted to \p AccumT after they are loaded, so unlike upcasting the input in a
+    /// separate pass it is read only once at its own width. The result is converted to the value
+    /// type of \p d_out.
+    template<typename AccumT, typename InputIteratorT, typename OutputIteratorT, typename NumItemsT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t MixedPrecisionSum(void*           d_temp_storage,
+                                                                size_t&         temp_storage_bytes,
+                                                                InputIteratorT  d_in,
+                                                                OutputIteratorT d_out,
+                                                                NumItemsT       num_items,
+                                                                hipStream_t     stream = 0)
+    {
+        using TransformOpT = detail::accumulator_cast_op<AccumT>;
+        return ::rocprim::reduce(
+            d_temp_storage,
+            temp_storage_bytes,
+            ::rocprim::transform_iterator<InputIteratorT, TransformOpT, AccumT>(d_in,
+                                                                             TransformOpT()),
+            d_out,
+            AccumT(0),
+            num_items,
+            ::hipcub::Sum(),
+            stream,
+            HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+    }
+
+    /// \brief Computes a device-wide sum with compensated (Neumaier) summation.
+    ///
+    /// The sum and its rounding error are accumulated in \p AccumT, which defaults to the value
+    /// type of \p d_out (or of \p d_in if that is \p void). Items are converted after they are
+    /// loaded, so the input is read only once at its own width.
+    template<typename AccumT = void,
+             typename InputIteratorT,
+             typename OutputIteratorT,
+             typename NumItemsT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t CompensatedSum(void*           d_temp_storage,
+                                                             size_t&         temp_storage_bytes,
+                                                             InputIteratorT  d_in,
+                                                             OutputIteratorT d_out,
+                                                             NumItemsT       num_items,
+                                                             hipStream_t     stream = 0)
+    {
+        using InputT  = typename std::iterator_traits<InputIteratorT>::value_type;
+        using OutputT = typename std::iterator_traits<OutputIteratorT>::value_type;
+        using ValueT  = std::conditional_t<std::is_void<AccumT>::value,
+                                          hipcub::detail::non_void_value_t<OutputT, InputT>,
+                                          AccumT>;
+        using AccumulatorT = CompensatedSumAccumulator<ValueT>;
+
+        using TransformOpT = detail::accumulator_cast_op<AccumulatorT>;
+        return ::rocprim::reduce(
+            d_temp_storage,
+            temp_storage_bytes,
+            ::rocprim::transform_iterator<InputIteratorT, TransformOpT, AccumulatorT>(
+                d_in,
+                TransformOpT()),
+            d_out,
+            AccumulatorT(ValueT(0), ValueT(0)),
+            num_items,
+            CompensatedSumOp(),
+            stream,
+            HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+    }
+
     template<typename InputIteratorT, typename OutputIteratorT, typename NumItemsT>
     HIPCUB_RUNTIME_FUNCTION static hipError_t Min(void*           d_temp_storage,
                                                   size_t&         temp_storage_bytes,
@@ -420,6 +721,41 @@ public:
                       debug_synchronous);
     }
 
+    /// \brief Computes the selected statistics of the input in a single pass over it.
+    ///
+    /// \p d_out points to a single \p ReduceStatistics, its accumulator type is used for the
+    /// sums and the variance.
+    /// \tparam Flags - Bitwise or of \p ReduceStatisticsFlags values.
+    template<unsigned int Flags = REDUCE_STATISTICS_ALL,
+             typename InputIteratorT,
+             typename OutputIteratorT,
+             typename NumItemsT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t Statistics(void*           d_temp_storage,
+                                                         size_t&         temp_storage_bytes,
+                                                         InputIteratorT  d_in,
+                                                         OutputIteratorT d_out,
+                                                         NumItemsT       num_items,
+                                                         hipStream_t     stream = 0)
+    {
+        using StatisticsT           = typename std::iterator_traits<OutputIteratorT>::value_type;
+        using ValueT                = typename StatisticsT::value_type;
+        using IndexedInputIteratorT = ArgIndexInputIterator<InputIteratorT, NumItemsT, ValueT>;
+        using TransformOpT          = detail::reduce_statistics_transform_op<Flags, StatisticsT>;
+
+        return ::rocprim::reduce(
+            d_temp_storage,
+            temp_storage_bytes,
+            ::rocprim::transform_iterator<IndexedInputIteratorT, TransformOpT, StatisticsT>(
+                IndexedInputIteratorT(d_in),
+                TransformOpT()),
+            d_out,
+            detail::reduce_statistics_identity<StatisticsT>(),
+            num_items,
+            detail::reduce_statistics_op<Flags, StatisticsT>(),
+            stream,
+            HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+    }
+
     template<typename InputIteratorT,
              typename OutputIteratorT,
              typename ReductionOpT,
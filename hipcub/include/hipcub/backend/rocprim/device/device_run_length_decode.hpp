@@ -0,0 +1,318 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HIPCUB_ROCPRIM_DEVICE_DEVICE_RUN_LENGTH_DECODE_HPP_
+#define HIPCUB_ROCPRIM_DEVICE_DEVICE_RUN_LENGTH_DECODE_HPP_
+
+#include "../../../config.hpp"
+
+#include "../util_sync.hpp"
+#include "../util_temporary_storage.hpp"
+
+#include <rocprim/device/device_scan.hpp>
+#include <rocprim/functional.hpp>
+#include <rocprim/intrinsics.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace detail
+{
+
+static constexpr unsigned int run_length_decode_block_size       = 256;
+static constexpr unsigned int run_length_decode_items_per_thread = 8;
+static constexpr unsigned int run_length_decode_items_per_tile
+    = run_length_decode_block_size * run_length_decode_items_per_thread;
+/// The decoded size is only known on the device, so a persistent grid of this many blocks per
+/// compute unit loops over the tiles of the merge path.
+static constexpr unsigned int run_length_decode_blocks_per_cu = 4;
+
+/// Finds the split of \p diagonal on the merge path of the run end offsets (\p x) and the
+/// output positions starting at \p first (\p y). Returns the number of consumed runs.
+template<class EndOffsetIteratorT>
+HIPCUB_DEVICE long long run_length_decode_merge_path_search(long long          diagonal,
+                                                            EndOffsetIteratorT run_ends,
+                                                            long long          first,
+                                                            long long          num_runs,
+                                                            long long          num_items)
+{
+    long long split_min = ::rocprim::max(diagonal - num_items, 0ll);
+    long long split_max = ::rocprim::min(diagonal, num_runs);
+    while(split_min < split_max)
+    {
+        const long long split_pivot = (split_min + split_max) / 2;
+        if(static_cast<long long>(run_ends[split_pivot])
+           <= first + diagonal - split_pivot - 1)
+        {
+            split_min = split_pivot + 1;
+        }
+        else
+        {
+            split_max = split_pivot;
+        }
+    }
+    return split_min;
+}
+
+/// Each tile covers a fixed number of steps of the merge path between the run end offsets and
+/// the output positions, so a tile does the same amount of work regardless of how the lengths
+/// are distributed. The run ends of the tile are staged in LDS and every thread walks its own
+/// sub-path writing the value of the current run for every output position it consumes.
+template<class ValuesInputIteratorT, class OffsetIteratorT, class OutputIteratorT>
+__global__ __launch_bounds__(run_length_decode_block_size) void run_length_decode_kernel(
+    ValuesInputIteratorT values,
+    OffsetIteratorT      run_offsets,
+    OutputIteratorT      output,
+    unsigned int         num_runs)
+{
+    constexpr unsigned int block_size       = run_length_decode_block_size;
+    constexpr unsigned int items_per_thread = run_length_decode_items_per_thread;
+    constexpr unsigned int items_per_tile   = run_length_decode_items_per_tile;
+
+    // One extra entry for the end of the run that continues into the next tile
+    __shared__ long long tile_run_ends[items_per_tile + 1];
+    __shared__ long long tile_coordinates[2];
+
+    const unsigned int flat_id  = ::rocprim::detail::block_thread_id<0>();
+    const auto         run_ends = run_offsets + 1;
+
+    const long long first       = static_cast<long long>(run_offsets[0]);
+    const long long num_items   = static_cast<long long>(run_offsets[num_runs]) - first;
+    const long long path_length = num_runs + num_items;
+    const long long num_tiles   = (path_length + items_per_tile - 1) / items_per_tile;
+
+    for(long long tile = ::rocprim::detail::block_id<0>(); tile < num_tiles; tile += gridDim.x)
+    {
+        if(flat_id < 2)
+        {
+            const long long diagonal
+                = ::rocprim::min((tile + flat_id) * items_per_tile, path_length);
+            tile_coordinates[flat_id] = run_length_decode_merge_path_search(diagonal,
+                                                                            run_ends,
+                                                                            first,
+                                                                            num_runs,
+                                                                            num_items);
+        }
+        ::rocprim::syncthreads();
+
+        const long long tile_diagonal = tile * items_per_tile;
+        const long long tile_x        = tile_coordinates[0];
+        const long long tile_y        = tile_diagonal - tile_x;
+        const long long tile_runs     = tile_coordinates[1] - tile_x;
+        const long long tile_items
+            = ::rocprim::min(tile_diagonal + items_per_tile, path_length) - tile_diagonal
+              - tile_runs;
+
+        for(long long i = flat_id; i <= tile_runs; i += block_size)
+        {
+            tile_run_ends[i] = tile_x + i < num_runs
+                                   ? static_cast<long long>(run_ends[tile_x + i]) - first
+                                   : num_items;
+        }
+        ::rocprim::syncthreads();
+
+        // Search the thread's start in the staged part of the path
+        const long long thread_diagonal
+            = ::rocprim::min<long long>(flat_id * items_per_thread, tile_runs + tile_items);
+        long long split_min = ::rocprim::max(thread_diagonal - tile_items, 0ll);
+        long long split_max = ::rocprim::min(thread_diagonal, tile_runs);
+        while(split_min < split_max)
+        {
+            const long long split_pivot = (split_min + split_max) / 2;
+            if(tile_run_ends[split_pivot] <= tile_y + thread_diagonal - split_pivot - 1)
+            {
+                split_min = split_pivot + 1;
+            }
+            else
+            {
+                split_max = split_pivot;
+            }
+        }
+
+        const long long tile_length = tile_runs + tile_items;
+        long long       x           = split_min;
+        long long       y           = thread_diagonal - split_min;
+        for(unsigned int item = 0; item < items_per_thread && x + y < tile_length; item++)
+        {
+            if(y < tile_items && tile_y + y < tile_run_ends[x])
+            {
+                output[first + tile_y + y] = values[tile_x + x];
+                y++;
+            }
+            else
+            {
+                x++;
+            }
+        }
+        ::rocprim::syncthreads();
+    }
+}
+
+template<class ValuesInputIteratorT, class OffsetIteratorT, class OutputIteratorT>
+inline hipError_t run_length_decode(ValuesInputIteratorT values,
+                                    OffsetIteratorT      run_offsets,
+                                    OutputIteratorT      output,
+                                    unsigned int         num_runs,
+                                    hipStream_t          stream)
+{
+    int        device_id;
+    hipError_t error = hipGetDevice(&device_id);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    int compute_units;
+    error = hipDeviceGetAttribute(&compute_units,
+                                  hipDeviceAttributeMultiprocessorCount,
+                                  device_id);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    const unsigned int grid_size = compute_units * run_length_decode_blocks_per_cu;
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(run_length_decode_kernel),
+                       dim3(grid_size),
+                       dim3(run_length_decode_block_size),
+                       0,
+                       stream,
+                       values,
+                       run_offsets,
+                       output,
+                       num_runs);
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("run_length_decode_kernel", num_runs, start);
+
+    return hipSuccess;
+}
+
+} // namespace detail
+
+/// \brief Expands runs of values, the inverse of \p DeviceRunLengthEncode::Encode.
+///
+/// Work is partitioned with merge path over the runs and the output positions, so inputs with
+/// runs of very different lengths are processed with the same throughput as uniform ones.
+struct DeviceRunLengthDecode
+{
+    /// \brief Writes <tt>d_run_lengths_in[i]</tt> copies of <tt>d_values_in[i]</tt> for every
+    /// run in order. \p d_decoded_out must hold the sum of all run lengths.
+    template<typename ValuesInputIteratorT,
+             typename LengthsInputIteratorT,
+             typename DecodedOutputIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t Decode(void*                  d_temp_storage,
+                                                     size_t&                temp_storage_bytes,
+                                                     ValuesInputIteratorT   d_values_in,
+                                                     LengthsInputIteratorT  d_run_lengths_in,
+                                                     DecodedOutputIteratorT d_decoded_out,
+                                                     int                    num_runs,
+                                                     hipStream_t            stream = 0)
+    {
+        const unsigned int runs = num_runs > 0 ? static_cast<unsigned int>(num_runs) : 0u;
+
+        size_t     scan_bytes = 0;
+        hipError_t error      = ::rocprim::inclusive_scan(nullptr,
+                                                     scan_bytes,
+                                                     d_run_lengths_in,
+                                                     static_cast<size_t*>(nullptr),
+                                                     runs,
+                                                     ::rocprim::plus<size_t>(),
+                                                     stream,
+                                                     HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+
+        void*  allocations[2]      = {};
+        size_t allocation_sizes[2] = {scan_bytes, (runs + 1) * sizeof(size_t)};
+        error = AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes);
+        if(error != hipSuccess || d_temp_storage == nullptr || runs == 0u)
+        {
+            return error;
+        }
+
+        size_t* d_run_offsets = static_cast<size_t*>(allocations[1]);
+        error                 = hipMemsetAsync(d_run_offsets, 0, sizeof(size_t), stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        error = ::rocprim::inclusive_scan(allocations[0],
+                                          scan_bytes,
+                                          d_run_lengths_in,
+                                          d_run_offsets + 1,
+                                          runs,
+                                          ::rocprim::plus<size_t>(),
+                                          stream,
+                                          HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+
+        return detail::run_length_decode(d_values_in, d_run_offsets, d_decoded_out, runs, stream);
+    }
+
+    /// \brief Writes <tt>d_values_in[i]</tt> to every position in
+    /// <tt>[d_run_offsets_in[i], d_run_offsets_in[i + 1])</tt> of \p d_decoded_out.
+    /// \p d_run_offsets_in holds <tt>num_runs + 1</tt> non-decreasing offsets, no temporary
+    /// storage is needed besides the minimal allocation.
+    template<typename ValuesInputIteratorT,
+             typename OffsetsInputIteratorT,
+             typename DecodedOutputIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t DecodeOffsets(void*   d_temp_storage,
+                                                            size_t& temp_storage_bytes,
+                                                            ValuesInputIteratorT  d_values_in,
+                                                            OffsetsInputIteratorT d_run_offsets_in,
+                                                            DecodedOutputIteratorT d_decoded_out,
+                                                            int                    num_runs,
+                                                            hipStream_t            stream = 0)
+    {
+        if(d_temp_storage == nullptr)
+        {
+            // Make sure user won't try to allocate 0 bytes memory
+            temp_storage_bytes = 4;
+            return hipSuccess;
+        }
+        if(num_runs <= 0)
+        {
+            return hipSuccess;
+        }
+        return detail::run_length_decode(d_values_in,
+                                         d_run_offsets_in,
+                                         d_decoded_out,
+                                         static_cast<unsigned int>(num_runs),
+                                         stream);
+    }
+};
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_ROCPRIM_DEVICE_DEVICE_RUN_LENGTH_DECODE_HPP_
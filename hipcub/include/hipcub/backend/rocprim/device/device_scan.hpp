@@ -32,6 +32,8 @@
 
 #include "../../../config.hpp"
 #include "../../../util_deprecated.hpp"
+#include "../agent/agent_reproducible_scan.hpp"
+#include "../agent/agent_single_block.hpp"
 #include "../thread/thread_operators.hpp"
 
 #include <rocprim/device/config_types.hpp>
@@ -40,6 +42,9 @@
 #include <rocprim/type_traits.hpp>
 #include <rocprim/types/future_value.hpp>
 
+#include <algorithm>
+#include <iterator>
+
 BEGIN_HIPCUB_NAMESPACE
 
 class DeviceScan
@@ -119,6 +124,17 @@ public:
             typename std::iterator_traits<InputIteratorT>::value_type,
             ScanOpT>;
 
+        if(detail::single_block_eligible(num_items))
+        {
+            return detail::single_block_scan<false, acc_t>(d_temp_storage,
+                                                           temp_storage_bytes,
+                                                           d_in,
+                                                           d_out,
+                                                           num_items,
+                                                           scan_op,
+                                                           acc_t{},
+                                                           stream);
+        }
         return ::rocprim::inclusive_scan<::rocprim::default_config,
                                          InputIteratorT,
                                          OutputIteratorT,
@@ -253,6 +269,69 @@ public:
                                        stream);
     }
 
+    /// \brief Computes a device-wide inclusive prefix sum that is bitwise identical on every
+    /// device.
+    ///
+    /// The input is split into tiles of a fixed size and every prefix is added up in a fixed
+    /// order, so unlike \p InclusiveSum the result for floating-point inputs does not depend on
+    /// the device, the grid size or the tuning config, only on the number of items. The scan can
+    /// run in place.
+    template<typename InputIteratorT, typename OutputIteratorT>
+    HIPCUB_RUNTIME_FUNCTION
+    static hipError_t ReproducibleInclusiveSum(void*           d_temp_storage,
+                                               size_t&         temp_storage_bytes,
+                                               InputIteratorT  d_in,
+                                               OutputIteratorT d_out,
+                                               size_t          num_items,
+                                               hipStream_t     stream = 0)
+    {
+        using InputT  = typename std::iterator_traits<InputIteratorT>::value_type;
+        using OutputT = typename std::iterator_traits<OutputIteratorT>::value_type;
+        using AccT    = hipcub::detail::non_void_value_t<OutputT, InputT>;
+
+        if(d_temp_storage == nullptr)
+        {
+            temp_storage_bytes = std::max<size_t>(
+                detail::reproducible_scan_temp_storage_bytes<AccT>(num_items),
+                4);
+            return hipSuccess;
+        }
+        return detail::reproducible_scan<false, AccT>(d_in,
+                                                      d_out,
+                                                      num_items,
+                                                      static_cast<AccT*>(d_temp_storage),
+                                                      stream);
+    }
+
+    /// \brief Computes a device-wide exclusive prefix sum that is bitwise identical on every
+    /// device, see \p ReproducibleInclusiveSum.
+    template<typename InputIteratorT, typename OutputIteratorT>
+    HIPCUB_RUNTIME_FUNCTION
+    static hipError_t ReproducibleExclusiveSum(void*           d_temp_storage,
+                                               size_t&         temp_storage_bytes,
+                                               InputIteratorT  d_in,
+                                               OutputIteratorT d_out,
+                                               size_t          num_items,
+                                               hipStream_t     stream = 0)
+    {
+        using InputT  = typename std::iterator_traits<InputIteratorT>::value_type;
+        using OutputT = typename std::iterator_traits<OutputIteratorT>::value_type;
+        using AccT    = hipcub::detail::non_void_value_t<OutputT, InputT>;
+
+        if(d_temp_storage == nullptr)
+        {
+            temp_storage_bytes = std::max<size_t>(
+                detail::reproducible_scan_temp_storage_bytes<AccT>(num_items),
+                4);
+            return hipSuccess;
+        }
+        return detail::reproducible_scan<true, AccT>(d_in,
+                                                     d_out,
+                                                     num_items,
+                                                     static_cast<AccT*>(d_temp_storage),
+                                                     stream);
+    }
+
     template<typename InputIteratorT,
              typename OutputIteratorT,
              typename ScanOpT,
@@ -271,6 +350,17 @@ public:
             = ::rocprim::invoke_result_binary_op_t<rocprim::detail::input_type_t<InitValueT>,
                                                    ScanOpT>;
 
+        if(detail::single_block_eligible(num_items))
+        {
+            return detail::single_block_scan<true, acc_t>(d_temp_storage,
+                                                          temp_storage_bytes,
+                                                          d_in,
+                                                          d_out,
+                                                          num_items,
+                                                          scan_op,
+                                                          static_cast<acc_t>(init_value),
+                                                          stream);
+        }
         return ::rocprim::exclusive_scan<::rocprim::default_config,
                                          InputIteratorT,
                                          OutputIteratorT,
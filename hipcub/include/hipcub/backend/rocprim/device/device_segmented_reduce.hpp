@@ -33,74 +33,198 @@
 #include "../../../config.hpp"
 #include "../../../util_deprecated.hpp"
 
+#include "../agent/agent_fixed_segment.hpp"
 #include "../iterator/arg_index_input_iterator.hpp"
+#include "../thread/thread_accumulators.hpp"
 #include "../thread/thread_operators.hpp"
 #include "../util_sync.hpp"
+#include "../util_temporary_storage.hpp"
 #include "device_reduce.hpp"
 #include "rocprim/type_traits.hpp"
 
+#include <rocprim/block/block_reduce.hpp>
+#include <rocprim/device/device_partition.hpp>
 #include <rocprim/device/device_segmented_reduce.hpp>
+#include <rocprim/iterator/counting_iterator.hpp>
+#include <rocprim/iterator/transform_iterator.hpp>
+#include <rocprim/warp/warp_reduce.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <iterator>
 #include <limits>
+#include <type_traits>
 
 BEGIN_HIPCUB_NAMESPACE
 
 namespace detail
 {
 
-template<class Config,
+/// Segments of at most \p segmented_arg_minmax_sub_warp_max_size items are reduced by a logical
+/// warp of \p segmented_arg_minmax_sub_warp_threads threads, segments of at most
+/// \p segmented_arg_minmax_warp_max_size items by a logical warp of
+/// \p segmented_arg_minmax_warp_threads threads and longer segments by a whole block.
+static constexpr unsigned int segmented_arg_minmax_sub_warp_threads  = 8;
+static constexpr unsigned int segmented_arg_minmax_warp_threads      = 32;
+static constexpr unsigned int segmented_arg_minmax_block_size        = 256;
+static constexpr size_t       segmented_arg_minmax_sub_warp_max_size = 32;
+static constexpr size_t       segmented_arg_minmax_warp_max_size     = 1024;
+/// All kernels loop over their segments, so the grid never has to be sized from the
+/// (device-side) number of segments of every size class.
+static constexpr unsigned int segmented_arg_minmax_max_grid_size = 8192;
+
+template<class OffsetIterator>
+struct segmented_arg_minmax_size_op
+{
+    OffsetIterator begin_offsets;
+    OffsetIterator end_offsets;
+    size_t         max_size;
+
+    HIPCUB_DEVICE bool operator()(unsigned int segment_id) const
+    {
+        const auto begin = begin_offsets[segment_id];
+        const auto end   = end_offsets[segment_id];
+        return end <= begin || static_cast<size_t>(end - begin) <= max_size;
+    }
+};
+
+/// Reduces the items of one segment with every thread of a group of \p GroupThreads threads.
+/// The key of every item is replaced by its index inside the segment before it is reduced, so no
+/// fix-up of the absolute index is needed afterwards.
+template<unsigned int GroupThreads,
+         class ResultType,
+         class InputIterator,
+         class OffsetType,
+         class BinaryFunction>
+HIPCUB_DEVICE HIPCUB_FORCEINLINE ResultType
+    segmented_arg_minmax_thread_reduce(InputIterator  input,
+                                       OffsetType     begin_offset,
+                                       size_t         size,
+                                       unsigned int   group_thread_id,
+                                       BinaryFunction reduce_op,
+                                       ResultType     initial_value)
+{
+    using key_type = typename ResultType::Key;
+
+    ResultType thread_result = initial_value;
+    for(size_t i = group_thread_id; i < size; i += GroupThreads)
+    {
+        ResultType item = input[begin_offset + i];
+        item.key        = static_cast<key_type>(i);
+        thread_result   = reduce_op(thread_result, item);
+    }
+    return thread_result;
+}
+
+/// Each logical warp reduces one of the segments listed in \p segment_ids and writes
+/// \p empty_value for empty segments.
+template<unsigned int WarpThreads,
          class InputIterator,
          class OutputIterator,
          class OffsetIterator,
          class ResultType,
          class BinaryFunction>
-__global__ __launch_bounds__(
-    ::rocprim::detail::device_params<Config>()
-        .reduce_config.block_size) void segmented_arg_minmax_kernel(InputIterator  input,
-                                                                    OutputIterator output,
-                                                                    OffsetIterator begin_offsets,
-                                                                    OffsetIterator end_offsets,
-                                                                    BinaryFunction reduce_op,
-                                                                    ResultType     initial_value,
-                                                                    ResultType     empty_value)
+__global__ __launch_bounds__(segmented_arg_minmax_block_size) void segmented_arg_minmax_warp_kernel(
+    InputIterator       input,
+    OutputIterator      output,
+    OffsetIterator      begin_offsets,
+    OffsetIterator      end_offsets,
+    const unsigned int* segment_ids,
+    const unsigned int* segment_count,
+    BinaryFunction      reduce_op,
+    ResultType          initial_value,
+    ResultType          empty_value)
 {
-    // each block processes one segment
-    ::rocprim::detail::segmented_reduce<Config>(input,
-                                                output,
-                                                begin_offsets,
-                                                end_offsets,
-                                                reduce_op,
-                                                initial_value);
-    // no synchronization is needed since thread 0 writes to output
+    using warp_reduce_type = ::rocprim::warp_reduce<ResultType, WarpThreads>;
 
-    const unsigned int flat_id    = ::rocprim::detail::block_thread_id<0>();
-    const unsigned int segment_id = ::rocprim::detail::block_id<0>();
+    constexpr unsigned int warps_per_block = segmented_arg_minmax_block_size / WarpThreads;
 
-    // Large indices need bigger offset type than unsigned int
-    using offset_type = typename std::iterator_traits<OffsetIterator>::value_type;
+    __shared__ typename warp_reduce_type::storage_type storage[warps_per_block];
 
-    const offset_type begin_offset = begin_offsets[segment_id];
-    const offset_type end_offset   = end_offsets[segment_id];
+    const unsigned int lane    = ::rocprim::detail::block_thread_id<0>() % WarpThreads;
+    const unsigned int warp_id = ::rocprim::detail::block_thread_id<0>() / WarpThreads;
+    const unsigned int count   = *segment_count;
 
-    // transform the segment output
-    if(flat_id == 0)
+    for(unsigned int i = ::rocprim::detail::block_id<0>() * warps_per_block + warp_id; i < count;
+        i += gridDim.x * warps_per_block)
     {
-        if(begin_offset == end_offset)
+        const unsigned int segment_id = segment_ids[i];
+        const auto         begin      = begin_offsets[segment_id];
+        const auto         end        = end_offsets[segment_id];
+        const size_t       size       = end > begin ? static_cast<size_t>(end - begin) : 0;
+
+        const ResultType thread_result
+            = segmented_arg_minmax_thread_reduce<WarpThreads>(input,
+                                                              begin,
+                                                              size,
+                                                              lane,
+                                                              reduce_op,
+                                                              initial_value);
+        ResultType result;
+        warp_reduce_type().reduce(thread_result, result, storage[warp_id], reduce_op);
+        if(lane == 0)
         {
-            output[segment_id] = empty_value;
+            output[segment_id] = size == 0 ? empty_value : result;
         }
-        else
+    }
+}
+
+/// Each block reduces one of the long segments listed in \p segment_ids. Their number is whatever
+/// remains after the two classes of short segments.
+template<class InputIterator,
+         class OutputIterator,
+         class OffsetIterator,
+         class ResultType,
+         class BinaryFunction>
+__global__
+    __launch_bounds__(segmented_arg_minmax_block_size) void segmented_arg_minmax_block_kernel(
+    InputIterator       input,
+    OutputIterator      output,
+    OffsetIterator      begin_offsets,
+    OffsetIterator      end_offsets,
+    const unsigned int* segment_ids,
+    const unsigned int* short_segment_counts,
+    unsigned int        segments,
+    BinaryFunction      reduce_op,
+    ResultType          initial_value)
+{
+    using block_reduce_type
+        = ::rocprim::block_reduce<ResultType, segmented_arg_minmax_block_size>;
+
+    __shared__ typename block_reduce_type::storage_type storage;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int count   = segments - short_segment_counts[0] - short_segment_counts[1];
+
+    for(unsigned int i = ::rocprim::detail::block_id<0>(); i < count; i += gridDim.x)
+    {
+        const unsigned int segment_id = segment_ids[i];
+        const auto         begin      = begin_offsets[segment_id];
+        const size_t       size       = static_cast<size_t>(end_offsets[segment_id] - begin);
+
+        const ResultType thread_result
+            = segmented_arg_minmax_thread_reduce<segmented_arg_minmax_block_size>(input,
+                                                                                  begin,
+                                                                                  size,
+                                                                                  flat_id,
+                                                                                  reduce_op,
+                                                                                  initial_value);
+        ResultType result;
+        block_reduce_type().reduce(thread_result, result, storage, reduce_op);
+        if(flat_id == 0)
         {
-            output[segment_id].key -= begin_offset;
+            output[segment_id] = result;
         }
+        // The storage is reused by the next segment
+        ::rocprim::syncthreads();
     }
 }
 
 /// Dispatch function similar to \p rocprim::segmented_reduce but writes \p empty_value for empty
-/// segments and writes a segment-relative index instead of an absolute one.
-template<class Config = rocprim::default_config,
-         class InputIterator,
+/// segments and writes a segment-relative index instead of an absolute one. The segments are
+/// partitioned by size first, so short segments are reduced by (sub-)warps instead of leaving
+/// most threads of a block idle.
+template<class InputIterator,
          class OutputIterator,
          class OffsetIterator,
          class InitValueType,
@@ -120,54 +244,246 @@ inline hipError_t segmented_arg_minmax(void*          temporary_storage,
     using input_type = typename std::iterator_traits<InputIterator>::value_type;
     using result_type =
         typename ::rocprim::invoke_result_binary_op<input_type, BinaryFunction>::type;
-
-    using config = ::rocprim::detail::wrapped_reduce_config<Config, result_type>;
-
-    ::rocprim::detail::target_arch target_arch;
-    hipError_t                     result = host_target_arch(stream, target_arch);
-    if(result != hipSuccess)
+    using size_op_type = segmented_arg_minmax_size_op<OffsetIterator>;
+
+    const size_op_type is_sub_warp_segment{begin_offsets,
+                                           end_offsets,
+                                           segmented_arg_minmax_sub_warp_max_size};
+    const size_op_type is_warp_segment{begin_offsets,
+                                       end_offsets,
+                                       segmented_arg_minmax_warp_max_size};
+    const ::rocprim::counting_iterator<unsigned int> segment_ids_in(0);
+
+    size_t     partition_bytes = 0;
+    hipError_t error           = ::rocprim::partition_three_way(nullptr,
+                                                      partition_bytes,
+                                                      segment_ids_in,
+                                                      static_cast<unsigned int*>(nullptr),
+                                                      static_cast<unsigned int*>(nullptr),
+                                                      static_cast<unsigned int*>(nullptr),
+                                                      static_cast<unsigned int*>(nullptr),
+                                                      segments,
+                                                      is_sub_warp_segment,
+                                                      is_warp_segment,
+                                                      stream,
+                                                      HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+    if(error != hipSuccess)
     {
-        return result;
+        return error;
     }
-    const ::rocprim::detail::reduce_config_params params
-        = ::rocprim::detail::dispatch_target_arch<config>(target_arch);
 
-    const unsigned int block_size = params.reduce_config.block_size;
-
-    if(temporary_storage == nullptr)
+    void*  allocations[5]      = {};
+    size_t allocation_sizes[5] = {partition_bytes,
+                                  segments * sizeof(unsigned int),
+                                  segments * sizeof(unsigned int),
+                                  segments * sizeof(unsigned int),
+                                  2 * sizeof(unsigned int)};
+    error = AliasTemporaries(temporary_storage, storage_size, allocations, allocation_sizes);
+    if(error != hipSuccess || temporary_storage == nullptr)
     {
-        // Make sure user won't try to allocate 0 bytes memory, because
-        // hipMalloc will return nullptr when size is zero.
-        storage_size = 4;
-        return hipSuccess;
+        return error;
     }
 
     if(segments == 0u)
         return hipSuccess;
 
+    unsigned int* d_sub_warp_segment_ids = static_cast<unsigned int*>(allocations[1]);
+    unsigned int* d_warp_segment_ids     = static_cast<unsigned int*>(allocations[2]);
+    unsigned int* d_block_segment_ids    = static_cast<unsigned int*>(allocations[3]);
+    unsigned int* d_short_segment_counts = static_cast<unsigned int*>(allocations[4]);
+
+    error = ::rocprim::partition_three_way(allocations[0],
+                                           partition_bytes,
+                                           segment_ids_in,
+                                           d_sub_warp_segment_ids,
+                                           d_warp_segment_ids,
+                                           d_block_segment_ids,
+                                           d_short_segment_counts,
+                                           segments,
+                                           is_sub_warp_segment,
+                                           is_warp_segment,
+                                           stream,
+                                           HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    constexpr unsigned int sub_warps_per_block
+        = segmented_arg_minmax_block_size / segmented_arg_minmax_sub_warp_threads;
+    constexpr unsigned int warps_per_block
+        = segmented_arg_minmax_block_size / segmented_arg_minmax_warp_threads;
+    const unsigned int sub_warp_grid_size
+        = std::min(::rocprim::detail::ceiling_div(segments, sub_warps_per_block),
+                   segmented_arg_minmax_max_grid_size);
+    const unsigned int warp_grid_size
+        = std::min(::rocprim::detail::ceiling_div(segments, warps_per_block),
+                   segmented_arg_minmax_max_grid_size);
+    const unsigned int block_grid_size = std::min(segments, segmented_arg_minmax_max_grid_size);
+
     std::chrono::high_resolution_clock::time_point start;
 
     if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
     {
         start = std::chrono::high_resolution_clock::now();
     }
-    hipLaunchKernelGGL(HIP_KERNEL_NAME(segmented_arg_minmax_kernel<config>),
-                       dim3(segments),
-                       dim3(block_size),
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(segmented_arg_minmax_warp_kernel<segmented_arg_minmax_sub_warp_threads>),
+        dim3(sub_warp_grid_size),
+        dim3(segmented_arg_minmax_block_size),
+        0,
+        stream,
+        input,
+        output,
+        begin_offsets,
+        end_offsets,
+        d_sub_warp_segment_ids,
+        d_short_segment_counts,
+        reduce_op,
+        static_cast<result_type>(initial_value),
+        static_cast<result_type>(empty_value));
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_arg_minmax_sub_warp_kernel",
+                                               segments,
+                                               start);
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(segmented_arg_minmax_warp_kernel<segmented_arg_minmax_warp_threads>),
+        dim3(warp_grid_size),
+        dim3(segmented_arg_minmax_block_size),
+        0,
+        stream,
+        input,
+        output,
+        begin_offsets,
+        end_offsets,
+        d_warp_segment_ids,
+        d_short_segment_counts + 1,
+        reduce_op,
+        static_cast<result_type>(initial_value),
+        static_cast<result_type>(empty_value));
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_arg_minmax_warp_kernel", segments, start);
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(segmented_arg_minmax_block_kernel),
+                       dim3(block_grid_size),
+                       dim3(segmented_arg_minmax_block_size),
                        0,
                        stream,
                        input,
                        output,
                        begin_offsets,
                        end_offsets,
+                       d_block_segment_ids,
+                       d_short_segment_counts,
+                       segments,
                        reduce_op,
-                       static_cast<result_type>(initial_value),
-                       static_cast<result_type>(empty_value));
-    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_arg_minmax", segments, start);
+                       static_cast<result_type>(initial_value));
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_arg_minmax_block_kernel",
+                                               segments,
+                                               start);
 
     return hipSuccess;
 }
 
+/// Reduces \p num_segments segments of \p segment_size items stored back to back. Short segments
+/// are reduced by logical warps without temporary storage, long ones by
+/// \p rocprim::segmented_reduce with offsets computed from the segment index.
+template<class InputIteratorT, class OutputIteratorT, class ReduceOpT, class InitT>
+inline hipError_t fixed_segment_reduce(void*           d_temp_storage,
+                                       size_t&         temp_storage_bytes,
+                                       InputIteratorT  input,
+                                       OutputIteratorT output,
+                                       int             num_segments,
+                                       int             segment_size,
+                                       ReduceOpT       reduce_op,
+                                       InitT           init,
+                                       hipStream_t     stream)
+{
+    using input_type = typename std::iterator_traits<InputIteratorT>::value_type;
+    using acc_type   = accumulator_t<ReduceOpT, InitT, input_type>;
+
+    if(segment_size > fixed_segment_reduce_warp_max_size)
+    {
+        using offset_op_type     = fixed_segment_offset_op<size_t>;
+        const auto begin_offsets = ::rocprim::make_transform_iterator(
+            ::rocprim::make_counting_iterator<size_t>(0),
+            offset_op_type{static_cast<size_t>(segment_size)});
+        return ::rocprim::segmented_reduce(
+            d_temp_storage,
+            temp_storage_bytes,
+            input,
+            output,
+            num_segments,
+            begin_offsets,
+            begin_offsets + 1,
+            convert_result_type<InputIteratorT, OutputIteratorT>(reduce_op),
+            init,
+            stream,
+            HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+    }
+
+    if(d_temp_storage == nullptr)
+    {
+        // Make sure user won't try to allocate 0 bytes memory
+        temp_storage_bytes = 1;
+        return hipSuccess;
+    }
+    if(num_segments <= 0)
+    {
+        return hipSuccess;
+    }
+
+    // Vector loads need every segment to start at a multiple of the vector size
+    constexpr unsigned int vector_items = fixed_segment_vector_items<InputIteratorT>::value;
+    const bool             aligned      = vector_items > 1 && segment_size % vector_items == 0
+                         && fixed_segment_is_aligned(input);
+
+    if(segment_size <= 4)
+    {
+        return fixed_segment_warp_reduce<4, 1, acc_type>(input,
+                                                         output,
+                                                         num_segments,
+                                                         segment_size,
+                                                         reduce_op,
+                                                         init,
+                                                         stream);
+    }
+    if(segment_size <= 16)
+    {
+        return fixed_segment_warp_reduce<16, 1, acc_type>(input,
+                                                          output,
+                                                          num_segments,
+                                                          segment_size,
+                                                          reduce_op,
+                                                          init,
+                                                          stream);
+    }
+    if(aligned)
+    {
+        return fixed_segment_warp_reduce<32, vector_items, acc_type>(input,
+                                                                     output,
+                                                                     num_segments,
+                                                                     segment_size,
+                                                                     reduce_op,
+                                                                     init,
+                                                                     stream);
+    }
+    return fixed_segment_warp_reduce<32, 1, acc_type>(input,
+                                                      output,
+                                                      num_segments,
+                                                      segment_size,
+                                                      reduce_op,
+                                                      init,
+                                                      stream);
+}
+
 } // namespace detail
 
 struct DeviceSegmentedReduce
@@ -279,6 +595,76 @@ struct DeviceSegmentedReduce
                    stream);
     }
 
+    /// \brief Computes the sum of every segment accumulated in \p AccumT, e.g. \p float for
+    /// \p __half or \p hip_bfloat16 inputs. The input is read once at its own width.
+    template<typename AccumT,
+             typename InputIteratorT,
+             typename OutputIteratorT,
+             typename OffsetIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t MixedPrecisionSum(void*           d_temp_storage,
+                                                                size_t&         temp_storage_bytes,
+                                                                InputIteratorT  d_in,
+                                                                OutputIteratorT d_out,
+                                                                int             num_segments,
+                                                                OffsetIteratorT d_begin_offsets,
+                                                                OffsetIteratorT d_end_offsets,
+                                                                hipStream_t     stream = 0)
+    {
+        using TransformOpT = detail::accumulator_cast_op<AccumT>;
+        return ::rocprim::segmented_reduce(
+            d_temp_storage,
+            temp_storage_bytes,
+            ::rocprim::transform_iterator<InputIteratorT, TransformOpT, AccumT>(d_in,
+                                                                             TransformOpT()),
+            d_out,
+            num_segments,
+            d_begin_offsets,
+            d_end_offsets,
+            ::hipcub::Sum(),
+            AccumT(0),
+            stream,
+            HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+    }
+
+    /// \brief Computes the sum of every segment with compensated (Neumaier) summation in
+    /// \p AccumT, see \p DeviceReduce::CompensatedSum.
+    template<typename AccumT = void,
+             typename InputIteratorT,
+             typename OutputIteratorT,
+             typename OffsetIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t CompensatedSum(void*           d_temp_storage,
+                                                             size_t&         temp_storage_bytes,
+                                                             InputIteratorT  d_in,
+                                                             OutputIteratorT d_out,
+                                                             int             num_segments,
+                                                             OffsetIteratorT d_begin_offsets,
+                                                             OffsetIteratorT d_end_offsets,
+                                                             hipStream_t     stream = 0)
+    {
+        using InputT  = typename std::iterator_traits<InputIteratorT>::value_type;
+        using OutputT = typename std::iterator_traits<OutputIteratorT>::value_type;
+        using ValueT  = std::conditional_t<std::is_void<AccumT>::value,
+                                          hipcub::detail::non_void_value_t<OutputT, InputT>,
+                                          AccumT>;
+        using AccumulatorT = CompensatedSumAccumulator<ValueT>;
+
+        using TransformOpT = detail::accumulator_cast_op<AccumulatorT>;
+        return ::rocprim::segmented_reduce(
+            d_temp_storage,
+            temp_storage_bytes,
+            ::rocprim::transform_iterator<InputIteratorT, TransformOpT, AccumulatorT>(
+                d_in,
+                TransformOpT()),
+            d_out,
+            num_segments,
+            d_begin_offsets,
+            d_end_offsets,
+            CompensatedSumOp(),
+            AccumulatorT(ValueT(0), ValueT(0)),
+            stream,
+            HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+    }
+
     template<typename InputIteratorT, typename OutputIteratorT, typename OffsetIteratorT>
     HIPCUB_RUNTIME_FUNCTION static hipError_t Min(void*           d_temp_storage,
                                                   size_t&         temp_storage_bytes,
@@ -504,6 +890,101 @@ struct DeviceSegmentedReduce
                       d_end_offsets,
                       stream);
     }
+
+    /// \brief Same as \p Reduce for \p num_segments segments of \p segment_size items stored
+    /// back to back, e.g. the rows of a matrix. The offsets are computed from the segment index
+    /// instead of being read from memory. Segments of up to 1024 items are reduced by logical
+    /// warps with loads of 16 bytes if \p d_in is a pointer aligned to whole segments.
+    template<typename InputIteratorT, typename OutputIteratorT, typename ReductionOp, typename T>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t ReduceFixedSize(void*           d_temp_storage,
+                                                              size_t&         temp_storage_bytes,
+                                                              InputIteratorT  d_in,
+                                                              OutputIteratorT d_out,
+                                                              int             num_segments,
+                                                              int             segment_size,
+                                                              ReductionOp     reduction_op,
+                                                              T               initial_value,
+                                                              hipStream_t     stream = 0)
+    {
+        return detail::fixed_segment_reduce(d_temp_storage,
+                                            temp_storage_bytes,
+                                            d_in,
+                                            d_out,
+                                            num_segments,
+                                            segment_size,
+                                            reduction_op,
+                                            initial_value,
+                                            stream);
+    }
+
+    /// \brief Same as \p Sum for segments of \p segment_size items, see \p ReduceFixedSize.
+    template<typename InputIteratorT, typename OutputIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t SumFixedSize(void*           d_temp_storage,
+                                                           size_t&         temp_storage_bytes,
+                                                           InputIteratorT  d_in,
+                                                           OutputIteratorT d_out,
+                                                           int             num_segments,
+                                                           int             segment_size,
+                                                           hipStream_t     stream = 0)
+    {
+        using input_type = typename std::iterator_traits<InputIteratorT>::value_type;
+
+        return ReduceFixedSize(d_temp_storage,
+                               temp_storage_bytes,
+                               d_in,
+                               d_out,
+                               num_segments,
+                               segment_size,
+                               ::hipcub::Sum(),
+                               input_type(),
+                               stream);
+    }
+
+    /// \brief Same as \p Min for segments of \p segment_size items, see \p ReduceFixedSize.
+    template<typename InputIteratorT, typename OutputIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t MinFixedSize(void*           d_temp_storage,
+                                                           size_t&         temp_storage_bytes,
+                                                           InputIteratorT  d_in,
+                                                           OutputIteratorT d_out,
+                                                           int             num_segments,
+                                                           int             segment_size,
+                                                           hipStream_t     stream = 0)
+    {
+        using input_type = typename std::iterator_traits<InputIteratorT>::value_type;
+
+        return ReduceFixedSize(d_temp_storage,
+                               temp_storage_bytes,
+                               d_in,
+                               d_out,
+                               num_segments,
+                               segment_size,
+                               ::hipcub::Min(),
+                               std::numeric_limits<input_type>::max(),
+                               stream);
+    }
+
+    /// \brief Same as \p Max for segments of \p segment_size items, see \p ReduceFixedSize.
+    template<typename InputIteratorT, typename OutputIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t MaxFixedSize(void*           d_temp_storage,
+                                                           size_t&         temp_storage_bytes,
+                                                           InputIteratorT  d_in,
+                                                           OutputIteratorT d_out,
+                                                           int             num_segments,
+                                                           int             segment_size,
+                                                           hipStream_t     stream = 0)
+    {
+        using input_type = typename std::iterator_traits<InputIteratorT>::value_type;
+
+        return ReduceFixedSize(d_temp_storage,
+                               temp_storage_bytes,
+                               d_in,
+                               d_out,
+                               num_segments,
+                               segment_size,
+                               ::hipcub::Max(),
+                               std::numeric_limits<input_type>::lowest(),
+                               stream);
+    }
 };
 
 END_HIPCUB_NAMESPACE
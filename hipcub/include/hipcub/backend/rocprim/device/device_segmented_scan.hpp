@@ -0,0 +1,489 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef HIPCUB_ROCPRIM_DEVICE_DEVICE_SEGMENTED_SCAN_HPP_
+#define HIPCUB_ROCPRIM_DEVICE_DEVICE_SEGMENTED_SCAN_HPP_
+
+#include "../../../config.hpp"
+
+#include "../agent/single_pass_scan_operators.hpp"
+#include "../block/block_scan.hpp"
+#include "../thread/thread_operators.hpp"
+#include "../util_sync.hpp"
+#include "../util_temporary_storage.hpp"
+#include "../warp/warp_scan.hpp"
+
+#include <rocprim/detail/various.hpp>
+#include <rocprim/device/device_partition.hpp>
+#include <rocprim/intrinsics.hpp>
+#include <rocprim/iterator/counting_iterator.hpp>
+#include <rocprim/type_traits.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <type_traits>
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace detail
+{
+
+/// Segments of at most \p segmented_scan_warp_max_size items are scanned by a logical warp,
+/// longer ones by a whole block in tiles of \p segmented_scan_block_tile_size items.
+static constexpr unsigned int segmented_scan_block_size   = 256;
+static constexpr unsigned int segmented_scan_warp_threads = 32;
+static constexpr unsigned int segmented_scan_warps_per_block
+    = segmented_scan_block_size / segmented_scan_warp_threads;
+static constexpr unsigned int segmented_scan_items_per_thread = 4;
+static constexpr unsigned int segmented_scan_block_tile_size
+    = segmented_scan_block_size * segmented_scan_items_per_thread;
+static constexpr size_t segmented_scan_warp_max_size = 8 * segmented_scan_warp_threads;
+/// Both kernels loop over their segments, so the grid never has to be sized from the
+/// (device-side) number of short and long segments.
+static constexpr unsigned int segmented_scan_max_grid_size = 8192;
+
+template<class BeginOffsetIteratorT, class EndOffsetIteratorT>
+struct segmented_scan_long_segment_op
+{
+    BeginOffsetIteratorT begin_offsets;
+    EndOffsetIteratorT   end_offsets;
+
+    HIPCUB_DEVICE bool operator()(unsigned int segment_id) const
+    {
+        const auto begin = begin_offsets[segment_id];
+        const auto end   = end_offsets[segment_id];
+        return end > begin && static_cast<size_t>(end - begin) > segmented_scan_warp_max_size;
+    }
+};
+
+/// Each logical warp scans one short segment in chunks of one item per lane and carries the
+/// aggregate of the previous chunks over. Lanes past the end repeat the last item, they only
+/// affect the aggregate of the last chunk which is not used.
+template<bool Exclusive,
+         class AccT,
+         class InputIteratorT,
+         class OutputIteratorT,
+         class BeginOffsetIteratorT,
+         class EndOffsetIteratorT,
+         class ScanOpT>
+__global__ __launch_bounds__(segmented_scan_block_size) void segmented_scan_warp_kernel(
+    InputIteratorT       input,
+    OutputIteratorT      output,
+    BeginOffsetIteratorT begin_offsets,
+    EndOffsetIteratorT   end_offsets,
+    const unsigned int*  segment_ids,
+    const unsigned int*  long_segment_count,
+    unsigned int         num_segments,
+    ScanOpT              scan_op,
+    AccT                 init)
+{
+    using warp_scan_type = WarpScan<AccT, segmented_scan_warp_threads>;
+
+    __shared__ ::rocprim::detail::raw_storage<typename warp_scan_type::TempStorage>
+        storage[segmented_scan_warps_per_block];
+
+    const unsigned int lane = ::rocprim::detail::block_thread_id<0>() % segmented_scan_warp_threads;
+    const unsigned int warp_id
+        = ::rocprim::detail::block_thread_id<0>() / segmented_scan_warp_threads;
+
+    // Short segments were partitioned to the back of segment_ids
+    const unsigned int first_short_segment = *long_segment_count;
+    const unsigned int short_segment_count = num_segments - first_short_segment;
+
+    const unsigned int first_warp
+        = ::rocprim::detail::block_id<0>() * segmented_scan_warps_per_block + warp_id;
+    for(unsigned int i = first_warp; i < short_segment_count;
+        i += gridDim.x * segmented_scan_warps_per_block)
+    {
+        const unsigned int segment_id = segment_ids[first_short_segment + i];
+        const auto         begin      = begin_offsets[segment_id];
+        const auto         end        = end_offsets[segment_id];
+        const unsigned int size       = end > begin ? static_cast<unsigned int>(end - begin) : 0u;
+
+        AccT carry     = init;
+        bool has_carry = Exclusive;
+        for(unsigned int offset = 0; offset < size; offset += segmented_scan_warp_threads)
+        {
+            const unsigned int j    = offset + lane;
+            const AccT         item = static_cast<AccT>(input[begin + (j < size ? j : size - 1)]);
+
+            AccT           result;
+            AccT           chunk_aggregate;
+            warp_scan_type warp_scan(storage[warp_id].get());
+            if(Exclusive)
+            {
+                warp_scan.ExclusiveScan(item, result, scan_op, chunk_aggregate);
+                result = lane == 0 ? carry : scan_op(carry, result);
+            }
+            else
+            {
+                warp_scan.InclusiveScan(item, result, scan_op, chunk_aggregate);
+                result = has_carry ? scan_op(carry, result) : result;
+            }
+            carry     = has_carry ? scan_op(carry, chunk_aggregate) : chunk_aggregate;
+            has_carry = true;
+
+            if(j < size)
+            {
+                output[begin + j] = result;
+            }
+            ::rocprim::wave_barrier();
+        }
+    }
+}
+
+/// Each block scans one long segment in tiles, the aggregate of the previous tiles is passed to
+/// the block scan by a running prefix callback. Items past the end repeat the last item of the
+/// segment, they take part in the scan of the last tile but are not written.
+template<bool Exclusive,
+         class AccT,
+         class InputIteratorT,
+         class OutputIteratorT,
+         class BeginOffsetIteratorT,
+         class EndOffsetIteratorT,
+         class ScanOpT>
+__global__ __launch_bounds__(segmented_scan_block_size) void segmented_scan_block_kernel(
+    InputIteratorT       input,
+    OutputIteratorT      output,
+    BeginOffsetIteratorT begin_offsets,
+    EndOffsetIteratorT   end_offsets,
+    const unsigned int*  segment_ids,
+    const unsigned int*  long_segment_count,
+    ScanOpT              scan_op,
+    AccT                 init)
+{
+    using block_scan_type = BlockScan<AccT, segmented_scan_block_size>;
+    using prefix_op_type  = BlockScanRunningPrefixOp<AccT, ScanOpT>;
+
+    constexpr unsigned int items_per_thread = segmented_scan_items_per_thread;
+    constexpr unsigned int tile_size        = segmented_scan_block_tile_size;
+
+    __shared__ ::rocprim::detail::raw_storage<typename block_scan_type::TempStorage> storage;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int count   = *long_segment_count;
+
+    for(unsigned int i = ::rocprim::detail::block_id<0>(); i < count; i += gridDim.x)
+    {
+        const unsigned int segment_id = segment_ids[i];
+        const size_t       begin      = begin_offsets[segment_id];
+        const size_t       size       = static_cast<size_t>(end_offsets[segment_id]) - begin;
+
+        prefix_op_type prefix_op(init, scan_op);
+        for(size_t tile = 0; tile < size; tile += tile_size)
+        {
+            AccT items[items_per_thread];
+            for(unsigned int item = 0; item < items_per_thread; item++)
+            {
+                const size_t j = tile + flat_id * items_per_thread + item;
+                items[item]    = static_cast<AccT>(input[begin + (j < size ? j : size - 1)]);
+            }
+
+            block_scan_type block_scan(storage.get());
+            if(Exclusive)
+            {
+                block_scan.ExclusiveScan(items, items, scan_op, prefix_op);
+            }
+            else if(tile == 0)
+            {
+                AccT tile_aggregate;
+                block_scan.InclusiveScan(items, items, scan_op, tile_aggregate);
+                prefix_op.running_total = tile_aggregate;
+            }
+            else
+            {
+                block_scan.InclusiveScan(items, items, scan_op, prefix_op);
+            }
+
+            for(unsigned int item = 0; item < items_per_thread; item++)
+            {
+                const size_t j = tile + flat_id * items_per_thread + item;
+                if(j < size)
+                {
+                    output[begin + j] = items[item];
+                }
+            }
+            // The storage is reused by the next tile
+            ::rocprim::syncthreads();
+        }
+    }
+}
+
+/// Long segments are moved to the front of the segment ids by \p rocprim::partition, short ones
+/// to the back, then both kinds are scanned by their own kernel. \p init is only used by the
+/// exclusive scan.
+template<bool Exclusive,
+         class AccT,
+         class InputIteratorT,
+         class OutputIteratorT,
+         class BeginOffsetIteratorT,
+         class EndOffsetIteratorT,
+         class ScanOpT>
+inline hipError_t segmented_scan(void*                d_temp_storage,
+                                 size_t&              temp_storage_bytes,
+                                 InputIteratorT       input,
+                                 OutputIteratorT      output,
+                                 int                  num_segments,
+                                 BeginOffsetIteratorT begin_offsets,
+                                 EndOffsetIteratorT   end_offsets,
+                                 ScanOpT              scan_op,
+                                 AccT                 init,
+                                 hipStream_t          stream)
+{
+    using predicate_type
+        = segmented_scan_long_segment_op<BeginOffsetIteratorT, EndOffsetIteratorT>;
+
+    const unsigned int segments = num_segments > 0 ? static_cast<unsigned int>(num_segments) : 0u;
+    const predicate_type is_long_segment{begin_offsets, end_offsets};
+    const ::rocprim::counting_iterator<unsigned int> segment_ids_in(0);
+
+    size_t     partition_bytes = 0;
+    hipError_t error           = ::rocprim::partition(nullptr,
+                                            partition_bytes,
+                                            segment_ids_in,
+                                            static_cast<unsigned int*>(nullptr),
+                                            static_cast<unsigned int*>(nullptr),
+                                            segments,
+                                            is_long_segment,
+                                            stream,
+                                            HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    void*  allocations[3]      = {};
+    size_t allocation_sizes[3]
+        = {partition_bytes, segments * sizeof(unsigned int), sizeof(unsigned int)};
+    error = AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes);
+    if(error != hipSuccess || d_temp_storage == nullptr)
+    {
+        return error;
+    }
+
+    if(segments == 0u)
+    {
+        return hipSuccess;
+    }
+
+    unsigned int* d_segment_ids        = static_cast<unsigned int*>(allocations[1]);
+    unsigned int* d_long_segment_count = static_cast<unsigned int*>(allocations[2]);
+
+    error = ::rocprim::partition(allocations[0],
+                                 partition_bytes,
+                                 segment_ids_in,
+                                 d_segment_ids,
+                                 d_long_segment_count,
+                                 segments,
+                                 is_long_segment,
+                                 stream,
+                                 HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    const unsigned int warp_grid_size
+        = std::min(::rocprim::detail::ceiling_div(segments, segmented_scan_warps_per_block),
+                   segmented_scan_max_grid_size);
+    const unsigned int block_grid_size = std::min(segments, segmented_scan_max_grid_size);
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(segmented_scan_warp_kernel<Exclusive, AccT>),
+                       dim3(warp_grid_size),
+                       dim3(segmented_scan_block_size),
+                       0,
+                       stream,
+                       input,
+                       output,
+                       begin_offsets,
+                       end_offsets,
+                       d_segment_ids,
+                       d_long_segment_count,
+                       segments,
+                       scan_op,
+                       init);
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_scan_warp_kernel", segments, start);
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(segmented_scan_block_kernel<Exclusive, AccT>),
+                       dim3(block_grid_size),
+                       dim3(segmented_scan_block_size),
+                       0,
+                       stream,
+                       input,
+                       output,
+                       begin_offsets,
+                       end_offsets,
+                       d_segment_ids,
+                       d_long_segment_count,
+                       scan_op,
+                       init);
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_scan_block_kernel", segments, start);
+
+    return hipSuccess;
+}
+
+} // namespace detail
+
+/// \brief Computes an independent prefix scan of every segment, segment \p i covers the items
+/// <tt>[d_begin_offsets[i], d_end_offsets[i])</tt> of the input and output.
+///
+/// Unlike \p DeviceScan::InclusiveScanByKey no keys are read, the bounds of every segment are
+/// taken from the offsets, e.g. the row offsets of a CSR matrix. Segments of up to 256 items are
+/// scanned by a logical warp each and longer ones by a block each, so many short segments do not
+/// leave most threads idle. Items outside of all segments are not written, empty segments and
+/// segments with an end offset before the begin offset are skipped.
+struct DeviceSegmentedScan
+{
+    /// \brief Computes the inclusive scan of every segment with \p scan_op.
+    template<typename InputIteratorT,
+             typename OutputIteratorT,
+             typename BeginOffsetIteratorT,
+             typename EndOffsetIteratorT,
+             typename ScanOpT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t InclusiveScan(void*                d_temp_storage,
+                                                            size_t&              temp_storage_bytes,
+                                                            InputIteratorT       d_in,
+                                                            OutputIteratorT      d_out,
+                                                            int                  num_segments,
+                                                            BeginOffsetIteratorT d_begin_offsets,
+                                                            EndOffsetIteratorT   d_end_offsets,
+                                                            ScanOpT              scan_op,
+                                                            hipStream_t          stream = 0)
+    {
+        using input_type       = typename std::iterator_traits<InputIteratorT>::value_type;
+        using accumulator_type = ::rocprim::invoke_result_binary_op_t<input_type, ScanOpT>;
+
+        return detail::segmented_scan<false>(d_temp_storage,
+                                             temp_storage_bytes,
+                                             d_in,
+                                             d_out,
+                                             num_segments,
+                                             d_begin_offsets,
+                                             d_end_offsets,
+                                             scan_op,
+                                             accumulator_type{},
+                                             stream);
+    }
+
+    /// \brief Computes the inclusive prefix sum of every segment.
+    template<typename InputIteratorT,
+             typename OutputIteratorT,
+             typename BeginOffsetIteratorT,
+             typename EndOffsetIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t InclusiveSum(void*                d_temp_storage,
+                                                           size_t&              temp_storage_bytes,
+                                                           InputIteratorT       d_in,
+                                                           OutputIteratorT      d_out,
+                                                           int                  num_segments,
+                                                           BeginOffsetIteratorT d_begin_offsets,
+                                                           EndOffsetIteratorT   d_end_offsets,
+                                                           hipStream_t          stream = 0)
+    {
+        return InclusiveScan(d_temp_storage,
+                             temp_storage_bytes,
+                             d_in,
+                             d_out,
+                             num_segments,
+                             d_begin_offsets,
+                             d_end_offsets,
+                             ::hipcub::Sum(),
+                             stream);
+    }
+
+    /// \brief Computes the exclusive scan of every segment with \p scan_op, the first item of
+    /// every segment is set to \p init_value.
+    template<typename InputIteratorT,
+             typename OutputIteratorT,
+             typename BeginOffsetIteratorT,
+             typename EndOffsetIteratorT,
+             typename ScanOpT,
+             typename InitValueT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t ExclusiveScan(void*                d_temp_storage,
+                                                            size_t&              temp_storage_bytes,
+                                                            InputIteratorT       d_in,
+                                                            OutputIteratorT      d_out,
+                                                            int                  num_segments,
+                                                            BeginOffsetIteratorT d_begin_offsets,
+                                                            EndOffsetIteratorT   d_end_offsets,
+                                                            ScanOpT              scan_op,
+                                                            InitValueT           init_value,
+                                                            hipStream_t          stream = 0)
+    {
+        using accumulator_type = ::rocprim::invoke_result_binary_op_t<InitValueT, ScanOpT>;
+
+        return detail::segmented_scan<true>(d_temp_storage,
+                                            temp_storage_bytes,
+                                            d_in,
+                                            d_out,
+                                            num_segments,
+                                            d_begin_offsets,
+                                            d_end_offsets,
+                                            scan_op,
+                                            static_cast<accumulator_type>(init_value),
+                                            stream);
+    }
+
+    /// \brief Computes the exclusive prefix sum of every segment, the first item of every
+    /// segment is set to zero.
+    template<typename InputIteratorT,
+             typename OutputIteratorT,
+             typename BeginOffsetIteratorT,
+             typename EndOffsetIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t ExclusiveSum(void*                d_temp_storage,
+                                                           size_t&              temp_storage_bytes,
+                                                           InputIteratorT       d_in,
+                                                           OutputIteratorT      d_out,
+                                                           int                  num_segments,
+                                                           BeginOffsetIteratorT d_begin_offsets,
+                                                           EndOffsetIteratorT   d_end_offsets,
+                                                           hipStream_t          stream = 0)
+    {
+        using input_type = typename std::iterator_traits<InputIteratorT>::value_type;
+
+        return ExclusiveScan(d_temp_storage,
+                             temp_storage_bytes,
+                             d_in,
+                             d_out,
+                             num_segments,
+                             d_begin_offsets,
+                             d_end_offsets,
+                             ::hipcub::Sum(),
+                             input_type(),
+                             stream);
+    }
+};
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_ROCPRIM_DEVICE_DEVICE_SEGMENTED_SCAN_HPP_
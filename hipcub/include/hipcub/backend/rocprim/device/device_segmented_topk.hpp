@@ -0,0 +1,557 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HIPCUB_ROCPRIM_DEVICE_DEVICE_SEGMENTED_TOPK_HPP_
+#define HIPCUB_ROCPRIM_DEVICE_DEVICE_SEGMENTED_TOPK_HPP_
+
+#include "../../../config.hpp"
+
+#include "../util_sync.hpp"
+#include "../util_temporary_storage.hpp"
+#include "../util_type.hpp"
+
+#include <rocprim/block/block_scan.hpp>
+#include <rocprim/device/device_partition.hpp>
+#include <rocprim/intrinsics.hpp>
+#include <rocprim/iterator/counting_iterator.hpp>
+#include <rocprim/thread/radix_key_codec.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace detail
+{
+
+/// Number of threads of the logical warp that handles a short segment. Segments with at most
+/// this many items are ranked entirely in registers, larger ones use block-wide radix select.
+static constexpr unsigned int segmented_topk_warp_threads = 32;
+static constexpr unsigned int segmented_topk_block_size   = 256;
+static constexpr unsigned int segmented_topk_radix_bits   = 8;
+/// Both kernels loop over their segments, so the grid never has to be sized from the
+/// (device-side) number of short and long segments.
+static constexpr unsigned int segmented_topk_max_grid_size = 8192;
+
+template<class BeginOffsetIteratorT, class EndOffsetIteratorT>
+struct segmented_topk_long_segment_op
+{
+    BeginOffsetIteratorT begin_offsets;
+    EndOffsetIteratorT   end_offsets;
+
+    HIPCUB_DEVICE bool operator()(unsigned int segment_id) const
+    {
+        return static_cast<size_t>(end_offsets[segment_id] - begin_offsets[segment_id])
+               > segmented_topk_warp_threads;
+    }
+};
+
+/// Each logical warp handles one short segment. Every lane holds one item and computes its rank
+/// by comparing against all other items of the segment, ties are resolved by the position of
+/// the item. Lanes with a rank lower than \p k write their item directly to its final place.
+template<bool Descending,
+         bool WithValues,
+         class KeyT,
+         class ValueT,
+         class BeginOffsetIteratorT,
+         class EndOffsetIteratorT>
+__global__ __launch_bounds__(segmented_topk_block_size) void segmented_topk_warp_kernel(
+    const KeyT*          keys_in,
+    KeyT*                keys_out,
+    const ValueT*        values_in,
+    ValueT*              values_out,
+    BeginOffsetIteratorT begin_offsets,
+    EndOffsetIteratorT   end_offsets,
+    const unsigned int*  segment_ids,
+    const unsigned int*  long_segment_count,
+    unsigned int         num_segments,
+    unsigned int         k)
+{
+    using codec        = ::rocprim::radix_key_codec<KeyT, Descending>;
+    using bit_key_type = typename codec::bit_key_type;
+
+    constexpr unsigned int warp_threads    = segmented_topk_warp_threads;
+    constexpr unsigned int warps_per_block = segmented_topk_block_size / warp_threads;
+
+    const unsigned int lane    = ::rocprim::detail::block_thread_id<0>() % warp_threads;
+    const unsigned int warp_id = ::rocprim::detail::block_thread_id<0>() / warp_threads;
+
+    // Short segments were partitioned to the back of segment_ids
+    const unsigned int first_short_segment = *long_segment_count;
+    const unsigned int short_segment_count = num_segments - first_short_segment;
+
+    for(unsigned int i = ::rocprim::detail::block_id<0>() * warps_per_block + warp_id;
+        i < short_segment_count;
+        i += gridDim.x * warps_per_block)
+    {
+        const unsigned int segment_id = segment_ids[first_short_segment + i];
+        const auto         begin      = begin_offsets[segment_id];
+        const unsigned int size       = static_cast<unsigned int>(end_offsets[segment_id] - begin);
+
+        const bool   valid = lane < size;
+        KeyT         key{};
+        bit_key_type bit_key{};
+        if(valid)
+        {
+            key     = keys_in[begin + lane];
+            bit_key = codec::encode(key);
+        }
+
+        unsigned int rank = 0;
+        for(unsigned int j = 0; j < size; j++)
+        {
+            const bit_key_type other = ::rocprim::warp_shuffle(bit_key, j, warp_threads);
+            rank += (other < bit_key || (other == bit_key && j < lane)) ? 1 : 0;
+        }
+
+        if(valid && rank < k)
+        {
+            const size_t output_offset = static_cast<size_t>(segment_id) * k + rank;
+            keys_out[output_offset]    = key;
+            if HIPCUB_IF_CONSTEXPR(WithValues)
+            {
+                values_out[output_offset] = values_in[begin + lane];
+            }
+        }
+    }
+}
+
+/// Each block handles one long segment. The k-th item is found with a most-significant-digit
+/// radix select: every pass histograms the digit of the items that still match the selected
+/// prefix and descends into the bucket containing the k-th item. The search stops as soon as
+/// every candidate of the selected bucket is part of the result. A final pass writes all items
+/// below the prefix together with the first matching ones in order of their position.
+template<bool Descending,
+         bool WithValues,
+         class KeyT,
+         class ValueT,
+         class BeginOffsetIteratorT,
+         class EndOffsetIteratorT>
+__global__ __launch_bounds__(segmented_topk_block_size) void segmented_topk_block_kernel(
+    const KeyT*          keys_in,
+    KeyT*                keys_out,
+    const ValueT*        values_in,
+    ValueT*              values_out,
+    BeginOffsetIteratorT begin_offsets,
+    EndOffsetIteratorT   end_offsets,
+    const unsigned int*  segment_ids,
+    const unsigned int*  long_segment_count,
+    unsigned int         k)
+{
+    using codec           = ::rocprim::radix_key_codec<KeyT, Descending>;
+    using bit_key_type    = typename codec::bit_key_type;
+    using block_scan_type = ::rocprim::block_scan<unsigned int, segmented_topk_block_size>;
+
+    constexpr unsigned int block_size = segmented_topk_block_size;
+    constexpr unsigned int radix_bits = segmented_topk_radix_bits;
+    constexpr unsigned int radix_size = 1u << radix_bits;
+    constexpr unsigned int key_bits   = sizeof(bit_key_type) * 8;
+    static_assert(radix_size == block_size, "Each thread must own exactly one histogram bin");
+    static_assert(key_bits % radix_bits == 0, "Key width must be a multiple of the digit width");
+
+    __shared__ typename block_scan_type::storage_type scan_storage;
+    __shared__ unsigned int                           histogram[radix_size];
+    __shared__ unsigned int                           selected_digit;
+    __shared__ unsigned int                           selected_count;
+    __shared__ unsigned int                           selected_remaining;
+
+    const unsigned int flat_id = ::rocprim::detail::block_thread_id<0>();
+    const unsigned int count   = *long_segment_count;
+
+    for(unsigned int i = ::rocprim::detail::block_id<0>(); i < count; i += gridDim.x)
+    {
+        const unsigned int segment_id = segment_ids[i];
+        const size_t       begin      = begin_offsets[segment_id];
+        const size_t       end        = end_offsets[segment_id];
+        const size_t       output     = static_cast<size_t>(segment_id) * k;
+        const unsigned int selected_total
+            = static_cast<unsigned int>(::rocprim::min<size_t>(k, end - begin));
+
+        // Items whose masked key is below prefix are always selected, items whose masked key
+        // equals prefix are selected until remaining of them are taken.
+        bit_key_type prefix    = 0;
+        bit_key_type mask      = 0;
+        unsigned int remaining = selected_total;
+
+        if(end - begin > k)
+        {
+            for(unsigned int shift = key_bits - radix_bits;; shift -= radix_bits)
+            {
+                histogram[flat_id] = 0;
+                ::rocprim::syncthreads();
+
+                for(size_t j = begin + flat_id; j < end; j += block_size)
+                {
+                    const bit_key_type bit_key = codec::encode(keys_in[j]);
+                    if((bit_key & mask) == prefix)
+                    {
+                        const unsigned int digit
+                            = static_cast<unsigned int>(bit_key >> shift) & (radix_size - 1);
+                        atomicAdd(&histogram[digit], 1u);
+                    }
+                }
+                ::rocprim::syncthreads();
+
+                const unsigned int bin_count = histogram[flat_id];
+                unsigned int       bin_offset;
+                block_scan_type().exclusive_scan(bin_count, bin_offset, 0u, scan_storage);
+                if(bin_offset < remaining && remaining <= bin_offset + bin_count)
+                {
+                    selected_digit     = flat_id;
+                    selected_count     = bin_count;
+                    selected_remaining = remaining - bin_offset;
+                }
+                ::rocprim::syncthreads();
+
+                prefix |= static_cast<bit_key_type>(selected_digit) << shift;
+                mask |= static_cast<bit_key_type>(radix_size - 1) << shift;
+                remaining              = selected_remaining;
+                const bool bucket_done = selected_count == remaining;
+                // The shared selection is overwritten by the next pass
+                ::rocprim::syncthreads();
+
+                if(bucket_done || shift == 0)
+                {
+                    break;
+                }
+            }
+        }
+
+        unsigned int output_count = 0;
+        unsigned int equal_count  = 0;
+        for(size_t tile = begin; tile < end; tile += block_size)
+        {
+            const size_t j     = tile + flat_id;
+            bool         less  = false;
+            bool         equal = false;
+            KeyT         key{};
+            if(j < end)
+            {
+                key                        = keys_in[j];
+                const bit_key_type bit_key = codec::encode(key) & mask;
+                less                       = bit_key < prefix;
+                equal                      = bit_key == prefix;
+            }
+
+            unsigned int equal_rank;
+            unsigned int tile_equal_count;
+            block_scan_type().exclusive_scan(equal ? 1u : 0u,
+                                             equal_rank,
+                                             0u,
+                                             tile_equal_count,
+                                             scan_storage);
+            ::rocprim::syncthreads();
+
+            const bool selected = less || (equal && equal_count + equal_rank < remaining);
+
+            unsigned int output_rank;
+            unsigned int tile_output_count;
+            block_scan_type().exclusive_scan(selected ? 1u : 0u,
+                                             output_rank,
+                                             0u,
+                                             tile_output_count,
+                                             scan_storage);
+            ::rocprim::syncthreads();
+
+            if(selected)
+            {
+                keys_out[output + output_count + output_rank] = key;
+                if HIPCUB_IF_CONSTEXPR(WithValues)
+                {
+                    values_out[output + output_count + output_rank] = values_in[j];
+                }
+            }
+
+            output_count += tile_output_count;
+            equal_count += tile_equal_count;
+            if(output_count >= selected_total)
+            {
+                break;
+            }
+        }
+    }
+}
+
+/// Long segments are moved to the front of the segment ids by \p rocprim::partition, short ones
+/// to the back, then both kinds are handled by their own kernel. Nothing is launched when there
+/// are no items.
+template<bool Descending,
+         bool WithValues,
+         class KeyT,
+         class ValueT,
+         class BeginOffsetIteratorT,
+         class EndOffsetIteratorT>
+inline hipError_t segmented_topk(void*                d_temp_storage,
+                                 size_t&              temp_storage_bytes,
+                                 const KeyT*          keys_in,
+                                 KeyT*                keys_out,
+                                 const ValueT*        values_in,
+                                 ValueT*              values_out,
+                                 int                  num_items,
+                                 int                  num_segments,
+                                 BeginOffsetIteratorT begin_offsets,
+                                 EndOffsetIteratorT   end_offsets,
+                                 int                  k,
+                                 hipStream_t          stream)
+{
+    using predicate_type
+        = segmented_topk_long_segment_op<BeginOffsetIteratorT, EndOffsetIteratorT>;
+
+    if(num_items < 0 || k < 0)
+    {
+        return hipErrorInvalidValue;
+    }
+
+    const unsigned int segments = num_segments > 0 ? static_cast<unsigned int>(num_segments) : 0u;
+    const predicate_type is_long_segment{begin_offsets, end_offsets};
+    const ::rocprim::counting_iterator<unsigned int> segment_ids_in(0);
+
+    size_t     partition_bytes = 0;
+    hipError_t error           = ::rocprim::partition(nullptr,
+                                            partition_bytes,
+                                            segment_ids_in,
+                                            static_cast<unsigned int*>(nullptr),
+                                            static_cast<unsigned int*>(nullptr),
+                                            segments,
+                                            is_long_segment,
+                                            stream,
+                                            HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    void*  allocations[3]      = {};
+    size_t allocation_sizes[3]
+        = {partition_bytes, segments * sizeof(unsigned int), sizeof(unsigned int)};
+    error = AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes);
+    if(error != hipSuccess || d_temp_storage == nullptr)
+    {
+        return error;
+    }
+
+    if(num_items == 0 || segments == 0u || k == 0)
+    {
+        return hipSuccess;
+    }
+
+    unsigned int* d_segment_ids        = static_cast<unsigned int*>(allocations[1]);
+    unsigned int* d_long_segment_count = static_cast<unsigned int*>(allocations[2]);
+
+    // Long segments are stored at the front in order, short ones at the back in reverse order
+    error = ::rocprim::partition(allocations[0],
+                                 partition_bytes,
+                                 segment_ids_in,
+                                 d_segment_ids,
+                                 d_long_segment_count,
+                                 segments,
+                                 is_long_segment,
+                                 stream,
+                                 HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    constexpr unsigned int warps_per_block
+        = segmented_topk_block_size / segmented_topk_warp_threads;
+    const unsigned int warp_grid_size
+        = std::min(::rocprim::detail::ceiling_div(segments, warps_per_block),
+                   segmented_topk_max_grid_size);
+    const unsigned int block_grid_size = std::min(segments, segmented_topk_max_grid_size);
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(segmented_topk_warp_kernel<Descending, WithValues>),
+                       dim3(warp_grid_size),
+                       dim3(segmented_topk_block_size),
+                       0,
+                       stream,
+                       keys_in,
+                       keys_out,
+                       values_in,
+                       values_out,
+                       begin_offsets,
+                       end_offsets,
+                       d_segment_ids,
+                       d_long_segment_count,
+                       segments,
+                       static_cast<unsigned int>(k));
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_topk_warp_kernel", segments, start);
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(segmented_topk_block_kernel<Descending, WithValues>),
+                       dim3(block_grid_size),
+                       dim3(segmented_topk_block_size),
+                       0,
+                       stream,
+                       keys_in,
+                       keys_out,
+                       values_in,
+                       values_out,
+                       begin_offsets,
+                       end_offsets,
+                       d_segment_ids,
+                       d_long_segment_count,
+                       static_cast<unsigned int>(k));
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("segmented_topk_block_kernel", segments, start);
+
+    return hipSuccess;
+}
+
+} // namespace detail
+
+/// \brief Selects the \p k largest or smallest items of every segment.
+///
+/// The results of segment \p i are written to <tt>[i * k, i * k + min(k, size_i))</tt> of the
+/// output, the remaining places of shorter segments are left untouched. The order of the
+/// selected items inside a segment is unspecified. Among equal keys the ones with the lower
+/// position in the segment are selected first, so the selected set is deterministic. Keys are
+/// compared the same way as by \p DeviceRadixSort. A negative \p num_items or \p k returns
+/// \p hipErrorInvalidValue, a \p k of zero writes nothing.
+struct DeviceSegmentedTopK
+{
+    template<typename KeyT, typename BeginOffsetIteratorT, typename EndOffsetIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t MaxKeys(void*                d_temp_storage,
+                                                      size_t&              temp_storage_bytes,
+                                                      const KeyT*          d_keys_in,
+                                                      KeyT*                d_keys_out,
+                                                      int                  num_items,
+                                                      int                  num_segments,
+                                                      BeginOffsetIteratorT d_begin_offsets,
+                                                      EndOffsetIteratorT   d_end_offsets,
+                                                      int                  k,
+                                                      hipStream_t          stream = 0)
+    {
+        return detail::segmented_topk<true, false>(d_temp_storage,
+                                                   temp_storage_bytes,
+                                                   d_keys_in,
+                                                   d_keys_out,
+                                                   static_cast<const NullType*>(nullptr),
+                                                   static_cast<NullType*>(nullptr),
+                                                   num_items,
+                                                   num_segments,
+                                                   d_begin_offsets,
+                                                   d_end_offsets,
+                                                   k,
+                                                   stream);
+    }
+
+    template<typename KeyT, typename BeginOffsetIteratorT, typename EndOffsetIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t MinKeys(void*                d_temp_storage,
+                                                      size_t&              temp_storage_bytes,
+                                                      const KeyT*          d_keys_in,
+                                                      KeyT*                d_keys_out,
+                                                      int                  num_items,
+                                                      int                  num_segments,
+                                                      BeginOffsetIteratorT d_begin_offsets,
+                                                      EndOffsetIteratorT   d_end_offsets,
+                                                      int                  k,
+                                                      hipStream_t          stream = 0)
+    {
+        return detail::segmented_topk<false, false>(d_temp_storage,
+                                                    temp_storage_bytes,
+                                                    d_keys_in,
+                                                    d_keys_out,
+                                                    static_cast<const NullType*>(nullptr),
+                                                    static_cast<NullType*>(nullptr),
+                                                    num_items,
+                                                    num_segments,
+                                                    d_begin_offsets,
+                                                    d_end_offsets,
+                                                    k,
+                                                    stream);
+    }
+
+    template<typename KeyT,
+             typename ValueT,
+             typename BeginOffsetIteratorT,
+             typename EndOffsetIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t MaxPairs(void*                d_temp_storage,
+                                                       size_t&              temp_storage_bytes,
+                                                       const KeyT*          d_keys_in,
+                                                       KeyT*                d_keys_out,
+                                                       const ValueT*        d_values_in,
+                                                       ValueT*              d_values_out,
+                                                       int                  num_items,
+                                                       int                  num_segments,
+                                                       BeginOffsetIteratorT d_begin_offsets,
+                                                       EndOffsetIteratorT   d_end_offsets,
+                                                       int                  k,
+                                                       hipStream_t          stream = 0)
+    {
+        return detail::segmented_topk<true, true>(d_temp_storage,
+                                                  temp_storage_bytes,
+                                                  d_keys_in,
+                                                  d_keys_out,
+                                                  d_values_in,
+                                                  d_values_out,
+                                                  num_items,
+                                                  num_segments,
+                                                  d_begin_offsets,
+                                                  d_end_offsets,
+                                                  k,
+                                                  stream);
+    }
+
+    template<typename KeyT,
+             typename ValueT,
+             typename BeginOffsetIteratorT,
+             typename EndOffsetIteratorT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t MinPairs(void*                d_temp_storage,
+                                                       size_t&              temp_storage_bytes,
+                                                       const KeyT*          d_keys_in,
+                                                       KeyT*                d_keys_out,
+                                                       const ValueT*        d_values_in,
+                                                       ValueT*              d_values_out,
+                                                       int                  num_items,
+                                                       int                  num_segments,
+                                                       BeginOffsetIteratorT d_begin_offsets,
+                                                       EndOffsetIteratorT   d_end_offsets,
+                                                       int                  k,
+                                                       hipStream_t          stream = 0)
+    {
+        return detail::segmented_topk<false, true>(d_temp_storage,
+                                                   temp_storage_bytes,
+                                                   d_keys_in,
+                                                   d_keys_out,
+                                                   d_values_in,
+                                                   d_values_out,
+                                                   num_items,
+                                                   num_segments,
+                                                   d_begin_offsets,
+                                                   d_end_offsets,
+                                                   k,
+                                                   stream);
+    }
+};
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_ROCPRIM_DEVICE_DEVICE_SEGMENTED_TOPK_HPP_
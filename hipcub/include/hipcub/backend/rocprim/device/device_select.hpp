@@ -33,6 +33,7 @@
 #include "../../../config.hpp"
 #include "../../../util_deprecated.hpp"
 
+#include "../agent/agent_single_block.hpp"
 #include "../thread/thread_operators.hpp"
 
 #include <rocprim/device/device_select.hpp>
@@ -58,6 +59,18 @@ public:
                               int64_t              num_items,
                               hipStream_t          stream = 0)
     {
+        if(detail::single_block_eligible(num_items))
+        {
+            return detail::single_block_select(
+                d_temp_storage,
+                temp_storage_bytes,
+                d_in,
+                d_out,
+                d_num_selected_out,
+                static_cast<size_t>(num_items),
+                detail::single_block_select_flagged<FlagIterator>{d_flags},
+                stream);
+        }
         return ::rocprim::select(d_temp_storage,
                                  temp_storage_bytes,
                                  d_in,
@@ -150,6 +163,18 @@ public:
                          SelectOp             select_op,
                          hipStream_t          stream = 0)
     {
+        if(detail::single_block_eligible(num_items))
+        {
+            return detail::single_block_select(
+                d_temp_storage,
+                temp_storage_bytes,
+                d_in,
+                d_out,
+                d_num_selected_out,
+                static_cast<size_t>(num_items),
+                detail::single_block_select_if<SelectOp>{select_op},
+                stream);
+        }
         return ::rocprim::select(d_temp_storage,
                                  temp_storage_bytes,
                                  d_in,
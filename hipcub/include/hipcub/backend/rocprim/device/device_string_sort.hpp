@@ -0,0 +1,603 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HIPCUB_ROCPRIM_DEVICE_DEVICE_STRING_SORT_HPP_
+#define HIPCUB_ROCPRIM_DEVICE_DEVICE_STRING_SORT_HPP_
+
+#include "../../../config.hpp"
+
+#include "../block/block_reduce.hpp"
+#include "../util_sync.hpp"
+#include "../util_temporary_storage.hpp"
+
+#include <rocprim/detail/various.hpp>
+#include <rocprim/device/device_radix_sort.hpp>
+#include <rocprim/device/device_run_length_encode.hpp>
+#include <rocprim/device/device_scan.hpp>
+#include <rocprim/device/device_segmented_radix_sort.hpp>
+#include <rocprim/functional.hpp>
+#include <rocprim/intrinsics.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+BEGIN_HIPCUB_NAMESPACE
+
+namespace detail
+{
+
+/// Every level sorts 7 characters of the strings in the most significant bytes of a 64-bit
+/// prefix key. The least significant byte is the number of characters left in the string, capped
+/// at 8, so a string that ends within the prefix sorts before the strings it is a prefix of, and
+/// a value of 8 marks a string that continues after the prefix.
+static constexpr unsigned int string_sort_block_size      = 256;
+static constexpr unsigned int string_sort_prefix_chars    = 7;
+static constexpr unsigned int string_sort_continues_value = 8;
+
+/// Run detection key of a sorted prefix. Strings with equal prefixes form a run only within
+/// their segment, and strings that ended are given a unique tag so they never form one.
+struct string_sort_run_key
+{
+    uint64_t prefix;
+    uint64_t tag;
+
+    HIPCUB_HOST_DEVICE HIPCUB_FORCEINLINE bool operator==(const string_sort_run_key& other) const
+    {
+        return prefix == other.prefix && tag == other.tag;
+    }
+
+    HIPCUB_HOST_DEVICE HIPCUB_FORCEINLINE bool operator!=(const string_sort_run_key& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+/// Returns the global index of the calling thread in a one-dimensional grid.
+HIPCUB_DEVICE HIPCUB_FORCEINLINE unsigned int string_sort_index()
+{
+    return ::rocprim::detail::block_id<0>() * string_sort_block_size
+           + ::rocprim::detail::block_thread_id<0>();
+}
+
+template<class IndexT>
+__global__ __launch_bounds__(string_sort_block_size) void string_sort_sequence_kernel(
+    IndexT* indices, unsigned int size)
+{
+    const unsigned int i = string_sort_index();
+    if(i < size)
+    {
+        indices[i] = static_cast<IndexT>(i);
+    }
+}
+
+/// Builds the prefix key of the characters <tt>[depth, depth + 7)</tt> of the string at every
+/// unresolved position of the permutation.
+template<class OffsetT, class IndexT>
+__global__ __launch_bounds__(string_sort_block_size) void string_sort_prefix_kernel(
+    const char*         chars,
+    const OffsetT*      offsets,
+    size_t              depth,
+    const IndexT*       permutation,
+    const unsigned int* positions,
+    uint64_t*           keys,
+    unsigned int        size)
+{
+    const unsigned int i = string_sort_index();
+    if(i >= size)
+    {
+        return;
+    }
+
+    const size_t row       = static_cast<size_t>(permutation[positions[i]]);
+    const size_t begin     = static_cast<size_t>(offsets[row]);
+    const size_t length    = static_cast<size_t>(offsets[row + 1]) - begin;
+    const size_t remaining = length > depth ? length - depth : 0;
+
+    const unsigned char* string = reinterpret_cast<const unsigned char*>(chars) + begin + depth;
+
+    uint64_t key = 0;
+    for(unsigned int c = 0; c < string_sort_prefix_chars; c++)
+    {
+        key = (key << 8) | (c < remaining ? string[c] : 0u);
+    }
+    keys[i] = (key << 8) | ::rocprim::min<size_t>(remaining, string_sort_continues_value);
+}
+
+/// Reads the rows of the unresolved positions in their sorted order. The rows are read from the
+/// permutation before any of them is overwritten by the scatter kernel.
+template<class IndexT>
+__global__ __launch_bounds__(string_sort_block_size) void string_sort_reorder_kernel(
+    const IndexT*       permutation,
+    const unsigned int* positions,
+    const unsigned int* order,
+    IndexT*             rows,
+    unsigned int        size)
+{
+    const unsigned int i = string_sort_index();
+    if(i < size)
+    {
+        rows[i] = permutation[positions[order[i]]];
+    }
+}
+
+/// Writes the sorted rows back to their positions and builds the run keys. Strings that continue
+/// and share their prefix with a neighbour of the same segment are unresolved, they are counted
+/// in \p unresolved_count.
+template<class IndexT>
+__global__ __launch_bounds__(string_sort_block_size) void string_sort_scatter_kernel(
+    IndexT*              permutation,
+    const unsigned int*  positions,
+    const IndexT*        rows,
+    const uint64_t*      sorted_keys,
+    const unsigned int*  segments,
+    string_sort_run_key* run_keys,
+    unsigned int*        unresolved_count,
+    unsigned int         size)
+{
+    using block_reduce_type = BlockReduce<unsigned int, string_sort_block_size>;
+
+    __shared__ ::rocprim::detail::raw_storage<typename block_reduce_type::TempStorage> storage;
+
+    const unsigned int i = string_sort_index();
+
+    unsigned int unresolved = 0;
+    if(i < size)
+    {
+        permutation[positions[i]] = rows[i];
+
+        const uint64_t     key      = sorted_keys[i];
+        const unsigned int segment  = segments == nullptr ? 0 : segments[i];
+        const bool         finished = (key & 0xFF) < string_sort_continues_value;
+        run_keys[i] = string_sort_run_key{key, finished ? uint64_t(size) + i : uint64_t(segment)};
+
+        auto same_run = [&](unsigned int j)
+        {
+            return sorted_keys[j] == key && (segments == nullptr || segments[j] == segment);
+        };
+        unresolved
+            = !finished && ((i > 0 && same_run(i - 1)) || (i + 1 < size && same_run(i + 1)));
+    }
+
+    unresolved = block_reduce_type(storage.get()).Sum(unresolved);
+    if(::rocprim::detail::block_thread_id<0>() == 0 && unresolved != 0)
+    {
+        atomicAdd(unresolved_count, unresolved);
+    }
+}
+
+/// Enumerates the positions of the runs of equal prefixes for the next level. Run \p s covers the
+/// items <tt>[bounds[s], bounds[s + 1])</tt> of the next level, which are the items from
+/// <tt>run_offsets[s]</tt> on of the current level.
+static __global__ __launch_bounds__(string_sort_block_size) void string_sort_segments_kernel(
+    const unsigned int* positions,
+    const unsigned int* run_offsets,
+    const unsigned int* bounds,
+    unsigned int        num_runs,
+    unsigned int*       next_positions,
+    unsigned int*       segments,
+    unsigned int        size)
+{
+    const unsigned int i = string_sort_index();
+    if(i >= size)
+    {
+        return;
+    }
+
+    unsigned int low  = 0;
+    unsigned int high = num_runs;
+    while(high - low > 1)
+    {
+        const unsigned int middle = low + (high - low) / 2;
+        if(bounds[middle] <= i)
+        {
+            low = middle;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    next_positions[i] = positions[run_offsets[low] + (i - bounds[low])];
+    segments[i]       = low;
+}
+
+template<class IndexT>
+inline hipError_t
+    string_sort_storage_bytes(size_t& storage_bytes, unsigned int size, unsigned int max_runs)
+{
+    size_t sort_bytes           = 0;
+    size_t segmented_sort_bytes = 0;
+    size_t encode_bytes         = 0;
+    size_t scan_bytes           = 0;
+
+    hipError_t error = ::rocprim::radix_sort_pairs(nullptr,
+                                                   sort_bytes,
+                                                   static_cast<uint64_t*>(nullptr),
+                                                   static_cast<uint64_t*>(nullptr),
+                                                   static_cast<const unsigned int*>(nullptr),
+                                                   static_cast<unsigned int*>(nullptr),
+                                                   size);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    error = ::rocprim::segmented_radix_sort_pairs(nullptr,
+                                                  segmented_sort_bytes,
+                                                  static_cast<uint64_t*>(nullptr),
+                                                  static_cast<uint64_t*>(nullptr),
+                                                  static_cast<const unsigned int*>(nullptr),
+                                                  static_cast<unsigned int*>(nullptr),
+                                                  size,
+                                                  max_runs,
+                                                  static_cast<const unsigned int*>(nullptr),
+                                                  static_cast<const unsigned int*>(nullptr));
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    error = ::rocprim::run_length_encode_non_trivial_runs(
+        nullptr,
+        encode_bytes,
+        static_cast<const string_sort_run_key*>(nullptr),
+        size,
+        static_cast<unsigned int*>(nullptr),
+        static_cast<unsigned int*>(nullptr),
+        static_cast<unsigned int*>(nullptr));
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    error = ::rocprim::inclusive_scan(nullptr,
+                                      scan_bytes,
+                                      static_cast<const unsigned int*>(nullptr),
+                                      static_cast<unsigned int*>(nullptr),
+                                      max_runs,
+                                      ::rocprim::plus<unsigned int>());
+    storage_bytes = std::max({sort_bytes, segmented_sort_bytes, encode_bytes, scan_bytes});
+    return error;
+}
+
+/// The first level sorts all strings by their first prefix with a radix sort. The runs of equal
+/// prefixes of strings that continue are found with a run-length encoding and copied back, which
+/// synchronizes the stream once per level, and every further level sorts only the strings of
+/// these runs by their next prefix with a segmented radix sort, one segment per run.
+template<class OffsetT, class IndexT>
+inline hipError_t string_sort(void*          d_temp_storage,
+                              size_t&        temp_storage_bytes,
+                              const char*    chars,
+                              const OffsetT* offsets,
+                              IndexT*        indices_output,
+                              int            num_strings,
+                              hipStream_t    stream)
+{
+    const unsigned int size     = num_strings > 0 ? static_cast<unsigned int>(num_strings) : 0u;
+    const unsigned int max_runs = std::max(size / 2, 1u);
+
+    size_t     storage_bytes = 0;
+    hipError_t error         = string_sort_storage_bytes<IndexT>(storage_bytes, size, max_runs);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    // Storage, sequence, two position buffers, segments, keys, sorted keys, order, rows, run
+    // keys, run offsets, run lengths, run bounds and the counts of runs and unresolved strings
+    void*  allocations[14]      = {};
+    size_t allocation_sizes[14] = {storage_bytes,
+                                   size * sizeof(unsigned int),
+                                   size * sizeof(unsigned int),
+                                   size * sizeof(unsigned int),
+                                   size * sizeof(unsigned int),
+                                   size * sizeof(uint64_t),
+                                   size * sizeof(uint64_t),
+                                   size * sizeof(unsigned int),
+                                   size * sizeof(IndexT),
+                                   size * sizeof(string_sort_run_key),
+                                   max_runs * sizeof(unsigned int),
+                                   max_runs * sizeof(unsigned int),
+                                   (max_runs + 1) * sizeof(unsigned int),
+                                   2 * sizeof(unsigned int)};
+    error = AliasTemporaries(d_temp_storage, temp_storage_bytes, allocations, allocation_sizes);
+    if(error != hipSuccess || d_temp_storage == nullptr || size == 0)
+    {
+        return error;
+    }
+
+    unsigned int*        d_sequence     = static_cast<unsigned int*>(allocations[1]);
+    unsigned int*        d_positions[2] = {static_cast<unsigned int*>(allocations[2]),
+                                           static_cast<unsigned int*>(allocations[3])};
+    unsigned int*        d_segments     = static_cast<unsigned int*>(allocations[4]);
+    uint64_t*            d_keys         = static_cast<uint64_t*>(allocations[5]);
+    uint64_t*            d_sorted_keys  = static_cast<uint64_t*>(allocations[6]);
+    unsigned int*        d_order        = static_cast<unsigned int*>(allocations[7]);
+    IndexT*              d_rows         = static_cast<IndexT*>(allocations[8]);
+    string_sort_run_key* d_run_keys     = static_cast<string_sort_run_key*>(allocations[9]);
+    unsigned int*        d_run_offsets  = static_cast<unsigned int*>(allocations[10]);
+    unsigned int*        d_run_lengths  = static_cast<unsigned int*>(allocations[11]);
+    unsigned int*        d_bounds       = static_cast<unsigned int*>(allocations[12]);
+    unsigned int*        d_counts       = static_cast<unsigned int*>(allocations[13]);
+
+    const unsigned int grid_size = ::rocprim::detail::ceiling_div(size, string_sort_block_size);
+
+    std::chrono::high_resolution_clock::time_point start;
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(string_sort_sequence_kernel),
+                       dim3(grid_size),
+                       dim3(string_sort_block_size),
+                       0,
+                       stream,
+                       indices_output,
+                       size);
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("string_sort_sequence_kernel", size, start);
+
+    if(size == 1)
+    {
+        return hipSuccess;
+    }
+
+    if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+    {
+        start = std::chrono::high_resolution_clock::now();
+    }
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(string_sort_sequence_kernel),
+                       dim3(grid_size),
+                       dim3(string_sort_block_size),
+                       0,
+                       stream,
+                       d_sequence,
+                       size);
+    HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("string_sort_sequence_kernel", size, start);
+
+    // The bounds of the runs start at zero
+    error = hipMemsetAsync(d_bounds, 0, sizeof(unsigned int), stream);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+
+    // The first level sorts every string in one segment
+    const unsigned int* positions    = d_sequence;
+    const unsigned int* segments     = nullptr;
+    unsigned int        items        = size;
+    unsigned int        num_segments = 1;
+    for(size_t depth = 0;; depth += string_sort_prefix_chars)
+    {
+        const unsigned int level_grid_size
+            = ::rocprim::detail::ceiling_div(items, string_sort_block_size);
+
+        if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+        {
+            start = std::chrono::high_resolution_clock::now();
+        }
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(string_sort_prefix_kernel),
+                           dim3(level_grid_size),
+                           dim3(string_sort_block_size),
+                           0,
+                           stream,
+                           chars,
+                           offsets,
+                           depth,
+                           indices_output,
+                           positions,
+                           d_keys,
+                           items);
+        HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("string_sort_prefix_kernel", items, start);
+
+        if(segments == nullptr)
+        {
+            error = ::rocprim::radix_sort_pairs(allocations[0],
+                                                storage_bytes,
+                                                d_keys,
+                                                d_sorted_keys,
+                                                d_sequence,
+                                                d_order,
+                                                items,
+                                                0,
+                                                64,
+                                                stream,
+                                                HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+        }
+        else
+        {
+            error = ::rocprim::segmented_radix_sort_pairs(allocations[0],
+                                                          storage_bytes,
+                                                          d_keys,
+                                                          d_sorted_keys,
+                                                          d_sequence,
+                                                          d_order,
+                                                          items,
+                                                          num_segments,
+                                                          d_bounds,
+                                                          d_bounds + 1,
+                                                          0,
+                                                          64,
+                                                          stream,
+                                                          HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+        }
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+
+        if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+        {
+            start = std::chrono::high_resolution_clock::now();
+        }
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(string_sort_reorder_kernel),
+                           dim3(level_grid_size),
+                           dim3(string_sort_block_size),
+                           0,
+                           stream,
+                           indices_output,
+                           positions,
+                           d_order,
+                           d_rows,
+                           items);
+        HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("string_sort_reorder_kernel", items, start);
+
+        error = hipMemsetAsync(d_counts, 0, 2 * sizeof(unsigned int), stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+
+        if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+        {
+            start = std::chrono::high_resolution_clock::now();
+        }
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(string_sort_scatter_kernel),
+                           dim3(level_grid_size),
+                           dim3(string_sort_block_size),
+                           0,
+                           stream,
+                           indices_output,
+                           positions,
+                           d_rows,
+                           d_sorted_keys,
+                           segments,
+                           d_run_keys,
+                           d_counts + 1,
+                           items);
+        HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("string_sort_scatter_kernel", items, start);
+
+        error = ::rocprim::run_length_encode_non_trivial_runs(allocations[0],
+                                                              storage_bytes,
+                                                              d_run_keys,
+                                                              items,
+                                                              d_run_offsets,
+                                                              d_run_lengths,
+                                                              d_counts,
+                                                              stream,
+                                                              HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+
+        unsigned int counts[2] = {};
+        error                  = hipMemcpyAsync(counts,
+                                                d_counts,
+                                                2 * sizeof(unsigned int),
+                                                hipMemcpyDeviceToHost,
+                                                stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        error = hipStreamSynchronize(stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        if(counts[0] == 0)
+        {
+            break;
+        }
+
+        error = ::rocprim::inclusive_scan(allocations[0],
+                                          storage_bytes,
+                                          d_run_lengths,
+                                          d_bounds + 1,
+                                          counts[0],
+                                          ::rocprim::plus<unsigned int>(),
+                                          stream,
+                                          HIPCUB_DETAIL_DEBUG_SYNC_VALUE);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+
+        unsigned int* next_positions
+            = positions == d_positions[0] ? d_positions[1] : d_positions[0];
+
+        if HIPCUB_IF_CONSTEXPR(HIPCUB_DETAIL_DEBUG_SYNC_VALUE)
+        {
+            start = std::chrono::high_resolution_clock::now();
+        }
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(string_sort_segments_kernel),
+                           dim3(::rocprim::detail::ceiling_div(counts[1], string_sort_block_size)),
+                           dim3(string_sort_block_size),
+                           0,
+                           stream,
+                           positions,
+                           d_run_offsets,
+                           d_bounds,
+                           counts[0],
+                           next_positions,
+                           d_segments,
+                           counts[1]);
+        HIPCUB_DETAIL_HIP_SYNC_AND_RETURN_ON_ERROR("string_sort_segments_kernel",
+                                                   counts[1],
+                                                   start);
+
+        positions    = next_positions;
+        segments     = d_segments;
+        items        = counts[1];
+        num_segments = counts[0];
+    }
+
+    return hipSuccess;
+}
+
+} // namespace detail
+
+/// \brief Sorts variable-length strings stored as a character buffer and offsets.
+///
+/// String \p i is the characters <tt>[d_offsets[i], d_offsets[i + 1])</tt> of \p d_chars, so
+/// \p d_offsets holds <tt>num_strings + 1</tt> offsets. Strings compare lexicographically by
+/// their characters as unsigned values, a string sorts before the longer strings it is a prefix
+/// of, and equal strings keep their order.
+struct DeviceStringSort
+{
+    /// \brief Computes the permutation that sorts the strings.
+    ///
+    /// The strings are sorted by prefix keys of 7 characters. Runs of strings with equal prefixes
+    /// are detected with a run-length encoding and only these runs are refined by the next
+    /// prefix, with one segment per run. The number of runs is copied back after every prefix,
+    /// which synchronizes \p stream, so strings that differ early take a single sort.
+    template<typename OffsetT, typename IndexT>
+    HIPCUB_RUNTIME_FUNCTION static hipError_t ArgSort(void*          d_temp_storage,
+                                                      size_t&        temp_storage_bytes,
+                                                      const char*    d_chars,
+                                                      const OffsetT* d_offsets,
+                                                      IndexT*        d_indices_out,
+                                                      int            num_strings,
+                                                      hipStream_t    stream = 0)
+    {
+        return detail::string_sort(d_temp_storage,
+                                   temp_storage_bytes,
+                                   d_chars,
+                                   d_offsets,
+                                   d_indices_out,
+                                   num_strings,
+                                   stream);
+    }
+};
+
+END_HIPCUB_NAMESPACE
+
+#endif // HIPCUB_ROCPRIM_DEVICE_DEVICE_STRING_SORT_HPP_
@@ -51,20 +51,31 @@
 
 // Device
 #include "device/device_adjacent_difference.hpp"
+#include "device/device_batched.hpp"
 #include "device/device_copy.hpp"
+#include "device/device_distinct.hpp"
+#include "device/device_find.hpp"
+#include "device/device_group_by.hpp"
 #include "device/device_histogram.hpp"
 #include "device/device_memcpy.hpp"
+#include "device/device_merge.hpp"
 #include "device/device_merge_sort.hpp"
 #include "device/device_partition.hpp"
 #include "device/device_radix_sort.hpp"
 #include "device/device_reduce.hpp"
+#include "device/device_run_length_decode.hpp"
 #include "device/device_run_length_encode.hpp"
 #include "device/device_scan.hpp"
+#include "device/device_segmented_histogram.hpp"
 #include "device/device_segmented_radix_sort.hpp"
 #include "device/device_segmented_reduce.hpp"
+#include "device/device_segmented_scan.hpp"
 #include "device/device_segmented_sort.hpp"
+#include "device/device_segmented_topk.hpp"
 #include "device/device_select.hpp"
+#include "device/device_set_operations.hpp"
 #include "device/device_spmv.hpp"
+#include "device/device_string_sort.hpp"
 
 // Grid
 #include "grid/grid_barrier.hpp"
@@ -84,6 +95,7 @@
 #include "iterator/transform_input_iterator.hpp"
 
 // Thread
+#include "thread/thread_accumulators.hpp"
 #include "thread/thread_load.hpp"
 #include "thread/thread_operators.hpp"
 #include "thread/thread_reduce.hpp"
@@ -24,6 +24,7 @@
 
 // hipcub API
 #include "hipcub/block/block_reduce.hpp"
+#include "hipcub/thread/thread_accumulators.hpp"
 #include "hipcub/thread/thread_operators.hpp"
 
 // Params for tests
@@ -519,3 +520,80 @@ TYPED_TEST(HipcubBlockReduceInputArrayTests, Reduce)
         HIP_CHECK(hipFree(device_output_reductions));
     }
 }
+
+template<unsigned int BlockSize, class T>
+__global__
+__launch_bounds__(BlockSize)
+void compensated_reduce_kernel(const T* device_input, float* device_output_reductions)
+{
+    using accumulator_type = hipcub::CompensatedSumAccumulator<float>;
+    using breduce_t        = hipcub::BlockReduce<accumulator_type, BlockSize>;
+    __shared__ typename breduce_t::TempStorage temp_storage;
+
+    const unsigned int index = (hipBlockIdx_x * BlockSize) + hipThreadIdx_x;
+    const accumulator_type value(device_input[index]);
+    const accumulator_type reduction
+        = breduce_t(temp_storage).Reduce(value, hipcub::CompensatedSumOp());
+    if(hipThreadIdx_x == 0)
+    {
+        device_output_reductions[hipBlockIdx_x] = reduction.Value();
+    }
+}
+
+TEST(HipcubBlockReduceAccumulatorTests, CompensatedSum)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = test_utils::half;
+    constexpr unsigned int block_size = 256;
+    constexpr size_t       grid_size  = 113;
+    constexpr size_t       size       = block_size * grid_size;
+
+    for (size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value = seed_index < random_seeds_count  ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        // Half inputs reduced in a float accumulator with its rounding error
+        std::vector<T> input = test_utils::get_random_data<T>(size, 0, 2, seed_value);
+        std::vector<double> expected_reductions(grid_size, 0.0);
+        for(size_t i = 0; i < size; i++)
+        {
+            expected_reductions[i / block_size]
+                += static_cast<double>(test_utils::convert_to_native(input[i]));
+        }
+
+        T* device_input;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&device_input, size * sizeof(T)));
+        float* device_output_reductions;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&device_output_reductions, grid_size * sizeof(float)));
+        HIP_CHECK(hipMemcpy(device_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(compensated_reduce_kernel<block_size, T>),
+            dim3(grid_size), dim3(block_size), 0, 0,
+            device_input, device_output_reductions
+        );
+        HIP_CHECK(hipGetLastError());
+
+        std::vector<float> output_reductions(grid_size);
+        HIP_CHECK(
+            hipMemcpy(
+                output_reductions.data(), device_output_reductions,
+                grid_size * sizeof(float),
+                hipMemcpyDeviceToHost
+            )
+        );
+
+        for(size_t i = 0; i < grid_size; i++)
+        {
+            ASSERT_NEAR(output_reductions[i], expected_reductions[i], 1e-6 * expected_reductions[i])
+                << "with block= " << i;
+        }
+
+        HIP_CHECK(hipFree(device_input));
+        HIP_CHECK(hipFree(device_output_reductions));
+    }
+}
@@ -0,0 +1,542 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "common_test_header.hpp"
+
+// hipcub API
+#include "hipcub/device/device_batched.hpp"
+
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+template<class T, int MaxProblemSize, bool FixedSize>
+struct params
+{
+    using type                             = T;
+    static constexpr int  max_problem_size = MaxProblemSize;
+    static constexpr bool fixed_size       = FixedSize;
+};
+
+template<class Params>
+class HipcubDeviceBatched : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+// Covers problems handled by a single pass of a warp, problems a warp loops over and sorts
+// done by warps (<= 128 items) and by blocks.
+typedef ::testing::Types<params<int, 1, false>,
+                         params<int, 32, false>,
+                         params<unsigned int, 100, true>,
+                         params<short, 128, false>,
+                         params<long long, 500, false>,
+                         params<unsigned char, 129, true>,
+                         params<int, 2048, false>,
+                         params<unsigned long long, 2048, true>>
+    Params;
+
+TYPED_TEST_SUITE(HipcubDeviceBatched, Params);
+
+// Problems of random sizes (or of max_problem_size with the fixed size overloads) stored back to
+// back in one allocation, every problem starts at offsets[i].
+struct batched_problems
+{
+    std::vector<int>    sizes;
+    std::vector<size_t> offsets;
+    size_t              total_size;
+};
+
+template<bool FixedSize>
+batched_problems get_batched_problems(int num_problems, int max_problem_size, unsigned int seed)
+{
+    std::default_random_engine         gen(seed);
+    std::uniform_int_distribution<int> size_dis(0, max_problem_size);
+
+    batched_problems problems;
+    problems.total_size = 0;
+    for(int i = 0; i < num_problems; i++)
+    {
+        const int size = FixedSize ? max_problem_size : size_dis(gen);
+        problems.sizes.push_back(size);
+        problems.offsets.push_back(problems.total_size);
+        problems.total_size += size;
+    }
+    return problems;
+}
+
+// Device array of the pointers to the problems in d_base
+template<class T>
+T** get_problem_pointers(T* d_base, const batched_problems& problems)
+{
+    std::vector<T*> pointers;
+    for(size_t offset : problems.offsets)
+    {
+        pointers.push_back(d_base + offset);
+    }
+
+    T** d_pointers;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_pointers, (pointers.size() + 1) * sizeof(T*)));
+    HIP_CHECK(hipMemcpy(d_pointers,
+                        pointers.data(),
+                        pointers.size() * sizeof(T*),
+                        hipMemcpyHostToDevice));
+    return d_pointers;
+}
+
+const std::vector<int> batched_num_problems = {0, 1, 7, 100, 1000};
+
+TYPED_TEST(HipcubDeviceBatched, Reduce)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                         = typename TestFixture::params::type;
+    using U                         = long long;
+    constexpr int  max_problem_size = TestFixture::params::max_problem_size;
+    constexpr bool fixed_size       = TestFixture::params::fixed_size;
+
+    hipStream_t stream = 0;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(int num_problems : batched_num_problems)
+        {
+            SCOPED_TRACE(testing::Message() << "with num_problems= " << num_problems);
+
+            const batched_problems problems
+                = get_batched_problems<fixed_size>(num_problems, max_problem_size, seed_value);
+            const std::vector<T> input
+                = test_utils::get_random_data<T>(problems.total_size, 0, 100, seed_value);
+
+            T*   d_input;
+            U*   d_output;
+            int* d_sizes;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_input, (input.size() + 1) * sizeof(T)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_output, (num_problems + 1) * sizeof(U)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_sizes, (num_problems + 1) * sizeof(int)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), input.size() * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_sizes,
+                                problems.sizes.data(),
+                                num_problems * sizeof(int),
+                                hipMemcpyHostToDevice));
+            T** d_inputs = get_problem_pointers(d_input, problems);
+
+            const U init = 5;
+            auto    run  = [&](void* d_temp_storage, size_t& temp_storage_bytes)
+            {
+                if(fixed_size)
+                {
+                    return hipcub::DeviceBatched::ReduceFixedSize(d_temp_storage,
+                                                                  temp_storage_bytes,
+                                                                  d_input,
+                                                                  d_output,
+                                                                  max_problem_size,
+                                                                  num_problems,
+                                                                  hipcub::Sum(),
+                                                                  init,
+                                                                  stream);
+                }
+                return hipcub::DeviceBatched::Reduce(d_temp_storage,
+                                                     temp_storage_bytes,
+                                                     d_inputs,
+                                                     d_output,
+                                                     d_sizes,
+                                                     num_problems,
+                                                     hipcub::Sum(),
+                                                     init,
+                                                     stream);
+            };
+
+            size_t temp_storage_bytes = 0;
+            HIP_CHECK(run(nullptr, temp_storage_bytes));
+            ASSERT_GT(temp_storage_bytes, 0U);
+
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_bytes));
+            HIP_CHECK(run(d_temp_storage, temp_storage_bytes));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<U> output(num_problems);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                num_problems * sizeof(U),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temp_storage));
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_sizes));
+            HIP_CHECK(hipFree(d_inputs));
+
+            for(int problem = 0; problem < num_problems; problem++)
+            {
+                const auto first = input.begin() + problems.offsets[problem];
+                const U expected = std::accumulate(first, first + problems.sizes[problem], init);
+                ASSERT_EQ(output[problem], expected) << "with problem= " << problem;
+            }
+        }
+    }
+}
+
+TYPED_TEST(HipcubDeviceBatched, Scan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T                         = typename TestFixture::params::type;
+    constexpr int  max_problem_size = TestFixture::params::max_problem_size;
+    constexpr bool fixed_size       = TestFixture::params::fixed_size;
+
+    hipStream_t stream = 0;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(int num_problems : batched_num_problems)
+        {
+            SCOPED_TRACE(testing::Message() << "with num_problems= " << num_problems);
+
+            const batched_problems problems
+                = get_batched_problems<fixed_size>(num_problems, max_problem_size, seed_value);
+            // Maximum is the operator so the results stay in range of the small types
+            const std::vector<T> input
+                = test_utils::get_random_data<T>(problems.total_size, 0, 100, seed_value);
+
+            T*   d_input;
+            T*   d_output;
+            int* d_sizes;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                         (input.size() + 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                         (input.size() + 1) * sizeof(T)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_sizes, (num_problems + 1) * sizeof(int)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), input.size() * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_sizes,
+                                problems.sizes.data(),
+                                num_problems * sizeof(int),
+                                hipMemcpyHostToDevice));
+            T** d_inputs  = get_problem_pointers(d_input, problems);
+            T** d_outputs = get_problem_pointers(d_output, problems);
+
+            for(bool exclusive : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with exclusive= " << exclusive);
+
+                const T init = 50;
+                auto    run  = [&](void* d_temp_storage, size_t& temp_storage_bytes)
+                {
+                    if(exclusive && fixed_size)
+                    {
+                        return hipcub::DeviceBatched::ExclusiveScanFixedSize(d_temp_storage,
+                                                                             temp_storage_bytes,
+                                                                             d_input,
+                                                                             d_output,
+                                                                             max_problem_size,
+                                                                             num_problems,
+                                                                             hipcub::Max(),
+                                                                             init,
+                                                                             stream);
+                    }
+                    else if(exclusive)
+                    {
+                        return hipcub::DeviceBatched::ExclusiveScan(d_temp_storage,
+                                                                    temp_storage_bytes,
+                                                                    d_inputs,
+                                                                    d_outputs,
+                                                                    d_sizes,
+                                                                    num_problems,
+                                                                    hipcub::Max(),
+                                                                    init,
+                                                                    stream);
+                    }
+                    else if(fixed_size)
+                    {
+                        return hipcub::DeviceBatched::InclusiveScanFixedSize(d_temp_storage,
+                                                                             temp_storage_bytes,
+                                                                             d_input,
+                                                                             d_output,
+                                                                             max_problem_size,
+                                                                             num_problems,
+                                                                             hipcub::Max(),
+                                                                             stream);
+                    }
+                    return hipcub::DeviceBatched::InclusiveScan(d_temp_storage,
+                                                                temp_storage_bytes,
+                                                                d_inputs,
+                                                                d_outputs,
+                                                                d_sizes,
+                                                                num_problems,
+                                                                hipcub::Max(),
+                                                                stream);
+                };
+
+                size_t temp_storage_bytes = 0;
+                HIP_CHECK(run(nullptr, temp_storage_bytes));
+                ASSERT_GT(temp_storage_bytes, 0U);
+
+                void* d_temp_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_bytes));
+                HIP_CHECK(run(d_temp_storage, temp_storage_bytes));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+                HIP_CHECK(hipFree(d_temp_storage));
+
+                std::vector<T> output(input.size());
+                HIP_CHECK(hipMemcpy(output.data(),
+                                    d_output,
+                                    output.size() * sizeof(T),
+                                    hipMemcpyDeviceToHost));
+
+                for(int problem = 0; problem < num_problems; problem++)
+                {
+                    SCOPED_TRACE(testing::Message() << "with problem= " << problem);
+
+                    const size_t offset = problems.offsets[problem];
+                    T            carry  = init;
+                    for(int i = 0; i < problems.sizes[problem]; i++)
+                    {
+                        const T item = input[offset + i];
+                        if(exclusive)
+                        {
+                            ASSERT_EQ(output[offset + i], carry) << "with index= " << i;
+                            carry = std::max(carry, item);
+                        }
+                        else
+                        {
+                            carry = i == 0 ? item : std::max(carry, item);
+                            ASSERT_EQ(output[offset + i], carry) << "with index= " << i;
+                        }
+                    }
+                }
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_sizes));
+            HIP_CHECK(hipFree(d_inputs));
+            HIP_CHECK(hipFree(d_outputs));
+        }
+    }
+}
+
+TYPED_TEST(HipcubDeviceBatched, Sort)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                  = typename TestFixture::params::type;
+    using value_type                = unsigned int;
+    constexpr int  max_problem_size = TestFixture::params::max_problem_size;
+    constexpr bool fixed_size       = TestFixture::params::fixed_size;
+
+    hipStream_t stream = 0;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(int num_problems : batched_num_problems)
+        {
+            SCOPED_TRACE(testing::Message() << "with num_problems= " << num_problems);
+
+            const batched_problems problems
+                = get_batched_problems<fixed_size>(num_problems, max_problem_size, seed_value);
+            // Small key range to get many equal keys
+            const std::vector<key_type> keys_input
+                = test_utils::get_random_data<key_type>(problems.total_size, 0, 20, seed_value);
+            std::vector<value_type> values_input(problems.total_size);
+            std::iota(values_input.begin(), values_input.end(), 0);
+
+            key_type*   d_keys_input;
+            key_type*   d_keys_output;
+            value_type* d_values_input;
+            value_type* d_values_output;
+            int*        d_sizes;
+            const size_t size = problems.total_size;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_keys_input, (size + 1) * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_keys_output, (size + 1) * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                         (size + 1) * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                         (size + 1) * sizeof(value_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_sizes, (num_problems + 1) * sizeof(int)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_sizes,
+                                problems.sizes.data(),
+                                num_problems * sizeof(int),
+                                hipMemcpyHostToDevice));
+            key_type**   d_keys_inputs    = get_problem_pointers(d_keys_input, problems);
+            key_type**   d_keys_outputs   = get_problem_pointers(d_keys_output, problems);
+            value_type** d_values_inputs  = get_problem_pointers(d_values_input, problems);
+            value_type** d_values_outputs = get_problem_pointers(d_values_output, problems);
+
+            for(bool with_values : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with with_values= " << with_values);
+
+                auto run = [&](void* d_temp_storage, size_t& temp_storage_bytes)
+                {
+                    if(with_values && fixed_size)
+                    {
+                        return hipcub::DeviceBatched::SortPairsFixedSize(d_temp_storage,
+                                                                         temp_storage_bytes,
+                                                                         d_keys_input,
+                                                                         d_keys_output,
+                                                                         d_values_input,
+                                                                         d_values_output,
+                                                                         max_problem_size,
+                                                                         num_problems,
+                                                                         hipcub::Less(),
+                                                                         stream);
+                    }
+                    else if(with_values)
+                    {
+                        return hipcub::DeviceBatched::SortPairs(d_temp_storage,
+                                                                temp_storage_bytes,
+                                                                d_keys_inputs,
+                                                                d_keys_outputs,
+                                                                d_values_inputs,
+                                                                d_values_outputs,
+                                                                d_sizes,
+                                                                num_problems,
+                                                                max_problem_size,
+                                                                hipcub::Less(),
+                                                                stream);
+                    }
+                    else if(fixed_size)
+                    {
+                        return hipcub::DeviceBatched::SortKeysFixedSize(d_temp_storage,
+                                                                        temp_storage_bytes,
+                                                                        d_keys_input,
+                                                                        d_keys_output,
+                                                                        max_problem_size,
+                                                                        num_problems,
+                                                                        hipcub::Less(),
+                                                                        stream);
+                    }
+                    return hipcub::DeviceBatched::SortKeys(d_temp_storage,
+                                                           temp_storage_bytes,
+                                                           d_keys_inputs,
+                                                           d_keys_outputs,
+                                                           d_sizes,
+                                                           num_problems,
+                                                           max_problem_size,
+                                                           hipcub::Less(),
+                                                           stream);
+                };
+
+                size_t temp_storage_bytes = 0;
+                HIP_CHECK(run(nullptr, temp_storage_bytes));
+                ASSERT_GT(temp_storage_bytes, 0U);
+
+                void* d_temp_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_bytes));
+                HIP_CHECK(run(d_temp_storage, temp_storage_bytes));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+                HIP_CHECK(hipFree(d_temp_storage));
+
+                std::vector<key_type>   keys_output(size);
+                std::vector<value_type> values_output(size);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys_output,
+                                    size * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(values_output.data(),
+                                    d_values_output,
+                                    size * sizeof(value_type),
+                                    hipMemcpyDeviceToHost));
+
+                for(int problem = 0; problem < num_problems; problem++)
+                {
+                    SCOPED_TRACE(testing::Message() << "with problem= " << problem);
+
+                    const size_t offset = problems.offsets[problem];
+                    std::vector<std::pair<key_type, value_type>> expected;
+                    for(int i = 0; i < problems.sizes[problem]; i++)
+                    {
+                        expected.emplace_back(keys_input[offset + i], values_input[offset + i]);
+                    }
+                    std::stable_sort(expected.begin(),
+                                     expected.end(),
+                                     [](const auto& a, const auto& b)
+                                     { return a.first < b.first; });
+
+                    for(size_t i = 0; i < expected.size(); i++)
+                    {
+                        ASSERT_EQ(keys_output[offset + i], expected[i].first)
+                            << "with index= " << i;
+                        if(with_values)
+                        {
+                            ASSERT_EQ(values_output[offset + i], expected[i].second)
+                                << "with index= " << i;
+                        }
+                    }
+                }
+            }
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_values_output));
+            HIP_CHECK(hipFree(d_sizes));
+            HIP_CHECK(hipFree(d_keys_inputs));
+            HIP_CHECK(hipFree(d_keys_outputs));
+            HIP_CHECK(hipFree(d_values_inputs));
+            HIP_CHECK(hipFree(d_values_outputs));
+        }
+    }
+}
@@ -0,0 +1,342 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "common_test_header.hpp"
+
+// hipcub API
+#include "hipcub/device/device_distinct.hpp"
+
+#include "test_utils_data_generation.hpp"
+
+#include <cmath>
+#include <limits>
+#include <map>
+#include <vector>
+
+template<class Key, int MaxValue>
+struct params
+{
+    using key_type                 = Key;
+    static constexpr int max_value = MaxValue;
+};
+
+template<class Params>
+class HipcubDeviceDistinct : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+// The maximum value bounds the number of distinct keys: a few keys which every tile shares up to
+// keys which are mostly unique
+typedef ::testing::Types<params<int, 10>,
+                         params<int, 1000000>,
+                         params<unsigned int, 5000>,
+                         params<unsigned char, 200>,
+                         params<short, 20000>,
+                         params<float, 1000>,
+                         params<double, 1000000>,
+                         params<unsigned long long, 3>>
+    Params;
+
+TYPED_TEST_SUITE(HipcubDeviceDistinct, Params);
+
+TYPED_TEST(HipcubDeviceDistinct, Distinct)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type          = typename TestFixture::params::key_type;
+    using index_type        = unsigned int;
+    constexpr int max_value = TestFixture::params::max_value;
+
+    hipStream_t stream = 0;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+            const std::vector<key_type> input
+                = test_utils::get_random_data<key_type>(size, 0, max_value, seed_value);
+
+            // Distinct keys in the order of their first occurrence
+            std::map<key_type, size_t> positions;
+            std::vector<key_type>      expected_keys;
+            std::vector<index_type>    expected_indices;
+            std::vector<index_type>    expected_counts;
+            for(size_t i = 0; i < size; i++)
+            {
+                const auto result = positions.emplace(input[i], expected_keys.size());
+                if(result.second)
+                {
+                    expected_keys.push_back(input[i]);
+                    expected_indices.push_back(static_cast<index_type>(i));
+                    expected_counts.push_back(0);
+                }
+                expected_counts[result.first->second]++;
+            }
+            const size_t expected_size = expected_keys.size();
+
+            key_type*   d_input;
+            key_type*   d_keys_output;
+            index_type* d_indices_output;
+            index_type* d_counts_output;
+            index_type* d_num_distinct;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output,
+                                                         (size + 1) * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_indices_output,
+                                                         (size + 1) * sizeof(index_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_counts_output,
+                                                         (size + 1) * sizeof(index_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_num_distinct, sizeof(index_type)));
+            HIP_CHECK(hipMemcpy(d_input,
+                                input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+
+            // 0: keys only, 1: with first indices, 2: with first indices and counts
+            for(int variant = 0; variant < 3; variant++)
+            {
+                SCOPED_TRACE(testing::Message() << "with variant= " << variant);
+
+                auto run = [&](void* d_temp_storage, size_t& temp_storage_bytes)
+                {
+                    if(variant == 0)
+                    {
+                        return hipcub::DeviceDistinct::Distinct(d_temp_storage,
+                                                                temp_storage_bytes,
+                                                                d_input,
+                                                                d_keys_output,
+                                                                d_num_distinct,
+                                                                static_cast<int>(size),
+                                                                stream);
+                    }
+                    else if(variant == 1)
+                    {
+                        return hipcub::DeviceDistinct::DistinctWithIndices(d_temp_storage,
+                                                                           temp_storage_bytes,
+                                                                           d_input,
+                                                                           d_keys_output,
+                                                                           d_indices_output,
+                                                                           d_num_distinct,
+                                                                           static_cast<int>(size),
+                                                                           stream);
+                    }
+                    return hipcub::DeviceDistinct::DistinctWithCounts(d_temp_storage,
+                                                                      temp_storage_bytes,
+                                                                      d_input,
+                                                                      d_keys_output,
+                                                                      d_indices_output,
+                                                                      d_counts_output,
+                                                                      d_num_distinct,
+                                                                      static_cast<int>(size),
+                                                                      stream);
+                };
+
+                size_t temporary_storage_bytes = 0;
+                HIP_CHECK(run(nullptr, temporary_storage_bytes));
+                ASSERT_GT(temporary_storage_bytes, 0U);
+
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+                HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                index_type num_distinct;
+                HIP_CHECK(hipMemcpy(&num_distinct,
+                                    d_num_distinct,
+                                    sizeof(index_type),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_EQ(num_distinct, expected_size);
+
+                std::vector<key_type>   keys_output(expected_size);
+                std::vector<index_type> indices_output(expected_size);
+                std::vector<index_type> counts_output(expected_size);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys_output,
+                                    expected_size * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(indices_output.data(),
+                                    d_indices_output,
+                                    expected_size * sizeof(index_type),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(counts_output.data(),
+                                    d_counts_output,
+                                    expected_size * sizeof(index_type),
+                                    hipMemcpyDeviceToHost));
+
+                for(size_t i = 0; i < expected_size; i++)
+                {
+                    ASSERT_EQ(keys_output[i], expected_keys[i]) << "with index= " << i;
+                    if(variant >= 1)
+                    {
+                        ASSERT_EQ(indices_output[i], expected_indices[i]) << "with index= " << i;
+                    }
+                    if(variant == 2)
+                    {
+                        ASSERT_EQ(counts_output[i], expected_counts[i]) << "with index= " << i;
+                    }
+                }
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_indices_output));
+            HIP_CHECK(hipFree(d_counts_output));
+            HIP_CHECK(hipFree(d_num_distinct));
+        }
+    }
+}
+
+TEST(HipcubDeviceDistinctTests, NaNKeys)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type   = float;
+    using index_type = unsigned int;
+
+    hipStream_t stream = 0;
+
+    // NaNs of both signs spread over several tiles, all of them are one key
+    const size_t          size = 10000;
+    std::vector<key_type> input(size);
+    for(size_t i = 0; i < size; i++)
+    {
+        const key_type nan = std::numeric_limits<key_type>::quiet_NaN();
+        input[i]           = i % 5 == 2 ? (i % 2 == 0 ? nan : -nan) : static_cast<key_type>(i % 13);
+    }
+
+    // NaN is the only key which is not finite, so infinity stands in for it in the map
+    std::map<key_type, size_t> positions;
+    std::vector<key_type>      expected_keys;
+    std::vector<index_type>    expected_indices;
+    std::vector<index_type>    expected_counts;
+    for(size_t i = 0; i < size; i++)
+    {
+        const key_type key    = std::isnan(input[i]) ? std::numeric_limits<key_type>::infinity()
+                                                     : input[i];
+        const auto     result = positions.emplace(key, expected_keys.size());
+        if(result.second)
+        {
+            expected_keys.push_back(input[i]);
+            expected_indices.push_back(static_cast<index_type>(i));
+            expected_counts.push_back(0);
+        }
+        expected_counts[result.first->second]++;
+    }
+    const size_t expected_size = expected_keys.size();
+
+    key_type*   d_input;
+    key_type*   d_keys_output;
+    index_type* d_indices_output;
+    index_type* d_counts_output;
+    index_type* d_num_distinct;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(key_type)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_indices_output, size * sizeof(index_type)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_counts_output, size * sizeof(index_type)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_num_distinct, sizeof(index_type)));
+    HIP_CHECK(
+        hipMemcpy(d_input, input.data(), size * sizeof(key_type), hipMemcpyHostToDevice));
+
+    size_t temporary_storage_bytes = 0;
+    HIP_CHECK(hipcub::DeviceDistinct::DistinctWithCounts(nullptr,
+                                                         temporary_storage_bytes,
+                                                         d_input,
+                                                         d_keys_output,
+                                                         d_indices_output,
+                                                         d_counts_output,
+                                                         d_num_distinct,
+                                                         static_cast<int>(size),
+                                                         stream));
+    ASSERT_GT(temporary_storage_bytes, 0U);
+
+    void* d_temporary_storage;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+    HIP_CHECK(hipcub::DeviceDistinct::DistinctWithCounts(d_temporary_storage,
+                                                         temporary_storage_bytes,
+                                                         d_input,
+                                                         d_keys_output,
+                                                         d_indices_output,
+                                                         d_counts_output,
+                                                         d_num_distinct,
+                                                         static_cast<int>(size),
+                                                         stream));
+    HIP_CHECK(hipGetLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(d_temporary_storage));
+
+    index_type num_distinct;
+    HIP_CHECK(
+        hipMemcpy(&num_distinct, d_num_distinct, sizeof(index_type), hipMemcpyDeviceToHost));
+    ASSERT_EQ(num_distinct, expected_size);
+
+    std::vector<key_type>   keys_output(expected_size);
+    std::vector<index_type> indices_output(expected_size);
+    std::vector<index_type> counts_output(expected_size);
+    HIP_CHECK(hipMemcpy(keys_output.data(),
+                        d_keys_output,
+                        expected_size * sizeof(key_type),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(indices_output.data(),
+                        d_indices_output,
+                        expected_size * sizeof(index_type),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(counts_output.data(),
+                        d_counts_output,
+                        expected_size * sizeof(index_type),
+                        hipMemcpyDeviceToHost));
+
+    for(size_t i = 0; i < expected_size; i++)
+    {
+        if(std::isnan(expected_keys[i]))
+        {
+            ASSERT_TRUE(std::isnan(keys_output[i])) << "with index= " << i;
+        }
+        else
+        {
+            ASSERT_EQ(keys_output[i], expected_keys[i]) << "with index= " << i;
+        }
+        ASSERT_EQ(indices_output[i], expected_indices[i]) << "with index= " << i;
+        ASSERT_EQ(counts_output[i], expected_counts[i]) << "with index= " << i;
+    }
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_keys_output));
+    HIP_CHECK(hipFree(d_indices_output));
+    HIP_CHECK(hipFree(d_counts_output));
+    HIP_CHECK(hipFree(d_num_distinct));
+}
@@ -0,0 +1,342 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "common_test_header.hpp"
+
+// hipcub API
+#include "hipcub/device/device_find.hpp"
+
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+template<class Key, bool Upper, int MaxValue, class CompareFunction = test_utils::less>
+struct params
+{
+    using key_type                  = Key;
+    using compare_function          = CompareFunction;
+    static constexpr bool upper     = Upper;
+    static constexpr int  max_value = MaxValue;
+};
+
+template<class Params>
+class HipcubDeviceFind : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+// Small value ranges give long runs of equal items and haystack slices too wide for the cache,
+// large ranges give narrow slices.
+typedef ::testing::Types<params<int, false, 100>,
+                         params<int, true, 1000000>,
+                         params<unsigned int, false, 5000, test_utils::greater>,
+                         params<unsigned char, true, 200>,
+                         params<short, true, 20000, test_utils::greater>,
+                         params<float, false, 1000000>,
+                         params<double, true, 100>,
+                         params<unsigned long long, false, 1000000>>
+    Params;
+
+TYPED_TEST_SUITE(HipcubDeviceFind, Params);
+
+TYPED_TEST(HipcubDeviceFind, Bounds)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type           = typename TestFixture::params::key_type;
+    using compare_function   = typename TestFixture::params::compare_function;
+    using output_type        = unsigned int;
+    constexpr bool upper     = TestFixture::params::upper;
+    constexpr int  max_value = TestFixture::params::max_value;
+
+    const compare_function compare_op;
+
+    hipStream_t stream = 0;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(size_t haystack_size : {0, 1, 37, 3000, 200000})
+        {
+            SCOPED_TRACE(testing::Message() << "with haystack_size= " << haystack_size);
+
+            std::vector<key_type> haystack
+                = test_utils::get_random_data<key_type>(haystack_size, 0, max_value, seed_value);
+            std::sort(haystack.begin(), haystack.end(), compare_op);
+
+            key_type* d_haystack;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_haystack,
+                                                         (haystack_size + 1) * sizeof(key_type)));
+            HIP_CHECK(hipMemcpy(d_haystack,
+                                haystack.data(),
+                                haystack_size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+
+            for(size_t size : test_utils::get_sizes(seed_value))
+            {
+                SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+                // Unsorted needles, some of them outside of the haystack range
+                const std::vector<key_type> needles
+                    = test_utils::get_random_data<key_type>(size,
+                                                            0,
+                                                            max_value + max_value / 10,
+                                                            seed_value + 1);
+
+                key_type*    d_needles;
+                output_type* d_output;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_needles, size * sizeof(key_type)));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_output, size * sizeof(output_type)));
+                HIP_CHECK(hipMemcpy(d_needles,
+                                    needles.data(),
+                                    size * sizeof(key_type),
+                                    hipMemcpyHostToDevice));
+
+                auto run = [&](void* d_temp_storage, size_t& temp_storage_bytes)
+                {
+                    if(upper)
+                    {
+                        return hipcub::DeviceFind::UpperBound(d_temp_storage,
+                                                              temp_storage_bytes,
+                                                              d_haystack,
+                                                              haystack_size,
+                                                              d_needles,
+                                                              size,
+                                                              d_output,
+                                                              compare_op,
+                                                              stream);
+                    }
+                    return hipcub::DeviceFind::LowerBound(d_temp_storage,
+                                                          temp_storage_bytes,
+                                                          d_haystack,
+                                                          haystack_size,
+                                                          d_needles,
+                                                          size,
+                                                          d_output,
+                                                          compare_op,
+                                                          stream);
+                };
+
+                size_t temporary_storage_bytes = 0;
+                HIP_CHECK(run(nullptr, temporary_storage_bytes));
+                ASSERT_GT(temporary_storage_bytes, 0U);
+
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+                HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                std::vector<output_type> output(size);
+                HIP_CHECK(hipMemcpy(output.data(),
+                                    d_output,
+                                    size * sizeof(output_type),
+                                    hipMemcpyDeviceToHost));
+
+                HIP_CHECK(hipFree(d_needles));
+                HIP_CHECK(hipFree(d_output));
+
+                for(size_t i = 0; i < size; i++)
+                {
+                    const auto bound
+                        = upper ? std::upper_bound(haystack.begin(),
+                                                   haystack.end(),
+                                                   needles[i],
+                                                   compare_op)
+                                : std::lower_bound(haystack.begin(),
+                                                   haystack.end(),
+                                                   needles[i],
+                                                   compare_op);
+                    ASSERT_EQ(output[i], static_cast<output_type>(bound - haystack.begin()))
+                        << "with index= " << i;
+                }
+            }
+
+            HIP_CHECK(hipFree(d_haystack));
+        }
+    }
+}
+
+template<class Key>
+struct find_if_params
+{
+    using key_type = Key;
+};
+
+template<class Params>
+class HipcubDeviceFindIf : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<find_if_params<int>,
+                         find_if_params<unsigned char>,
+                         find_if_params<short>,
+                         find_if_params<float>,
+                         find_if_params<double>,
+                         find_if_params<unsigned long long>>
+    FindIfParams;
+
+TYPED_TEST_SUITE(HipcubDeviceFindIf, FindIfParams);
+
+template<class T>
+struct greater_than_op
+{
+    T threshold;
+
+    HIPCUB_HOST_DEVICE
+    bool operator()(const T& item) const
+    {
+        return item > threshold;
+    }
+};
+
+TYPED_TEST(HipcubDeviceFindIf, FindIf)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type = typename TestFixture::params::key_type;
+
+    const greater_than_op<key_type> predicate{key_type(50)};
+
+    hipStream_t stream = 0;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        std::default_random_engine gen(seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            // No match, a single match anywhere in the input, and several matches so that
+            // blocks publish different indices
+            for(size_t matches : {0, 1, 10})
+            {
+                SCOPED_TRACE(testing::Message() << "with size= " << size);
+                SCOPED_TRACE(testing::Message() << "with matches= " << matches);
+
+                std::vector<key_type> input
+                    = test_utils::get_random_data<key_type>(size, 0, 50, seed_value);
+                if(size > 0)
+                {
+                    std::uniform_int_distribution<size_t> position_dis(0, size - 1);
+                    for(size_t i = 0; i < matches; i++)
+                    {
+                        input[position_dis(gen)] = key_type(100);
+                    }
+                }
+
+                key_type* d_input;
+                int*      d_index;
+                bool*     d_found;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_input,
+                                                             (size + 1) * sizeof(key_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_index, sizeof(int)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_found, 3 * sizeof(bool)));
+                HIP_CHECK(hipMemcpy(d_input,
+                                    input.data(),
+                                    size * sizeof(key_type),
+                                    hipMemcpyHostToDevice));
+
+                const int num_items = static_cast<int>(size);
+
+                size_t temporary_storage_bytes = 0;
+                HIP_CHECK(hipcub::DeviceFind::FindIf(nullptr,
+                                                     temporary_storage_bytes,
+                                                     d_input,
+                                                     d_index,
+                                                     predicate,
+                                                     num_items,
+                                                     stream));
+                ASSERT_GT(temporary_storage_bytes, 0U);
+
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+                HIP_CHECK(hipcub::DeviceFind::FindIf(d_temporary_storage,
+                                                     temporary_storage_bytes,
+                                                     d_input,
+                                                     d_index,
+                                                     predicate,
+                                                     num_items,
+                                                     stream));
+                HIP_CHECK(hipcub::DeviceFind::AnyOf(d_temporary_storage,
+                                                    temporary_storage_bytes,
+                                                    d_input,
+                                                    d_found,
+                                                    predicate,
+                                                    num_items,
+                                                    stream));
+                HIP_CHECK(hipcub::DeviceFind::AllOf(d_temporary_storage,
+                                                    temporary_storage_bytes,
+                                                    d_input,
+                                                    d_found + 1,
+                                                    predicate,
+                                                    num_items,
+                                                    stream));
+                HIP_CHECK(hipcub::DeviceFind::NoneOf(d_temporary_storage,
+                                                     temporary_storage_bytes,
+                                                     d_input,
+                                                     d_found + 2,
+                                                     predicate,
+                                                     num_items,
+                                                     stream));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                int  index;
+                bool found[3];
+                HIP_CHECK(hipMemcpy(&index, d_index, sizeof(int), hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(found, d_found, 3 * sizeof(bool), hipMemcpyDeviceToHost));
+
+                HIP_CHECK(hipFree(d_input));
+                HIP_CHECK(hipFree(d_index));
+                HIP_CHECK(hipFree(d_found));
+
+                const auto expected = std::find_if(input.begin(), input.end(), predicate);
+                ASSERT_EQ(index, static_cast<int>(expected - input.begin()));
+                ASSERT_EQ(found[0], std::any_of(input.begin(), input.end(), predicate));
+                ASSERT_EQ(found[1], std::all_of(input.begin(), input.end(), predicate));
+                ASSERT_EQ(found[2], std::none_of(input.begin(), input.end(), predicate));
+            }
+        }
+    }
+}
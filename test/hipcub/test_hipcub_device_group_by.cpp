@@ -0,0 +1,392 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include "common_test_header.hpp"
+
+// hipcub API
+#include "hipcub/device/device_group_by.hpp"
+
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <utility>
+#include <vector>
+
+// Reduction without hardware atomics, aggregated with a CAS loop
+struct xor_op
+{
+    template<class T>
+    HIPCUB_HOST_DEVICE T operator()(const T& a, const T& b) const
+    {
+        return a ^ b;
+    }
+};
+
+template<class ReductionOp, class T>
+struct reduction_identity;
+
+template<class T>
+struct reduction_identity<hipcub::Sum, T>
+{
+    static T value()
+    {
+        return T(0);
+    }
+};
+
+template<class T>
+struct reduction_identity<hipcub::Min, T>
+{
+    static T value()
+    {
+        return std::numeric_limits<T>::max();
+    }
+};
+
+template<class T>
+struct reduction_identity<hipcub::Max, T>
+{
+    static T value()
+    {
+        return std::numeric_limits<T>::lowest();
+    }
+};
+
+template<class T>
+struct reduction_identity<xor_op, T>
+{
+    static T value()
+    {
+        return T(0);
+    }
+};
+
+template<class Key, class Value, class ReductionOp, int MaxValue, size_t TableCapacity = 0>
+struct params
+{
+    using key_type                         = Key;
+    using value_type                       = Value;
+    using reduction_op_type                = ReductionOp;
+    static constexpr int    max_value      = MaxValue;
+    static constexpr size_t table_capacity = TableCapacity;
+};
+
+template<class Params>
+class HipcubDeviceGroupBy : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+// Atomic and CAS aggregation for few and many groups. A table capacity other than 0 bounds the
+// hash table so that most keys are spilled to the sort-based path.
+typedef ::testing::Types<params<int, int, hipcub::Sum, 10>,
+                         params<int, unsigned long long, hipcub::Sum, 1000000>,
+                         params<unsigned int, double, hipcub::Sum, 5000>,
+                         params<short, int, hipcub::Min, 20000>,
+                         params<unsigned char, unsigned int, hipcub::Max, 200>,
+                         params<float, float, hipcub::Min, 1000>,
+                         params<double, long long, hipcub::Max, 100000>,
+                         params<int, unsigned int, xor_op, 300>,
+                         params<unsigned long long, unsigned long long, xor_op, 3>,
+                         params<int, int, hipcub::Sum, 100000, 64>,
+                         params<int, float, hipcub::Max, 5000, 1024>>
+    Params;
+
+TYPED_TEST_SUITE(HipcubDeviceGroupBy, Params);
+
+TYPED_TEST(HipcubDeviceGroupBy, ReduceByKey)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                  = typename TestFixture::params::key_type;
+    using value_type                = typename TestFixture::params::value_type;
+    using reduction_op_type         = typename TestFixture::params::reduction_op_type;
+    using count_type                = unsigned int;
+    constexpr int    max_value      = TestFixture::params::max_value;
+    constexpr size_t table_capacity = TestFixture::params::table_capacity;
+
+    const value_type  init = reduction_identity<reduction_op_type, value_type>::value();
+    reduction_op_type reduction_op;
+
+    hipStream_t stream = 0;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+            const std::vector<key_type> keys_input
+                = test_utils::get_random_data<key_type>(size, 0, max_value, seed_value);
+            // Small integral values keep floating-point sums exact in any order
+            const std::vector<value_type> values_input
+                = test_utils::get_random_data<value_type>(size, 0, 100, seed_value + 1);
+
+            // Groups in the order of the first occurrence of their keys
+            std::map<key_type, size_t> positions;
+            std::vector<key_type>      expected_keys;
+            std::vector<value_type>    expected_aggregates;
+            for(size_t i = 0; i < size; i++)
+            {
+                const auto result = positions.emplace(keys_input[i], expected_keys.size());
+                if(result.second)
+                {
+                    expected_keys.push_back(keys_input[i]);
+                    expected_aggregates.push_back(init);
+                }
+                value_type& aggregate = expected_aggregates[result.first->second];
+                aggregate             = reduction_op(aggregate, values_input[i]);
+            }
+            const size_t expected_size = expected_keys.size();
+
+            key_type*   d_keys_input;
+            key_type*   d_unique_output;
+            value_type* d_values_input;
+            value_type* d_aggregates_output;
+            count_type* d_num_groups;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input,
+                                                         (size + 1) * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_unique_output,
+                                                         (size + 1) * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                         (size + 1) * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_aggregates_output,
+                                                         (size + 1) * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_num_groups, sizeof(count_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+
+            auto run = [&](void* d_temp_storage, size_t& temp_storage_bytes)
+            {
+                if(table_capacity == 0)
+                {
+                    return hipcub::DeviceGroupBy::ReduceByKey(d_temp_storage,
+                                                              temp_storage_bytes,
+                                                              d_keys_input,
+                                                              d_unique_output,
+                                                              d_values_input,
+                                                              d_aggregates_output,
+                                                              d_num_groups,
+                                                              reduction_op,
+                                                              init,
+                                                              static_cast<int>(size),
+                                                              stream);
+                }
+                return hipcub::DeviceGroupBy::ReduceByKeyWithTableCapacity(
+                    d_temp_storage,
+                    temp_storage_bytes,
+                    d_keys_input,
+                    d_unique_output,
+                    d_values_input,
+                    d_aggregates_output,
+                    d_num_groups,
+                    reduction_op,
+                    init,
+                    static_cast<int>(size),
+                    table_capacity,
+                    stream);
+            };
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(run(nullptr, temporary_storage_bytes));
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipFree(d_temporary_storage));
+
+            count_type num_groups;
+            HIP_CHECK(
+                hipMemcpy(&num_groups, d_num_groups, sizeof(count_type), hipMemcpyDeviceToHost));
+            ASSERT_EQ(num_groups, expected_size);
+
+            std::vector<key_type>   unique_output(expected_size);
+            std::vector<value_type> aggregates_output(expected_size);
+            HIP_CHECK(hipMemcpy(unique_output.data(),
+                                d_unique_output,
+                                expected_size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(aggregates_output.data(),
+                                d_aggregates_output,
+                                expected_size * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_unique_output));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_aggregates_output));
+            HIP_CHECK(hipFree(d_num_groups));
+
+            std::vector<std::pair<key_type, value_type>> expected;
+            std::vector<std::pair<key_type, value_type>> output;
+            for(size_t i = 0; i < expected_size; i++)
+            {
+                expected.emplace_back(expected_keys[i], expected_aggregates[i]);
+                output.emplace_back(unique_output[i], aggregates_output[i]);
+            }
+            // Spilled groups are appended in key order, so only the set of groups is checked
+            if(table_capacity != 0)
+            {
+                std::sort(expected.begin(), expected.end());
+                std::sort(output.begin(), output.end());
+            }
+
+            for(size_t i = 0; i < expected_size; i++)
+            {
+                ASSERT_EQ(output[i].first, expected[i].first) << "with index= " << i;
+                ASSERT_EQ(output[i].second, expected[i].second) << "with index= " << i;
+            }
+        }
+    }
+}
+
+TYPED_TEST(HipcubDeviceGroupBy, CountByKey)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type          = typename TestFixture::params::key_type;
+    using count_type        = unsigned int;
+    constexpr int max_value = TestFixture::params::max_value;
+
+    hipStream_t stream = 0;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+            const std::vector<key_type> keys_input
+                = test_utils::get_random_data<key_type>(size, 0, max_value, seed_value);
+
+            std::map<key_type, size_t> positions;
+            std::vector<key_type>      expected_keys;
+            std::vector<count_type>    expected_counts;
+            for(size_t i = 0; i < size; i++)
+            {
+                const auto result = positions.emplace(keys_input[i], expected_keys.size());
+                if(result.second)
+                {
+                    expected_keys.push_back(keys_input[i]);
+                    expected_counts.push_back(0);
+                }
+                expected_counts[result.first->second]++;
+            }
+            const size_t expected_size = expected_keys.size();
+
+            key_type*   d_keys_input;
+            key_type*   d_unique_output;
+            count_type* d_counts_output;
+            count_type* d_num_groups;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input,
+                                                         (size + 1) * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_unique_output,
+                                                         (size + 1) * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_counts_output,
+                                                         (size + 1) * sizeof(count_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_num_groups, sizeof(count_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(hipcub::DeviceGroupBy::CountByKey(nullptr,
+                                                        temporary_storage_bytes,
+                                                        d_keys_input,
+                                                        d_unique_output,
+                                                        d_counts_output,
+                                                        d_num_groups,
+                                                        static_cast<int>(size),
+                                                        stream));
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipcub::DeviceGroupBy::CountByKey(d_temporary_storage,
+                                                        temporary_storage_bytes,
+                                                        d_keys_input,
+                                                        d_unique_output,
+                                                        d_counts_output,
+                                                        d_num_groups,
+                                                        static_cast<int>(size),
+                                                        stream));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipFree(d_temporary_storage));
+
+            count_type num_groups;
+            HIP_CHECK(
+                hipMemcpy(&num_groups, d_num_groups, sizeof(count_type), hipMemcpyDeviceToHost));
+            ASSERT_EQ(num_groups, expected_size);
+
+            std::vector<key_type>   unique_output(expected_size);
+            std::vector<count_type> counts_output(expected_size);
+            HIP_CHECK(hipMemcpy(unique_output.data(),
+                                d_unique_output,
+                                expected_size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(counts_output.data(),
+                                d_counts_output,
+                                expected_size * sizeof(count_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_unique_output));
+            HIP_CHECK(hipFree(d_counts_output));
+            HIP_CHECK(hipFree(d_num_groups));
+
+            for(size_t i = 0; i < expected_size; i++)
+            {
+                ASSERT_EQ(unique_output[i], expected_keys[i]) << "with index= " << i;
+                ASSERT_EQ(counts_output[i], expected_counts[i]) << "with index= " << i;
+            }
+        }
+    }
+}
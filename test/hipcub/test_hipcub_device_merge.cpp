@@ -0,0 +1,240 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "common_test_header.hpp"
+
+// hipcub API
+#include "hipcub/device/device_merge.hpp"
+
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+template<class Key, int MaxValue, class CompareFunction = test_utils::less>
+struct params
+{
+    using key_type                 = Key;
+    using compare_function         = CompareFunction;
+    static constexpr int max_value = MaxValue;
+};
+
+template<class Params>
+class HipcubDeviceMerge : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+// Small value ranges give long runs of equal keys which check the stability of the merge
+typedef ::testing::Types<params<int, 100>,
+                         params<int, 1000000>,
+                         params<unsigned int, 5000, test_utils::greater>,
+                         params<unsigned char, 10>,
+                         params<short, 20000, test_utils::greater>,
+                         params<float, 1000>,
+                         params<double, 1000000>,
+                         params<unsigned long long, 3>>
+    Params;
+
+TYPED_TEST_SUITE(HipcubDeviceMerge, Params);
+
+TYPED_TEST(HipcubDeviceMerge, Merge)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type          = typename TestFixture::params::key_type;
+    using compare_function  = typename TestFixture::params::compare_function;
+    using value_type        = unsigned int;
+    using item_type         = std::pair<key_type, value_type>;
+    constexpr int max_value = TestFixture::params::max_value;
+
+    const compare_function compare_op;
+    const auto             compare_items
+        = [&](const item_type& a, const item_type& b) { return compare_op(a.first, b.first); };
+
+    hipStream_t stream = 0;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(size_t size1 : test_utils::get_sizes(seed_value))
+        {
+            for(size_t size2 : {size_t(0), size1 / 3, size1 + 17})
+            {
+                SCOPED_TRACE(testing::Message() << "with size1= " << size1);
+                SCOPED_TRACE(testing::Message() << "with size2= " << size2);
+
+                std::vector<key_type> keys1
+                    = test_utils::get_random_data<key_type>(size1, 0, max_value, seed_value);
+                std::vector<key_type> keys2
+                    = test_utils::get_random_data<key_type>(size2, 0, max_value, seed_value + 1);
+                std::sort(keys1.begin(), keys1.end(), compare_op);
+                std::sort(keys2.begin(), keys2.end(), compare_op);
+
+                // The values tell which input item was placed at each position
+                std::vector<item_type>  items1(size1);
+                std::vector<item_type>  items2(size2);
+                std::vector<value_type> values1(size1);
+                std::vector<value_type> values2(size2);
+                for(size_t i = 0; i < size1; i++)
+                {
+                    values1[i] = static_cast<value_type>(i);
+                    items1[i]  = item_type(keys1[i], values1[i]);
+                }
+                for(size_t i = 0; i < size2; i++)
+                {
+                    values2[i] = static_cast<value_type>(size1 + i);
+                    items2[i]  = item_type(keys2[i], values2[i]);
+                }
+
+                // std::merge is stable, equal items of the first range come first
+                std::vector<item_type> expected;
+                std::merge(items1.begin(),
+                           items1.end(),
+                           items2.begin(),
+                           items2.end(),
+                           std::back_inserter(expected),
+                           compare_items);
+
+                const size_t output_size = size1 + size2;
+
+                key_type*   d_keys1;
+                key_type*   d_keys2;
+                value_type* d_values1;
+                value_type* d_values2;
+                key_type*   d_keys_output;
+                value_type* d_values_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys1,
+                                                             (size1 + 1) * sizeof(key_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys2,
+                                                             (size2 + 1) * sizeof(key_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values1,
+                                                             (size1 + 1) * sizeof(value_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values2,
+                                                             (size2 + 1) * sizeof(value_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output,
+                                                             (output_size + 1)
+                                                                 * sizeof(key_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                             (output_size + 1)
+                                                                 * sizeof(value_type)));
+                HIP_CHECK(hipMemcpy(d_keys1,
+                                    keys1.data(),
+                                    size1 * sizeof(key_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_keys2,
+                                    keys2.data(),
+                                    size2 * sizeof(key_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_values1,
+                                    values1.data(),
+                                    size1 * sizeof(value_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_values2,
+                                    values2.data(),
+                                    size2 * sizeof(value_type),
+                                    hipMemcpyHostToDevice));
+
+                for(bool with_values : {false, true})
+                {
+                    SCOPED_TRACE(testing::Message() << "with with_values= " << with_values);
+
+                    auto run = [&](void* d_temp_storage, size_t& temp_storage_bytes)
+                    {
+                        if(with_values)
+                        {
+                            return hipcub::DeviceMerge::MergePairs(d_temp_storage,
+                                                                   temp_storage_bytes,
+                                                                   d_keys1,
+                                                                   d_values1,
+                                                                   static_cast<int>(size1),
+                                                                   d_keys2,
+                                                                   d_values2,
+                                                                   static_cast<int>(size2),
+                                                                   d_keys_output,
+                                                                   d_values_output,
+                                                                   compare_op,
+                                                                   stream);
+                        }
+                        return hipcub::DeviceMerge::MergeKeys(d_temp_storage,
+                                                              temp_storage_bytes,
+                                                              d_keys1,
+                                                              static_cast<int>(size1),
+                                                              d_keys2,
+                                                              static_cast<int>(size2),
+                                                              d_keys_output,
+                                                              compare_op,
+                                                              stream);
+                    };
+
+                    size_t temporary_storage_bytes = 0;
+                    HIP_CHECK(run(nullptr, temporary_storage_bytes));
+                    ASSERT_GT(temporary_storage_bytes, 0U);
+
+                    void* d_temporary_storage;
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                                 temporary_storage_bytes));
+                    HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+                    HIP_CHECK(hipGetLastError());
+                    HIP_CHECK(hipDeviceSynchronize());
+                    HIP_CHECK(hipFree(d_temporary_storage));
+
+                    std::vector<key_type>   keys_output(output_size);
+                    std::vector<value_type> values_output(output_size);
+                    HIP_CHECK(hipMemcpy(keys_output.data(),
+                                        d_keys_output,
+                                        output_size * sizeof(key_type),
+                                        hipMemcpyDeviceToHost));
+                    HIP_CHECK(hipMemcpy(values_output.data(),
+                                        d_values_output,
+                                        output_size * sizeof(value_type),
+                                        hipMemcpyDeviceToHost));
+
+                    for(size_t i = 0; i < output_size; i++)
+                    {
+                        ASSERT_EQ(keys_output[i], expected[i].first) << "with index= " << i;
+                        if(with_values)
+                        {
+                            ASSERT_EQ(values_output[i], expected[i].second)
+                                << "with index= " << i;
+                        }
+                    }
+                }
+
+                HIP_CHECK(hipFree(d_keys1));
+                HIP_CHECK(hipFree(d_keys2));
+                HIP_CHECK(hipFree(d_values1));
+                HIP_CHECK(hipFree(d_values2));
+                HIP_CHECK(hipFree(d_keys_output));
+                HIP_CHECK(hipFree(d_values_output));
+            }
+        }
+    }
+}
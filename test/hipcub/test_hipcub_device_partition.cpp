@@ -30,6 +30,7 @@
 
 #include <algorithm>
 #include <array>
+#include <vector>
 
 // Params for tests
 template<class InputType,
@@ -562,3 +563,150 @@ TYPED_TEST(HipcubDevicePartitionTests, IfThreeWay)
     if(TestFixture::use_graphs)
         HIP_CHECK(hipStreamDestroy(stream));
 }
+
+namespace
+{
+template<typename T>
+struct ModuloBucketOp
+{
+    HIPCUB_HOST_DEVICE ModuloBucketOp(unsigned int num_buckets) : num_buckets_{num_buckets} {}
+
+    HIPCUB_HOST_DEVICE
+    unsigned int operator()(const T& val) const
+    {
+        return static_cast<unsigned int>(val) % num_buckets_;
+    }
+
+private:
+    unsigned int num_buckets_;
+};
+} // namespace
+
+template<class T>
+class HipcubDevicePartitionBucketsTests : public ::testing::Test
+{
+public:
+    using input_type = T;
+};
+
+typedef ::testing::Types<int, unsigned int, unsigned char, unsigned long long, float, double>
+    HipcubDevicePartitionBucketsTestsParams;
+
+TYPED_TEST_SUITE(HipcubDevicePartitionBucketsTests, HipcubDevicePartitionBucketsTestsParams);
+
+TYPED_TEST(HipcubDevicePartitionBucketsTests, Buckets)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = typename TestFixture::input_type;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size= " << size);
+            // Generate data
+            const auto input = test_utils::get_random_data<T>(size, 0, 250, seed_value);
+
+            T* d_input  = nullptr;
+            T* d_output = nullptr;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, (size + 1) * sizeof(T)));
+            HIP_CHECK(
+                hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            for(unsigned int num_buckets : {1u, 2u, 7u, 16u, 100u, 256u})
+            {
+                SCOPED_TRACE(testing::Message() << "with num_buckets= " << num_buckets);
+
+                const auto bucket_op = ModuloBucketOp<T>{num_buckets};
+
+                // A stable sort by bucket is a stable partition into the buckets
+                auto expected = input;
+                std::stable_sort(expected.begin(),
+                                 expected.end(),
+                                 [&](const T& a, const T& b)
+                                 { return bucket_op(a) < bucket_op(b); });
+                std::vector<unsigned int> expected_counts(num_buckets, 0);
+                for(const T& value : input)
+                {
+                    expected_counts[bucket_op(value)]++;
+                }
+                std::vector<unsigned int> expected_offsets(num_buckets, 0);
+                for(unsigned int bucket = 1; bucket < num_buckets; bucket++)
+                {
+                    expected_offsets[bucket]
+                        = expected_offsets[bucket - 1] + expected_counts[bucket - 1];
+                }
+
+                unsigned int* d_bucket_offsets = nullptr;
+                unsigned int* d_bucket_counts  = nullptr;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_bucket_offsets,
+                                                             num_buckets * sizeof(unsigned int)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_bucket_counts,
+                                                             num_buckets * sizeof(unsigned int)));
+
+                size_t temp_storage_size_bytes = 0;
+                HIP_CHECK(hipcub::DevicePartition::Buckets(nullptr,
+                                                           temp_storage_size_bytes,
+                                                           d_input,
+                                                           d_output,
+                                                           d_bucket_offsets,
+                                                           d_bucket_counts,
+                                                           static_cast<int>(num_buckets),
+                                                           bucket_op,
+                                                           static_cast<int>(size),
+                                                           stream));
+
+                void* d_temp_storage = nullptr;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(hipcub::DevicePartition::Buckets(d_temp_storage,
+                                                           temp_storage_size_bytes,
+                                                           d_input,
+                                                           d_output,
+                                                           d_bucket_offsets,
+                                                           d_bucket_counts,
+                                                           static_cast<int>(num_buckets),
+                                                           bucket_op,
+                                                           static_cast<int>(size),
+                                                           stream));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                std::vector<T>            output(size);
+                std::vector<unsigned int> bucket_offsets(num_buckets);
+                std::vector<unsigned int> bucket_counts(num_buckets);
+                HIP_CHECK(
+                    hipMemcpy(output.data(), d_output, size * sizeof(T), hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(bucket_offsets.data(),
+                                    d_bucket_offsets,
+                                    num_buckets * sizeof(unsigned int),
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(bucket_counts.data(),
+                                    d_bucket_counts,
+                                    num_buckets * sizeof(unsigned int),
+                                    hipMemcpyDeviceToHost));
+
+                ASSERT_EQ(bucket_offsets, expected_offsets);
+                ASSERT_EQ(bucket_counts, expected_counts);
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+                HIP_CHECK(hipFree(d_bucket_offsets));
+                HIP_CHECK(hipFree(d_bucket_counts));
+                HIP_CHECK(hipFree(d_temp_storage));
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+        }
+    }
+}
@@ -35,6 +35,8 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <tuple>
 #include <vector>
 
 #define HIP_CHECK_MEMORY(condition)                                                         \
@@ -1247,4 +1249,1048 @@ inline void sort_keys_large_sizes()
     }
 }
 
+/// Checks ArgSort with and without the sorted keys and applies the permutation to several
+/// columns with GatherColumns.
+template<class Key, class Index, bool Descending>
+inline void arg_sort()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                       = Key;
+    using index_type                     = Index;
+    using column_type                    = double;
+    constexpr unsigned int start_bit     = 0;
+    constexpr unsigned int end_bit       = sizeof(key_type) * 8;
+    constexpr int          columns_count = 3;
+
+    hipStream_t stream = 0;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            if(size > (1 << 20))
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+            const std::vector<key_type> keys_input = generate_key_input<key_type>(size, seed_value);
+
+            std::vector<index_type> indices_expected(size);
+            std::iota(indices_expected.begin(), indices_expected.end(), 0);
+            std::stable_sort(indices_expected.begin(),
+                             indices_expected.end(),
+                             [&](const index_type lhs, const index_type rhs)
+                             {
+                                 return test_utils::
+                                     key_comparator<key_type, Descending, start_bit, end_bit>()(
+                                         keys_input[lhs],
+                                         keys_input[rhs]);
+                             });
+            std::vector<key_type> keys_expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                keys_expected[i] = keys_input[indices_expected[i]];
+            }
+
+            key_type*   d_keys_input;
+            key_type*   d_keys_output;
+            index_type* d_indices;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_indices, size * sizeof(index_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+
+            for(bool discard_keys : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with discard_keys= " << discard_keys);
+
+                key_type* d_keys = discard_keys ? nullptr : d_keys_output;
+                auto      run    = [&](void* d_temp_storage, size_t& temp_storage_bytes)
+                {
+                    if(Descending)
+                    {
+                        return hipcub::DeviceRadixSort::ArgSortDescending(d_temp_storage,
+                                                                          temp_storage_bytes,
+                                                                          d_keys_input,
+                                                                          d_keys,
+                                                                          d_indices,
+                                                                          size,
+                                                                          start_bit,
+                                                                          end_bit,
+                                                                          stream);
+                    }
+                    return hipcub::DeviceRadixSort::ArgSort(d_temp_storage,
+                                                            temp_storage_bytes,
+                                                            d_keys_input,
+                                                            d_keys,
+                                                            d_indices,
+                                                            size,
+                                                            start_bit,
+                                                            end_bit,
+                                                            stream);
+                };
+
+                size_t temporary_storage_bytes = 0;
+                HIP_CHECK(run(nullptr, temporary_storage_bytes));
+                ASSERT_GT(temporary_storage_bytes, 0U);
+
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+                HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                std::vector<index_type> indices_output(size);
+                HIP_CHECK(hipMemcpy(indices_output.data(),
+                                    d_indices,
+                                    size * sizeof(index_type),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(indices_output, indices_expected));
+
+                if(!discard_keys)
+                {
+                    std::vector<key_type> keys_output(size);
+                    HIP_CHECK(hipMemcpy(keys_output.data(),
+                                        d_keys_output,
+                                        size * sizeof(key_type),
+                                        hipMemcpyDeviceToHost));
+                    ASSERT_NO_FATAL_FAILURE(test_utils::assert_bit_eq(keys_output, keys_expected));
+                }
+            }
+
+            // Columns are passed as device arrays of column pointers
+            std::vector<column_type*> columns_input(columns_count);
+            std::vector<column_type*> columns_output(columns_count);
+            for(int column = 0; column < columns_count; column++)
+            {
+                std::vector<column_type> values(size);
+                for(size_t i = 0; i < size; i++)
+                {
+                    values[i] = static_cast<column_type>(i * columns_count + column);
+                }
+                HIP_CHECK(test_common_utils::hipMallocHelper(&columns_input[column],
+                                                             size * sizeof(column_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&columns_output[column],
+                                                             size * sizeof(column_type)));
+                HIP_CHECK(hipMemcpy(columns_input[column],
+                                    values.data(),
+                                    size * sizeof(column_type),
+                                    hipMemcpyHostToDevice));
+            }
+            column_type** d_columns_input;
+            column_type** d_columns_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_columns_input,
+                                                         columns_count * sizeof(column_type*)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_columns_output,
+                                                         columns_count * sizeof(column_type*)));
+            HIP_CHECK(hipMemcpy(d_columns_input,
+                                columns_input.data(),
+                                columns_count * sizeof(column_type*),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_columns_output,
+                                columns_output.data(),
+                                columns_count * sizeof(column_type*),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(hipcub::DeviceRadixSort::GatherColumns(nullptr,
+                                                             temporary_storage_bytes,
+                                                             d_indices,
+                                                             d_columns_input,
+                                                             d_columns_output,
+                                                             columns_count,
+                                                             size,
+                                                             stream));
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipcub::DeviceRadixSort::GatherColumns(d_temporary_storage,
+                                                             temporary_storage_bytes,
+                                                             d_indices,
+                                                             d_columns_input,
+                                                             d_columns_output,
+                                                             columns_count,
+                                                             size,
+                                                             stream));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipFree(d_temporary_storage));
+
+            for(int column = 0; column < columns_count; column++)
+            {
+                SCOPED_TRACE(testing::Message() << "with column= " << column);
+
+                std::vector<column_type> values_output(size);
+                HIP_CHECK(hipMemcpy(values_output.data(),
+                                    columns_output[column],
+                                    size * sizeof(column_type),
+                                    hipMemcpyDeviceToHost));
+                for(size_t i = 0; i < size; i++)
+                {
+                    ASSERT_EQ(values_output[i],
+                              static_cast<column_type>(indices_expected[i] * columns_count
+                                                       + column))
+                        << "with index= " << i;
+                }
+                HIP_CHECK(hipFree(columns_input[column]));
+                HIP_CHECK(hipFree(columns_output[column]));
+            }
+
+            HIP_CHECK(hipFree(d_columns_input));
+            HIP_CHECK(hipFree(d_columns_output));
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_indices));
+        }
+    }
+}
+
+template<class T>
+T* upload_column(const std::vector<T>& values)
+{
+    T* d_values;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_values, values.size() * sizeof(T)));
+    HIP_CHECK(
+        hipMemcpy(d_values, values.data(), values.size() * sizeof(T), hipMemcpyHostToDevice));
+    return d_values;
+}
+
+template<class T>
+std::vector<T> scale_column(const std::vector<int>& values, T scale)
+{
+    std::vector<T> result(values.size());
+    for(size_t i = 0; i < values.size(); i++)
+    {
+        result[i] = static_cast<T>(values[i]) * scale;
+    }
+    return result;
+}
+
+inline void arg_sort_columns()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using index_type = unsigned int;
+
+    hipStream_t stream = 0;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            if(size > (1 << 20))
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+            // Small ranges in the leading columns give ties that the later columns break, the
+            // wide ranges of the later columns need several packed keys
+            auto random = [&](int min, int max, unsigned int column)
+            { return test_utils::get_random_data<int>(size, min, max, seed_value + column); };
+
+            const std::vector<int>            column0 = random(-3, 3, 0);
+            const std::vector<unsigned short> column1
+                = scale_column<unsigned short>(random(0, 4, 1), 1);
+            const std::vector<int>       column2(size, 7);
+            const std::vector<float>     column3 = scale_column<float>(random(-4, 4, 3), 0.5f);
+            const std::vector<long long> column4
+                = scale_column<long long>(random(-2, 2, 4), 1ll << 40);
+            const std::vector<double> column5 = scale_column<double>(random(-3, 3, 5), 1e300);
+            const std::vector<unsigned char> column6
+                = scale_column<unsigned char>(random(0, 255, 6), 1);
+
+            std::vector<index_type> indices_expected(size);
+            std::iota(indices_expected.begin(), indices_expected.end(), 0);
+            std::stable_sort(indices_expected.begin(),
+                             indices_expected.end(),
+                             [&](const index_type lhs, const index_type rhs)
+                             {
+                                 // Descending columns swap the operands
+                                 return std::tie(column0[lhs],
+                                                 column1[rhs],
+                                                 column2[lhs],
+                                                 column3[lhs],
+                                                 column4[lhs],
+                                                 column5[lhs],
+                                                 column6[rhs])
+                                        < std::tie(column0[rhs],
+                                                   column1[lhs],
+                                                   column2[rhs],
+                                                   column3[rhs],
+                                                   column4[rhs],
+                                                   column5[rhs],
+                                                   column6[lhs]);
+                             });
+
+            int*            d_column0 = upload_column(column0);
+            unsigned short* d_column1 = upload_column(column1);
+            int*            d_column2 = upload_column(column2);
+            float*          d_column3 = upload_column(column3);
+            long long*      d_column4 = upload_column(column4);
+            double*         d_column5 = upload_column(column5);
+            unsigned char*  d_column6 = upload_column(column6);
+
+            const hipcub::RadixSortColumn columns[] = {
+                hipcub::RadixSortColumn(d_column0),
+                hipcub::RadixSortColumn(d_column1, true),
+                hipcub::RadixSortColumn(d_column2),
+                hipcub::RadixSortColumn(d_column3),
+                hipcub::RadixSortColumn(d_column4),
+                hipcub::RadixSortColumn(d_column5),
+                hipcub::RadixSortColumn(d_column6, true),
+            };
+            const int columns_count = sizeof(columns) / sizeof(columns[0]);
+
+            index_type* d_indices;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_indices, size * sizeof(index_type)));
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(hipcub::DeviceRadixSort::ArgSortColumns(nullptr,
+                                                              temporary_storage_bytes,
+                                                              columns,
+                                                              columns_count,
+                                                              d_indices,
+                                                              size,
+                                                              stream));
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipcub::DeviceRadixSort::ArgSortColumns(d_temporary_storage,
+                                                              temporary_storage_bytes,
+                                                              columns,
+                                                              columns_count,
+                                                              d_indices,
+                                                              size,
+                                                              stream));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipFree(d_temporary_storage));
+
+            std::vector<index_type> indices_output(size);
+            HIP_CHECK(hipMemcpy(indices_output.data(),
+                                d_indices,
+                                size * sizeof(index_type),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(indices_output, indices_expected));
+
+            HIP_CHECK(hipFree(d_column0));
+            HIP_CHECK(hipFree(d_column1));
+            HIP_CHECK(hipFree(d_column2));
+            HIP_CHECK(hipFree(d_column3));
+            HIP_CHECK(hipFree(d_column4));
+            HIP_CHECK(hipFree(d_column5));
+            HIP_CHECK(hipFree(d_column6));
+            HIP_CHECK(hipFree(d_indices));
+        }
+    }
+}
+
+template<class Key, bool Descending>
+inline void sort_detect_bits()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type   = Key;
+    using value_type = unsigned int;
+
+    hipStream_t stream = 0;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            if(size > (1 << 20))
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+            // Integral keys differ in about 20 bits with equal bits below and above them, floating
+            // point keys have both signs. 128-bit keys are scaled so that the bits cross from the
+            // low to the high 64 bits.
+            const long long        offset = std::is_floating_point<key_type>::value ? -(1ll << 23)
+                                                                                    : (1ll << 40);
+            const key_type         scale  = static_cast<key_type>(sizeof(key_type) > 8 ? 1ull << 50
+                                                                                       : 1ull);
+            const std::vector<int> random
+                = test_utils::get_random_data<int>(size, 0, 1 << 20, seed_value);
+            std::vector<key_type> keys_input(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                keys_input[i]
+                    = static_cast<key_type>(static_cast<long long>(random[i]) * 16 + offset)
+                      * scale;
+            }
+            std::vector<value_type> values_input(size);
+            std::iota(values_input.begin(), values_input.end(), 0);
+
+            std::vector<value_type> values_expected = values_input;
+            std::stable_sort(values_expected.begin(),
+                             values_expected.end(),
+                             [&](const value_type lhs, const value_type rhs)
+                             {
+                                 return Descending ? keys_input[rhs] < keys_input[lhs]
+                                                   : keys_input[lhs] < keys_input[rhs];
+                             });
+            std::vector<key_type> keys_expected(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                keys_expected[i] = keys_input[values_expected[i]];
+            }
+
+            key_type*   d_keys_input;
+            key_type*   d_keys_output;
+            value_type* d_values_input;
+            value_type* d_values_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output, size * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_input, size * sizeof(value_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_values_output, size * sizeof(value_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+
+            for(bool pairs : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with pairs= " << pairs);
+
+                auto run = [&](void* d_temp_storage, size_t& temp_storage_bytes)
+                {
+                    if(pairs)
+                    {
+                        return Descending ? hipcub::DeviceRadixSort::SortPairsDescendingDetectBits(
+                                                d_temp_storage,
+                                                temp_storage_bytes,
+                                                d_keys_input,
+                                                d_keys_output,
+                                                d_values_input,
+                                                d_values_output,
+                                                size,
+                                                stream)
+                                          : hipcub::DeviceRadixSort::SortPairsDetectBits(
+                                                d_temp_storage,
+                                                temp_storage_bytes,
+                                                d_keys_input,
+                                                d_keys_output,
+                                                d_values_input,
+                                                d_values_output,
+                                                size,
+                                                stream);
+                    }
+                    return Descending ? hipcub::DeviceRadixSort::SortKeysDescendingDetectBits(
+                                            d_temp_storage,
+                                            temp_storage_bytes,
+                                            d_keys_input,
+                                            d_keys_output,
+                                            size,
+                                            stream)
+                                      : hipcub::DeviceRadixSort::SortKeysDetectBits(
+                                            d_temp_storage,
+                                            temp_storage_bytes,
+                                            d_keys_input,
+                                            d_keys_output,
+                                            size,
+                                            stream);
+                };
+
+                size_t temporary_storage_bytes = 0;
+                HIP_CHECK(run(nullptr, temporary_storage_bytes));
+                ASSERT_GT(temporary_storage_bytes, 0U);
+
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+                HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                std::vector<key_type> keys_output(size);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys_output,
+                                    size * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_bit_eq(keys_output, keys_expected));
+
+                if(pairs)
+                {
+                    std::vector<value_type> values_output(size);
+                    HIP_CHECK(hipMemcpy(values_output.data(),
+                                        d_values_output,
+                                        size * sizeof(value_type),
+                                        hipMemcpyDeviceToHost));
+                    ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, values_expected));
+                }
+            }
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_values_output));
+        }
+    }
+}
+
+template<class Key, bool Pairs, bool Descending>
+inline void sort_in_place()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type   = Key;
+    using value_type = unsigned int;
+
+    hipStream_t stream = 0;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            if(size > (1 << 22))
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+            // The sort is not stable, so floating point keys avoid -0.0 and NaN, whose order
+            // relative to equal keys is not defined by operator<
+            const std::vector<key_type> keys_input
+                = std::is_floating_point<key_type>::value
+                      ? test_utils::get_random_data<key_type>(size,
+                                                              static_cast<key_type>(-1000),
+                                                              static_cast<key_type>(1000),
+                                                              seed_value)
+                      : generate_key_input<key_type>(size, seed_value);
+
+            std::vector<key_type> keys_expected = keys_input;
+            std::sort(keys_expected.begin(),
+                      keys_expected.end(),
+                      [](const key_type& lhs, const key_type& rhs)
+                      { return Descending ? rhs < lhs : lhs < rhs; });
+
+            key_type*   d_keys;
+            value_type* d_values = nullptr;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, size * sizeof(key_type)));
+            HIP_CHECK(hipMemcpy(d_keys,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            if(Pairs)
+            {
+                std::vector<value_type> values_input(size);
+                std::iota(values_input.begin(), values_input.end(), 0);
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_values, size * sizeof(value_type)));
+                HIP_CHECK(hipMemcpy(d_values,
+                                    values_input.data(),
+                                    size * sizeof(value_type),
+                                    hipMemcpyHostToDevice));
+            }
+
+            auto run = [&](void* d_temp_storage, size_t& temp_storage_bytes)
+            {
+                if(Pairs && Descending)
+                {
+                    return hipcub::DeviceRadixSort::SortPairsDescendingInPlace(d_temp_storage,
+                                                                               temp_storage_bytes,
+                                                                               d_keys,
+                                                                               d_values,
+                                                                               size,
+                                                                               stream);
+                }
+                if(Pairs)
+                {
+                    return hipcub::DeviceRadixSort::SortPairsInPlace(d_temp_storage,
+                                                                     temp_storage_bytes,
+                                                                     d_keys,
+                                                                     d_values,
+                                                                     size,
+                                                                     stream);
+                }
+                if(Descending)
+                {
+                    return hipcub::DeviceRadixSort::SortKeysDescendingInPlace(d_temp_storage,
+                                                                              temp_storage_bytes,
+                                                                              d_keys,
+                                                                              size,
+                                                                              stream);
+                }
+                return hipcub::DeviceRadixSort::SortKeysInPlace(d_temp_storage,
+                                                                temp_storage_bytes,
+                                                                d_keys,
+                                                                size,
+                                                                stream);
+            };
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(run(nullptr, temporary_storage_bytes));
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipFree(d_temporary_storage));
+
+            std::vector<key_type> keys_output(size);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_bit_eq(keys_output, keys_expected));
+
+            if(Pairs)
+            {
+                // Every value must still belong to its key and appear once
+                std::vector<value_type> values_output(size);
+                HIP_CHECK(hipMemcpy(values_output.data(),
+                                    d_values,
+                                    size * sizeof(value_type),
+                                    hipMemcpyDeviceToHost));
+                std::vector<key_type> keys_of_values(size);
+                for(size_t i = 0; i < size; i++)
+                {
+                    ASSERT_LT(values_output[i], size) << "with index= " << i;
+                    keys_of_values[i] = keys_input[values_output[i]];
+                }
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_bit_eq(keys_of_values, keys_output));
+
+                std::sort(values_output.begin(), values_output.end());
+                std::vector<value_type> values_expected(size);
+                std::iota(values_expected.begin(), values_expected.end(), 0);
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, values_expected));
+
+                HIP_CHECK(hipFree(d_values));
+            }
+            HIP_CHECK(hipFree(d_keys));
+        }
+    }
+}
+
+inline void arg_sort_bytes(int key_bytes)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using index_type = unsigned int;
+
+    hipStream_t stream = 0;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            if(size > (1 << 20))
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+            // Three byte values give long shared prefixes, bytes above 127 check that the bytes
+            // compare as unsigned values, and every seventh key repeats the previous one to check
+            // stability
+            const std::vector<int> random
+                = test_utils::get_random_data<int>(size * key_bytes, 0, 2, seed_value);
+            const unsigned char        byte_values[3] = {0x00, 0x80, 0xFF};
+            std::vector<unsigned char> keys_input(size * key_bytes);
+            for(size_t i = 0; i < keys_input.size(); i++)
+            {
+                keys_input[i] = byte_values[random[i]];
+            }
+            for(size_t row = 7; row < size; row += 7)
+            {
+                std::copy_n(keys_input.begin() + (row - 1) * key_bytes,
+                            key_bytes,
+                            keys_input.begin() + row * key_bytes);
+            }
+
+            std::vector<index_type> indices_expected(size);
+            std::iota(indices_expected.begin(), indices_expected.end(), 0);
+            std::stable_sort(indices_expected.begin(),
+                             indices_expected.end(),
+                             [&](const index_type lhs, const index_type rhs)
+                             {
+                                 return std::memcmp(&keys_input[size_t(lhs) * key_bytes],
+                                                    &keys_input[size_t(rhs) * key_bytes],
+                                                    key_bytes)
+                                        < 0;
+                             });
+
+            unsigned char* d_keys;
+            index_type*    d_indices;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys, keys_input.size()));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_indices, size * sizeof(index_type)));
+            HIP_CHECK(
+                hipMemcpy(d_keys, keys_input.data(), keys_input.size(), hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(hipcub::DeviceRadixSort::ArgSortBytes(nullptr,
+                                                            temporary_storage_bytes,
+                                                            d_keys,
+                                                            key_bytes,
+                                                            d_indices,
+                                                            size,
+                                                            stream));
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipcub::DeviceRadixSort::ArgSortBytes(d_temporary_storage,
+                                                            temporary_storage_bytes,
+                                                            d_keys,
+                                                            key_bytes,
+                                                            d_indices,
+                                                            size,
+                                                            stream));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipFree(d_temporary_storage));
+
+            std::vector<index_type> indices_output(size);
+            HIP_CHECK(hipMemcpy(indices_output.data(),
+                                d_indices,
+                                size * sizeof(index_type),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(indices_output, indices_expected));
+
+            HIP_CHECK(hipFree(d_keys));
+            HIP_CHECK(hipFree(d_indices));
+        }
+    }
+}
+
+template<class Key, class Count>
+inline void sort_keys_and_count(int max_key)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type   = Key;
+    using count_type = Count;
+
+    hipStream_t stream = 0;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            if(size > (1 << 20))
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+            // Every 97th key is the largest key, which equals the padding of partial tiles
+            const std::vector<int> random
+                = test_utils::get_random_data<int>(size, 0, max_key - 1, seed_value);
+            std::vector<key_type> keys_input(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                keys_input[i] = i % 97 == 0 ? std::numeric_limits<key_type>::max()
+                                            : static_cast<key_type>(random[i] - max_key / 2);
+            }
+
+            std::vector<key_type> keys_sorted = keys_input;
+            std::sort(keys_sorted.begin(), keys_sorted.end());
+            std::vector<key_type>   unique_expected;
+            std::vector<count_type> counts_expected;
+            for(size_t i = 0; i < size; i++)
+            {
+                if(i == 0 || keys_sorted[i] != keys_sorted[i - 1])
+                {
+                    unique_expected.push_back(keys_sorted[i]);
+                    counts_expected.push_back(0);
+                }
+                counts_expected.back()++;
+            }
+
+            key_type*     d_keys_input;
+            key_type*     d_unique_output;
+            count_type*   d_counts_output;
+            unsigned int* d_num_unique_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input, size * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_unique_output, size * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_counts_output, size * sizeof(count_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_num_unique_output, sizeof(unsigned int)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(hipcub::DeviceRadixSort::SortKeysAndCount(nullptr,
+                                                                temporary_storage_bytes,
+                                                                d_keys_input,
+                                                                d_unique_output,
+                                                                d_counts_output,
+                                                                d_num_unique_output,
+                                                                size,
+                                                                stream));
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipcub::DeviceRadixSort::SortKeysAndCount(d_temporary_storage,
+                                                                temporary_storage_bytes,
+                                                                d_keys_input,
+                                                                d_unique_output,
+                                                                d_counts_output,
+                                                                d_num_unique_output,
+                                                                size,
+                                                                stream));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipFree(d_temporary_storage));
+
+            unsigned int num_unique_output;
+            HIP_CHECK(hipMemcpy(&num_unique_output,
+                                d_num_unique_output,
+                                sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+            ASSERT_EQ(num_unique_output, unique_expected.size());
+
+            std::vector<key_type>   unique_output(num_unique_output);
+            std::vector<count_type> counts_output(num_unique_output);
+            HIP_CHECK(hipMemcpy(unique_output.data(),
+                                d_unique_output,
+                                num_unique_output * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(counts_output.data(),
+                                d_counts_output,
+                                num_unique_output * sizeof(count_type),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_bit_eq(unique_output, unique_expected));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(counts_output, counts_expected));
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_unique_output));
+            HIP_CHECK(hipFree(d_counts_output));
+            HIP_CHECK(hipFree(d_num_unique_output));
+        }
+    }
+}
+
+/// Inputs of up to 2048 items are sorted by a single block, the sizes cover both sides of the
+/// limit and the empty input. A partial bit range is only used with unsigned keys.
+template<class Key, bool Descending>
+inline void sort_single_block_boundary(int begin_bit = 0, int end_bit = sizeof(Key) * 8)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type   = Key;
+    using value_type = unsigned int;
+
+    hipStream_t stream = 0;
+
+    unsigned int seed_value = rand();
+    SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+    const bool full_range = begin_bit == 0 && end_bit == int(sizeof(key_type) * 8);
+    // Compares the bits in [begin_bit, end_bit), equal keys keep their order in the stable sort
+    auto key_less = [&](const key_type& lhs, const key_type& rhs)
+    {
+        if(full_range)
+        {
+            return Descending ? rhs < lhs : lhs < rhs;
+        }
+        const unsigned long long mask = (1ull << (end_bit - begin_bit)) - 1;
+        const unsigned long long l    = (static_cast<unsigned long long>(lhs) >> begin_bit) & mask;
+        const unsigned long long r    = (static_cast<unsigned long long>(rhs) >> begin_bit) & mask;
+        return Descending ? r < l : l < r;
+    };
+
+    const std::vector<size_t> sizes = {0, 1, 2047, 2048, 2049};
+    for(size_t size : sizes)
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        const std::vector<key_type> keys_input
+            = test_utils::get_random_data<key_type>(size,
+                                                    static_cast<key_type>(0),
+                                                    static_cast<key_type>(1000),
+                                                    seed_value);
+        std::vector<value_type> values_input(size);
+        std::iota(values_input.begin(), values_input.end(), 0);
+
+        std::vector<value_type> values_expected = values_input;
+        std::stable_sort(values_expected.begin(),
+                         values_expected.end(),
+                         [&](value_type lhs, value_type rhs)
+                         { return key_less(keys_input[lhs], keys_input[rhs]); });
+        std::vector<key_type> keys_expected(size);
+        for(size_t i = 0; i < size; i++)
+        {
+            keys_expected[i] = keys_input[values_expected[i]];
+        }
+
+        for(bool pairs : {false, true})
+        {
+            SCOPED_TRACE(testing::Message() << "with pairs= " << pairs);
+
+            key_type*   d_keys_input;
+            key_type*   d_keys_output;
+            value_type* d_values_input;
+            value_type* d_values_output;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_keys_input, (size + 1) * sizeof(key_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_keys_output, (size + 1) * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                         (size + 1) * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                         (size + 1) * sizeof(value_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+
+            auto run = [&](void* d_temp_storage, size_t& temp_storage_bytes)
+            {
+                if(pairs && Descending)
+                {
+                    return hipcub::DeviceRadixSort::SortPairsDescending(d_temp_storage,
+                                                                        temp_storage_bytes,
+                                                                        d_keys_input,
+                                                                        d_keys_output,
+                                                                        d_values_input,
+                                                                        d_values_output,
+                                                                        size,
+                                                                        begin_bit,
+                                                                        end_bit,
+                                                                        stream);
+                }
+                if(pairs)
+                {
+                    return hipcub::DeviceRadixSort::SortPairs(d_temp_storage,
+                                                              temp_storage_bytes,
+                                                              d_keys_input,
+                                                              d_keys_output,
+                                                              d_values_input,
+                                                              d_values_output,
+                                                              size,
+                                                              begin_bit,
+                                                              end_bit,
+                                                              stream);
+                }
+                if(Descending)
+                {
+                    return hipcub::DeviceRadixSort::SortKeysDescending(d_temp_storage,
+                                                                       temp_storage_bytes,
+                                                                       d_keys_input,
+                                                                       d_keys_output,
+                                                                       size,
+                                                                       begin_bit,
+                                                                       end_bit,
+                                                                       stream);
+                }
+                return hipcub::DeviceRadixSort::SortKeys(d_temp_storage,
+                                                         temp_storage_bytes,
+                                                         d_keys_input,
+                                                         d_keys_output,
+                                                         size,
+                                                         begin_bit,
+                                                         end_bit,
+                                                         stream);
+            };
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(run(nullptr, temporary_storage_bytes));
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipFree(d_temporary_storage));
+
+            std::vector<key_type> keys_output(size);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_bit_eq(keys_output, keys_expected));
+
+            if(pairs)
+            {
+                std::vector<value_type> values_output(size);
+                HIP_CHECK(hipMemcpy(values_output.data(),
+                                    d_values_output,
+                                    size * sizeof(value_type),
+                                    hipMemcpyDeviceToHost));
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(values_output, values_expected));
+            }
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_values_output));
+        }
+    }
+}
+
 #endif // HIPCUB_TEST_HIPCUB_DEVICE_RADIX_SORT_HPP_
@@ -30,6 +30,7 @@
 #include "hipcub/iterator/constant_input_iterator.hpp"
 
 #include "test_utils_data_generation.hpp"
+#include "test_utils_reproducible.hpp"
 
 #include <bitset>
 
@@ -813,3 +814,454 @@ TYPED_TEST(HipcubDeviceReduceLargeIndicesTests, LargeIndices)
         }
     }
 }
+
+// ---------------------------------------------------------
+// Test for the single-pass statistics reduction
+// ---------------------------------------------------------
+
+template<class T>
+class HipcubDeviceReduceStatisticsTests : public ::testing::Test
+{};
+
+using HipcubDeviceReduceStatisticsTestsParams = ::testing::Types<float, double, int, short>;
+TYPED_TEST_SUITE(HipcubDeviceReduceStatisticsTests, HipcubDeviceReduceStatisticsTestsParams);
+
+TYPED_TEST(HipcubDeviceReduceStatisticsTests, Statistics)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T            = TypeParam;
+    using statistics   = hipcub::ReduceStatistics<T, double>;
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+            // Generate data, every 97th item of floating-point inputs is NaN
+            std::vector<T> input = test_utils::get_random_data<T>(size, -100, 100, seed_value);
+            if(std::is_floating_point<T>::value)
+            {
+                for(size_t i = 0; i < size; i += 97)
+                {
+                    input[i] = std::numeric_limits<T>::quiet_NaN();
+                }
+            }
+
+            size_t expected_count     = 0;
+            size_t expected_nan_count = 0;
+            double expected_sum       = 0;
+            double expected_squares   = 0;
+            size_t expected_arg_min   = 0;
+            size_t expected_arg_max   = 0;
+            for(size_t i = 0; i < size; i++)
+            {
+                if(input[i] != input[i])
+                {
+                    expected_nan_count++;
+                    continue;
+                }
+                if(expected_count == 0 || input[i] < input[expected_arg_min])
+                {
+                    expected_arg_min = i;
+                }
+                if(expected_count == 0 || input[expected_arg_max] < input[i])
+                {
+                    expected_arg_max = i;
+                }
+                expected_count++;
+                expected_sum += static_cast<double>(input[i]);
+                expected_squares += static_cast<double>(input[i]) * static_cast<double>(input[i]);
+            }
+            const double expected_mean
+                = expected_count > 0 ? expected_sum / static_cast<double>(expected_count) : 0.0;
+            double expected_m2 = 0;
+            for(size_t i = 0; i < size; i++)
+            {
+                if(input[i] == input[i])
+                {
+                    const double delta = static_cast<double>(input[i]) - expected_mean;
+                    expected_m2 += delta * delta;
+                }
+            }
+
+            T*          d_input;
+            statistics* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(statistics)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(hipcub::DeviceReduce::Statistics(d_temp_storage,
+                                                       temp_storage_size_bytes,
+                                                       d_input,
+                                                       d_output,
+                                                       size,
+                                                       stream));
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0U);
+
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            HIP_CHECK(hipcub::DeviceReduce::Statistics(d_temp_storage,
+                                                       temp_storage_size_bytes,
+                                                       d_input,
+                                                       d_output,
+                                                       size,
+                                                       stream));
+            HIP_CHECK(hipPeekAtLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            statistics output;
+            HIP_CHECK(hipMemcpy(&output, d_output, sizeof(statistics), hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+
+            ASSERT_EQ(output.count, expected_count);
+            ASSERT_EQ(output.nan_count, expected_nan_count);
+            // Inputs are within [-100, 100] and accumulated in double
+            const double tolerance = 1e-9 * (size + 1);
+            ASSERT_NEAR(output.sum, expected_sum, 100 * tolerance);
+            ASSERT_NEAR(output.sum_squares, expected_squares, 10000 * tolerance);
+            ASSERT_NEAR(output.mean, expected_mean, 1e-9);
+            ASSERT_NEAR(output.m2, expected_m2, 10000 * tolerance);
+            if(expected_count > 0)
+            {
+                ASSERT_EQ(output.min, input[expected_arg_min]);
+                ASSERT_EQ(output.max, input[expected_arg_max]);
+                ASSERT_EQ(output.arg_min, expected_arg_min);
+                ASSERT_EQ(output.arg_max, expected_arg_max);
+            }
+        }
+    }
+}
+
+TYPED_TEST(HipcubDeviceReduceStatisticsTests, StatisticsSubset)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T            = TypeParam;
+    using statistics   = hipcub::ReduceStatistics<T, double>;
+    hipStream_t stream = 0; // default
+
+    constexpr unsigned int flags = hipcub::REDUCE_STATISTICS_MIN | hipcub::REDUCE_STATISTICS_SUM;
+    const size_t           size  = 12345;
+    std::vector<T>         input = test_utils::get_random_data<T>(size, -100, 100, seeds[0]);
+
+    T*          d_input;
+    statistics* d_output;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, size * sizeof(T)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(statistics)));
+    HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+    size_t temp_storage_size_bytes;
+    void*  d_temp_storage = nullptr;
+    HIP_CHECK(hipcub::DeviceReduce::Statistics<flags>(d_temp_storage,
+                                                      temp_storage_size_bytes,
+                                                      d_input,
+                                                      d_output,
+                                                      size,
+                                                      stream));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+    HIP_CHECK(hipcub::DeviceReduce::Statistics<flags>(d_temp_storage,
+                                                      temp_storage_size_bytes,
+                                                      d_input,
+                                                      d_output,
+                                                      size,
+                                                      stream));
+    HIP_CHECK(hipPeekAtLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    statistics output;
+    HIP_CHECK(hipMemcpy(&output, d_output, sizeof(statistics), hipMemcpyDeviceToHost));
+
+    HIP_CHECK(hipFree(d_input));
+    HIP_CHECK(hipFree(d_output));
+    HIP_CHECK(hipFree(d_temp_storage));
+
+    double expected_sum = 0;
+    for(const T& value : input)
+    {
+        expected_sum += static_cast<double>(value);
+    }
+
+    // Statistics that were not selected keep their identity values
+    ASSERT_EQ(output.count, size);
+    ASSERT_EQ(output.min, *std::min_element(input.begin(), input.end()));
+    ASSERT_NEAR(output.sum, expected_sum, 1e-6 * size);
+    ASSERT_EQ(output.sum_squares, 0.0);
+    ASSERT_EQ(output.m2, 0.0);
+    ASSERT_EQ(output.max, std::numeric_limits<T>::lowest());
+}
+
+template<class T>
+class HipcubDeviceReduceReproducibleTests : public ::testing::Test
+{};
+
+using HipcubDeviceReduceReproducibleTestsParams = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(HipcubDeviceReduceReproducibleTests, HipcubDeviceReduceReproducibleTestsParams);
+
+TYPED_TEST(HipcubDeviceReduceReproducibleTests, ReproducibleSum)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T            = TypeParam;
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        std::vector<size_t> sizes = test_utils::get_sizes(seed_value);
+        if(seed_index == 0)
+        {
+            // More than one level of tile totals
+            sizes.push_back(test_utils::reproducible_items_per_tile
+                                * test_utils::reproducible_items_per_tile
+                            + 4097);
+        }
+        for(size_t size : sizes)
+        {
+            SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+            // Mixed magnitudes and signs make the result depend on the order of the additions
+            std::vector<T> input = test_utils::get_random_data<T>(size, -1000, 1000, seed_value);
+            for(size_t i = 0; i < size; i += 7)
+            {
+                input[i] *= T(1e-6);
+            }
+            const T expected = test_utils::reproducible_sum<T>(input);
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            size_t temp_storage_size_bytes;
+            void*  d_temp_storage = nullptr;
+            HIP_CHECK(hipcub::DeviceReduce::ReproducibleSum(d_temp_storage,
+                                                            temp_storage_size_bytes,
+                                                            d_input,
+                                                            d_output,
+                                                            size,
+                                                            stream));
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0U);
+
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+
+            // Repeated runs and the host emulation of the fixed order must agree bitwise
+            for(int run = 0; run < 2; run++)
+            {
+                HIP_CHECK(hipcub::DeviceReduce::ReproducibleSum(d_temp_storage,
+                                                                temp_storage_size_bytes,
+                                                                d_input,
+                                                                d_output,
+                                                                size,
+                                                                stream));
+                HIP_CHECK(hipPeekAtLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                T output;
+                HIP_CHECK(hipMemcpy(&output, d_output, sizeof(T), hipMemcpyDeviceToHost));
+                ASSERT_EQ(output, expected);
+            }
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
+
+template<class T>
+class HipcubDeviceReduceAccumulatorTests : public ::testing::Test
+{};
+
+using HipcubDeviceReduceAccumulatorTestsParams
+    = ::testing::Types<test_utils::half, test_utils::bfloat16, float>;
+TYPED_TEST_SUITE(HipcubDeviceReduceAccumulatorTests, HipcubDeviceReduceAccumulatorTestsParams);
+
+template<class T, bool Compensated>
+void test_accumulated_sum()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+            std::vector<T> input = test_utils::get_random_data<T>(size, 0, 2, seed_value);
+            if(Compensated && size > 1)
+            {
+                // Large terms that cancel out hide the small ones from a plain float sum
+                input[0]        = T(30000.0f);
+                input[size - 1] = T(-30000.0f);
+            }
+            double expected = 0;
+            for(const T& value : input)
+            {
+                expected += static_cast<double>(test_utils::convert_to_native(value));
+            }
+
+            T*     d_input;
+            float* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(float)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            auto run = [&](void* d_temp_storage, size_t& temp_storage_bytes)
+            {
+                if(Compensated)
+                {
+                    return hipcub::DeviceReduce::CompensatedSum<float>(d_temp_storage,
+                                                                       temp_storage_bytes,
+                                                                       d_input,
+                                                                       d_output,
+                                                                       size,
+                                                                       stream);
+                }
+                return hipcub::DeviceReduce::MixedPrecisionSum<float>(d_temp_storage,
+                                                                      temp_storage_bytes,
+                                                                      d_input,
+                                                                      d_output,
+                                                                      size,
+                                                                      stream);
+            };
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(run(nullptr, temp_storage_size_bytes));
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0U);
+
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(run(d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(hipPeekAtLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            float output;
+            HIP_CHECK(hipMemcpy(&output, d_output, sizeof(float), hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+
+            // Accumulating in the input type would lose most digits for half and bfloat16
+            const double tolerance = Compensated ? 1e-6 * std::abs(expected) + 1e-3
+                                                 : 1e-5 * std::abs(expected) + 1e-3;
+            ASSERT_NEAR(output, expected, tolerance);
+        }
+    }
+}
+
+TYPED_TEST(HipcubDeviceReduceAccumulatorTests, MixedPrecisionSum)
+{
+    test_accumulated_sum<TypeParam, false>();
+}
+
+TYPED_TEST(HipcubDeviceReduceAccumulatorTests, CompensatedSum)
+{
+    test_accumulated_sum<TypeParam, true>();
+}
+
+// Inputs of up to 2048 items are reduced by a single block, the sizes cover both sides of the
+// limit and the empty input
+TEST(HipcubDeviceReduceTests, ReduceSingleBlockBoundary)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+
+    hipStream_t stream = 0; // default
+
+    unsigned int seed_value = rand();
+    SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+    const std::vector<size_t> sizes = {0, 1, 2047, 2048, 2049};
+    for(size_t size : sizes)
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        std::vector<T> input    = test_utils::get_random_data<T>(size, -100, 100, seed_value);
+        const T        init     = 10;
+        T              expected = init;
+        for(const T& value : input)
+        {
+            expected += value;
+        }
+
+        T* d_input;
+        T* d_output;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(T)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, sizeof(T)));
+        HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+        size_t temp_storage_size_bytes;
+        void*  d_temp_storage = nullptr;
+        HIP_CHECK(hipcub::DeviceReduce::Reduce(d_temp_storage,
+                                               temp_storage_size_bytes,
+                                               d_input,
+                                               d_output,
+                                               size,
+                                               hipcub::Sum(),
+                                               init,
+                                               stream));
+
+        // temp_storage_size_bytes must be >0
+        ASSERT_GT(temp_storage_size_bytes, 0U);
+
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+        HIP_CHECK(hipcub::DeviceReduce::Reduce(d_temp_storage,
+                                               temp_storage_size_bytes,
+                                               d_input,
+                                               d_output,
+                                               size,
+                                               hipcub::Sum(),
+                                               init,
+                                               stream));
+        HIP_CHECK(hipPeekAtLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        T output;
+        HIP_CHECK(hipMemcpy(&output, d_output, sizeof(T), hipMemcpyDeviceToHost));
+        ASSERT_EQ(output, expected);
+
+        HIP_CHECK(hipFree(d_input));
+        HIP_CHECK(hipFree(d_output));
+        HIP_CHECK(hipFree(d_temp_storage));
+    }
+}
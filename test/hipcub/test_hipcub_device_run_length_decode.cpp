@@ -0,0 +1,286 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "common_test_header.hpp"
+
+// hipcub API
+#include "hipcub/device/device_run_length_decode.hpp"
+
+#include "test_utils_data_generation.hpp"
+
+#include <numeric>
+
+template<class Value, class Length, unsigned int MinRunLength, unsigned int MaxRunLength>
+struct params
+{
+    using value_type                             = Value;
+    using length_type                            = Length;
+    static constexpr unsigned int min_run_length = MinRunLength;
+    static constexpr unsigned int max_run_length = MaxRunLength;
+};
+
+template<class Params>
+class HipcubDeviceRunLengthDecode : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+typedef ::testing::Types<params<int, int, 0, 1>,
+                         params<double, unsigned int, 0, 10>,
+                         params<float, int, 1, 100>,
+                         params<unsigned long long, size_t, 0, 3000>,
+                         params<short, unsigned int, 2048, 2048>,
+                         params<unsigned char, unsigned long long, 0, 100000>>
+    Params;
+
+TYPED_TEST_SUITE(HipcubDeviceRunLengthDecode, Params);
+
+// Mostly short runs with a few very long ones, so that the work per run is heavily skewed
+template<class Length>
+std::vector<Length> generate_run_lengths(size_t                      size,
+                                         unsigned int                min_run_length,
+                                         unsigned int                max_run_length,
+                                         std::default_random_engine& gen)
+{
+    std::uniform_int_distribution<unsigned int> run_length_dis(min_run_length, max_run_length);
+    std::uniform_int_distribution<unsigned int> long_run_dis(0, 63);
+
+    std::vector<Length> lengths;
+    size_t              total = 0;
+    while(total < size)
+    {
+        size_t length = run_length_dis(gen);
+        if(long_run_dis(gen) == 0)
+        {
+            length *= 50;
+        }
+        length = std::min(length, size - total);
+        lengths.push_back(static_cast<Length>(length));
+        total += length;
+    }
+    return lengths;
+}
+
+TYPED_TEST(HipcubDeviceRunLengthDecode, Decode)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using value_type  = typename TestFixture::params::value_type;
+    using length_type = typename TestFixture::params::length_type;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        std::default_random_engine gen(seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+            const std::vector<length_type> lengths
+                = generate_run_lengths<length_type>(size,
+                                                    TestFixture::params::min_run_length,
+                                                    TestFixture::params::max_run_length,
+                                                    gen);
+            const size_t                  runs_count = lengths.size();
+            const std::vector<value_type> values
+                = test_utils::get_random_data<value_type>(runs_count, 0, 100, seed_value);
+
+            std::vector<value_type> expected;
+            for(size_t i = 0; i < runs_count; i++)
+            {
+                expected.insert(expected.end(), static_cast<size_t>(lengths[i]), values[i]);
+            }
+
+            value_type*  d_values;
+            length_type* d_lengths;
+            value_type*  d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values,
+                                                         (runs_count + 1) * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_lengths,
+                                                         (runs_count + 1) * sizeof(length_type)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_output, (size + 1) * sizeof(value_type)));
+            HIP_CHECK(hipMemcpy(d_values,
+                                values.data(),
+                                runs_count * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_lengths,
+                                lengths.data(),
+                                runs_count * sizeof(length_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(hipcub::DeviceRunLengthDecode::Decode(nullptr,
+                                                            temporary_storage_bytes,
+                                                            d_values,
+                                                            d_lengths,
+                                                            d_output,
+                                                            runs_count,
+                                                            stream));
+
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(hipcub::DeviceRunLengthDecode::Decode(d_temporary_storage,
+                                                            temporary_storage_bytes,
+                                                            d_values,
+                                                            d_lengths,
+                                                            d_output,
+                                                            runs_count,
+                                                            stream));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<value_type> output(size);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                size * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_values));
+            HIP_CHECK(hipFree(d_lengths));
+            HIP_CHECK(hipFree(d_output));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+        }
+    }
+}
+
+TYPED_TEST(HipcubDeviceRunLengthDecode, DecodeOffsets)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using value_type  = typename TestFixture::params::value_type;
+    using offset_type = typename TestFixture::params::length_type;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        std::default_random_engine gen(seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+            const std::vector<offset_type> lengths
+                = generate_run_lengths<offset_type>(size,
+                                                    TestFixture::params::min_run_length,
+                                                    TestFixture::params::max_run_length,
+                                                    gen);
+            const size_t                  runs_count = lengths.size();
+            const std::vector<value_type> values
+                = test_utils::get_random_data<value_type>(runs_count, 0, 100, seed_value);
+
+            // The offsets do not start at zero, positions before the first run are untouched
+            const offset_type        first = 7;
+            std::vector<offset_type> offsets(runs_count + 1, first);
+            std::partial_sum(lengths.begin(), lengths.end(), offsets.begin() + 1);
+            for(size_t i = 1; i < offsets.size(); i++)
+            {
+                offsets[i] += first;
+            }
+
+            std::vector<value_type> expected(first, value_type(0));
+            for(size_t i = 0; i < runs_count; i++)
+            {
+                expected.insert(expected.end(), static_cast<size_t>(lengths[i]), values[i]);
+            }
+
+            value_type*  d_values;
+            offset_type* d_offsets;
+            value_type*  d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values,
+                                                         (runs_count + 1) * sizeof(value_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                         (runs_count + 1) * sizeof(offset_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output,
+                                                         expected.size() * sizeof(value_type)));
+            HIP_CHECK(hipMemcpy(d_values,
+                                values.data(),
+                                runs_count * sizeof(value_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_offsets,
+                                offsets.data(),
+                                (runs_count + 1) * sizeof(offset_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemset(d_output, 0, expected.size() * sizeof(value_type)));
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(hipcub::DeviceRunLengthDecode::DecodeOffsets(nullptr,
+                                                                   temporary_storage_bytes,
+                                                                   d_values,
+                                                                   d_offsets,
+                                                                   d_output,
+                                                                   runs_count,
+                                                                   stream));
+
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+
+            HIP_CHECK(hipcub::DeviceRunLengthDecode::DecodeOffsets(d_temporary_storage,
+                                                                   temporary_storage_bytes,
+                                                                   d_values,
+                                                                   d_offsets,
+                                                                   d_output,
+                                                                   runs_count,
+                                                                   stream));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<value_type> output(expected.size());
+            HIP_CHECK(hipMemcpy(output.data(),
+                                d_output,
+                                output.size() * sizeof(value_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_values));
+            HIP_CHECK(hipFree(d_offsets));
+            HIP_CHECK(hipFree(d_output));
+
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+        }
+    }
+}
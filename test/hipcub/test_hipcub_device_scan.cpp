@@ -31,6 +31,7 @@
 #include "single_index_iterator.hpp"
 #include "test_utils_bfloat16.hpp"
 #include "test_utils_data_generation.hpp"
+#include "test_utils_reproducible.hpp"
 
 // Params for tests
 template<class InputType,
@@ -1229,3 +1230,211 @@ TYPED_TEST(HipcubDeviceScanTests, ExclusiveScanFuture)
     if(TestFixture::use_graphs)
         HIP_CHECK(hipStreamDestroy(stream));
 }
+
+template<class T>
+class HipcubDeviceScanReproducibleTests : public ::testing::Test
+{};
+
+using HipcubDeviceScanReproducibleTestsParams = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(HipcubDeviceScanReproducibleTests, HipcubDeviceScanReproducibleTestsParams);
+
+TYPED_TEST(HipcubDeviceScanReproducibleTests, ReproducibleSum)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T            = TypeParam;
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            for(bool exclusive : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with size= " << size);
+                SCOPED_TRACE(testing::Message() << "with exclusive= " << exclusive);
+
+                // Mixed magnitudes and signs make the result depend on the order of the additions
+                std::vector<T> input
+                    = test_utils::get_random_data<T>(size, -1000, 1000, seed_value);
+                for(size_t i = 0; i < size; i += 7)
+                {
+                    input[i] *= T(1e-6);
+                }
+                const std::vector<T> expected = test_utils::reproducible_scan<T>(input, exclusive);
+
+                T* d_input;
+                T* d_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(T)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, (size + 1) * sizeof(T)));
+                HIP_CHECK(
+                    hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+                auto run = [&](void* d_temp_storage, size_t& temp_storage_bytes)
+                {
+                    if(exclusive)
+                    {
+                        return hipcub::DeviceScan::ReproducibleExclusiveSum(d_temp_storage,
+                                                                            temp_storage_bytes,
+                                                                            d_input,
+                                                                            d_output,
+                                                                            size,
+                                                                            stream);
+                    }
+                    return hipcub::DeviceScan::ReproducibleInclusiveSum(d_temp_storage,
+                                                                        temp_storage_bytes,
+                                                                        d_input,
+                                                                        d_output,
+                                                                        size,
+                                                                        stream);
+                };
+
+                size_t temp_storage_size_bytes;
+                HIP_CHECK(run(nullptr, temp_storage_size_bytes));
+
+                // temp_storage_size_bytes must be >0
+                ASSERT_GT(temp_storage_size_bytes, 0U);
+
+                void* d_temp_storage;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(run(d_temp_storage, temp_storage_size_bytes));
+                HIP_CHECK(hipPeekAtLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                std::vector<T> output(size);
+                HIP_CHECK(hipMemcpy(output.data(),
+                                    d_output,
+                                    size * sizeof(T),
+                                    hipMemcpyDeviceToHost));
+
+                HIP_CHECK(hipFree(d_input));
+                HIP_CHECK(hipFree(d_output));
+                HIP_CHECK(hipFree(d_temp_storage));
+
+                // The host emulation of the fixed order must agree bitwise
+                ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+            }
+        }
+    }
+}
+
+// Inputs of up to 2048 items are scanned by a single block, the sizes cover both sides of the
+// limit and the empty input. The in-place overloads are checked as well.
+TEST(HipcubDeviceScanTests, ScanSingleBlockBoundary)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+
+    hipStream_t stream = 0; // default
+
+    unsigned int seed_value = rand();
+    SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+    const std::vector<size_t> sizes = {0, 1, 2047, 2048, 2049};
+    for(size_t size : sizes)
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        std::vector<T> input = test_utils::get_random_data<T>(size, -100, 100, seed_value);
+        const T        init  = 10;
+
+        std::vector<T> expected_inclusive(size);
+        std::vector<T> expected_exclusive(size);
+        T              inclusive = 0;
+        for(size_t i = 0; i < size; i++)
+        {
+            expected_exclusive[i] = init + inclusive;
+            inclusive += input[i];
+            expected_inclusive[i] = inclusive;
+        }
+
+        for(int variant = 0; variant < 4; variant++)
+        {
+            const bool exclusive = (variant & 1) != 0;
+            const bool in_place  = (variant & 2) != 0;
+            SCOPED_TRACE(testing::Message()
+                         << "with exclusive= " << exclusive << ", in_place= " << in_place);
+
+            T* d_input;
+            T* d_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, (size + 1) * sizeof(T)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+
+            auto run = [&](void* d_temp_storage, size_t& temp_storage_bytes)
+            {
+                if(exclusive && in_place)
+                {
+                    return hipcub::DeviceScan::ExclusiveScan(d_temp_storage,
+                                                             temp_storage_bytes,
+                                                             d_input,
+                                                             hipcub::Sum(),
+                                                             init,
+                                                             size,
+                                                             stream);
+                }
+                if(exclusive)
+                {
+                    return hipcub::DeviceScan::ExclusiveScan(d_temp_storage,
+                                                             temp_storage_bytes,
+                                                             d_input,
+                                                             d_output,
+                                                             hipcub::Sum(),
+                                                             init,
+                                                             size,
+                                                             stream);
+                }
+                if(in_place)
+                {
+                    return hipcub::DeviceScan::InclusiveScan(d_temp_storage,
+                                                             temp_storage_bytes,
+                                                             d_input,
+                                                             hipcub::Sum(),
+                                                             size,
+                                                             stream);
+                }
+                return hipcub::DeviceScan::InclusiveScan(d_temp_storage,
+                                                         temp_storage_bytes,
+                                                         d_input,
+                                                         d_output,
+                                                         hipcub::Sum(),
+                                                         size,
+                                                         stream);
+            };
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(run(nullptr, temp_storage_size_bytes));
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0U);
+
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(run(d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(hipPeekAtLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<T> output(size);
+            HIP_CHECK(hipMemcpy(output.data(),
+                                in_place ? d_input : d_output,
+                                size * sizeof(T),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(
+                test_utils::assert_eq(output, exclusive ? expected_exclusive : expected_inclusive));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
@@ -0,0 +1,329 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "common_test_header.hpp"
+
+// hipcub API
+#include "hipcub/device/device_segmented_histogram.hpp"
+
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <vector>
+
+template<class Sample,
+         class Counter,
+         int          Bins,
+         int          LowerLevel,
+         int          UpperLevel,
+         unsigned int MinSegmentLength,
+         unsigned int MaxSegmentLength>
+struct params
+{
+    using sample_type                                = Sample;
+    using counter_type                               = Counter;
+    static constexpr int          bins               = Bins;
+    static constexpr int          lower_level        = LowerLevel;
+    static constexpr int          upper_level        = UpperLevel;
+    static constexpr unsigned int min_segment_length = MinSegmentLength;
+    static constexpr unsigned int max_segment_length = MaxSegmentLength;
+};
+
+template<class Params>
+class HipcubDeviceSegmentedHistogram : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+// Covers histograms privatised in LDS (<= 2048 bins), histograms counted with global atomics
+// and empty segments.
+typedef ::testing::Types<params<int, int, 10, 0, 100, 0, 100>,
+                         params<unsigned char, unsigned int, 256, 0, 256, 1, 3000>,
+                         params<unsigned short, unsigned int, 2048, 0, 4096, 0, 10000>,
+                         params<int, unsigned long long, 7, -50, 50, 0, 10>,
+                         params<short, int, 3000, -3000, 3000, 100, 5000>,
+                         params<unsigned int, unsigned int, 10000, 0, 100000, 0, 20000>>
+    Params;
+
+TYPED_TEST_SUITE(HipcubDeviceSegmentedHistogram, Params);
+
+TYPED_TEST(HipcubDeviceSegmentedHistogram, Even)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using sample_type         = typename TestFixture::params::sample_type;
+    using counter_type        = typename TestFixture::params::counter_type;
+    using offset_type         = unsigned int;
+    constexpr int bins        = TestFixture::params::bins;
+    constexpr int lower_level = TestFixture::params::lower_level;
+    constexpr int upper_level = TestFixture::params::upper_level;
+
+    hipStream_t stream = 0;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        std::default_random_engine            gen(seed_value);
+        std::uniform_int_distribution<size_t> segment_length_dis(
+            TestFixture::params::min_segment_length,
+            TestFixture::params::max_segment_length);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+            // Some samples are outside of the levels and must not be counted
+            const long long margin = (upper_level - lower_level) / 10;
+
+            std::vector<sample_type> samples = test_utils::get_random_data<sample_type>(
+                size,
+                static_cast<sample_type>(std::max<long long>(
+                    lower_level - margin,
+                    static_cast<long long>(std::numeric_limits<sample_type>::lowest()))),
+                static_cast<sample_type>(std::min<long long>(
+                    upper_level + margin,
+                    static_cast<long long>(std::numeric_limits<sample_type>::max()))),
+                seed_value);
+
+            std::vector<offset_type> offsets;
+            size_t                   offset = 0;
+            while(offset < size)
+            {
+                offsets.push_back(offset);
+                offset += segment_length_dis(gen);
+            }
+            offsets.push_back(size);
+            const int    segments_count = static_cast<int>(offsets.size() - 1);
+            const size_t histogram_size = static_cast<size_t>(segments_count) * bins;
+
+            std::vector<counter_type> expected(histogram_size, 0);
+            for(int segment = 0; segment < segments_count; segment++)
+            {
+                for(size_t i = offsets[segment]; i < offsets[segment + 1]; i++)
+                {
+                    const long long sample = static_cast<long long>(samples[i]);
+                    if(sample >= lower_level && sample < upper_level)
+                    {
+                        const long long bin
+                            = (sample - lower_level) * bins / (upper_level - lower_level);
+                        expected[static_cast<size_t>(segment) * bins + bin]++;
+                    }
+                }
+            }
+
+            sample_type*  d_samples;
+            counter_type* d_histogram;
+            offset_type*  d_offsets;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_samples,
+                                                         (size + 1) * sizeof(sample_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_histogram,
+                                                         (histogram_size + 1)
+                                                             * sizeof(counter_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                         offsets.size() * sizeof(offset_type)));
+            HIP_CHECK(hipMemcpy(d_samples,
+                                samples.data(),
+                                size * sizeof(sample_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_offsets,
+                                offsets.data(),
+                                offsets.size() * sizeof(offset_type),
+                                hipMemcpyHostToDevice));
+            // The histograms must be overwritten, not accumulated into
+            HIP_CHECK(hipMemset(d_histogram, 0xFF, histogram_size * sizeof(counter_type)));
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(hipcub::DeviceSegmentedHistogram::HistogramEven(nullptr,
+                                                                      temporary_storage_bytes,
+                                                                      d_samples,
+                                                                      d_histogram,
+                                                                      bins + 1,
+                                                                      lower_level,
+                                                                      upper_level,
+                                                                      segments_count,
+                                                                      d_offsets,
+                                                                      d_offsets + 1,
+                                                                      stream));
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipcub::DeviceSegmentedHistogram::HistogramEven(d_temporary_storage,
+                                                                      temporary_storage_bytes,
+                                                                      d_samples,
+                                                                      d_histogram,
+                                                                      bins + 1,
+                                                                      lower_level,
+                                                                      upper_level,
+                                                                      segments_count,
+                                                                      d_offsets,
+                                                                      d_offsets + 1,
+                                                                      stream));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipFree(d_temporary_storage));
+
+            std::vector<counter_type> histogram(histogram_size);
+            HIP_CHECK(hipMemcpy(histogram.data(),
+                                d_histogram,
+                                histogram_size * sizeof(counter_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_samples));
+            HIP_CHECK(hipFree(d_histogram));
+            HIP_CHECK(hipFree(d_offsets));
+
+            for(size_t i = 0; i < histogram_size; i++)
+            {
+                ASSERT_EQ(histogram[i], expected[i])
+                    << "with segment= " << i / bins << " bin= " << i % bins;
+            }
+        }
+    }
+}
+
+TEST(HipcubDeviceSegmentedHistogramTests, Range)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using sample_type  = float;
+    using counter_type = unsigned int;
+
+    // Gaps between the segments and an empty segment, samples in the gaps are not counted
+    const std::vector<int> begin_offsets  = {0, 10, 500, 500, 3000};
+    const std::vector<int> end_offsets    = {5, 400, 500, 2800, 20000};
+    const size_t           size           = end_offsets.back();
+    const int              segments_count = static_cast<int>(begin_offsets.size());
+
+    const std::vector<sample_type> samples
+        = test_utils::get_random_data<sample_type>(size, -10.0f, 1010.0f, 0);
+
+    sample_type* d_samples;
+    int*         d_begin_offsets;
+    int*         d_end_offsets;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_samples, size * sizeof(sample_type)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_begin_offsets, segments_count * sizeof(int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_end_offsets, segments_count * sizeof(int)));
+    HIP_CHECK(hipMemcpy(d_samples,
+                        samples.data(),
+                        size * sizeof(sample_type),
+                        hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_begin_offsets,
+                        begin_offsets.data(),
+                        segments_count * sizeof(int),
+                        hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_end_offsets,
+                        end_offsets.data(),
+                        segments_count * sizeof(int),
+                        hipMemcpyHostToDevice));
+
+    // Both the LDS and the global atomics paths, with levels of uneven widths
+    for(int bins : {17, 4000})
+    {
+        SCOPED_TRACE(testing::Message() << "with bins= " << bins);
+
+        std::vector<sample_type> levels(bins + 1);
+        for(int i = 0; i <= bins; i++)
+        {
+            levels[i] = 1000.0f * i * i / (static_cast<float>(bins) * bins);
+        }
+
+        const size_t              histogram_size = static_cast<size_t>(segments_count) * bins;
+        std::vector<counter_type> expected(histogram_size, 0);
+        for(int segment = 0; segment < segments_count; segment++)
+        {
+            for(int i = begin_offsets[segment]; i < end_offsets[segment]; i++)
+            {
+                const auto level = std::upper_bound(levels.begin(), levels.end(), samples[i]);
+                if(level != levels.begin() && level != levels.end())
+                {
+                    expected[static_cast<size_t>(segment) * bins + (level - levels.begin() - 1)]++;
+                }
+            }
+        }
+
+        sample_type*  d_levels;
+        counter_type* d_histogram;
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_levels, levels.size() * sizeof(float)));
+        HIP_CHECK(test_common_utils::hipMallocHelper(&d_histogram,
+                                                     histogram_size * sizeof(counter_type)));
+        HIP_CHECK(hipMemcpy(d_levels,
+                            levels.data(),
+                            levels.size() * sizeof(float),
+                            hipMemcpyHostToDevice));
+
+        size_t temporary_storage_bytes = 0;
+        HIP_CHECK(hipcub::DeviceSegmentedHistogram::HistogramRange(nullptr,
+                                                                   temporary_storage_bytes,
+                                                                   d_samples,
+                                                                   d_histogram,
+                                                                   bins + 1,
+                                                                   d_levels,
+                                                                   segments_count,
+                                                                   d_begin_offsets,
+                                                                   d_end_offsets));
+
+        void* d_temporary_storage;
+        HIP_CHECK(
+            test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+        HIP_CHECK(hipcub::DeviceSegmentedHistogram::HistogramRange(d_temporary_storage,
+                                                                   temporary_storage_bytes,
+                                                                   d_samples,
+                                                                   d_histogram,
+                                                                   bins + 1,
+                                                                   d_levels,
+                                                                   segments_count,
+                                                                   d_begin_offsets,
+                                                                   d_end_offsets));
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipFree(d_temporary_storage));
+
+        std::vector<counter_type> histogram(histogram_size);
+        HIP_CHECK(hipMemcpy(histogram.data(),
+                            d_histogram,
+                            histogram_size * sizeof(counter_type),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipFree(d_levels));
+        HIP_CHECK(hipFree(d_histogram));
+
+        for(size_t i = 0; i < histogram_size; i++)
+        {
+            ASSERT_EQ(histogram[i], expected[i])
+                << "with segment= " << i / bins << " bin= " << i % bins;
+        }
+    }
+
+    HIP_CHECK(hipFree(d_samples));
+    HIP_CHECK(hipFree(d_begin_offsets));
+    HIP_CHECK(hipFree(d_end_offsets));
+}
@@ -1438,4 +1438,169 @@ inline void sort_pairs_double_buffer()
     }
 }
 
+template<typename TestFixture>
+inline void sort_pairs_fixed_size()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type                    = typename TestFixture::params::key_type;
+    using value_type                  = typename TestFixture::params::value_type;
+    constexpr bool         descending = TestFixture::params::descending;
+    constexpr unsigned int start_bit  = TestFixture::params::start_bit;
+    constexpr unsigned int end_bit    = TestFixture::params::end_bit;
+
+    hipStream_t stream = 0;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        // Covers the small block, the single block and the segmented radix sort fallback
+        for(int segment_size : {1, 100, 128, 1000, 2048, 3000})
+        {
+            SCOPED_TRACE(testing::Message() << "with segment_size= " << segment_size);
+
+            for(size_t size : test_utils::get_sizes(seed_value))
+            {
+                const int segments_count = static_cast<int>(size / segment_size);
+                size                     = static_cast<size_t>(segments_count) * segment_size;
+                SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+                // Generate data
+                std::vector<key_type> keys_input;
+                if(std::is_floating_point<key_type>::value)
+                {
+                    keys_input = test_utils::get_random_data<key_type>(size,
+                                                                       (key_type)-1000,
+                                                                       (key_type) + 1000,
+                                                                       seed_value);
+                }
+                else
+                {
+                    keys_input = test_utils::get_random_data<key_type>(
+                        size,
+                        std::numeric_limits<key_type>::min(),
+                        std::numeric_limits<key_type>::max(),
+                        seed_value + seed_value_addition);
+                }
+
+                std::vector<value_type> values_input(size);
+                std::iota(values_input.begin(), values_input.end(), 0);
+
+                key_type* d_keys_input;
+                key_type* d_keys_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input,
+                                                             (size + 1) * sizeof(key_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output,
+                                                             (size + 1) * sizeof(key_type)));
+                HIP_CHECK(hipMemcpy(d_keys_input,
+                                    keys_input.data(),
+                                    size * sizeof(key_type),
+                                    hipMemcpyHostToDevice));
+
+                value_type* d_values_input;
+                value_type* d_values_output;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                             (size + 1) * sizeof(value_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                             (size + 1) * sizeof(value_type)));
+                HIP_CHECK(hipMemcpy(d_values_input,
+                                    values_input.data(),
+                                    size * sizeof(value_type),
+                                    hipMemcpyHostToDevice));
+
+                using key_value = std::pair<key_type, value_type>;
+
+                // Calculate expected results on host
+                std::vector<key_value> expected(size);
+                for(size_t i = 0; i < size; i++)
+                {
+                    expected[i] = key_value(keys_input[i], values_input[i]);
+                }
+                for(int i = 0; i < segments_count; i++)
+                {
+                    std::stable_sort(expected.begin() + static_cast<size_t>(i) * segment_size,
+                                     expected.begin() + static_cast<size_t>(i + 1) * segment_size,
+                                     test_utils::key_value_comparator<key_type,
+                                                                      value_type,
+                                                                      descending,
+                                                                      start_bit,
+                                                                      end_bit>());
+                }
+
+                auto run = [&](void* d_temp_storage, size_t& temp_storage_bytes)
+                {
+                    if(descending)
+                    {
+                        return hipcub::DeviceSegmentedRadixSort::SortPairsDescendingFixedSize(
+                            d_temp_storage,
+                            temp_storage_bytes,
+                            d_keys_input,
+                            d_keys_output,
+                            d_values_input,
+                            d_values_output,
+                            segments_count,
+                            segment_size,
+                            start_bit,
+                            end_bit,
+                            stream);
+                    }
+                    return hipcub::DeviceSegmentedRadixSort::SortPairsFixedSize(
+                        d_temp_storage,
+                        temp_storage_bytes,
+                        d_keys_input,
+                        d_keys_output,
+                        d_values_input,
+                        d_values_output,
+                        segments_count,
+                        segment_size,
+                        start_bit,
+                        end_bit,
+                        stream);
+                };
+
+                size_t temporary_storage_bytes = 0;
+                HIP_CHECK(run(nullptr, temporary_storage_bytes));
+
+                ASSERT_GT(temporary_storage_bytes, 0U);
+
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+                HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                std::vector<key_type> keys_output(size);
+                HIP_CHECK(hipMemcpy(keys_output.data(),
+                                    d_keys_output,
+                                    size * sizeof(key_type),
+                                    hipMemcpyDeviceToHost));
+
+                std::vector<value_type> values_output(size);
+                HIP_CHECK(hipMemcpy(values_output.data(),
+                                    d_values_output,
+                                    size * sizeof(value_type),
+                                    hipMemcpyDeviceToHost));
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+                HIP_CHECK(hipFree(d_keys_input));
+                HIP_CHECK(hipFree(d_values_input));
+                HIP_CHECK(hipFree(d_keys_output));
+                HIP_CHECK(hipFree(d_values_output));
+
+                for(size_t i = 0; i < size; i++)
+                {
+                    ASSERT_EQ(keys_output[i], expected[i].first);
+                    ASSERT_EQ(values_output[i], expected[i].second);
+                }
+            }
+        }
+    }
+}
+
 #endif // HIPCUB_TEST_HIPCUB_DEVICE_SEGMENTED_RADIX_SORT_HPP_
@@ -430,6 +430,126 @@ TYPED_TEST(HipcubDeviceSegmentedReduce, Sum)
         HIP_CHECK(hipStreamDestroy(stream));
 }
 
+TYPED_TEST(HipcubDeviceSegmentedReduce, SumFixedSize)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using input_type     = typename TestFixture::params::input_type;
+    using output_type    = typename TestFixture::params::output_type;
+    using reduce_op_type = typename hipcub::Sum;
+    using result_type    = output_type;
+
+    reduce_op_type reduce_op;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        // Covers every warp width, segments above the warp limit and both aligned and
+        // unaligned inputs.
+        for(int segment_size : {1, 3, 4, 16, 33, 100, 1024, 1500})
+        {
+            SCOPED_TRACE(testing::Message() << "with segment_size= " << segment_size);
+
+            const float precision = test_utils::precision<result_type>::value * segment_size;
+            if(precision > 0.5)
+            {
+                continue;
+            }
+
+            for(size_t input_offset : {0, 1})
+            {
+                SCOPED_TRACE(testing::Message() << "with input_offset= " << input_offset);
+
+                const int    segments_count = 1 + static_cast<int>(seed_value % 2000);
+                const size_t size = static_cast<size_t>(segments_count) * segment_size;
+
+                std::vector<input_type> values_input
+                    = test_utils::get_random_data<input_type>(size + input_offset,
+                                                              0,
+                                                              100,
+                                                              seed_value);
+
+                std::vector<output_type> aggregates_expected(segments_count);
+                for(int segment = 0; segment < segments_count; segment++)
+                {
+                    result_type aggregate = result_type(0);
+                    for(int i = 0; i < segment_size; i++)
+                    {
+                        const size_t index
+                            = input_offset + static_cast<size_t>(segment) * segment_size + i;
+                        aggregate
+                            = reduce_op(aggregate, static_cast<result_type>(values_input[index]));
+                    }
+                    aggregates_expected[segment] = aggregate;
+                }
+
+                input_type* d_values_input;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                             values_input.size()
+                                                                 * sizeof(input_type)));
+                HIP_CHECK(hipMemcpy(d_values_input,
+                                    values_input.data(),
+                                    values_input.size() * sizeof(input_type),
+                                    hipMemcpyHostToDevice));
+
+                // A const pointer also takes the one item per vector path for unaligned inputs
+                const input_type* d_values_begin = d_values_input + input_offset;
+
+                output_type* d_aggregates_output;
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_aggregates_output,
+                                                       segments_count * sizeof(output_type)));
+
+                size_t temporary_storage_bytes;
+                HIP_CHECK(hipcub::DeviceSegmentedReduce::SumFixedSize(nullptr,
+                                                                      temporary_storage_bytes,
+                                                                      d_values_begin,
+                                                                      d_aggregates_output,
+                                                                      segments_count,
+                                                                      segment_size,
+                                                                      stream));
+
+                ASSERT_GT(temporary_storage_bytes, 0U);
+
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+
+                HIP_CHECK(hipcub::DeviceSegmentedReduce::SumFixedSize(d_temporary_storage,
+                                                                      temporary_storage_bytes,
+                                                                      d_values_begin,
+                                                                      d_aggregates_output,
+                                                                      segments_count,
+                                                                      segment_size,
+                                                                      stream));
+                HIP_CHECK(hipGetLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                std::vector<output_type> aggregates_output(segments_count);
+                HIP_CHECK(hipMemcpy(aggregates_output.data(),
+                                    d_aggregates_output,
+                                    segments_count * sizeof(output_type),
+                                    hipMemcpyDeviceToHost));
+
+                HIP_CHECK(hipFree(d_values_input));
+                HIP_CHECK(hipFree(d_aggregates_output));
+
+                ASSERT_NO_FATAL_FAILURE(
+                    test_utils::assert_near(aggregates_output, aggregates_expected, precision));
+            }
+        }
+    }
+}
+
 TYPED_TEST(HipcubDeviceSegmentedReduce, Min)
 {
     int device_id = test_common_utils::obtain_device_from_ctest();
@@ -1096,3 +1216,140 @@ TEST(HipcubDeviceSegmentedReduceLargeIndicesTests, LargeIndices)
         }
     }
 }
+
+template<class T>
+class HipcubDeviceSegmentedReduceAccumulatorTests : public testing::Test
+{};
+
+using HipcubDeviceSegmentedReduceAccumulatorTestsParams
+    = ::testing::Types<test_utils::half, test_utils::bfloat16, float>;
+TYPED_TEST_SUITE(HipcubDeviceSegmentedReduceAccumulatorTests,
+                 HipcubDeviceSegmentedReduceAccumulatorTestsParams);
+
+TYPED_TEST(HipcubDeviceSegmentedReduceAccumulatorTests, Sum)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using input_type  = TypeParam;
+    using offset_type = unsigned int;
+
+    hipStream_t stream = 0; // default
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        std::default_random_engine            gen(seed_value);
+        std::uniform_int_distribution<size_t> segment_length_dis(1, 100000);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+            std::vector<input_type> values_input
+                = test_utils::get_random_data<input_type>(size, 0, 2, seed_value);
+
+            std::vector<offset_type> offsets;
+            std::vector<double>      aggregates_expected;
+            size_t                   offset = 0;
+            while(offset < size)
+            {
+                const size_t end = std::min(size, offset + segment_length_dis(gen));
+                offsets.push_back(offset);
+                double aggregate = 0;
+                for(size_t i = offset; i < end; i++)
+                {
+                    aggregate
+                        += static_cast<double>(test_utils::convert_to_native(values_input[i]));
+                }
+                aggregates_expected.push_back(aggregate);
+                offset = end;
+            }
+            offsets.push_back(size);
+            const unsigned int segments_count = static_cast<unsigned int>(offsets.size() - 1);
+
+            input_type*  d_values_input;
+            offset_type* d_offsets;
+            float*       d_aggregates_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                         (size + 1) * sizeof(input_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                         offsets.size() * sizeof(offset_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_aggregates_output,
+                                                         (segments_count + 1) * sizeof(float)));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(input_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_offsets,
+                                offsets.data(),
+                                offsets.size() * sizeof(offset_type),
+                                hipMemcpyHostToDevice));
+
+            for(bool compensated : {false, true})
+            {
+                SCOPED_TRACE(testing::Message() << "with compensated= " << compensated);
+
+                auto run = [&](void* d_temporary_storage, size_t& temporary_storage_bytes)
+                {
+                    if(compensated)
+                    {
+                        return hipcub::DeviceSegmentedReduce::CompensatedSum<float>(
+                            d_temporary_storage,
+                            temporary_storage_bytes,
+                            d_values_input,
+                            d_aggregates_output,
+                            segments_count,
+                            d_offsets,
+                            d_offsets + 1,
+                            stream);
+                    }
+                    return hipcub::DeviceSegmentedReduce::MixedPrecisionSum<float>(
+                        d_temporary_storage,
+                        temporary_storage_bytes,
+                        d_values_input,
+                        d_aggregates_output,
+                        segments_count,
+                        d_offsets,
+                        d_offsets + 1,
+                        stream);
+                };
+
+                size_t temporary_storage_bytes;
+                HIP_CHECK(run(nullptr, temporary_storage_bytes));
+                ASSERT_GT(temporary_storage_bytes, 0U);
+
+                void* d_temporary_storage;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                             temporary_storage_bytes));
+                HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+                HIP_CHECK(hipPeekAtLastError());
+                HIP_CHECK(hipDeviceSynchronize());
+                HIP_CHECK(hipFree(d_temporary_storage));
+
+                std::vector<float> aggregates_output(segments_count);
+                HIP_CHECK(hipMemcpy(aggregates_output.data(),
+                                    d_aggregates_output,
+                                    segments_count * sizeof(float),
+                                    hipMemcpyDeviceToHost));
+
+                // Accumulating in the input type would lose most digits for half and bfloat16
+                for(unsigned int segment = 0; segment < segments_count; segment++)
+                {
+                    ASSERT_NEAR(aggregates_output[segment],
+                                aggregates_expected[segment],
+                                1e-5 * aggregates_expected[segment] + 1e-3)
+                        << "with segment= " << segment;
+                }
+            }
+
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_offsets));
+            HIP_CHECK(hipFree(d_aggregates_output));
+        }
+    }
+}
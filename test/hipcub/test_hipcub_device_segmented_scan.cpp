@@ -0,0 +1,317 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "common_test_header.hpp"
+
+// hipcub API
+#include "hipcub/device/device_segmented_scan.hpp"
+
+#include "test_utils_data_generation.hpp"
+
+#include <vector>
+
+template<class Input,
+         class Output,
+         class ScanOp,
+         bool         Exclusive,
+         unsigned int MinSegmentLength,
+         unsigned int MaxSegmentLength>
+struct params
+{
+    using input_type                                 = Input;
+    using output_type                                = Output;
+    using scan_op_type                               = ScanOp;
+    static constexpr bool         exclusive          = Exclusive;
+    static constexpr unsigned int min_segment_length = MinSegmentLength;
+    static constexpr unsigned int max_segment_length = MaxSegmentLength;
+};
+
+template<class Params>
+class HipcubDeviceSegmentedScan : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+// Covers segments handled by a logical warp (<= 256 items), by a block in several tiles and
+// empty segments.
+typedef ::testing::Types<params<int, int, hipcub::Sum, false, 0, 32>,
+                         params<int, int, hipcub::Sum, true, 0, 100>,
+                         params<unsigned int, unsigned long long, hipcub::Sum, false, 1, 1000>,
+                         params<unsigned int, unsigned long long, hipcub::Sum, true, 200, 5000>,
+                         params<short, short, hipcub::Max, false, 0, 300>,
+                         params<float, float, hipcub::Min, true, 1, 3000>,
+                         params<double, double, hipcub::Max, false, 1000, 10000>,
+                         params<long long, long long, hipcub::Min, true, 0, 10>>
+    Params;
+
+TYPED_TEST_SUITE(HipcubDeviceSegmentedScan, Params);
+
+TYPED_TEST(HipcubDeviceSegmentedScan, Scan)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using input_type         = typename TestFixture::params::input_type;
+    using output_type        = typename TestFixture::params::output_type;
+    using scan_op_type       = typename TestFixture::params::scan_op_type;
+    using offset_type        = unsigned int;
+    constexpr bool exclusive = TestFixture::params::exclusive;
+
+    // Items outside of the segments keep this value
+    const output_type unused = output_type(123);
+    const output_type init   = output_type(5);
+
+    scan_op_type scan_op;
+
+    hipStream_t stream = 0;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        std::default_random_engine            gen(seed_value);
+        std::uniform_int_distribution<size_t> segment_length_dis(
+            TestFixture::params::min_segment_length,
+            TestFixture::params::max_segment_length);
+        std::uniform_int_distribution<size_t> gap_length_dis(0, 2);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+            std::vector<input_type> values_input
+                = test_utils::get_random_data<input_type>(size, 0, 100, seed_value);
+
+            // Segments are separated by gaps of a few items which must not be written
+            std::vector<offset_type> begin_offsets;
+            std::vector<offset_type> end_offsets;
+            std::vector<output_type> expected(size, unused);
+            size_t                   offset = gap_length_dis(gen);
+            while(offset < size)
+            {
+                const size_t end = std::min(size, offset + segment_length_dis(gen));
+                begin_offsets.push_back(offset);
+                end_offsets.push_back(end);
+
+                output_type aggregate = init;
+                for(size_t i = offset; i < end; i++)
+                {
+                    const output_type value = static_cast<output_type>(values_input[i]);
+                    if(exclusive)
+                    {
+                        expected[i] = aggregate;
+                        aggregate   = scan_op(aggregate, value);
+                    }
+                    else
+                    {
+                        aggregate   = i == offset ? value : scan_op(aggregate, value);
+                        expected[i] = aggregate;
+                    }
+                }
+                offset = end + gap_length_dis(gen);
+            }
+            const int segments_count = static_cast<int>(begin_offsets.size());
+
+            input_type*  d_values_input;
+            output_type* d_values_output;
+            offset_type* d_begin_offsets;
+            offset_type* d_end_offsets;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                         (size + 1) * sizeof(input_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output,
+                                                         (size + 1) * sizeof(output_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_begin_offsets,
+                                                         (segments_count + 1)
+                                                             * sizeof(offset_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_end_offsets,
+                                                         (segments_count + 1)
+                                                             * sizeof(offset_type)));
+            HIP_CHECK(hipMemcpy(d_values_input,
+                                values_input.data(),
+                                size * sizeof(input_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_begin_offsets,
+                                begin_offsets.data(),
+                                segments_count * sizeof(offset_type),
+                                hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_end_offsets,
+                                end_offsets.data(),
+                                segments_count * sizeof(offset_type),
+                                hipMemcpyHostToDevice));
+
+            std::vector<output_type> values_output(size, unused);
+            HIP_CHECK(hipMemcpy(d_values_output,
+                                values_output.data(),
+                                size * sizeof(output_type),
+                                hipMemcpyHostToDevice));
+
+            auto run = [&](void* d_temp_storage, size_t& temp_storage_bytes)
+            {
+                if(exclusive)
+                {
+                    return hipcub::DeviceSegmentedScan::ExclusiveScan(d_temp_storage,
+                                                                      temp_storage_bytes,
+                                                                      d_values_input,
+                                                                      d_values_output,
+                                                                      segments_count,
+                                                                      d_begin_offsets,
+                                                                      d_end_offsets,
+                                                                      scan_op,
+                                                                      init,
+                                                                      stream);
+                }
+                return hipcub::DeviceSegmentedScan::InclusiveScan(d_temp_storage,
+                                                                  temp_storage_bytes,
+                                                                  d_values_input,
+                                                                  d_values_output,
+                                                                  segments_count,
+                                                                  d_begin_offsets,
+                                                                  d_end_offsets,
+                                                                  scan_op,
+                                                                  stream);
+            };
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(run(nullptr, temporary_storage_bytes));
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipFree(d_temporary_storage));
+
+            HIP_CHECK(hipMemcpy(values_output.data(),
+                                d_values_output,
+                                size * sizeof(output_type),
+                                hipMemcpyDeviceToHost));
+
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_values_output));
+            HIP_CHECK(hipFree(d_begin_offsets));
+            HIP_CHECK(hipFree(d_end_offsets));
+
+            for(size_t i = 0; i < size; i++)
+            {
+                ASSERT_EQ(values_output[i], expected[i]) << "with index= " << i;
+            }
+        }
+    }
+}
+
+TEST(HipcubDeviceSegmentedScanTests, Sum)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    // CSR-like offsets: the segments cover the whole input back to back
+    const std::vector<int> offsets        = {0, 0, 3, 300, 301, 2000, 2000, 5000};
+    const size_t           size           = offsets.back();
+    const int              segments_count = static_cast<int>(offsets.size() - 1);
+
+    std::vector<int> values_input(size, 1);
+    std::vector<int> inclusive_expected(size);
+    std::vector<int> exclusive_expected(size);
+    for(int segment = 0; segment < segments_count; segment++)
+    {
+        for(int i = offsets[segment]; i < offsets[segment + 1]; i++)
+        {
+            inclusive_expected[i] = i - offsets[segment] + 1;
+            exclusive_expected[i] = i - offsets[segment];
+        }
+    }
+
+    int* d_values_input;
+    int* d_values_output;
+    int* d_offsets;
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input, size * sizeof(int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_output, size * sizeof(int)));
+    HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets, offsets.size() * sizeof(int)));
+    HIP_CHECK(hipMemcpy(d_values_input,
+                        values_input.data(),
+                        size * sizeof(int),
+                        hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_offsets,
+                        offsets.data(),
+                        offsets.size() * sizeof(int),
+                        hipMemcpyHostToDevice));
+
+    for(bool exclusive : {false, true})
+    {
+        SCOPED_TRACE(testing::Message() << "with exclusive= " << exclusive);
+
+        auto run = [&](void* d_temp_storage, size_t& temp_storage_bytes)
+        {
+            if(exclusive)
+            {
+                return hipcub::DeviceSegmentedScan::ExclusiveSum(d_temp_storage,
+                                                                 temp_storage_bytes,
+                                                                 d_values_input,
+                                                                 d_values_output,
+                                                                 segments_count,
+                                                                 d_offsets,
+                                                                 d_offsets + 1);
+            }
+            return hipcub::DeviceSegmentedScan::InclusiveSum(d_temp_storage,
+                                                             temp_storage_bytes,
+                                                             d_values_input,
+                                                             d_values_output,
+                                                             segments_count,
+                                                             d_offsets,
+                                                             d_offsets + 1);
+        };
+
+        size_t temporary_storage_bytes = 0;
+        HIP_CHECK(run(nullptr, temporary_storage_bytes));
+
+        void* d_temporary_storage;
+        HIP_CHECK(
+            test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+        HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+        HIP_CHECK(hipGetLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipFree(d_temporary_storage));
+
+        std::vector<int> values_output(size);
+        HIP_CHECK(hipMemcpy(values_output.data(),
+                            d_values_output,
+                            size * sizeof(int),
+                            hipMemcpyDeviceToHost));
+
+        const std::vector<int>& expected = exclusive ? exclusive_expected : inclusive_expected;
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_EQ(values_output[i], expected[i]) << "with index= " << i;
+        }
+    }
+
+    HIP_CHECK(hipFree(d_values_input));
+    HIP_CHECK(hipFree(d_values_output));
+    HIP_CHECK(hipFree(d_offsets));
+}
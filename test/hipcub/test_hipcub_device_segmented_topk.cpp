@@ -0,0 +1,284 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "common_test_header.hpp"
+
+// hipcub API
+#include "hipcub/device/device_segmented_topk.hpp"
+
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+template<class Key,
+         bool         Descending,
+         bool         WithValues,
+         int          K,
+         unsigned int MinSegmentLength,
+         unsigned int MaxSegmentLength>
+struct params
+{
+    using key_type                                   = Key;
+    static constexpr bool         descending         = Descending;
+    static constexpr bool         with_values        = WithValues;
+    static constexpr int          k                  = K;
+    static constexpr unsigned int min_segment_length = MinSegmentLength;
+    static constexpr unsigned int max_segment_length = MaxSegmentLength;
+};
+
+template<class Params>
+class HipcubDeviceSegmentedTopK : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+// Covers segments handled by a single warp (<= 32 items), by the block radix select and
+// segments shorter than k.
+typedef ::testing::Types<params<int, true, false, 4, 0, 32>,
+                         params<int, false, true, 10, 0, 100>,
+                         params<unsigned int, true, true, 1, 1, 1000>,
+                         params<short, false, false, 16, 0, 2000>,
+                         params<float, true, true, 64, 30, 5000>,
+                         params<double, false, false, 3, 0, 40>,
+                         params<unsigned long long, true, true, 100, 50, 300>,
+                         params<unsigned char, true, true, 20, 100, 1000>>
+    Params;
+
+TYPED_TEST_SUITE(HipcubDeviceSegmentedTopK, Params);
+
+TYPED_TEST(HipcubDeviceSegmentedTopK, TopK)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type              = typename TestFixture::params::key_type;
+    using value_type            = unsigned int;
+    using offset_type           = unsigned int;
+    constexpr bool descending   = TestFixture::params::descending;
+    constexpr bool with_values  = TestFixture::params::with_values;
+    constexpr int  k            = TestFixture::params::k;
+
+    hipStream_t stream = 0;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        std::default_random_engine gen(seed_value);
+        std::uniform_int_distribution<size_t> segment_length_dis(
+            TestFixture::params::min_segment_length,
+            TestFixture::params::max_segment_length);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+            // Small key range to get many equal keys
+            std::vector<key_type> keys_input
+                = test_utils::get_random_data<key_type>(size, 0, 100, seed_value);
+            std::vector<value_type> values_input(size);
+            std::iota(values_input.begin(), values_input.end(), 0);
+
+            std::vector<offset_type> offsets;
+            size_t                   offset = 0;
+            while(offset < size)
+            {
+                offsets.push_back(offset);
+                offset += segment_length_dis(gen);
+            }
+            offsets.push_back(size);
+            const unsigned int segments_count = static_cast<unsigned int>(offsets.size() - 1);
+            const size_t       output_size    = static_cast<size_t>(segments_count) * k;
+
+            key_type* d_keys_input;
+            key_type* d_keys_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_input,
+                                                         (size + 1) * sizeof(key_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys_output,
+                                                         (output_size + 1) * sizeof(key_type)));
+            HIP_CHECK(hipMemcpy(d_keys_input,
+                                keys_input.data(),
+                                size * sizeof(key_type),
+                                hipMemcpyHostToDevice));
+
+            value_type* d_values_input  = nullptr;
+            value_type* d_values_output = nullptr;
+            if(with_values)
+            {
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values_input,
+                                                             (size + 1) * sizeof(value_type)));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_values_output,
+                                                       (output_size + 1) * sizeof(value_type)));
+                HIP_CHECK(hipMemcpy(d_values_input,
+                                    values_input.data(),
+                                    size * sizeof(value_type),
+                                    hipMemcpyHostToDevice));
+            }
+
+            offset_type* d_offsets;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_offsets,
+                                                         offsets.size() * sizeof(offset_type)));
+            HIP_CHECK(hipMemcpy(d_offsets,
+                                offsets.data(),
+                                offsets.size() * sizeof(offset_type),
+                                hipMemcpyHostToDevice));
+
+            auto run = [&](void* d_temp_storage, size_t& temp_storage_bytes)
+            {
+                if(with_values && descending)
+                {
+                    return hipcub::DeviceSegmentedTopK::MaxPairs(d_temp_storage,
+                                                                 temp_storage_bytes,
+                                                                 d_keys_input,
+                                                                 d_keys_output,
+                                                                 d_values_input,
+                                                                 d_values_output,
+                                                                 size,
+                                                                 segments_count,
+                                                                 d_offsets,
+                                                                 d_offsets + 1,
+                                                                 k,
+                                                                 stream);
+                }
+                else if(with_values)
+                {
+                    return hipcub::DeviceSegmentedTopK::MinPairs(d_temp_storage,
+                                                                 temp_storage_bytes,
+                                                                 d_keys_input,
+                                                                 d_keys_output,
+                                                                 d_values_input,
+                                                                 d_values_output,
+                                                                 size,
+                                                                 segments_count,
+                                                                 d_offsets,
+                                                                 d_offsets + 1,
+                                                                 k,
+                                                                 stream);
+                }
+                else if(descending)
+                {
+                    return hipcub::DeviceSegmentedTopK::MaxKeys(d_temp_storage,
+                                                                temp_storage_bytes,
+                                                                d_keys_input,
+                                                                d_keys_output,
+                                                                size,
+                                                                segments_count,
+                                                                d_offsets,
+                                                                d_offsets + 1,
+                                                                k,
+                                                                stream);
+                }
+                return hipcub::DeviceSegmentedTopK::MinKeys(d_temp_storage,
+                                                            temp_storage_bytes,
+                                                            d_keys_input,
+                                                            d_keys_output,
+                                                            size,
+                                                            segments_count,
+                                                            d_offsets,
+                                                            d_offsets + 1,
+                                                            k,
+                                                            stream);
+            };
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(run(nullptr, temporary_storage_bytes));
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipFree(d_temporary_storage));
+
+            std::vector<key_type>   keys_output(output_size);
+            std::vector<value_type> values_output(output_size);
+            HIP_CHECK(hipMemcpy(keys_output.data(),
+                                d_keys_output,
+                                output_size * sizeof(key_type),
+                                hipMemcpyDeviceToHost));
+            if(with_values)
+            {
+                HIP_CHECK(hipMemcpy(values_output.data(),
+                                    d_values_output,
+                                    output_size * sizeof(value_type),
+                                    hipMemcpyDeviceToHost));
+            }
+
+            HIP_CHECK(hipFree(d_keys_input));
+            HIP_CHECK(hipFree(d_keys_output));
+            HIP_CHECK(hipFree(d_values_input));
+            HIP_CHECK(hipFree(d_values_output));
+            HIP_CHECK(hipFree(d_offsets));
+
+            // The selected set is the first k items of the stable sort of every segment, the
+            // order inside the output segment is unspecified so both sides are canonicalized.
+            for(unsigned int segment = 0; segment < segments_count; segment++)
+            {
+                SCOPED_TRACE(testing::Message() << "with segment= " << segment);
+
+                std::vector<std::pair<key_type, value_type>> expected;
+                for(size_t i = offsets[segment]; i < offsets[segment + 1]; i++)
+                {
+                    expected.emplace_back(keys_input[i], values_input[i]);
+                }
+                std::stable_sort(expected.begin(),
+                                 expected.end(),
+                                 [](const auto& a, const auto& b)
+                                 { return descending ? b.first < a.first : a.first < b.first; });
+                expected.resize(std::min<size_t>(k, expected.size()));
+
+                std::vector<std::pair<key_type, value_type>> output;
+                for(size_t i = 0; i < expected.size(); i++)
+                {
+                    const size_t index = static_cast<size_t>(segment) * k + i;
+                    output.emplace_back(keys_output[index],
+                                        with_values ? values_output[index] : value_type{});
+                }
+                if(!with_values)
+                {
+                    for(auto& item : expected)
+                    {
+                        item.second = value_type{};
+                    }
+                }
+                std::sort(expected.begin(), expected.end());
+                std::sort(output.begin(), output.end());
+
+                for(size_t i = 0; i < expected.size(); i++)
+                {
+                    ASSERT_EQ(output[i].first, expected[i].first) << "with index= " << i;
+                    ASSERT_EQ(output[i].second, expected[i].second) << "with index= " << i;
+                }
+            }
+        }
+    }
+}
@@ -1327,3 +1327,143 @@ TEST(HipcubDeviceUniqueByKeyTests, LargeIndicesUniqueByKey)
         }
     }
 }
+
+// Inputs of up to 2048 items are selected by a single block, the sizes cover both sides of the
+// limit and the empty input. The in-place overloads are checked as well.
+TEST(HipcubDeviceSelectTests, SelectSingleBlockBoundary)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using T = int;
+    using F = unsigned char;
+
+    hipStream_t stream = 0; // default
+
+    unsigned int seed_value = rand();
+    SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+    const std::vector<size_t> sizes = {0, 1, 2047, 2048, 2049};
+    for(size_t size : sizes)
+    {
+        SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+        std::vector<T> input = test_utils::get_random_data<T>(size, 1, 100, seed_value);
+        std::vector<F> flags = test_utils::get_random_data<F>(size,
+                                                              static_cast<F>(0),
+                                                              static_cast<F>(1),
+                                                              seed_value + seed_value_addition);
+
+        std::vector<T> expected_flagged;
+        std::vector<T> expected_if;
+        for(size_t i = 0; i < size; i++)
+        {
+            if(flags[i] != 0)
+            {
+                expected_flagged.push_back(input[i]);
+            }
+            if(TestSelectOp()(input[i]))
+            {
+                expected_if.push_back(input[i]);
+            }
+        }
+
+        for(int variant = 0; variant < 4; variant++)
+        {
+            const bool flagged  = (variant & 1) != 0;
+            const bool in_place = (variant & 2) != 0;
+            SCOPED_TRACE(testing::Message()
+                         << "with flagged= " << flagged << ", in_place= " << in_place);
+
+            T*            d_input;
+            F*            d_flags;
+            T*            d_output;
+            unsigned int* d_selected_count_output;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_input, (size + 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_flags, (size + 1) * sizeof(F)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_output, (size + 1) * sizeof(T)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_selected_count_output,
+                                                         sizeof(*d_selected_count_output)));
+            HIP_CHECK(hipMemcpy(d_input, input.data(), size * sizeof(T), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_flags, flags.data(), size * sizeof(F), hipMemcpyHostToDevice));
+
+            auto run = [&](void* d_temp_storage, size_t& temp_storage_bytes)
+            {
+                if(flagged && in_place)
+                {
+                    return hipcub::DeviceSelect::Flagged(d_temp_storage,
+                                                         temp_storage_bytes,
+                                                         d_input,
+                                                         d_flags,
+                                                         d_selected_count_output,
+                                                         size,
+                                                         stream);
+                }
+                if(flagged)
+                {
+                    return hipcub::DeviceSelect::Flagged(d_temp_storage,
+                                                         temp_storage_bytes,
+                                                         d_input,
+                                                         d_flags,
+                                                         d_output,
+                                                         d_selected_count_output,
+                                                         size,
+                                                         stream);
+                }
+                if(in_place)
+                {
+                    return hipcub::DeviceSelect::If(d_temp_storage,
+                                                    temp_storage_bytes,
+                                                    d_input,
+                                                    d_selected_count_output,
+                                                    size,
+                                                    TestSelectOp(),
+                                                    stream);
+                }
+                return hipcub::DeviceSelect::If(d_temp_storage,
+                                                temp_storage_bytes,
+                                                d_input,
+                                                d_output,
+                                                d_selected_count_output,
+                                                size,
+                                                TestSelectOp(),
+                                                stream);
+            };
+
+            size_t temp_storage_size_bytes;
+            HIP_CHECK(run(nullptr, temp_storage_size_bytes));
+
+            // temp_storage_size_bytes must be >0
+            ASSERT_GT(temp_storage_size_bytes, 0U);
+
+            void* d_temp_storage;
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(run(d_temp_storage, temp_storage_size_bytes));
+            HIP_CHECK(hipPeekAtLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            const std::vector<T>& expected = flagged ? expected_flagged : expected_if;
+
+            unsigned int selected_count_output = 0;
+            HIP_CHECK(hipMemcpy(&selected_count_output,
+                                d_selected_count_output,
+                                sizeof(selected_count_output),
+                                hipMemcpyDeviceToHost));
+            ASSERT_EQ(selected_count_output, expected.size());
+
+            std::vector<T> output(expected.size());
+            HIP_CHECK(hipMemcpy(output.data(),
+                                in_place ? d_input : d_output,
+                                expected.size() * sizeof(T),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(output, expected));
+
+            HIP_CHECK(hipFree(d_input));
+            HIP_CHECK(hipFree(d_flags));
+            HIP_CHECK(hipFree(d_output));
+            HIP_CHECK(hipFree(d_selected_count_output));
+            HIP_CHECK(hipFree(d_temp_storage));
+        }
+    }
+}
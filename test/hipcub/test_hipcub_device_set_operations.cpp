@@ -0,0 +1,355 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "common_test_header.hpp"
+
+// hipcub API
+#include "hipcub/device/device_set_operations.hpp"
+
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+template<class Key, int MaxValue, class CompareFunction = test_utils::less>
+struct params
+{
+    using key_type                 = Key;
+    using compare_function         = CompareFunction;
+    static constexpr int max_value = MaxValue;
+};
+
+template<class Params>
+class HipcubDeviceSetOperations : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+// Small value ranges give long runs of duplicates spanning several tiles
+typedef ::testing::Types<params<int, 100>,
+                         params<int, 1000000>,
+                         params<unsigned int, 5000, test_utils::greater>,
+                         params<unsigned char, 10>,
+                         params<short, 20000, test_utils::greater>,
+                         params<float, 1000>,
+                         params<double, 1000000>,
+                         params<unsigned long long, 3>>
+    Params;
+
+TYPED_TEST_SUITE(HipcubDeviceSetOperations, Params);
+
+struct intersection_op
+{
+    template<class... Args>
+    static hipError_t keys(Args... args)
+    {
+        return hipcub::DeviceSetOperations::IntersectionKeys(args...);
+    }
+
+    template<class... Args>
+    static hipError_t pairs(Args... args)
+    {
+        return hipcub::DeviceSetOperations::IntersectionPairs(args...);
+    }
+
+    template<class... Args>
+    static void reference(Args... args)
+    {
+        std::set_intersection(args...);
+    }
+};
+
+struct set_union_op
+{
+    template<class... Args>
+    static hipError_t keys(Args... args)
+    {
+        return hipcub::DeviceSetOperations::UnionKeys(args...);
+    }
+
+    template<class... Args>
+    static hipError_t pairs(Args... args)
+    {
+        return hipcub::DeviceSetOperations::UnionPairs(args...);
+    }
+
+    template<class... Args>
+    static void reference(Args... args)
+    {
+        std::set_union(args...);
+    }
+};
+
+struct difference_op
+{
+    template<class... Args>
+    static hipError_t keys(Args... args)
+    {
+        return hipcub::DeviceSetOperations::DifferenceKeys(args...);
+    }
+
+    template<class... Args>
+    static hipError_t pairs(Args... args)
+    {
+        return hipcub::DeviceSetOperations::DifferencePairs(args...);
+    }
+
+    template<class... Args>
+    static void reference(Args... args)
+    {
+        std::set_difference(args...);
+    }
+};
+
+struct symmetric_difference_op
+{
+    template<class... Args>
+    static hipError_t keys(Args... args)
+    {
+        return hipcub::DeviceSetOperations::SymmetricDifferenceKeys(args...);
+    }
+
+    template<class... Args>
+    static hipError_t pairs(Args... args)
+    {
+        return hipcub::DeviceSetOperations::SymmetricDifferencePairs(args...);
+    }
+
+    template<class... Args>
+    static void reference(Args... args)
+    {
+        std::set_symmetric_difference(args...);
+    }
+};
+
+template<class Params, class SetOperation>
+void test_set_operation()
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using key_type          = typename Params::key_type;
+    using compare_function  = typename Params::compare_function;
+    using value_type        = unsigned int;
+    using item_type         = std::pair<key_type, value_type>;
+    constexpr int max_value = Params::max_value;
+
+    const compare_function compare_op;
+    const auto             compare_items
+        = [&](const item_type& a, const item_type& b) { return compare_op(a.first, b.first); };
+
+    hipStream_t stream = 0;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        for(size_t size1 : test_utils::get_sizes(seed_value))
+        {
+            for(size_t size2 : {size_t(0), size1 / 3, size1 + 17})
+            {
+                SCOPED_TRACE(testing::Message() << "with size1= " << size1);
+                SCOPED_TRACE(testing::Message() << "with size2= " << size2);
+
+                std::vector<key_type> keys1
+                    = test_utils::get_random_data<key_type>(size1, 0, max_value, seed_value);
+                std::vector<key_type> keys2
+                    = test_utils::get_random_data<key_type>(size2, 0, max_value, seed_value + 1);
+                std::sort(keys1.begin(), keys1.end(), compare_op);
+                std::sort(keys2.begin(), keys2.end(), compare_op);
+
+                // The values tell which input item was selected
+                std::vector<item_type>  items1(size1);
+                std::vector<item_type>  items2(size2);
+                std::vector<value_type> values1(size1);
+                std::vector<value_type> values2(size2);
+                for(size_t i = 0; i < size1; i++)
+                {
+                    values1[i] = static_cast<value_type>(i);
+                    items1[i]  = item_type(keys1[i], values1[i]);
+                }
+                for(size_t i = 0; i < size2; i++)
+                {
+                    values2[i] = static_cast<value_type>(size1 + i);
+                    items2[i]  = item_type(keys2[i], values2[i]);
+                }
+
+                std::vector<item_type> expected;
+                SetOperation::reference(items1.begin(),
+                                        items1.end(),
+                                        items2.begin(),
+                                        items2.end(),
+                                        std::back_inserter(expected),
+                                        compare_items);
+
+                key_type*     d_keys1;
+                key_type*     d_keys2;
+                value_type*   d_values1;
+                value_type*   d_values2;
+                key_type*     d_keys_output;
+                value_type*   d_values_output;
+                unsigned int* d_num_selected;
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys1,
+                                                             (size1 + 1) * sizeof(key_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_keys2,
+                                                             (size2 + 1) * sizeof(key_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values1,
+                                                             (size1 + 1) * sizeof(value_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_values2,
+                                                             (size2 + 1) * sizeof(value_type)));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_keys_output,
+                                                       (size1 + size2 + 1) * sizeof(key_type)));
+                HIP_CHECK(
+                    test_common_utils::hipMallocHelper(&d_values_output,
+                                                       (size1 + size2 + 1) * sizeof(value_type)));
+                HIP_CHECK(test_common_utils::hipMallocHelper(&d_num_selected,
+                                                             sizeof(unsigned int)));
+                HIP_CHECK(hipMemcpy(d_keys1,
+                                    keys1.data(),
+                                    size1 * sizeof(key_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_keys2,
+                                    keys2.data(),
+                                    size2 * sizeof(key_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_values1,
+                                    values1.data(),
+                                    size1 * sizeof(value_type),
+                                    hipMemcpyHostToDevice));
+                HIP_CHECK(hipMemcpy(d_values2,
+                                    values2.data(),
+                                    size2 * sizeof(value_type),
+                                    hipMemcpyHostToDevice));
+
+                for(bool with_values : {false, true})
+                {
+                    SCOPED_TRACE(testing::Message() << "with with_values= " << with_values);
+
+                    auto run = [&](void* d_temp_storage, size_t& temp_storage_bytes)
+                    {
+                        if(with_values)
+                        {
+                            return SetOperation::pairs(d_temp_storage,
+                                                       temp_storage_bytes,
+                                                       d_keys1,
+                                                       d_values1,
+                                                       static_cast<int>(size1),
+                                                       d_keys2,
+                                                       d_values2,
+                                                       static_cast<int>(size2),
+                                                       d_keys_output,
+                                                       d_values_output,
+                                                       d_num_selected,
+                                                       compare_op,
+                                                       stream);
+                        }
+                        return SetOperation::keys(d_temp_storage,
+                                                  temp_storage_bytes,
+                                                  d_keys1,
+                                                  static_cast<int>(size1),
+                                                  d_keys2,
+                                                  static_cast<int>(size2),
+                                                  d_keys_output,
+                                                  d_num_selected,
+                                                  compare_op,
+                                                  stream);
+                    };
+
+                    size_t temporary_storage_bytes = 0;
+                    HIP_CHECK(run(nullptr, temporary_storage_bytes));
+                    ASSERT_GT(temporary_storage_bytes, 0U);
+
+                    void* d_temporary_storage;
+                    HIP_CHECK(test_common_utils::hipMallocHelper(&d_temporary_storage,
+                                                                 temporary_storage_bytes));
+                    HIP_CHECK(run(d_temporary_storage, temporary_storage_bytes));
+                    HIP_CHECK(hipGetLastError());
+                    HIP_CHECK(hipDeviceSynchronize());
+                    HIP_CHECK(hipFree(d_temporary_storage));
+
+                    unsigned int num_selected;
+                    HIP_CHECK(hipMemcpy(&num_selected,
+                                        d_num_selected,
+                                        sizeof(unsigned int),
+                                        hipMemcpyDeviceToHost));
+                    ASSERT_EQ(num_selected, expected.size());
+
+                    std::vector<key_type>   keys_output(num_selected);
+                    std::vector<value_type> values_output(num_selected);
+                    HIP_CHECK(hipMemcpy(keys_output.data(),
+                                        d_keys_output,
+                                        num_selected * sizeof(key_type),
+                                        hipMemcpyDeviceToHost));
+                    HIP_CHECK(hipMemcpy(values_output.data(),
+                                        d_values_output,
+                                        num_selected * sizeof(value_type),
+                                        hipMemcpyDeviceToHost));
+
+                    for(size_t i = 0; i < expected.size(); i++)
+                    {
+                        ASSERT_EQ(keys_output[i], expected[i].first) << "with index= " << i;
+                        if(with_values)
+                        {
+                            ASSERT_EQ(values_output[i], expected[i].second)
+                                << "with index= " << i;
+                        }
+                    }
+                }
+
+                HIP_CHECK(hipFree(d_keys1));
+                HIP_CHECK(hipFree(d_keys2));
+                HIP_CHECK(hipFree(d_values1));
+                HIP_CHECK(hipFree(d_values2));
+                HIP_CHECK(hipFree(d_keys_output));
+                HIP_CHECK(hipFree(d_values_output));
+                HIP_CHECK(hipFree(d_num_selected));
+            }
+        }
+    }
+}
+
+TYPED_TEST(HipcubDeviceSetOperations, Intersection)
+{
+    test_set_operation<typename TestFixture::params, intersection_op>();
+}
+
+TYPED_TEST(HipcubDeviceSetOperations, Union)
+{
+    test_set_operation<typename TestFixture::params, set_union_op>();
+}
+
+TYPED_TEST(HipcubDeviceSetOperations, Difference)
+{
+    test_set_operation<typename TestFixture::params, difference_op>();
+}
+
+TYPED_TEST(HipcubDeviceSetOperations, SymmetricDifference)
+{
+    test_set_operation<typename TestFixture::params, symmetric_difference_op>();
+}
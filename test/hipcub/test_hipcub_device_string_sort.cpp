@@ -0,0 +1,182 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "common_test_header.hpp"
+
+// hipcub API
+#include "hipcub/device/device_string_sort.hpp"
+
+#include "test_utils_data_generation.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+template<class Offset, class Index, unsigned int MaxLength, unsigned int Alphabet>
+struct params
+{
+    using offset_type                        = Offset;
+    using index_type                         = Index;
+    static constexpr unsigned int max_length = MaxLength;
+    static constexpr unsigned int alphabet   = Alphabet;
+};
+
+template<class Params>
+class HipcubDeviceStringSort : public ::testing::Test
+{
+public:
+    using params = Params;
+};
+
+// Covers short strings with many duplicates and empty strings, long strings with long shared
+// prefixes that take several levels, and all byte values including zero and values above 127.
+typedef ::testing::Types<params<unsigned int, unsigned int, 12, 3>,
+                         params<size_t, int, 64, 2>,
+                         params<unsigned int, size_t, 20, 256>>
+    Params;
+
+TYPED_TEST_SUITE(HipcubDeviceStringSort, Params);
+
+TYPED_TEST(HipcubDeviceStringSort, ArgSort)
+{
+    int device_id = test_common_utils::obtain_device_from_ctest();
+    SCOPED_TRACE(testing::Message() << "with device_id= " << device_id);
+    HIP_CHECK(hipSetDevice(device_id));
+
+    using offset_type                 = typename TestFixture::params::offset_type;
+    using index_type                  = typename TestFixture::params::index_type;
+    constexpr unsigned int max_length = TestFixture::params::max_length;
+    constexpr unsigned int alphabet   = TestFixture::params::alphabet;
+
+    hipStream_t stream = 0;
+
+    for(size_t seed_index = 0; seed_index < random_seeds_count + seed_size; seed_index++)
+    {
+        unsigned int seed_value
+            = seed_index < random_seeds_count ? rand() : seeds[seed_index - random_seeds_count];
+        SCOPED_TRACE(testing::Message() << "with seed= " << seed_value);
+
+        std::default_random_engine                  gen(seed_value);
+        std::uniform_int_distribution<unsigned int> length_dis(0, max_length);
+        std::uniform_int_distribution<unsigned int> char_dis(0, alphabet - 1);
+
+        for(size_t size : test_utils::get_sizes(seed_value))
+        {
+            if(size > (1 << 18))
+            {
+                continue;
+            }
+            SCOPED_TRACE(testing::Message() << "with size= " << size);
+
+            // Every fifth string extends the previous one by a character and every seventh
+            // repeats it, so strings that are prefixes of others and equal strings are common
+            const char               first_char = alphabet < 256 ? 'a' : 0;
+            std::vector<std::string> strings(size);
+            for(size_t i = 0; i < size; i++)
+            {
+                if(i > 0 && i % 7 == 0)
+                {
+                    strings[i] = strings[i - 1];
+                    continue;
+                }
+                if(i > 0 && i % 5 == 0)
+                {
+                    strings[i] = strings[i - 1] + static_cast<char>(first_char + char_dis(gen));
+                    continue;
+                }
+                const unsigned int length = length_dis(gen);
+                for(unsigned int c = 0; c < length; c++)
+                {
+                    strings[i].push_back(static_cast<char>(first_char + char_dis(gen)));
+                }
+            }
+
+            std::vector<char>        chars;
+            std::vector<offset_type> offsets(size + 1, 0);
+            for(size_t i = 0; i < size; i++)
+            {
+                chars.insert(chars.end(), strings[i].begin(), strings[i].end());
+                offsets[i + 1] = static_cast<offset_type>(chars.size());
+            }
+
+            // std::string compares its characters as unsigned char
+            std::vector<index_type> indices_expected(size);
+            std::iota(indices_expected.begin(), indices_expected.end(), 0);
+            std::stable_sort(indices_expected.begin(),
+                             indices_expected.end(),
+                             [&](const index_type lhs, const index_type rhs)
+                             { return strings[lhs] < strings[rhs]; });
+
+            char*        d_chars;
+            offset_type* d_offsets;
+            index_type*  d_indices;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_chars, std::max<size_t>(chars.size(), 1)));
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_offsets, (size + 1) * sizeof(offset_type)));
+            HIP_CHECK(test_common_utils::hipMallocHelper(&d_indices, size * sizeof(index_type)));
+            HIP_CHECK(hipMemcpy(d_chars, chars.data(), chars.size(), hipMemcpyHostToDevice));
+            HIP_CHECK(hipMemcpy(d_offsets,
+                                offsets.data(),
+                                (size + 1) * sizeof(offset_type),
+                                hipMemcpyHostToDevice));
+
+            size_t temporary_storage_bytes = 0;
+            HIP_CHECK(hipcub::DeviceStringSort::ArgSort(nullptr,
+                                                        temporary_storage_bytes,
+                                                        d_chars,
+                                                        d_offsets,
+                                                        d_indices,
+                                                        static_cast<int>(size),
+                                                        stream));
+            ASSERT_GT(temporary_storage_bytes, 0U);
+
+            void* d_temporary_storage;
+            HIP_CHECK(
+                test_common_utils::hipMallocHelper(&d_temporary_storage, temporary_storage_bytes));
+            HIP_CHECK(hipcub::DeviceStringSort::ArgSort(d_temporary_storage,
+                                                        temporary_storage_bytes,
+                                                        d_chars,
+                                                        d_offsets,
+                                                        d_indices,
+                                                        static_cast<int>(size),
+                                                        stream));
+            HIP_CHECK(hipGetLastError());
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<index_type> indices_output(size);
+            HIP_CHECK(hipMemcpy(indices_output.data(),
+                                d_indices,
+                                size * sizeof(index_type),
+                                hipMemcpyDeviceToHost));
+            ASSERT_NO_FATAL_FAILURE(test_utils::assert_eq(indices_output, indices_expected));
+
+            HIP_CHECK(hipFree(d_temporary_storage));
+            HIP_CHECK(hipFree(d_chars));
+            HIP_CHECK(hipFree(d_offsets));
+            HIP_CHECK(hipFree(d_indices));
+        }
+    }
+}
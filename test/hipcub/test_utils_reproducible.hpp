@@ -0,0 +1,157 @@
+// MIT License
+//
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HIPCUB_TEST_TEST_UTILS_REPRODUCIBLE_HPP_
+#define HIPCUB_TEST_TEST_UTILS_REPRODUCIBLE_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace test_utils
+{
+
+// Host versions of the fixed order of additions of DeviceReduce::ReproducibleSum and
+// DeviceScan::Reproducible*Sum, the device results must match them bitwise.
+constexpr size_t reproducible_block_size       = 256;
+constexpr size_t reproducible_items_per_thread = 16;
+constexpr size_t reproducible_items_per_tile
+    = reproducible_block_size * reproducible_items_per_thread;
+
+// Scans the tile in place like the device, returns the total of the tile.
+template<class T>
+T reproducible_scan_tile(std::vector<T>& items, bool exclusive)
+{
+    std::vector<T> thread_totals(reproducible_block_size);
+    for(size_t thread = 0; thread < reproducible_block_size; thread++)
+    {
+        T* thread_items = items.data() + thread * reproducible_items_per_thread;
+        for(size_t i = 1; i < reproducible_items_per_thread; i++)
+        {
+            thread_items[i] = thread_items[i - 1] + thread_items[i];
+        }
+        thread_totals[thread] = thread_items[reproducible_items_per_thread - 1];
+    }
+    for(size_t distance = 1; distance < reproducible_block_size; distance <<= 1)
+    {
+        const std::vector<T> previous = thread_totals;
+        for(size_t thread = distance; thread < reproducible_block_size; thread++)
+        {
+            thread_totals[thread] = previous[thread - distance] + previous[thread];
+        }
+    }
+    for(size_t thread = 0; thread < reproducible_block_size; thread++)
+    {
+        const T prefix       = thread == 0 ? T(0) : thread_totals[thread - 1];
+        T*      thread_items = items.data() + thread * reproducible_items_per_thread;
+        if(exclusive)
+        {
+            for(size_t i = reproducible_items_per_thread - 1; i > 0; i--)
+            {
+                thread_items[i] = prefix + thread_items[i - 1];
+            }
+            thread_items[0] = prefix;
+        }
+        else
+        {
+            for(size_t i = 0; i < reproducible_items_per_thread; i++)
+            {
+                thread_items[i] = prefix + thread_items[i];
+            }
+        }
+    }
+    return thread_totals[reproducible_block_size - 1];
+}
+
+template<class T, class InputT>
+std::vector<T> reproducible_load_tile(const std::vector<InputT>& input, size_t tile)
+{
+    std::vector<T> items(reproducible_items_per_tile, T(0));
+    for(size_t i = 0; i < reproducible_items_per_tile; i++)
+    {
+        const size_t index = tile * reproducible_items_per_tile + i;
+        if(index < input.size())
+        {
+            items[i] = static_cast<T>(input[index]);
+        }
+    }
+    return items;
+}
+
+template<class T, class InputT>
+std::vector<T> reproducible_tile_totals(const std::vector<InputT>& input)
+{
+    const size_t tiles
+        = (input.size() + reproducible_items_per_tile - 1) / reproducible_items_per_tile;
+    std::vector<T> totals(tiles > 0 ? tiles : 1);
+    for(size_t tile = 0; tile < totals.size(); tile++)
+    {
+        std::vector<T> items = reproducible_load_tile<T>(input, tile);
+        totals[tile]         = reproducible_scan_tile(items, false);
+    }
+    return totals;
+}
+
+template<class T, class InputT>
+T reproducible_sum(const std::vector<InputT>& input)
+{
+    std::vector<T> totals = reproducible_tile_totals<T>(input);
+    while(totals.size() > 1)
+    {
+        totals = reproducible_tile_totals<T>(totals);
+    }
+    return totals[0];
+}
+
+template<class T, class InputT>
+std::vector<T> reproducible_scan(const std::vector<InputT>& input, bool exclusive)
+{
+    std::vector<T> output(input.size());
+    if(input.empty())
+    {
+        return output;
+    }
+    const size_t tiles
+        = (input.size() + reproducible_items_per_tile - 1) / reproducible_items_per_tile;
+    std::vector<T> tile_prefixes(tiles, T(0));
+    if(tiles > 1)
+    {
+        tile_prefixes = reproducible_scan<T>(reproducible_tile_totals<T>(input), true);
+    }
+    for(size_t tile = 0; tile < tiles; tile++)
+    {
+        std::vector<T> items = reproducible_load_tile<T>(input, tile);
+        reproducible_scan_tile(items, exclusive);
+        for(size_t i = 0; i < reproducible_items_per_tile; i++)
+        {
+            const size_t index = tile * reproducible_items_per_tile + i;
+            if(index < input.size())
+            {
+                output[index] = tile_prefixes[tile] + items[i];
+            }
+        }
+    }
+    return output;
+}
+
+} // namespace test_utils
+
+#endif // HIPCUB_TEST_TEST_UTILS_REPRODUCIBLE_HPP_